@@ -0,0 +1,402 @@
+#ifndef CLASSIFY__KEYWORD_HPP_
+#define CLASSIFY__KEYWORD_HPP_
+
+#include <array>
+#include <string_view>
+
+namespace classify {
+
+namespace internal_ {
+
+enum class keyword_enum
+{
+    default_ = -1,
+    c_Age = 0,
+    c_Allow = 1,
+    c_Cookie = 2,
+    c_Accept = 3,
+    c_Connection = 4,
+    c_Content_Type = 5,
+    c_Content_Range = 6,
+    c_Authorization = 7,
+    c_Accept_Language = 8,
+    c_Content_Language = 9,
+    c_Content_Location = 10,
+    c_Accept_Charset = 11,
+    c_Accept_Ranges = 12,
+    c_Content_Disposition = 13,
+    c_Cache_Control = 14,
+    c_Access_Control_Max_Age = 15,
+    c_Accept_Encoding = 16,
+    c_Content_Encoding = 17,
+    c_Expect = 18,
+    c_TE = 19,
+    c_ETag = 20,
+    c_Expires = 21,
+    c_Timing_Allow_Origin = 22,
+    c_Set_Cookie = 23,
+    c_Range = 24,
+    c_X_XSS_Protection = 25,
+    c_Expect_CT = 26,
+    c_Transfer_Encoding = 27,
+    c_X_Forwarded_Host = 28,
+    c_X_Frame_Options = 29,
+    c_Trailer = 30,
+    c_Access_Control_Allow_Credentials = 31,
+    c_If_Range = 32,
+    c_Access_Control_Request_Headers = 33,
+    c_Server_Timing = 34,
+    c_Referrer_Policy = 35,
+    c_Proxy_Authenticate = 36,
+    c_Sec_WebSocket_Accept = 37,
+    c_Proxy_Authorization = 38,
+    c_Public_Key_Pins = 39,
+    c_Server = 40,
+    c_If_Modified_Since = 41,
+    c_X_Content_Type_Options = 42,
+    c_If_Unmodified_Since = 43,
+    c_X_Forwarded_For = 44,
+    c_Content_Length = 45,
+    c_X_DNS_Prefetch_Control = 46,
+    c_Referer = 47,
+    c_Location = 48,
+    c_Clear_Site_Data = 49,
+    c_Public_Key_Pins_Report_Only = 50,
+    c_Retry_After = 51,
+    c_Access_Control_Request_Method = 52,
+    c_Vary = 53,
+    c_Content_Security_Policy = 54,
+    c_User_Agent = 55,
+    c_Large_Allocation = 56,
+    c_Warning = 57,
+    c_WWW_Authenticate = 58,
+    c_Origin = 59,
+    c_Strict_Transport_Security = 60,
+    c_Host = 61,
+    c_Feature_Policy = 62,
+    c_Date = 63,
+    c_Cookie2 = 64,
+    c_Pragma = 65,
+    c_Content_Security_Policy_Report_Only = 66,
+    c_SourceMap = 67,
+    c_X_Forwarded_Proto = 68,
+    c_From = 69,
+    c_If_Match = 70,
+    c_DNT = 71,
+    c_Upgrade_Insecure_Requests = 72,
+    c_Tk = 73,
+    c_Access_Control_Allow_Methods = 74,
+    c_If_None_Match = 75,
+    c_Keep_Alive = 76,
+    c_Access_Control_Expose_Headers = 77,
+    c_Last_Modified = 78,
+    c_Access_Control_Allow_Origin = 79,
+    c_Forwarded = 80,
+    c_Access_Control_Allow_Headers = 81,
+    c_Set_Cookie2 = 82,
+    c_Via = 83,
+};
+
+} // namespace internal_
+
+// Number of keywords, enum values other than the default are in [ 0, keyword_count )
+constexpr size_t keyword_count = 84;
+
+constexpr internal_::keyword_enum keyword( std::string_view s );
+
+namespace internal_ {
+
+constexpr std::array< int, 256 > asso_values = {
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,    49,   100,   100,   100,   100,
+        64,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,     0,   100,     0,    66,    15,
+        54,   100,    60,    31,   100,    73,    46,    47,   100,    59,
+        25,   100,    26,    20,     9,    48,    55,    49,    15,   100,
+       100,   100,   100,   100,   100,   100,   100,    41,   100,    37,
+        26,     0,   100,     8,    38,   100,   100,    69,     8,    18,
+         1,    43,    45,   100,    21,     6,     4,   100,   100,     0,
+       100,     1,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,
+};
+
+struct word_entry
+{
+    std::string_view word;
+    keyword_enum enum_val;
+};
+
+constexpr std::array< word_entry, 100 > wordlist = {{
+    { "", keyword_enum::default_ },
+    { "", keyword_enum::default_ },
+    { "", keyword_enum::default_ },
+    { "Age", keyword_enum::c_Age },
+    { "", keyword_enum::default_ },
+    { "Allow", keyword_enum::c_Allow },
+    { "Cookie", keyword_enum::c_Cookie },
+    { "", keyword_enum::default_ },
+    { "", keyword_enum::default_ },
+    { "", keyword_enum::default_ },
+    { "Accept", keyword_enum::c_Accept },
+    { "Connection", keyword_enum::c_Connection },
+    { "Content-Type", keyword_enum::c_Content_Type },
+    { "Content-Range", keyword_enum::c_Content_Range },
+    { "Authorization", keyword_enum::c_Authorization },
+    { "Accept-Language", keyword_enum::c_Accept_Language },
+    { "Content-Language", keyword_enum::c_Content_Language },
+    { "Content-Location", keyword_enum::c_Content_Location },
+    { "Accept-Charset", keyword_enum::c_Accept_Charset },
+    { "Accept-Ranges", keyword_enum::c_Accept_Ranges },
+    { "Content-Disposition", keyword_enum::c_Content_Disposition },
+    { "Cache-Control", keyword_enum::c_Cache_Control },
+    { "Access-Control-Max-Age", keyword_enum::c_Access_Control_Max_Age },
+    { "Accept-Encoding", keyword_enum::c_Accept_Encoding },
+    { "Content-Encoding", keyword_enum::c_Content_Encoding },
+    { "Expect", keyword_enum::c_Expect },
+    { "TE", keyword_enum::c_TE },
+    { "ETag", keyword_enum::c_ETag },
+    { "Expires", keyword_enum::c_Expires },
+    { "Timing-Allow-Origin", keyword_enum::c_Timing_Allow_Origin },
+    { "Set-Cookie", keyword_enum::c_Set_Cookie },
+    { "Range", keyword_enum::c_Range },
+    { "X-XSS-Protection", keyword_enum::c_X_XSS_Protection },
+    { "Expect-CT", keyword_enum::c_Expect_CT },
+    { "Transfer-Encoding", keyword_enum::c_Transfer_Encoding },
+    { "X-Forwarded-Host", keyword_enum::c_X_Forwarded_Host },
+    { "X-Frame-Options", keyword_enum::c_X_Frame_Options },
+    { "Trailer", keyword_enum::c_Trailer },
+    { "Access-Control-Allow-Credentials", keyword_enum::c_Access_Control_Allow_Credentials },
+    { "If-Range", keyword_enum::c_If_Range },
+    { "Access-Control-Request-Headers", keyword_enum::c_Access_Control_Request_Headers },
+    { "Server-Timing", keyword_enum::c_Server_Timing },
+    { "Referrer-Policy", keyword_enum::c_Referrer_Policy },
+    { "Proxy-Authenticate", keyword_enum::c_Proxy_Authenticate },
+    { "Sec-WebSocket-Accept", keyword_enum::c_Sec_WebSocket_Accept },
+    { "Proxy-Authorization", keyword_enum::c_Proxy_Authorization },
+    { "Public-Key-Pins", keyword_enum::c_Public_Key_Pins },
+    { "Server", keyword_enum::c_Server },
+    { "If-Modified-Since", keyword_enum::c_If_Modified_Since },
+    { "X-Content-Type-Options", keyword_enum::c_X_Content_Type_Options },
+    { "If-Unmodified-Since", keyword_enum::c_If_Unmodified_Since },
+    { "X-Forwarded-For", keyword_enum::c_X_Forwarded_For },
+    { "Content-Length", keyword_enum::c_Content_Length },
+    { "X-DNS-Prefetch-Control", keyword_enum::c_X_DNS_Prefetch_Control },
+    { "Referer", keyword_enum::c_Referer },
+    { "Location", keyword_enum::c_Location },
+    { "Clear-Site-Data", keyword_enum::c_Clear_Site_Data },
+    { "Public-Key-Pins-Report-Only", keyword_enum::c_Public_Key_Pins_Report_Only },
+    { "Retry-After", keyword_enum::c_Retry_After },
+    { "Access-Control-Request-Method", keyword_enum::c_Access_Control_Request_Method },
+    { "Vary", keyword_enum::c_Vary },
+    { "Content-Security-Policy", keyword_enum::c_Content_Security_Policy },
+    { "User-Agent", keyword_enum::c_User_Agent },
+    { "Large-Allocation", keyword_enum::c_Large_Allocation },
+    { "Warning", keyword_enum::c_Warning },
+    { "WWW-Authenticate", keyword_enum::c_WWW_Authenticate },
+    { "Origin", keyword_enum::c_Origin },
+    { "Strict-Transport-Security", keyword_enum::c_Strict_Transport_Security },
+    { "Host", keyword_enum::c_Host },
+    { "Feature-Policy", keyword_enum::c_Feature_Policy },
+    { "Date", keyword_enum::c_Date },
+    { "Cookie2", keyword_enum::c_Cookie2 },
+    { "Pragma", keyword_enum::c_Pragma },
+    { "Content-Security-Policy-Report-Only", keyword_enum::c_Content_Security_Policy_Report_Only },
+    { "SourceMap", keyword_enum::c_SourceMap },
+    { "X-Forwarded-Proto", keyword_enum::c_X_Forwarded_Proto },
+    { "From", keyword_enum::c_From },
+    { "If-Match", keyword_enum::c_If_Match },
+    { "DNT", keyword_enum::c_DNT },
+    { "Upgrade-Insecure-Requests", keyword_enum::c_Upgrade_Insecure_Requests },
+    { "Tk", keyword_enum::c_Tk },
+    { "Access-Control-Allow-Methods", keyword_enum::c_Access_Control_Allow_Methods },
+    { "If-None-Match", keyword_enum::c_If_None_Match },
+    { "Keep-Alive", keyword_enum::c_Keep_Alive },
+    { "Access-Control-Expose-Headers", keyword_enum::c_Access_Control_Expose_Headers },
+    { "Last-Modified", keyword_enum::c_Last_Modified },
+    { "", keyword_enum::default_ },
+    { "Access-Control-Allow-Origin", keyword_enum::c_Access_Control_Allow_Origin },
+    { "", keyword_enum::default_ },
+    { "Forwarded", keyword_enum::c_Forwarded },
+    { "", keyword_enum::default_ },
+    { "", keyword_enum::default_ },
+    { "", keyword_enum::default_ },
+    { "", keyword_enum::default_ },
+    { "Access-Control-Allow-Headers", keyword_enum::c_Access_Control_Allow_Headers },
+    { "Set-Cookie2", keyword_enum::c_Set_Cookie2 },
+    { "", keyword_enum::default_ },
+    { "", keyword_enum::default_ },
+    { "", keyword_enum::default_ },
+    { "Via", keyword_enum::c_Via },
+}};
+
+} // namespace internal_
+
+constexpr internal_::keyword_enum keyword( std::string_view s )
+{
+    constexpr size_t MinWordLength = 2;
+    constexpr size_t MaxWordLength = 35;
+    constexpr size_t MaxHashValue = 99;
+
+    if ( s.size() < MinWordLength || s.size() > MaxWordLength )
+    {
+        return internal_::keyword_enum::default_;
+    }
+
+    size_t hash_val = s.size();
+    hash_val += internal_::asso_values[ static_cast< unsigned char >( s[ s.size() - 1 ] ) ];
+    switch( s.size() )
+    {
+                       case 35:
+    [[ fallthrough ]]; case 34:
+    [[ fallthrough ]]; case 33:
+    [[ fallthrough ]]; case 32:
+    [[ fallthrough ]]; case 31:
+    [[ fallthrough ]]; case 30:
+    [[ fallthrough ]]; case 29:
+    [[ fallthrough ]]; case 28:
+    [[ fallthrough ]]; case 27:
+    [[ fallthrough ]]; case 26:
+    [[ fallthrough ]]; case 25:
+    [[ fallthrough ]]; case 24:
+    [[ fallthrough ]]; case 23:
+    [[ fallthrough ]]; case 22:
+        hash_val += internal_::asso_values[ static_cast< unsigned char >( s[ 21] ) ];
+    [[ fallthrough ]]; case 21:
+    [[ fallthrough ]]; case 20:
+    [[ fallthrough ]]; case 19:
+    [[ fallthrough ]]; case 18:
+    [[ fallthrough ]]; case 17:
+    [[ fallthrough ]]; case 16:
+    [[ fallthrough ]]; case 15:
+    [[ fallthrough ]]; case 14:
+    [[ fallthrough ]]; case 13:
+    [[ fallthrough ]]; case 12:
+    [[ fallthrough ]]; case 11:
+    [[ fallthrough ]]; case 10:
+    [[ fallthrough ]]; case 9:
+    [[ fallthrough ]]; case 8:
+    [[ fallthrough ]]; case 7:
+    [[ fallthrough ]]; case 6:
+    [[ fallthrough ]]; case 5:
+    [[ fallthrough ]]; case 4:
+    [[ fallthrough ]]; case 3:
+    [[ fallthrough ]]; case 2:
+    [[ fallthrough ]]; case 1:
+        hash_val += internal_::asso_values[ static_cast< unsigned char >( s[ 0] ) ];
+    }
+
+    if ( hash_val <= MaxHashValue )
+    {
+        const size_t slot = hash_val;
+        if ( internal_::wordlist[ slot ].word == s )
+        {
+            return internal_::wordlist[ slot ].enum_val;
+        }
+    }
+    return internal_::keyword_enum::default_;
+}
+
+} // namespace classify {
+
+// Extra check for safety
+static_assert( classify::keyword( "Age" ) == classify::internal_::keyword_enum::c_Age );
+static_assert( classify::keyword( "Allow" ) == classify::internal_::keyword_enum::c_Allow );
+static_assert( classify::keyword( "Cookie" ) == classify::internal_::keyword_enum::c_Cookie );
+static_assert( classify::keyword( "Accept" ) == classify::internal_::keyword_enum::c_Accept );
+static_assert( classify::keyword( "Connection" ) == classify::internal_::keyword_enum::c_Connection );
+static_assert( classify::keyword( "Content-Type" ) == classify::internal_::keyword_enum::c_Content_Type );
+static_assert( classify::keyword( "Content-Range" ) == classify::internal_::keyword_enum::c_Content_Range );
+static_assert( classify::keyword( "Authorization" ) == classify::internal_::keyword_enum::c_Authorization );
+static_assert( classify::keyword( "Accept-Language" ) == classify::internal_::keyword_enum::c_Accept_Language );
+static_assert( classify::keyword( "Content-Language" ) == classify::internal_::keyword_enum::c_Content_Language );
+static_assert( classify::keyword( "Content-Location" ) == classify::internal_::keyword_enum::c_Content_Location );
+static_assert( classify::keyword( "Accept-Charset" ) == classify::internal_::keyword_enum::c_Accept_Charset );
+static_assert( classify::keyword( "Accept-Ranges" ) == classify::internal_::keyword_enum::c_Accept_Ranges );
+static_assert( classify::keyword( "Content-Disposition" ) == classify::internal_::keyword_enum::c_Content_Disposition );
+static_assert( classify::keyword( "Cache-Control" ) == classify::internal_::keyword_enum::c_Cache_Control );
+static_assert( classify::keyword( "Access-Control-Max-Age" ) == classify::internal_::keyword_enum::c_Access_Control_Max_Age );
+static_assert( classify::keyword( "Accept-Encoding" ) == classify::internal_::keyword_enum::c_Accept_Encoding );
+static_assert( classify::keyword( "Content-Encoding" ) == classify::internal_::keyword_enum::c_Content_Encoding );
+static_assert( classify::keyword( "Expect" ) == classify::internal_::keyword_enum::c_Expect );
+static_assert( classify::keyword( "TE" ) == classify::internal_::keyword_enum::c_TE );
+static_assert( classify::keyword( "ETag" ) == classify::internal_::keyword_enum::c_ETag );
+static_assert( classify::keyword( "Expires" ) == classify::internal_::keyword_enum::c_Expires );
+static_assert( classify::keyword( "Timing-Allow-Origin" ) == classify::internal_::keyword_enum::c_Timing_Allow_Origin );
+static_assert( classify::keyword( "Set-Cookie" ) == classify::internal_::keyword_enum::c_Set_Cookie );
+static_assert( classify::keyword( "Range" ) == classify::internal_::keyword_enum::c_Range );
+static_assert( classify::keyword( "X-XSS-Protection" ) == classify::internal_::keyword_enum::c_X_XSS_Protection );
+static_assert( classify::keyword( "Expect-CT" ) == classify::internal_::keyword_enum::c_Expect_CT );
+static_assert( classify::keyword( "Transfer-Encoding" ) == classify::internal_::keyword_enum::c_Transfer_Encoding );
+static_assert( classify::keyword( "X-Forwarded-Host" ) == classify::internal_::keyword_enum::c_X_Forwarded_Host );
+static_assert( classify::keyword( "X-Frame-Options" ) == classify::internal_::keyword_enum::c_X_Frame_Options );
+static_assert( classify::keyword( "Trailer" ) == classify::internal_::keyword_enum::c_Trailer );
+static_assert( classify::keyword( "Access-Control-Allow-Credentials" ) == classify::internal_::keyword_enum::c_Access_Control_Allow_Credentials );
+static_assert( classify::keyword( "If-Range" ) == classify::internal_::keyword_enum::c_If_Range );
+static_assert( classify::keyword( "Access-Control-Request-Headers" ) == classify::internal_::keyword_enum::c_Access_Control_Request_Headers );
+static_assert( classify::keyword( "Server-Timing" ) == classify::internal_::keyword_enum::c_Server_Timing );
+static_assert( classify::keyword( "Referrer-Policy" ) == classify::internal_::keyword_enum::c_Referrer_Policy );
+static_assert( classify::keyword( "Proxy-Authenticate" ) == classify::internal_::keyword_enum::c_Proxy_Authenticate );
+static_assert( classify::keyword( "Sec-WebSocket-Accept" ) == classify::internal_::keyword_enum::c_Sec_WebSocket_Accept );
+static_assert( classify::keyword( "Proxy-Authorization" ) == classify::internal_::keyword_enum::c_Proxy_Authorization );
+static_assert( classify::keyword( "Public-Key-Pins" ) == classify::internal_::keyword_enum::c_Public_Key_Pins );
+static_assert( classify::keyword( "Server" ) == classify::internal_::keyword_enum::c_Server );
+static_assert( classify::keyword( "If-Modified-Since" ) == classify::internal_::keyword_enum::c_If_Modified_Since );
+static_assert( classify::keyword( "X-Content-Type-Options" ) == classify::internal_::keyword_enum::c_X_Content_Type_Options );
+static_assert( classify::keyword( "If-Unmodified-Since" ) == classify::internal_::keyword_enum::c_If_Unmodified_Since );
+static_assert( classify::keyword( "X-Forwarded-For" ) == classify::internal_::keyword_enum::c_X_Forwarded_For );
+static_assert( classify::keyword( "Content-Length" ) == classify::internal_::keyword_enum::c_Content_Length );
+static_assert( classify::keyword( "X-DNS-Prefetch-Control" ) == classify::internal_::keyword_enum::c_X_DNS_Prefetch_Control );
+static_assert( classify::keyword( "Referer" ) == classify::internal_::keyword_enum::c_Referer );
+static_assert( classify::keyword( "Location" ) == classify::internal_::keyword_enum::c_Location );
+static_assert( classify::keyword( "Clear-Site-Data" ) == classify::internal_::keyword_enum::c_Clear_Site_Data );
+static_assert( classify::keyword( "Public-Key-Pins-Report-Only" ) == classify::internal_::keyword_enum::c_Public_Key_Pins_Report_Only );
+static_assert( classify::keyword( "Retry-After" ) == classify::internal_::keyword_enum::c_Retry_After );
+static_assert( classify::keyword( "Access-Control-Request-Method" ) == classify::internal_::keyword_enum::c_Access_Control_Request_Method );
+static_assert( classify::keyword( "Vary" ) == classify::internal_::keyword_enum::c_Vary );
+static_assert( classify::keyword( "Content-Security-Policy" ) == classify::internal_::keyword_enum::c_Content_Security_Policy );
+static_assert( classify::keyword( "User-Agent" ) == classify::internal_::keyword_enum::c_User_Agent );
+static_assert( classify::keyword( "Large-Allocation" ) == classify::internal_::keyword_enum::c_Large_Allocation );
+static_assert( classify::keyword( "Warning" ) == classify::internal_::keyword_enum::c_Warning );
+static_assert( classify::keyword( "WWW-Authenticate" ) == classify::internal_::keyword_enum::c_WWW_Authenticate );
+static_assert( classify::keyword( "Origin" ) == classify::internal_::keyword_enum::c_Origin );
+static_assert( classify::keyword( "Strict-Transport-Security" ) == classify::internal_::keyword_enum::c_Strict_Transport_Security );
+static_assert( classify::keyword( "Host" ) == classify::internal_::keyword_enum::c_Host );
+static_assert( classify::keyword( "Feature-Policy" ) == classify::internal_::keyword_enum::c_Feature_Policy );
+static_assert( classify::keyword( "Date" ) == classify::internal_::keyword_enum::c_Date );
+static_assert( classify::keyword( "Cookie2" ) == classify::internal_::keyword_enum::c_Cookie2 );
+static_assert( classify::keyword( "Pragma" ) == classify::internal_::keyword_enum::c_Pragma );
+static_assert( classify::keyword( "Content-Security-Policy-Report-Only" ) == classify::internal_::keyword_enum::c_Content_Security_Policy_Report_Only );
+static_assert( classify::keyword( "SourceMap" ) == classify::internal_::keyword_enum::c_SourceMap );
+static_assert( classify::keyword( "X-Forwarded-Proto" ) == classify::internal_::keyword_enum::c_X_Forwarded_Proto );
+static_assert( classify::keyword( "From" ) == classify::internal_::keyword_enum::c_From );
+static_assert( classify::keyword( "If-Match" ) == classify::internal_::keyword_enum::c_If_Match );
+static_assert( classify::keyword( "DNT" ) == classify::internal_::keyword_enum::c_DNT );
+static_assert( classify::keyword( "Upgrade-Insecure-Requests" ) == classify::internal_::keyword_enum::c_Upgrade_Insecure_Requests );
+static_assert( classify::keyword( "Tk" ) == classify::internal_::keyword_enum::c_Tk );
+static_assert( classify::keyword( "Access-Control-Allow-Methods" ) == classify::internal_::keyword_enum::c_Access_Control_Allow_Methods );
+static_assert( classify::keyword( "If-None-Match" ) == classify::internal_::keyword_enum::c_If_None_Match );
+static_assert( classify::keyword( "Keep-Alive" ) == classify::internal_::keyword_enum::c_Keep_Alive );
+static_assert( classify::keyword( "Access-Control-Expose-Headers" ) == classify::internal_::keyword_enum::c_Access_Control_Expose_Headers );
+static_assert( classify::keyword( "Last-Modified" ) == classify::internal_::keyword_enum::c_Last_Modified );
+static_assert( classify::keyword( "Access-Control-Allow-Origin" ) == classify::internal_::keyword_enum::c_Access_Control_Allow_Origin );
+static_assert( classify::keyword( "Forwarded" ) == classify::internal_::keyword_enum::c_Forwarded );
+static_assert( classify::keyword( "Access-Control-Allow-Headers" ) == classify::internal_::keyword_enum::c_Access_Control_Allow_Headers );
+static_assert( classify::keyword( "Set-Cookie2" ) == classify::internal_::keyword_enum::c_Set_Cookie2 );
+static_assert( classify::keyword( "Via" ) == classify::internal_::keyword_enum::c_Via );
+
+#endif // CLASSIFY__KEYWORD_HPP_
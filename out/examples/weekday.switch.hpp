@@ -0,0 +1,131 @@
+#ifndef __WEEKDAY_HPP_
+#define __WEEKDAY_HPP_
+
+#include <array>
+#include <string_view>
+
+
+namespace internal_ {
+
+enum class weekday_enum
+{
+    default_ = -1,
+    c_Sunday = 0,
+    c_Monday = 1,
+    c_Saturday = 2,
+    c_Tuesday = 3,
+    c_Thursday = 4,
+    c_Wednesday = 5,
+    c_Friday = 6,
+};
+
+} // namespace internal_
+
+// Number of keywords, enum values other than the default are in [ 0, weekday_count )
+constexpr size_t weekday_count = 7;
+
+constexpr internal_::weekday_enum weekday( std::string_view s );
+
+namespace internal_ {
+
+constexpr std::array< int, 256 > asso_values = {
+        13,    13,    13,    13,    13,    13,    13,    13,    13,    13,
+        13,    13,    13,    13,    13,    13,    13,    13,    13,    13,
+        13,    13,    13,    13,    13,    13,    13,    13,    13,    13,
+        13,    13,    13,    13,    13,    13,    13,    13,    13,    13,
+        13,    13,    13,    13,    13,    13,    13,    13,    13,    13,
+        13,    13,    13,    13,    13,    13,    13,    13,    13,    13,
+        13,    13,    13,    13,    13,    13,    13,    13,    13,    13,
+         6,    13,    13,    13,    13,    13,    13,     1,    13,    13,
+        13,    13,    13,     0,     2,    13,    13,     2,    13,    13,
+        13,    13,    13,    13,    13,    13,    13,    13,    13,    13,
+        13,    13,    13,    13,    13,    13,    13,    13,    13,    13,
+        13,    13,    13,    13,    13,    13,    13,    13,    13,    13,
+        13,    13,    13,    13,    13,    13,    13,    13,    13,    13,
+        13,    13,    13,    13,    13,    13,    13,    13,    13,    13,
+        13,    13,    13,    13,    13,    13,    13,    13,    13,    13,
+        13,    13,    13,    13,    13,    13,    13,    13,    13,    13,
+        13,    13,    13,    13,    13,    13,    13,    13,    13,    13,
+        13,    13,    13,    13,    13,    13,    13,    13,    13,    13,
+        13,    13,    13,    13,    13,    13,    13,    13,    13,    13,
+        13,    13,    13,    13,    13,    13,    13,    13,    13,    13,
+        13,    13,    13,    13,    13,    13,    13,    13,    13,    13,
+        13,    13,    13,    13,    13,    13,    13,    13,    13,    13,
+        13,    13,    13,    13,    13,    13,    13,    13,    13,    13,
+        13,    13,    13,    13,    13,    13,    13,    13,    13,    13,
+        13,    13,    13,    13,    13,    13,    13,    13,    13,    13,
+        13,    13,    13,    13,    13,    13,
+};
+
+struct word_entry
+{
+    std::string_view word;
+    weekday_enum enum_val;
+};
+
+constexpr std::array< word_entry, 13 > wordlist = {{
+    { "", weekday_enum::default_ },
+    { "", weekday_enum::default_ },
+    { "", weekday_enum::default_ },
+    { "", weekday_enum::default_ },
+    { "", weekday_enum::default_ },
+    { "", weekday_enum::default_ },
+    { "Sunday", weekday_enum::c_Sunday },
+    { "Monday", weekday_enum::c_Monday },
+    { "Saturday", weekday_enum::c_Saturday },
+    { "Tuesday", weekday_enum::c_Tuesday },
+    { "Thursday", weekday_enum::c_Thursday },
+    { "Wednesday", weekday_enum::c_Wednesday },
+    { "Friday", weekday_enum::c_Friday },
+}};
+
+} // namespace internal_
+
+constexpr internal_::weekday_enum weekday( std::string_view s )
+{
+    constexpr size_t MinWordLength = 6;
+    constexpr size_t MaxWordLength = 9;
+    constexpr size_t MaxHashValue = 12;
+
+    if ( s.size() < MinWordLength || s.size() > MaxWordLength )
+    {
+        return internal_::weekday_enum::default_;
+    }
+
+    size_t hash_val = s.size();
+    switch( s.size() )
+    {
+                       case 9:
+    [[ fallthrough ]]; case 8:
+    [[ fallthrough ]]; case 7:
+    [[ fallthrough ]]; case 6:
+    [[ fallthrough ]]; case 5:
+    [[ fallthrough ]]; case 4:
+    [[ fallthrough ]]; case 3:
+    [[ fallthrough ]]; case 2:
+    [[ fallthrough ]]; case 1:
+        hash_val += internal_::asso_values[ static_cast< unsigned char >( s[ 0] ) ];
+    }
+
+    if ( hash_val <= MaxHashValue )
+    {
+        const size_t slot = hash_val;
+        if ( internal_::wordlist[ slot ].word == s )
+        {
+            return internal_::wordlist[ slot ].enum_val;
+        }
+    }
+    return internal_::weekday_enum::default_;
+}
+
+
+// Extra check for safety
+static_assert( ::weekday( "Sunday" ) == ::internal_::weekday_enum::c_Sunday );
+static_assert( ::weekday( "Monday" ) == ::internal_::weekday_enum::c_Monday );
+static_assert( ::weekday( "Saturday" ) == ::internal_::weekday_enum::c_Saturday );
+static_assert( ::weekday( "Tuesday" ) == ::internal_::weekday_enum::c_Tuesday );
+static_assert( ::weekday( "Thursday" ) == ::internal_::weekday_enum::c_Thursday );
+static_assert( ::weekday( "Wednesday" ) == ::internal_::weekday_enum::c_Wednesday );
+static_assert( ::weekday( "Friday" ) == ::internal_::weekday_enum::c_Friday );
+
+#endif // __WEEKDAY_HPP_
@@ -0,0 +1,107 @@
+// Backend picked by --autotune, nanoseconds per lookup of keywords and as many misses
+// (7 hits), best of 7 runs, compiled with: g++ -Wall -Wextra -Wpedantic -std=c++17 -I src/third_party -O3 -DCATCH_CONFIG_NO_POSIX_SIGNALS
+//   gperf      3.835
+//   switch     1.911 (picked)
+//   full-key   5.906
+//   simd       8.192
+
+#ifndef __WEEKDAY_HPP_
+#define __WEEKDAY_HPP_
+
+#include <array>
+#include <string_view>
+
+
+namespace internal_ {
+
+enum class weekday_enum
+{
+    default_ = -1,
+    c_Monday = 0,
+    c_Tuesday = 1,
+    c_Wednesday = 2,
+    c_Thursday = 3,
+    c_Friday = 4,
+    c_Saturday = 5,
+    c_Sunday = 6,
+};
+
+} // namespace internal_
+
+// Number of keywords, enum values other than the default are in [ 0, weekday_count )
+constexpr size_t weekday_count = 7;
+
+constexpr internal_::weekday_enum weekday( std::string_view s );
+
+constexpr internal_::weekday_enum weekday( std::string_view s )
+{
+    switch ( s.size() )
+    {
+    case 6:
+        switch ( s[ 0 ] )
+        {
+        case 'F':
+            if ( s == "Friday" )
+            {
+                return internal_::weekday_enum::c_Friday;
+            }
+            break;
+        case 'M':
+            if ( s == "Monday" )
+            {
+                return internal_::weekday_enum::c_Monday;
+            }
+            break;
+        case 'S':
+            if ( s == "Sunday" )
+            {
+                return internal_::weekday_enum::c_Sunday;
+            }
+            break;
+        }
+        break;
+    case 7:
+        if ( s == "Tuesday" )
+        {
+            return internal_::weekday_enum::c_Tuesday;
+        }
+        break;
+    case 8:
+        switch ( s[ 0 ] )
+        {
+        case 'S':
+            if ( s == "Saturday" )
+            {
+                return internal_::weekday_enum::c_Saturday;
+            }
+            break;
+        case 'T':
+            if ( s == "Thursday" )
+            {
+                return internal_::weekday_enum::c_Thursday;
+            }
+            break;
+        }
+        break;
+    case 9:
+        if ( s == "Wednesday" )
+        {
+            return internal_::weekday_enum::c_Wednesday;
+        }
+        break;
+    }
+
+    return internal_::weekday_enum::default_;
+}
+
+
+// Extra check for safety
+static_assert( ::weekday( "Monday" ) == ::internal_::weekday_enum::c_Monday );
+static_assert( ::weekday( "Tuesday" ) == ::internal_::weekday_enum::c_Tuesday );
+static_assert( ::weekday( "Wednesday" ) == ::internal_::weekday_enum::c_Wednesday );
+static_assert( ::weekday( "Thursday" ) == ::internal_::weekday_enum::c_Thursday );
+static_assert( ::weekday( "Friday" ) == ::internal_::weekday_enum::c_Friday );
+static_assert( ::weekday( "Saturday" ) == ::internal_::weekday_enum::c_Saturday );
+static_assert( ::weekday( "Sunday" ) == ::internal_::weekday_enum::c_Sunday );
+
+#endif // __WEEKDAY_HPP_
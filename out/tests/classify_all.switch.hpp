@@ -0,0 +1,475 @@
+#ifndef CLASSIFY_ALL__HASH_HPP_
+#define CLASSIFY_ALL__HASH_HPP_
+
+#include <array>
+#include <string_view>
+
+#if defined( __SSE2__ )
+#include <emmintrin.h>
+#endif
+
+namespace classify_all {
+
+namespace internal_ {
+
+enum class hash_enum
+{
+    default_ = -1,
+    c_Age = 0,
+    c_Allow = 1,
+    c_Cookie = 2,
+    c_Accept = 3,
+    c_Connection = 4,
+    c_Content_Type = 5,
+    c_Content_Range = 6,
+    c_Authorization = 7,
+    c_Accept_Language = 8,
+    c_Content_Language = 9,
+    c_Content_Location = 10,
+    c_Accept_Charset = 11,
+    c_Accept_Ranges = 12,
+    c_Content_Disposition = 13,
+    c_Cache_Control = 14,
+    c_Access_Control_Max_Age = 15,
+    c_Accept_Encoding = 16,
+    c_Content_Encoding = 17,
+    c_Expect = 18,
+    c_TE = 19,
+    c_ETag = 20,
+    c_Expires = 21,
+    c_Timing_Allow_Origin = 22,
+    c_Set_Cookie = 23,
+    c_Range = 24,
+    c_X_XSS_Protection = 25,
+    c_Expect_CT = 26,
+    c_Transfer_Encoding = 27,
+    c_X_Forwarded_Host = 28,
+    c_X_Frame_Options = 29,
+    c_Trailer = 30,
+    c_Access_Control_Allow_Credentials = 31,
+    c_If_Range = 32,
+    c_Access_Control_Request_Headers = 33,
+    c_Server_Timing = 34,
+    c_Referrer_Policy = 35,
+    c_Proxy_Authenticate = 36,
+    c_Sec_WebSocket_Accept = 37,
+    c_Proxy_Authorization = 38,
+    c_Public_Key_Pins = 39,
+    c_Server = 40,
+    c_If_Modified_Since = 41,
+    c_X_Content_Type_Options = 42,
+    c_If_Unmodified_Since = 43,
+    c_X_Forwarded_For = 44,
+    c_Content_Length = 45,
+    c_X_DNS_Prefetch_Control = 46,
+    c_Referer = 47,
+    c_Location = 48,
+    c_Clear_Site_Data = 49,
+    c_Public_Key_Pins_Report_Only = 50,
+    c_Retry_After = 51,
+    c_Access_Control_Request_Method = 52,
+    c_Vary = 53,
+    c_Content_Security_Policy = 54,
+    c_User_Agent = 55,
+    c_Large_Allocation = 56,
+    c_Warning = 57,
+    c_WWW_Authenticate = 58,
+    c_Origin = 59,
+    c_Strict_Transport_Security = 60,
+    c_Host = 61,
+    c_Feature_Policy = 62,
+    c_Date = 63,
+    c_Cookie2 = 64,
+    c_Pragma = 65,
+    c_Content_Security_Policy_Report_Only = 66,
+    c_SourceMap = 67,
+    c_X_Forwarded_Proto = 68,
+    c_From = 69,
+    c_If_Match = 70,
+    c_DNT = 71,
+    c_Upgrade_Insecure_Requests = 72,
+    c_Tk = 73,
+    c_Access_Control_Allow_Methods = 74,
+    c_If_None_Match = 75,
+    c_Keep_Alive = 76,
+    c_Access_Control_Expose_Headers = 77,
+    c_Last_Modified = 78,
+    c_Access_Control_Allow_Origin = 79,
+    c_Forwarded = 80,
+    c_Access_Control_Allow_Headers = 81,
+    c_Set_Cookie2 = 82,
+    c_Via = 83,
+};
+
+} // namespace internal_
+
+// Number of keywords, enum values other than the default are in [ 0, hash_count )
+constexpr size_t hash_count = 84;
+
+constexpr internal_::hash_enum hash( std::string_view s );
+
+namespace internal_ {
+
+constexpr std::array< int, 256 > asso_values = {
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,    49,   100,   100,   100,   100,
+        64,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,     0,   100,     0,    66,    15,
+        54,   100,    60,    31,   100,    73,    46,    47,   100,    59,
+        25,   100,    26,    20,     9,    48,    55,    49,    15,   100,
+       100,   100,   100,   100,   100,   100,   100,    41,   100,    37,
+        26,     0,   100,     8,    38,   100,   100,    69,     8,    18,
+         1,    43,    45,   100,    21,     6,     4,   100,   100,     0,
+       100,     1,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,
+};
+
+struct word_entry
+{
+    std::string_view word;
+    hash_enum enum_val;
+};
+
+constexpr std::array< word_entry, 100 > wordlist = {{
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "Age", hash_enum::c_Age },
+    { "", hash_enum::default_ },
+    { "Allow", hash_enum::c_Allow },
+    { "Cookie", hash_enum::c_Cookie },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "Accept", hash_enum::c_Accept },
+    { "Connection", hash_enum::c_Connection },
+    { "Content-Type", hash_enum::c_Content_Type },
+    { "Content-Range", hash_enum::c_Content_Range },
+    { "Authorization", hash_enum::c_Authorization },
+    { "Accept-Language", hash_enum::c_Accept_Language },
+    { "Content-Language", hash_enum::c_Content_Language },
+    { "Content-Location", hash_enum::c_Content_Location },
+    { "Accept-Charset", hash_enum::c_Accept_Charset },
+    { "Accept-Ranges", hash_enum::c_Accept_Ranges },
+    { "Content-Disposition", hash_enum::c_Content_Disposition },
+    { "Cache-Control", hash_enum::c_Cache_Control },
+    { "Access-Control-Max-Age", hash_enum::c_Access_Control_Max_Age },
+    { "Accept-Encoding", hash_enum::c_Accept_Encoding },
+    { "Content-Encoding", hash_enum::c_Content_Encoding },
+    { "Expect", hash_enum::c_Expect },
+    { "TE", hash_enum::c_TE },
+    { "ETag", hash_enum::c_ETag },
+    { "Expires", hash_enum::c_Expires },
+    { "Timing-Allow-Origin", hash_enum::c_Timing_Allow_Origin },
+    { "Set-Cookie", hash_enum::c_Set_Cookie },
+    { "Range", hash_enum::c_Range },
+    { "X-XSS-Protection", hash_enum::c_X_XSS_Protection },
+    { "Expect-CT", hash_enum::c_Expect_CT },
+    { "Transfer-Encoding", hash_enum::c_Transfer_Encoding },
+    { "X-Forwarded-Host", hash_enum::c_X_Forwarded_Host },
+    { "X-Frame-Options", hash_enum::c_X_Frame_Options },
+    { "Trailer", hash_enum::c_Trailer },
+    { "Access-Control-Allow-Credentials", hash_enum::c_Access_Control_Allow_Credentials },
+    { "If-Range", hash_enum::c_If_Range },
+    { "Access-Control-Request-Headers", hash_enum::c_Access_Control_Request_Headers },
+    { "Server-Timing", hash_enum::c_Server_Timing },
+    { "Referrer-Policy", hash_enum::c_Referrer_Policy },
+    { "Proxy-Authenticate", hash_enum::c_Proxy_Authenticate },
+    { "Sec-WebSocket-Accept", hash_enum::c_Sec_WebSocket_Accept },
+    { "Proxy-Authorization", hash_enum::c_Proxy_Authorization },
+    { "Public-Key-Pins", hash_enum::c_Public_Key_Pins },
+    { "Server", hash_enum::c_Server },
+    { "If-Modified-Since", hash_enum::c_If_Modified_Since },
+    { "X-Content-Type-Options", hash_enum::c_X_Content_Type_Options },
+    { "If-Unmodified-Since", hash_enum::c_If_Unmodified_Since },
+    { "X-Forwarded-For", hash_enum::c_X_Forwarded_For },
+    { "Content-Length", hash_enum::c_Content_Length },
+    { "X-DNS-Prefetch-Control", hash_enum::c_X_DNS_Prefetch_Control },
+    { "Referer", hash_enum::c_Referer },
+    { "Location", hash_enum::c_Location },
+    { "Clear-Site-Data", hash_enum::c_Clear_Site_Data },
+    { "Public-Key-Pins-Report-Only", hash_enum::c_Public_Key_Pins_Report_Only },
+    { "Retry-After", hash_enum::c_Retry_After },
+    { "Access-Control-Request-Method", hash_enum::c_Access_Control_Request_Method },
+    { "Vary", hash_enum::c_Vary },
+    { "Content-Security-Policy", hash_enum::c_Content_Security_Policy },
+    { "User-Agent", hash_enum::c_User_Agent },
+    { "Large-Allocation", hash_enum::c_Large_Allocation },
+    { "Warning", hash_enum::c_Warning },
+    { "WWW-Authenticate", hash_enum::c_WWW_Authenticate },
+    { "Origin", hash_enum::c_Origin },
+    { "Strict-Transport-Security", hash_enum::c_Strict_Transport_Security },
+    { "Host", hash_enum::c_Host },
+    { "Feature-Policy", hash_enum::c_Feature_Policy },
+    { "Date", hash_enum::c_Date },
+    { "Cookie2", hash_enum::c_Cookie2 },
+    { "Pragma", hash_enum::c_Pragma },
+    { "Content-Security-Policy-Report-Only", hash_enum::c_Content_Security_Policy_Report_Only },
+    { "SourceMap", hash_enum::c_SourceMap },
+    { "X-Forwarded-Proto", hash_enum::c_X_Forwarded_Proto },
+    { "From", hash_enum::c_From },
+    { "If-Match", hash_enum::c_If_Match },
+    { "DNT", hash_enum::c_DNT },
+    { "Upgrade-Insecure-Requests", hash_enum::c_Upgrade_Insecure_Requests },
+    { "Tk", hash_enum::c_Tk },
+    { "Access-Control-Allow-Methods", hash_enum::c_Access_Control_Allow_Methods },
+    { "If-None-Match", hash_enum::c_If_None_Match },
+    { "Keep-Alive", hash_enum::c_Keep_Alive },
+    { "Access-Control-Expose-Headers", hash_enum::c_Access_Control_Expose_Headers },
+    { "Last-Modified", hash_enum::c_Last_Modified },
+    { "", hash_enum::default_ },
+    { "Access-Control-Allow-Origin", hash_enum::c_Access_Control_Allow_Origin },
+    { "", hash_enum::default_ },
+    { "Forwarded", hash_enum::c_Forwarded },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "Access-Control-Allow-Headers", hash_enum::c_Access_Control_Allow_Headers },
+    { "Set-Cookie2", hash_enum::c_Set_Cookie2 },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "Via", hash_enum::c_Via },
+}};
+
+} // namespace internal_
+
+constexpr internal_::hash_enum hash( std::string_view s )
+{
+    constexpr size_t MinWordLength = 2;
+    constexpr size_t MaxWordLength = 35;
+    constexpr size_t MaxHashValue = 99;
+
+    if ( s.size() < MinWordLength || s.size() > MaxWordLength )
+    {
+        return internal_::hash_enum::default_;
+    }
+
+    size_t hash_val = s.size();
+    hash_val += internal_::asso_values[ static_cast< unsigned char >( s[ s.size() - 1 ] ) ];
+    switch( s.size() )
+    {
+                       case 35:
+    [[ fallthrough ]]; case 34:
+    [[ fallthrough ]]; case 33:
+    [[ fallthrough ]]; case 32:
+    [[ fallthrough ]]; case 31:
+    [[ fallthrough ]]; case 30:
+    [[ fallthrough ]]; case 29:
+    [[ fallthrough ]]; case 28:
+    [[ fallthrough ]]; case 27:
+    [[ fallthrough ]]; case 26:
+    [[ fallthrough ]]; case 25:
+    [[ fallthrough ]]; case 24:
+    [[ fallthrough ]]; case 23:
+    [[ fallthrough ]]; case 22:
+        hash_val += internal_::asso_values[ static_cast< unsigned char >( s[ 21] ) ];
+    [[ fallthrough ]]; case 21:
+    [[ fallthrough ]]; case 20:
+    [[ fallthrough ]]; case 19:
+    [[ fallthrough ]]; case 18:
+    [[ fallthrough ]]; case 17:
+    [[ fallthrough ]]; case 16:
+    [[ fallthrough ]]; case 15:
+    [[ fallthrough ]]; case 14:
+    [[ fallthrough ]]; case 13:
+    [[ fallthrough ]]; case 12:
+    [[ fallthrough ]]; case 11:
+    [[ fallthrough ]]; case 10:
+    [[ fallthrough ]]; case 9:
+    [[ fallthrough ]]; case 8:
+    [[ fallthrough ]]; case 7:
+    [[ fallthrough ]]; case 6:
+    [[ fallthrough ]]; case 5:
+    [[ fallthrough ]]; case 4:
+    [[ fallthrough ]]; case 3:
+    [[ fallthrough ]]; case 2:
+    [[ fallthrough ]]; case 1:
+        hash_val += internal_::asso_values[ static_cast< unsigned char >( s[ 0] ) ];
+    }
+
+    if ( hash_val <= MaxHashValue )
+    {
+        const size_t slot = hash_val;
+        if ( internal_::wordlist[ slot ].word == s )
+        {
+            return internal_::wordlist[ slot ].enum_val;
+        }
+    }
+    return internal_::hash_enum::default_;
+}
+
+struct hash_token
+{
+    internal_::hash_enum value;
+    size_t offset; // Position of the token in buffer, after trimming
+    size_t size;
+};
+
+// Splits buf on any of delims, trims spaces and tabs around tokens and writes
+// a hash_token for each non-empty one to out. Returns out past the last
+// token. SSE2 is used for up to 4 delimiters.
+template < typename OutputIt >
+inline OutputIt hash_classify_all( std::string_view buf, std::string_view delims, OutputIt out )
+{
+    size_t start = 0;
+    auto token_end = [ & ]( size_t end ) {
+        while ( start < end && ( buf[ start ] == ' ' || buf[ start ] == '\t' ) )
+        {
+            ++start;
+        }
+        while ( start < end && ( buf[ end - 1 ] == ' ' || buf[ end - 1 ] == '\t' ) )
+        {
+            --end;
+        }
+        if ( start < end )
+        {
+            *out++ = hash_token{ hash( buf.substr( start, end - start ) ), start, end - start };
+        }
+    };
+
+    size_t i = 0;
+
+#if defined( __SSE2__ )
+    if ( delims.size() && delims.size() <= 4 )
+    {
+        // Unused patterns repeat the first delimiter
+        __m128i patterns[ 4 ];
+        for ( size_t j = 0; j < 4; ++j )
+        {
+            patterns[ j ] = _mm_set1_epi8( delims[ j < delims.size() ? j : 0 ] );
+        }
+
+        for ( ; i + 16 <= buf.size(); i += 16 )
+        {
+            const __m128i chunk = _mm_loadu_si128( reinterpret_cast< const __m128i* >( buf.data() + i ) );
+            const __m128i hits = _mm_or_si128( _mm_or_si128( _mm_cmpeq_epi8( chunk, patterns[ 0 ] ), _mm_cmpeq_epi8( chunk, patterns[ 1 ] ) ),
+                                               _mm_or_si128( _mm_cmpeq_epi8( chunk, patterns[ 2 ] ), _mm_cmpeq_epi8( chunk, patterns[ 3 ] ) ) );
+            for ( unsigned mask = _mm_movemask_epi8( hits ); mask; mask &= mask - 1 )
+            {
+                const size_t end = i + __builtin_ctz( mask );
+                token_end( end );
+                start = end + 1;
+            }
+        }
+    }
+#endif
+
+    for ( ; i < buf.size(); ++i )
+    {
+        if ( delims.find( buf[ i ] ) != std::string_view::npos )
+        {
+            token_end( i );
+            start = i + 1;
+        }
+    }
+    token_end( buf.size() );
+
+    return out;
+}
+
+} // namespace classify_all {
+
+// Extra check for safety
+static_assert( classify_all::hash( "Age" ) == classify_all::internal_::hash_enum::c_Age );
+static_assert( classify_all::hash( "Allow" ) == classify_all::internal_::hash_enum::c_Allow );
+static_assert( classify_all::hash( "Cookie" ) == classify_all::internal_::hash_enum::c_Cookie );
+static_assert( classify_all::hash( "Accept" ) == classify_all::internal_::hash_enum::c_Accept );
+static_assert( classify_all::hash( "Connection" ) == classify_all::internal_::hash_enum::c_Connection );
+static_assert( classify_all::hash( "Content-Type" ) == classify_all::internal_::hash_enum::c_Content_Type );
+static_assert( classify_all::hash( "Content-Range" ) == classify_all::internal_::hash_enum::c_Content_Range );
+static_assert( classify_all::hash( "Authorization" ) == classify_all::internal_::hash_enum::c_Authorization );
+static_assert( classify_all::hash( "Accept-Language" ) == classify_all::internal_::hash_enum::c_Accept_Language );
+static_assert( classify_all::hash( "Content-Language" ) == classify_all::internal_::hash_enum::c_Content_Language );
+static_assert( classify_all::hash( "Content-Location" ) == classify_all::internal_::hash_enum::c_Content_Location );
+static_assert( classify_all::hash( "Accept-Charset" ) == classify_all::internal_::hash_enum::c_Accept_Charset );
+static_assert( classify_all::hash( "Accept-Ranges" ) == classify_all::internal_::hash_enum::c_Accept_Ranges );
+static_assert( classify_all::hash( "Content-Disposition" ) == classify_all::internal_::hash_enum::c_Content_Disposition );
+static_assert( classify_all::hash( "Cache-Control" ) == classify_all::internal_::hash_enum::c_Cache_Control );
+static_assert( classify_all::hash( "Access-Control-Max-Age" ) == classify_all::internal_::hash_enum::c_Access_Control_Max_Age );
+static_assert( classify_all::hash( "Accept-Encoding" ) == classify_all::internal_::hash_enum::c_Accept_Encoding );
+static_assert( classify_all::hash( "Content-Encoding" ) == classify_all::internal_::hash_enum::c_Content_Encoding );
+static_assert( classify_all::hash( "Expect" ) == classify_all::internal_::hash_enum::c_Expect );
+static_assert( classify_all::hash( "TE" ) == classify_all::internal_::hash_enum::c_TE );
+static_assert( classify_all::hash( "ETag" ) == classify_all::internal_::hash_enum::c_ETag );
+static_assert( classify_all::hash( "Expires" ) == classify_all::internal_::hash_enum::c_Expires );
+static_assert( classify_all::hash( "Timing-Allow-Origin" ) == classify_all::internal_::hash_enum::c_Timing_Allow_Origin );
+static_assert( classify_all::hash( "Set-Cookie" ) == classify_all::internal_::hash_enum::c_Set_Cookie );
+static_assert( classify_all::hash( "Range" ) == classify_all::internal_::hash_enum::c_Range );
+static_assert( classify_all::hash( "X-XSS-Protection" ) == classify_all::internal_::hash_enum::c_X_XSS_Protection );
+static_assert( classify_all::hash( "Expect-CT" ) == classify_all::internal_::hash_enum::c_Expect_CT );
+static_assert( classify_all::hash( "Transfer-Encoding" ) == classify_all::internal_::hash_enum::c_Transfer_Encoding );
+static_assert( classify_all::hash( "X-Forwarded-Host" ) == classify_all::internal_::hash_enum::c_X_Forwarded_Host );
+static_assert( classify_all::hash( "X-Frame-Options" ) == classify_all::internal_::hash_enum::c_X_Frame_Options );
+static_assert( classify_all::hash( "Trailer" ) == classify_all::internal_::hash_enum::c_Trailer );
+static_assert( classify_all::hash( "Access-Control-Allow-Credentials" ) == classify_all::internal_::hash_enum::c_Access_Control_Allow_Credentials );
+static_assert( classify_all::hash( "If-Range" ) == classify_all::internal_::hash_enum::c_If_Range );
+static_assert( classify_all::hash( "Access-Control-Request-Headers" ) == classify_all::internal_::hash_enum::c_Access_Control_Request_Headers );
+static_assert( classify_all::hash( "Server-Timing" ) == classify_all::internal_::hash_enum::c_Server_Timing );
+static_assert( classify_all::hash( "Referrer-Policy" ) == classify_all::internal_::hash_enum::c_Referrer_Policy );
+static_assert( classify_all::hash( "Proxy-Authenticate" ) == classify_all::internal_::hash_enum::c_Proxy_Authenticate );
+static_assert( classify_all::hash( "Sec-WebSocket-Accept" ) == classify_all::internal_::hash_enum::c_Sec_WebSocket_Accept );
+static_assert( classify_all::hash( "Proxy-Authorization" ) == classify_all::internal_::hash_enum::c_Proxy_Authorization );
+static_assert( classify_all::hash( "Public-Key-Pins" ) == classify_all::internal_::hash_enum::c_Public_Key_Pins );
+static_assert( classify_all::hash( "Server" ) == classify_all::internal_::hash_enum::c_Server );
+static_assert( classify_all::hash( "If-Modified-Since" ) == classify_all::internal_::hash_enum::c_If_Modified_Since );
+static_assert( classify_all::hash( "X-Content-Type-Options" ) == classify_all::internal_::hash_enum::c_X_Content_Type_Options );
+static_assert( classify_all::hash( "If-Unmodified-Since" ) == classify_all::internal_::hash_enum::c_If_Unmodified_Since );
+static_assert( classify_all::hash( "X-Forwarded-For" ) == classify_all::internal_::hash_enum::c_X_Forwarded_For );
+static_assert( classify_all::hash( "Content-Length" ) == classify_all::internal_::hash_enum::c_Content_Length );
+static_assert( classify_all::hash( "X-DNS-Prefetch-Control" ) == classify_all::internal_::hash_enum::c_X_DNS_Prefetch_Control );
+static_assert( classify_all::hash( "Referer" ) == classify_all::internal_::hash_enum::c_Referer );
+static_assert( classify_all::hash( "Location" ) == classify_all::internal_::hash_enum::c_Location );
+static_assert( classify_all::hash( "Clear-Site-Data" ) == classify_all::internal_::hash_enum::c_Clear_Site_Data );
+static_assert( classify_all::hash( "Public-Key-Pins-Report-Only" ) == classify_all::internal_::hash_enum::c_Public_Key_Pins_Report_Only );
+static_assert( classify_all::hash( "Retry-After" ) == classify_all::internal_::hash_enum::c_Retry_After );
+static_assert( classify_all::hash( "Access-Control-Request-Method" ) == classify_all::internal_::hash_enum::c_Access_Control_Request_Method );
+static_assert( classify_all::hash( "Vary" ) == classify_all::internal_::hash_enum::c_Vary );
+static_assert( classify_all::hash( "Content-Security-Policy" ) == classify_all::internal_::hash_enum::c_Content_Security_Policy );
+static_assert( classify_all::hash( "User-Agent" ) == classify_all::internal_::hash_enum::c_User_Agent );
+static_assert( classify_all::hash( "Large-Allocation" ) == classify_all::internal_::hash_enum::c_Large_Allocation );
+static_assert( classify_all::hash( "Warning" ) == classify_all::internal_::hash_enum::c_Warning );
+static_assert( classify_all::hash( "WWW-Authenticate" ) == classify_all::internal_::hash_enum::c_WWW_Authenticate );
+static_assert( classify_all::hash( "Origin" ) == classify_all::internal_::hash_enum::c_Origin );
+static_assert( classify_all::hash( "Strict-Transport-Security" ) == classify_all::internal_::hash_enum::c_Strict_Transport_Security );
+static_assert( classify_all::hash( "Host" ) == classify_all::internal_::hash_enum::c_Host );
+static_assert( classify_all::hash( "Feature-Policy" ) == classify_all::internal_::hash_enum::c_Feature_Policy );
+static_assert( classify_all::hash( "Date" ) == classify_all::internal_::hash_enum::c_Date );
+static_assert( classify_all::hash( "Cookie2" ) == classify_all::internal_::hash_enum::c_Cookie2 );
+static_assert( classify_all::hash( "Pragma" ) == classify_all::internal_::hash_enum::c_Pragma );
+static_assert( classify_all::hash( "Content-Security-Policy-Report-Only" ) == classify_all::internal_::hash_enum::c_Content_Security_Policy_Report_Only );
+static_assert( classify_all::hash( "SourceMap" ) == classify_all::internal_::hash_enum::c_SourceMap );
+static_assert( classify_all::hash( "X-Forwarded-Proto" ) == classify_all::internal_::hash_enum::c_X_Forwarded_Proto );
+static_assert( classify_all::hash( "From" ) == classify_all::internal_::hash_enum::c_From );
+static_assert( classify_all::hash( "If-Match" ) == classify_all::internal_::hash_enum::c_If_Match );
+static_assert( classify_all::hash( "DNT" ) == classify_all::internal_::hash_enum::c_DNT );
+static_assert( classify_all::hash( "Upgrade-Insecure-Requests" ) == classify_all::internal_::hash_enum::c_Upgrade_Insecure_Requests );
+static_assert( classify_all::hash( "Tk" ) == classify_all::internal_::hash_enum::c_Tk );
+static_assert( classify_all::hash( "Access-Control-Allow-Methods" ) == classify_all::internal_::hash_enum::c_Access_Control_Allow_Methods );
+static_assert( classify_all::hash( "If-None-Match" ) == classify_all::internal_::hash_enum::c_If_None_Match );
+static_assert( classify_all::hash( "Keep-Alive" ) == classify_all::internal_::hash_enum::c_Keep_Alive );
+static_assert( classify_all::hash( "Access-Control-Expose-Headers" ) == classify_all::internal_::hash_enum::c_Access_Control_Expose_Headers );
+static_assert( classify_all::hash( "Last-Modified" ) == classify_all::internal_::hash_enum::c_Last_Modified );
+static_assert( classify_all::hash( "Access-Control-Allow-Origin" ) == classify_all::internal_::hash_enum::c_Access_Control_Allow_Origin );
+static_assert( classify_all::hash( "Forwarded" ) == classify_all::internal_::hash_enum::c_Forwarded );
+static_assert( classify_all::hash( "Access-Control-Allow-Headers" ) == classify_all::internal_::hash_enum::c_Access_Control_Allow_Headers );
+static_assert( classify_all::hash( "Set-Cookie2" ) == classify_all::internal_::hash_enum::c_Set_Cookie2 );
+static_assert( classify_all::hash( "Via" ) == classify_all::internal_::hash_enum::c_Via );
+
+#endif // CLASSIFY_ALL__HASH_HPP_
@@ -0,0 +1,233 @@
+#ifndef CURRENCY__CODE_HPP_
+#define CURRENCY__CODE_HPP_
+
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <string_view>
+
+namespace currency {
+
+namespace internal_ {
+
+enum class code_enum
+{
+    default_ = -1,
+    c_DKK = 0,
+    c_AED = 1,
+    c_HKD = 2,
+    c_RUB = 3,
+    c_SEK = 4,
+    c_NOK = 5,
+    c_MXN = 6,
+    c_CZK = 7,
+    c_MYR = 8,
+    c_CNY = 9,
+    c_IDR = 10,
+    c_THB = 11,
+    c_SGD = 12,
+    c_EUR = 13,
+    c_ZAR = 14,
+    c_KRW = 15,
+    c_ILS = 16,
+    c_INR = 17,
+    c_JPY = 18,
+    c_GBP = 19,
+    c_CAD = 20,
+    c_CHF = 21,
+    c_NZD = 22,
+    c_USD = 23,
+    c_AUD = 24,
+    c_TWD = 25,
+    c_TRY = 26,
+    c_HUF = 27,
+    c_PHP = 28,
+    c_SAR = 29,
+    c_BRL = 30,
+    c_PLN = 31,
+};
+
+} // namespace internal_
+
+// Number of keywords, enum values other than the default are in [ 0, code_count )
+constexpr size_t code_count = 32;
+
+constexpr internal_::code_enum code( std::string_view s );
+
+namespace internal_ {
+
+constexpr uint64_t load_le3( const char *p )
+{
+    return uint64_t( static_cast< unsigned char >( p[ 0 ] ) )
+         | uint64_t( static_cast< unsigned char >( p[ 1 ] ) ) << 8
+         | uint64_t( static_cast< unsigned char >( p[ 2 ] ) ) << 16;
+}
+
+struct key_entry
+{
+    uint64_t key;
+    code_enum enum_val;
+};
+
+constexpr std::array< key_entry, 64 > keylist = {{
+    { 0x4B4B44ull, code_enum::c_DKK }, // DKK
+    { 0x444541ull, code_enum::c_AED }, // AED
+    { 0x444B48ull, code_enum::c_HKD }, // HKD
+    { 0x425552ull, code_enum::c_RUB }, // RUB
+    { 0x4B4B44ull, code_enum::default_ },
+    { 0x4B4553ull, code_enum::c_SEK }, // SEK
+    { 0x4B4F4Eull, code_enum::c_NOK }, // NOK
+    { 0x4B4B44ull, code_enum::default_ },
+    { 0x4E584Dull, code_enum::c_MXN }, // MXN
+    { 0x4B4B44ull, code_enum::default_ },
+    { 0x4B4B44ull, code_enum::default_ },
+    { 0x4B4B44ull, code_enum::default_ },
+    { 0x4B5A43ull, code_enum::c_CZK }, // CZK
+    { 0x52594Dull, code_enum::c_MYR }, // MYR
+    { 0x594E43ull, code_enum::c_CNY }, // CNY
+    { 0x4B4B44ull, code_enum::default_ },
+    { 0x4B4B44ull, code_enum::default_ },
+    { 0x4B4B44ull, code_enum::default_ },
+    { 0x4B4B44ull, code_enum::default_ },
+    { 0x524449ull, code_enum::c_IDR }, // IDR
+    { 0x4B4B44ull, code_enum::default_ },
+    { 0x4B4B44ull, code_enum::default_ },
+    { 0x4B4B44ull, code_enum::default_ },
+    { 0x424854ull, code_enum::c_THB }, // THB
+    { 0x4B4B44ull, code_enum::default_ },
+    { 0x444753ull, code_enum::c_SGD }, // SGD
+    { 0x525545ull, code_enum::c_EUR }, // EUR
+    { 0x52415Aull, code_enum::c_ZAR }, // ZAR
+    { 0x57524Bull, code_enum::c_KRW }, // KRW
+    { 0x4B4B44ull, code_enum::default_ },
+    { 0x534C49ull, code_enum::c_ILS }, // ILS
+    { 0x4B4B44ull, code_enum::default_ },
+    { 0x4B4B44ull, code_enum::default_ },
+    { 0x524E49ull, code_enum::c_INR }, // INR
+    { 0x4B4B44ull, code_enum::default_ },
+    { 0x59504Aull, code_enum::c_JPY }, // JPY
+    { 0x4B4B44ull, code_enum::default_ },
+    { 0x4B4B44ull, code_enum::default_ },
+    { 0x504247ull, code_enum::c_GBP }, // GBP
+    { 0x444143ull, code_enum::c_CAD }, // CAD
+    { 0x4B4B44ull, code_enum::default_ },
+    { 0x464843ull, code_enum::c_CHF }, // CHF
+    { 0x4B4B44ull, code_enum::default_ },
+    { 0x4B4B44ull, code_enum::default_ },
+    { 0x445A4Eull, code_enum::c_NZD }, // NZD
+    { 0x4B4B44ull, code_enum::default_ },
+    { 0x445355ull, code_enum::c_USD }, // USD
+    { 0x4B4B44ull, code_enum::default_ },
+    { 0x445541ull, code_enum::c_AUD }, // AUD
+    { 0x445754ull, code_enum::c_TWD }, // TWD
+    { 0x595254ull, code_enum::c_TRY }, // TRY
+    { 0x4B4B44ull, code_enum::default_ },
+    { 0x465548ull, code_enum::c_HUF }, // HUF
+    { 0x4B4B44ull, code_enum::default_ },
+    { 0x4B4B44ull, code_enum::default_ },
+    { 0x4B4B44ull, code_enum::default_ },
+    { 0x4B4B44ull, code_enum::default_ },
+    { 0x504850ull, code_enum::c_PHP }, // PHP
+    { 0x4B4B44ull, code_enum::default_ },
+    { 0x4B4B44ull, code_enum::default_ },
+    { 0x524153ull, code_enum::c_SAR }, // SAR
+    { 0x4B4B44ull, code_enum::default_ },
+    { 0x4C5242ull, code_enum::c_BRL }, // BRL
+    { 0x4E4C50ull, code_enum::c_PLN }, // PLN
+}};
+
+} // namespace internal_
+
+constexpr internal_::code_enum code( std::string_view s )
+{
+    constexpr size_t WordLength = 3;
+
+    if ( s.size() != WordLength )
+    {
+        return internal_::code_enum::default_;
+    }
+
+    const uint64_t key = internal_::load_le3( s.data() );
+    const internal_::key_entry &entry = internal_::keylist[ ( key * 0xA3EBCABA7EFE0B45ull ) >> 58 ];
+    return entry.key == key ? entry.enum_val : internal_::code_enum::default_;
+}
+
+// Same as code(), but s must be one of the keywords. Only the hash
+// is computed, s is not verified (except by an assertion in debug builds).
+constexpr internal_::code_enum code_unchecked( std::string_view s )
+{
+    const uint64_t key = internal_::load_le3( s.data() );
+    const auto res = internal_::keylist[ ( key * 0xA3EBCABA7EFE0B45ull ) >> 58 ].enum_val;
+    assert( code( s ) == res );
+    return res;
+}
+
+} // namespace currency {
+
+// Extra check for safety
+static_assert( currency::code( "DKK" ) == currency::internal_::code_enum::c_DKK );
+static_assert( currency::code( "AED" ) == currency::internal_::code_enum::c_AED );
+static_assert( currency::code( "HKD" ) == currency::internal_::code_enum::c_HKD );
+static_assert( currency::code( "RUB" ) == currency::internal_::code_enum::c_RUB );
+static_assert( currency::code( "SEK" ) == currency::internal_::code_enum::c_SEK );
+static_assert( currency::code( "NOK" ) == currency::internal_::code_enum::c_NOK );
+static_assert( currency::code( "MXN" ) == currency::internal_::code_enum::c_MXN );
+static_assert( currency::code( "CZK" ) == currency::internal_::code_enum::c_CZK );
+static_assert( currency::code( "MYR" ) == currency::internal_::code_enum::c_MYR );
+static_assert( currency::code( "CNY" ) == currency::internal_::code_enum::c_CNY );
+static_assert( currency::code( "IDR" ) == currency::internal_::code_enum::c_IDR );
+static_assert( currency::code( "THB" ) == currency::internal_::code_enum::c_THB );
+static_assert( currency::code( "SGD" ) == currency::internal_::code_enum::c_SGD );
+static_assert( currency::code( "EUR" ) == currency::internal_::code_enum::c_EUR );
+static_assert( currency::code( "ZAR" ) == currency::internal_::code_enum::c_ZAR );
+static_assert( currency::code( "KRW" ) == currency::internal_::code_enum::c_KRW );
+static_assert( currency::code( "ILS" ) == currency::internal_::code_enum::c_ILS );
+static_assert( currency::code( "INR" ) == currency::internal_::code_enum::c_INR );
+static_assert( currency::code( "JPY" ) == currency::internal_::code_enum::c_JPY );
+static_assert( currency::code( "GBP" ) == currency::internal_::code_enum::c_GBP );
+static_assert( currency::code( "CAD" ) == currency::internal_::code_enum::c_CAD );
+static_assert( currency::code( "CHF" ) == currency::internal_::code_enum::c_CHF );
+static_assert( currency::code( "NZD" ) == currency::internal_::code_enum::c_NZD );
+static_assert( currency::code( "USD" ) == currency::internal_::code_enum::c_USD );
+static_assert( currency::code( "AUD" ) == currency::internal_::code_enum::c_AUD );
+static_assert( currency::code( "TWD" ) == currency::internal_::code_enum::c_TWD );
+static_assert( currency::code( "TRY" ) == currency::internal_::code_enum::c_TRY );
+static_assert( currency::code( "HUF" ) == currency::internal_::code_enum::c_HUF );
+static_assert( currency::code( "PHP" ) == currency::internal_::code_enum::c_PHP );
+static_assert( currency::code( "SAR" ) == currency::internal_::code_enum::c_SAR );
+static_assert( currency::code( "BRL" ) == currency::internal_::code_enum::c_BRL );
+static_assert( currency::code( "PLN" ) == currency::internal_::code_enum::c_PLN );
+static_assert( currency::code_unchecked( "DKK" ) == currency::internal_::code_enum::c_DKK );
+static_assert( currency::code_unchecked( "AED" ) == currency::internal_::code_enum::c_AED );
+static_assert( currency::code_unchecked( "HKD" ) == currency::internal_::code_enum::c_HKD );
+static_assert( currency::code_unchecked( "RUB" ) == currency::internal_::code_enum::c_RUB );
+static_assert( currency::code_unchecked( "SEK" ) == currency::internal_::code_enum::c_SEK );
+static_assert( currency::code_unchecked( "NOK" ) == currency::internal_::code_enum::c_NOK );
+static_assert( currency::code_unchecked( "MXN" ) == currency::internal_::code_enum::c_MXN );
+static_assert( currency::code_unchecked( "CZK" ) == currency::internal_::code_enum::c_CZK );
+static_assert( currency::code_unchecked( "MYR" ) == currency::internal_::code_enum::c_MYR );
+static_assert( currency::code_unchecked( "CNY" ) == currency::internal_::code_enum::c_CNY );
+static_assert( currency::code_unchecked( "IDR" ) == currency::internal_::code_enum::c_IDR );
+static_assert( currency::code_unchecked( "THB" ) == currency::internal_::code_enum::c_THB );
+static_assert( currency::code_unchecked( "SGD" ) == currency::internal_::code_enum::c_SGD );
+static_assert( currency::code_unchecked( "EUR" ) == currency::internal_::code_enum::c_EUR );
+static_assert( currency::code_unchecked( "ZAR" ) == currency::internal_::code_enum::c_ZAR );
+static_assert( currency::code_unchecked( "KRW" ) == currency::internal_::code_enum::c_KRW );
+static_assert( currency::code_unchecked( "ILS" ) == currency::internal_::code_enum::c_ILS );
+static_assert( currency::code_unchecked( "INR" ) == currency::internal_::code_enum::c_INR );
+static_assert( currency::code_unchecked( "JPY" ) == currency::internal_::code_enum::c_JPY );
+static_assert( currency::code_unchecked( "GBP" ) == currency::internal_::code_enum::c_GBP );
+static_assert( currency::code_unchecked( "CAD" ) == currency::internal_::code_enum::c_CAD );
+static_assert( currency::code_unchecked( "CHF" ) == currency::internal_::code_enum::c_CHF );
+static_assert( currency::code_unchecked( "NZD" ) == currency::internal_::code_enum::c_NZD );
+static_assert( currency::code_unchecked( "USD" ) == currency::internal_::code_enum::c_USD );
+static_assert( currency::code_unchecked( "AUD" ) == currency::internal_::code_enum::c_AUD );
+static_assert( currency::code_unchecked( "TWD" ) == currency::internal_::code_enum::c_TWD );
+static_assert( currency::code_unchecked( "TRY" ) == currency::internal_::code_enum::c_TRY );
+static_assert( currency::code_unchecked( "HUF" ) == currency::internal_::code_enum::c_HUF );
+static_assert( currency::code_unchecked( "PHP" ) == currency::internal_::code_enum::c_PHP );
+static_assert( currency::code_unchecked( "SAR" ) == currency::internal_::code_enum::c_SAR );
+static_assert( currency::code_unchecked( "BRL" ) == currency::internal_::code_enum::c_BRL );
+static_assert( currency::code_unchecked( "PLN" ) == currency::internal_::code_enum::c_PLN );
+
+#endif // CURRENCY__CODE_HPP_
@@ -0,0 +1,241 @@
+#ifndef SMTP__COMMAND_HPP_
+#define SMTP__COMMAND_HPP_
+
+#include <array>
+#include <cstring>
+#include <string_view>
+
+namespace smtp {
+
+namespace internal_ {
+
+enum class command_enum
+{
+    default_ = -1,
+    c_VRFY = 0,
+    c_RSET = 1,
+    c_QUIT = 2,
+    c_NOOP = 3,
+    c_STARTTLS = 4,
+    c_RCPT = 5,
+    c_DATA = 6,
+    c_MAIL = 7,
+    c_HELO = 8,
+    c_EHLO = 9,
+    c_AUTH = 10,
+};
+
+} // namespace internal_
+
+// Number of keywords, enum values other than the default are in [ 0, command_count )
+constexpr size_t command_count = 11;
+
+constexpr internal_::command_enum command( std::string_view s );
+
+namespace internal_ {
+
+constexpr std::array< int, 257 > asso_values = {
+        15,    15,    15,    15,    15,    15,    15,    15,    15,    15,
+        15,    15,    15,    15,    15,    15,    15,    15,    15,    15,
+        15,    15,    15,    15,    15,    15,    15,    15,    15,    15,
+        15,    15,    15,    15,    15,    15,    15,    15,    15,    15,
+        15,    15,    15,    15,    15,    15,    15,    15,    15,    15,
+        15,    15,    15,    15,    15,    15,    15,    15,    15,    15,
+        15,    15,    15,    15,    15,    10,     2,    15,     4,     5,
+         4,    15,     4,     4,    15,    15,    15,     5,     2,    15,
+         1,     2,     1,     0,     0,     0,     0,    15,    15,    15,
+        15,    15,    15,    15,    15,    15,    15,    15,    15,    15,
+        15,    15,    15,    15,    15,    15,    15,    15,    15,    15,
+        15,    15,    15,    15,    15,    15,    15,    15,    15,    15,
+        15,    15,    15,    15,    15,    15,    15,    15,    15,    15,
+        15,    15,    15,    15,    15,    15,    15,    15,    15,    15,
+        15,    15,    15,    15,    15,    15,    15,    15,    15,    15,
+        15,    15,    15,    15,    15,    15,    15,    15,    15,    15,
+        15,    15,    15,    15,    15,    15,    15,    15,    15,    15,
+        15,    15,    15,    15,    15,    15,    15,    15,    15,    15,
+        15,    15,    15,    15,    15,    15,    15,    15,    15,    15,
+        15,    15,    15,    15,    15,    15,    15,    15,    15,    15,
+        15,    15,    15,    15,    15,    15,    15,    15,    15,    15,
+        15,    15,    15,    15,    15,    15,    15,    15,    15,    15,
+        15,    15,    15,    15,    15,    15,    15,    15,    15,    15,
+        15,    15,    15,    15,    15,    15,    15,    15,    15,    15,
+        15,    15,    15,    15,    15,    15,    15,    15,    15,    15,
+        15,    15,    15,    15,    15,    15,    15,
+};
+
+struct word_entry
+{
+    std::string_view word;
+    command_enum enum_val;
+};
+
+constexpr std::array< word_entry, 15 > wordlist = {{
+    { "", command_enum::default_ },
+    { "", command_enum::default_ },
+    { "", command_enum::default_ },
+    { "", command_enum::default_ },
+    { "VRFY", command_enum::c_VRFY },
+    { "RSET", command_enum::c_RSET },
+    { "QUIT", command_enum::c_QUIT },
+    { "NOOP", command_enum::c_NOOP },
+    { "STARTTLS", command_enum::c_STARTTLS },
+    { "RCPT", command_enum::c_RCPT },
+    { "DATA", command_enum::c_DATA },
+    { "MAIL", command_enum::c_MAIL },
+    { "HELO", command_enum::c_HELO },
+    { "EHLO", command_enum::c_EHLO },
+    { "AUTH", command_enum::c_AUTH },
+}};
+
+} // namespace internal_
+
+constexpr internal_::command_enum command( std::string_view s )
+{
+    constexpr size_t MinWordLength = 4;
+    constexpr size_t MaxWordLength = 8;
+    constexpr size_t MaxHashValue = 14;
+
+    if ( s.size() < MinWordLength || s.size() > MaxWordLength )
+    {
+        return internal_::command_enum::default_;
+    }
+
+    size_t hash_val = s.size();
+    switch( s.size() )
+    {
+                       case 8:
+    [[ fallthrough ]]; case 7:
+    [[ fallthrough ]]; case 6:
+    [[ fallthrough ]]; case 5:
+    [[ fallthrough ]]; case 4:
+    [[ fallthrough ]]; case 3:
+    [[ fallthrough ]]; case 2:
+        hash_val += internal_::asso_values[ static_cast< unsigned char >( s[ 1] ) + 1 ];
+    [[ fallthrough ]]; case 1:
+        hash_val += internal_::asso_values[ static_cast< unsigned char >( s[ 0] ) ];
+    }
+
+    if ( hash_val <= MaxHashValue )
+    {
+        const size_t slot = hash_val;
+        if ( internal_::wordlist[ slot ].word == s )
+        {
+            return internal_::wordlist[ slot ].enum_val;
+        }
+    }
+    return internal_::command_enum::default_;
+}
+
+// Runs the handler of keyword s, the default statement if s is not a keyword
+inline bool command_dispatch( std::string_view s, Session &session, std::string_view args )
+{
+    constexpr size_t MinWordLength = 4;
+    constexpr size_t MaxWordLength = 8;
+
+    if ( s.size() >= MinWordLength && s.size() <= MaxWordLength )
+    {
+        size_t hash_val = s.size();
+        switch( s.size() )
+        {
+                           case 8:
+        [[ fallthrough ]]; case 7:
+        [[ fallthrough ]]; case 6:
+        [[ fallthrough ]]; case 5:
+        [[ fallthrough ]]; case 4:
+        [[ fallthrough ]]; case 3:
+        [[ fallthrough ]]; case 2:
+            hash_val += internal_::asso_values[ static_cast< unsigned char >( s[ 1] ) + 1 ];
+        [[ fallthrough ]]; case 1:
+            hash_val += internal_::asso_values[ static_cast< unsigned char >( s[ 0] ) ];
+        }
+
+        switch ( hash_val )
+        {
+        case 4:
+            if ( s.size() == 4 && std::memcmp( s.data(), "VRFY", 4 ) == 0 )
+            {
+                return false;
+            }
+            break;
+        case 5:
+            if ( s.size() == 4 && std::memcmp( s.data(), "RSET", 4 ) == 0 )
+            {
+                session.reset(); return true;
+            }
+            break;
+        case 6:
+            if ( s.size() == 4 && std::memcmp( s.data(), "QUIT", 4 ) == 0 )
+            {
+                session.open = false; return true;
+            }
+            break;
+        case 7:
+            if ( s.size() == 4 && std::memcmp( s.data(), "NOOP", 4 ) == 0 )
+            {
+                return true;
+            }
+            break;
+        case 8:
+            if ( s.size() == 8 && std::memcmp( s.data(), "STARTTLS", 8 ) == 0 )
+            {
+                return session.start_tls();
+            }
+            break;
+        case 9:
+            if ( s.size() == 4 && std::memcmp( s.data(), "RCPT", 4 ) == 0 )
+            {
+                return session.rcpt( args );
+            }
+            break;
+        case 10:
+            if ( s.size() == 4 && std::memcmp( s.data(), "DATA", 4 ) == 0 )
+            {
+                return session.data();
+            }
+            break;
+        case 11:
+            if ( s.size() == 4 && std::memcmp( s.data(), "MAIL", 4 ) == 0 )
+            {
+                return session.mail( args );
+            }
+            break;
+        case 12:
+            if ( s.size() == 4 && std::memcmp( s.data(), "HELO", 4 ) == 0 )
+            {
+                return session.hello( args );
+            }
+            break;
+        case 13:
+            if ( s.size() == 4 && std::memcmp( s.data(), "EHLO", 4 ) == 0 )
+            {
+                return session.hello( args );
+            }
+            break;
+        case 14:
+            if ( s.size() == 4 && std::memcmp( s.data(), "AUTH", 4 ) == 0 )
+            {
+                return session.auth( args );
+            }
+            break;
+        }
+    }
+
+    return session.unknown();
+}
+
+} // namespace smtp {
+
+// Extra check for safety
+static_assert( smtp::command( "VRFY" ) == smtp::internal_::command_enum::c_VRFY );
+static_assert( smtp::command( "RSET" ) == smtp::internal_::command_enum::c_RSET );
+static_assert( smtp::command( "QUIT" ) == smtp::internal_::command_enum::c_QUIT );
+static_assert( smtp::command( "NOOP" ) == smtp::internal_::command_enum::c_NOOP );
+static_assert( smtp::command( "STARTTLS" ) == smtp::internal_::command_enum::c_STARTTLS );
+static_assert( smtp::command( "RCPT" ) == smtp::internal_::command_enum::c_RCPT );
+static_assert( smtp::command( "DATA" ) == smtp::internal_::command_enum::c_DATA );
+static_assert( smtp::command( "MAIL" ) == smtp::internal_::command_enum::c_MAIL );
+static_assert( smtp::command( "HELO" ) == smtp::internal_::command_enum::c_HELO );
+static_assert( smtp::command( "EHLO" ) == smtp::internal_::command_enum::c_EHLO );
+static_assert( smtp::command( "AUTH" ) == smtp::internal_::command_enum::c_AUTH );
+
+#endif // SMTP__COMMAND_HPP_
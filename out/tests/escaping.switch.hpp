@@ -0,0 +1,251 @@
+#ifndef __HASH_HPP_
+#define __HASH_HPP_
+
+#include <array>
+#include <string_view>
+
+
+namespace internal_ {
+
+enum class hash_enum
+{
+    default_ = -1,
+    c_qwe_qwe = 0,
+    c_default_ = 1,
+    c_Quotes___ = 2,
+    c_qwe_qwe_0 = 3,
+    c_Backslash__ = 4,
+    c_222222222 = 5,
+    c_123123132 = 6,
+    c_qwe_qwe_1 = 7,
+    c_qwe_qwe_2 = 8,
+    c_String_with_tabs = 9,
+    c_String_with_spaces = 10,
+    c_Some_punctuation_chars________________ = 11,
+    c_UTF_8_stuff__emoji__________________________________________ = 12,
+    c_Control_chars_________________________________except_newline___ = 13,
+};
+
+} // namespace internal_
+
+// Number of keywords, enum values other than the default are in [ 0, hash_count )
+constexpr size_t hash_count = 14;
+
+constexpr internal_::hash_enum hash( std::string_view s );
+
+namespace internal_ {
+
+constexpr std::array< int, 256 > asso_values = {
+        64,    64,    64,    64,    64,    64,    64,    64,    64,    64,
+        64,    64,    64,    64,    64,    64,    64,    64,    64,    64,
+        64,    64,    64,    64,    64,    64,    64,    64,    64,    64,
+        64,    64,     8,    64,    64,    64,    64,    64,    64,    64,
+        64,    64,    64,     7,    64,     0,    64,    64,    64,     4,
+         3,    64,    64,    64,    64,    64,    64,    64,    64,    64,
+        64,    64,    64,    64,    64,    64,    64,    64,    64,    64,
+        64,    64,    64,    64,    64,    64,    64,    64,    64,    64,
+        64,    64,    64,    64,    64,    64,    64,    64,    64,    64,
+        64,    64,    64,    64,    64,     3,    64,     0,    64,    64,
+        64,     0,    64,    64,    64,     0,    64,     0,    64,    64,
+        64,    64,    64,    64,    64,    64,     0,    64,    64,    64,
+        64,    64,    64,    64,    64,    64,    64,    64,    64,    64,
+        64,    64,    64,    64,    64,    64,    64,    64,    64,    64,
+        64,    64,    64,    64,    64,    64,    64,    64,    64,    64,
+        64,    64,    64,    64,    64,    64,    64,    64,    64,    64,
+        64,    64,    64,    64,    64,    64,    64,    64,    64,    64,
+        64,    64,    64,    64,    64,    64,    64,    64,    64,    64,
+        64,    64,    64,    64,    64,    64,    64,    64,    64,    64,
+        64,    64,    64,    64,    64,    64,    64,    64,    64,    64,
+        64,    64,    64,    64,    64,    64,    64,    64,    64,    64,
+        64,    64,    64,    64,    64,    64,    64,    64,    64,    64,
+        64,    64,    64,    64,    64,    64,    64,    64,    64,    64,
+        64,    64,    64,    64,    64,    64,    64,    64,    64,    64,
+        64,    64,    64,    64,    64,    64,    64,    64,    64,    64,
+        64,    64,    64,    64,    64,    64,
+};
+
+struct word_entry
+{
+    std::string_view word;
+    hash_enum enum_val;
+};
+
+constexpr std::array< word_entry, 64 > wordlist = {{
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "qwe-qwe", hash_enum::c_qwe_qwe },
+    { "default_", hash_enum::c_default_ },
+    { "Quotes \"\'", hash_enum::c_Quotes___ },
+    { "qwe_qwe", hash_enum::c_qwe_qwe_0 },
+    { "Backslash \\", hash_enum::c_Backslash__ },
+    { "222222222", hash_enum::c_222222222 },
+    { "123123132", hash_enum::c_123123132 },
+    { "qwe+qwe", hash_enum::c_qwe_qwe_1 },
+    { "qwe qwe", hash_enum::c_qwe_qwe_2 },
+    { "String\x09with\x09tabs", hash_enum::c_String_with_tabs },
+    { "", hash_enum::default_ },
+    { "String with spaces", hash_enum::c_String_with_spaces },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "Some punctuation chars: !@#$%^&*(){}[]", hash_enum::c_Some_punctuation_chars________________ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "UTF-8 stuff (emoji): \xF0\x9F\xA4\x90 \xF0\x9F\xA4\x91 \xF0\x9F\xA4\x92 \xF0\x9F\xA4\x93 \xF0\x9F\xA4\x94 \xF0\x9F\xA4\x95 \xF0\x9F\xA4\x96 \xF0\x9F\xA4\x97", hash_enum::c_UTF_8_stuff__emoji__________________________________________ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "Control chars \x01\x02\x03\x04\x05\x06\x07\x08\x09\x0B\x0C\x0D\x0E\x0F\x10\x11\x12\x13\x14\x15\x16\x17\x18\x19\x1A\x1B\x1C\x1D\x1E\x1F (except newline) !", hash_enum::c_Control_chars_________________________________except_newline___ },
+}};
+
+} // namespace internal_
+
+constexpr internal_::hash_enum hash( std::string_view s )
+{
+    constexpr size_t MinWordLength = 7;
+    constexpr size_t MaxWordLength = 63;
+    constexpr size_t MaxHashValue = 63;
+
+    if ( s.size() < MinWordLength || s.size() > MaxWordLength )
+    {
+        return internal_::hash_enum::default_;
+    }
+
+    size_t hash_val = s.size();
+    switch( s.size() )
+    {
+                       case 63:
+    [[ fallthrough ]]; case 62:
+    [[ fallthrough ]]; case 61:
+    [[ fallthrough ]]; case 60:
+    [[ fallthrough ]]; case 59:
+    [[ fallthrough ]]; case 58:
+    [[ fallthrough ]]; case 57:
+    [[ fallthrough ]]; case 56:
+    [[ fallthrough ]]; case 55:
+    [[ fallthrough ]]; case 54:
+    [[ fallthrough ]]; case 53:
+    [[ fallthrough ]]; case 52:
+    [[ fallthrough ]]; case 51:
+    [[ fallthrough ]]; case 50:
+    [[ fallthrough ]]; case 49:
+    [[ fallthrough ]]; case 48:
+    [[ fallthrough ]]; case 47:
+    [[ fallthrough ]]; case 46:
+    [[ fallthrough ]]; case 45:
+    [[ fallthrough ]]; case 44:
+    [[ fallthrough ]]; case 43:
+    [[ fallthrough ]]; case 42:
+    [[ fallthrough ]]; case 41:
+    [[ fallthrough ]]; case 40:
+    [[ fallthrough ]]; case 39:
+    [[ fallthrough ]]; case 38:
+    [[ fallthrough ]]; case 37:
+    [[ fallthrough ]]; case 36:
+    [[ fallthrough ]]; case 35:
+    [[ fallthrough ]]; case 34:
+    [[ fallthrough ]]; case 33:
+    [[ fallthrough ]]; case 32:
+    [[ fallthrough ]]; case 31:
+    [[ fallthrough ]]; case 30:
+    [[ fallthrough ]]; case 29:
+    [[ fallthrough ]]; case 28:
+    [[ fallthrough ]]; case 27:
+    [[ fallthrough ]]; case 26:
+    [[ fallthrough ]]; case 25:
+    [[ fallthrough ]]; case 24:
+    [[ fallthrough ]]; case 23:
+    [[ fallthrough ]]; case 22:
+    [[ fallthrough ]]; case 21:
+    [[ fallthrough ]]; case 20:
+    [[ fallthrough ]]; case 19:
+    [[ fallthrough ]]; case 18:
+    [[ fallthrough ]]; case 17:
+    [[ fallthrough ]]; case 16:
+    [[ fallthrough ]]; case 15:
+    [[ fallthrough ]]; case 14:
+    [[ fallthrough ]]; case 13:
+    [[ fallthrough ]]; case 12:
+    [[ fallthrough ]]; case 11:
+    [[ fallthrough ]]; case 10:
+    [[ fallthrough ]]; case 9:
+    [[ fallthrough ]]; case 8:
+    [[ fallthrough ]]; case 7:
+    [[ fallthrough ]]; case 6:
+    [[ fallthrough ]]; case 5:
+    [[ fallthrough ]]; case 4:
+        hash_val += internal_::asso_values[ static_cast< unsigned char >( s[ 3] ) ];
+    [[ fallthrough ]]; case 3:
+    [[ fallthrough ]]; case 2:
+    [[ fallthrough ]]; case 1:
+        ; // Prevent compiler error
+    }
+
+    if ( hash_val <= MaxHashValue )
+    {
+        const size_t slot = hash_val;
+        if ( internal_::wordlist[ slot ].word == s )
+        {
+            return internal_::wordlist[ slot ].enum_val;
+        }
+    }
+    return internal_::hash_enum::default_;
+}
+
+
+// Extra check for safety
+static_assert( ::hash( "qwe-qwe" ) == ::internal_::hash_enum::c_qwe_qwe );
+static_assert( ::hash( "default_" ) == ::internal_::hash_enum::c_default_ );
+static_assert( ::hash( "Quotes \"\'" ) == ::internal_::hash_enum::c_Quotes___ );
+static_assert( ::hash( "qwe_qwe" ) == ::internal_::hash_enum::c_qwe_qwe_0 );
+static_assert( ::hash( "Backslash \\" ) == ::internal_::hash_enum::c_Backslash__ );
+static_assert( ::hash( "222222222" ) == ::internal_::hash_enum::c_222222222 );
+static_assert( ::hash( "123123132" ) == ::internal_::hash_enum::c_123123132 );
+static_assert( ::hash( "qwe+qwe" ) == ::internal_::hash_enum::c_qwe_qwe_1 );
+static_assert( ::hash( "qwe qwe" ) == ::internal_::hash_enum::c_qwe_qwe_2 );
+static_assert( ::hash( "String\x09with\x09tabs" ) == ::internal_::hash_enum::c_String_with_tabs );
+static_assert( ::hash( "String with spaces" ) == ::internal_::hash_enum::c_String_with_spaces );
+static_assert( ::hash( "Some punctuation chars: !@#$%^&*(){}[]" ) == ::internal_::hash_enum::c_Some_punctuation_chars________________ );
+static_assert( ::hash( "UTF-8 stuff (emoji): \xF0\x9F\xA4\x90 \xF0\x9F\xA4\x91 \xF0\x9F\xA4\x92 \xF0\x9F\xA4\x93 \xF0\x9F\xA4\x94 \xF0\x9F\xA4\x95 \xF0\x9F\xA4\x96 \xF0\x9F\xA4\x97" ) == ::internal_::hash_enum::c_UTF_8_stuff__emoji__________________________________________ );
+static_assert( ::hash( "Control chars \x01\x02\x03\x04\x05\x06\x07\x08\x09\x0B\x0C\x0D\x0E\x0F\x10\x11\x12\x13\x14\x15\x16\x17\x18\x19\x1A\x1B\x1C\x1D\x1E\x1F (except newline) !" ) == ::internal_::hash_enum::c_Control_chars_________________________________except_newline___ );
+
+#endif // __HASH_HPP_
@@ -0,0 +1,596 @@
+#ifndef FIND_ALL__HASH_HPP_
+#define FIND_ALL__HASH_HPP_
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+#if defined( __GNUC__ ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+#include <immintrin.h>
+#endif
+
+namespace find_all {
+
+namespace internal_ {
+
+enum class hash_enum
+{
+    default_ = -1,
+    c_Age = 0,
+    c_Allow = 1,
+    c_Cookie = 2,
+    c_Accept = 3,
+    c_Connection = 4,
+    c_Content_Type = 5,
+    c_Content_Range = 6,
+    c_Authorization = 7,
+    c_Accept_Language = 8,
+    c_Content_Language = 9,
+    c_Content_Location = 10,
+    c_Accept_Charset = 11,
+    c_Accept_Ranges = 12,
+    c_Content_Disposition = 13,
+    c_Cache_Control = 14,
+    c_Access_Control_Max_Age = 15,
+    c_Accept_Encoding = 16,
+    c_Content_Encoding = 17,
+    c_Expect = 18,
+    c_TE = 19,
+    c_ETag = 20,
+    c_Expires = 21,
+    c_Timing_Allow_Origin = 22,
+    c_Set_Cookie = 23,
+    c_Range = 24,
+    c_X_XSS_Protection = 25,
+    c_Expect_CT = 26,
+    c_Transfer_Encoding = 27,
+    c_X_Forwarded_Host = 28,
+    c_X_Frame_Options = 29,
+    c_Trailer = 30,
+    c_Access_Control_Allow_Credentials = 31,
+    c_If_Range = 32,
+    c_Access_Control_Request_Headers = 33,
+    c_Server_Timing = 34,
+    c_Referrer_Policy = 35,
+    c_Proxy_Authenticate = 36,
+    c_Sec_WebSocket_Accept = 37,
+    c_Proxy_Authorization = 38,
+    c_Public_Key_Pins = 39,
+    c_Server = 40,
+    c_If_Modified_Since = 41,
+    c_X_Content_Type_Options = 42,
+    c_If_Unmodified_Since = 43,
+    c_X_Forwarded_For = 44,
+    c_Content_Length = 45,
+    c_X_DNS_Prefetch_Control = 46,
+    c_Referer = 47,
+    c_Location = 48,
+    c_Clear_Site_Data = 49,
+    c_Public_Key_Pins_Report_Only = 50,
+    c_Retry_After = 51,
+    c_Access_Control_Request_Method = 52,
+    c_Vary = 53,
+    c_Content_Security_Policy = 54,
+    c_User_Agent = 55,
+    c_Large_Allocation = 56,
+    c_Warning = 57,
+    c_WWW_Authenticate = 58,
+    c_Origin = 59,
+    c_Strict_Transport_Security = 60,
+    c_Host = 61,
+    c_Feature_Policy = 62,
+    c_Date = 63,
+    c_Cookie2 = 64,
+    c_Pragma = 65,
+    c_Content_Security_Policy_Report_Only = 66,
+    c_SourceMap = 67,
+    c_X_Forwarded_Proto = 68,
+    c_From = 69,
+    c_If_Match = 70,
+    c_DNT = 71,
+    c_Upgrade_Insecure_Requests = 72,
+    c_Tk = 73,
+    c_Access_Control_Allow_Methods = 74,
+    c_If_None_Match = 75,
+    c_Keep_Alive = 76,
+    c_Access_Control_Expose_Headers = 77,
+    c_Last_Modified = 78,
+    c_Access_Control_Allow_Origin = 79,
+    c_Forwarded = 80,
+    c_Access_Control_Allow_Headers = 81,
+    c_Set_Cookie2 = 82,
+    c_Via = 83,
+};
+
+} // namespace internal_
+
+// Number of keywords, enum values other than the default are in [ 0, hash_count )
+constexpr size_t hash_count = 84;
+
+constexpr internal_::hash_enum hash( std::string_view s );
+
+namespace internal_ {
+
+constexpr std::array< int, 256 > asso_values = {
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,    49,   100,   100,   100,   100,
+        64,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,     0,   100,     0,    66,    15,
+        54,   100,    60,    31,   100,    73,    46,    47,   100,    59,
+        25,   100,    26,    20,     9,    48,    55,    49,    15,   100,
+       100,   100,   100,   100,   100,   100,   100,    41,   100,    37,
+        26,     0,   100,     8,    38,   100,   100,    69,     8,    18,
+         1,    43,    45,   100,    21,     6,     4,   100,   100,     0,
+       100,     1,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,
+};
+
+struct word_entry
+{
+    std::string_view word;
+    hash_enum enum_val;
+};
+
+constexpr std::array< word_entry, 100 > wordlist = {{
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "Age", hash_enum::c_Age },
+    { "", hash_enum::default_ },
+    { "Allow", hash_enum::c_Allow },
+    { "Cookie", hash_enum::c_Cookie },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "Accept", hash_enum::c_Accept },
+    { "Connection", hash_enum::c_Connection },
+    { "Content-Type", hash_enum::c_Content_Type },
+    { "Content-Range", hash_enum::c_Content_Range },
+    { "Authorization", hash_enum::c_Authorization },
+    { "Accept-Language", hash_enum::c_Accept_Language },
+    { "Content-Language", hash_enum::c_Content_Language },
+    { "Content-Location", hash_enum::c_Content_Location },
+    { "Accept-Charset", hash_enum::c_Accept_Charset },
+    { "Accept-Ranges", hash_enum::c_Accept_Ranges },
+    { "Content-Disposition", hash_enum::c_Content_Disposition },
+    { "Cache-Control", hash_enum::c_Cache_Control },
+    { "Access-Control-Max-Age", hash_enum::c_Access_Control_Max_Age },
+    { "Accept-Encoding", hash_enum::c_Accept_Encoding },
+    { "Content-Encoding", hash_enum::c_Content_Encoding },
+    { "Expect", hash_enum::c_Expect },
+    { "TE", hash_enum::c_TE },
+    { "ETag", hash_enum::c_ETag },
+    { "Expires", hash_enum::c_Expires },
+    { "Timing-Allow-Origin", hash_enum::c_Timing_Allow_Origin },
+    { "Set-Cookie", hash_enum::c_Set_Cookie },
+    { "Range", hash_enum::c_Range },
+    { "X-XSS-Protection", hash_enum::c_X_XSS_Protection },
+    { "Expect-CT", hash_enum::c_Expect_CT },
+    { "Transfer-Encoding", hash_enum::c_Transfer_Encoding },
+    { "X-Forwarded-Host", hash_enum::c_X_Forwarded_Host },
+    { "X-Frame-Options", hash_enum::c_X_Frame_Options },
+    { "Trailer", hash_enum::c_Trailer },
+    { "Access-Control-Allow-Credentials", hash_enum::c_Access_Control_Allow_Credentials },
+    { "If-Range", hash_enum::c_If_Range },
+    { "Access-Control-Request-Headers", hash_enum::c_Access_Control_Request_Headers },
+    { "Server-Timing", hash_enum::c_Server_Timing },
+    { "Referrer-Policy", hash_enum::c_Referrer_Policy },
+    { "Proxy-Authenticate", hash_enum::c_Proxy_Authenticate },
+    { "Sec-WebSocket-Accept", hash_enum::c_Sec_WebSocket_Accept },
+    { "Proxy-Authorization", hash_enum::c_Proxy_Authorization },
+    { "Public-Key-Pins", hash_enum::c_Public_Key_Pins },
+    { "Server", hash_enum::c_Server },
+    { "If-Modified-Since", hash_enum::c_If_Modified_Since },
+    { "X-Content-Type-Options", hash_enum::c_X_Content_Type_Options },
+    { "If-Unmodified-Since", hash_enum::c_If_Unmodified_Since },
+    { "X-Forwarded-For", hash_enum::c_X_Forwarded_For },
+    { "Content-Length", hash_enum::c_Content_Length },
+    { "X-DNS-Prefetch-Control", hash_enum::c_X_DNS_Prefetch_Control },
+    { "Referer", hash_enum::c_Referer },
+    { "Location", hash_enum::c_Location },
+    { "Clear-Site-Data", hash_enum::c_Clear_Site_Data },
+    { "Public-Key-Pins-Report-Only", hash_enum::c_Public_Key_Pins_Report_Only },
+    { "Retry-After", hash_enum::c_Retry_After },
+    { "Access-Control-Request-Method", hash_enum::c_Access_Control_Request_Method },
+    { "Vary", hash_enum::c_Vary },
+    { "Content-Security-Policy", hash_enum::c_Content_Security_Policy },
+    { "User-Agent", hash_enum::c_User_Agent },
+    { "Large-Allocation", hash_enum::c_Large_Allocation },
+    { "Warning", hash_enum::c_Warning },
+    { "WWW-Authenticate", hash_enum::c_WWW_Authenticate },
+    { "Origin", hash_enum::c_Origin },
+    { "Strict-Transport-Security", hash_enum::c_Strict_Transport_Security },
+    { "Host", hash_enum::c_Host },
+    { "Feature-Policy", hash_enum::c_Feature_Policy },
+    { "Date", hash_enum::c_Date },
+    { "Cookie2", hash_enum::c_Cookie2 },
+    { "Pragma", hash_enum::c_Pragma },
+    { "Content-Security-Policy-Report-Only", hash_enum::c_Content_Security_Policy_Report_Only },
+    { "SourceMap", hash_enum::c_SourceMap },
+    { "X-Forwarded-Proto", hash_enum::c_X_Forwarded_Proto },
+    { "From", hash_enum::c_From },
+    { "If-Match", hash_enum::c_If_Match },
+    { "DNT", hash_enum::c_DNT },
+    { "Upgrade-Insecure-Requests", hash_enum::c_Upgrade_Insecure_Requests },
+    { "Tk", hash_enum::c_Tk },
+    { "Access-Control-Allow-Methods", hash_enum::c_Access_Control_Allow_Methods },
+    { "If-None-Match", hash_enum::c_If_None_Match },
+    { "Keep-Alive", hash_enum::c_Keep_Alive },
+    { "Access-Control-Expose-Headers", hash_enum::c_Access_Control_Expose_Headers },
+    { "Last-Modified", hash_enum::c_Last_Modified },
+    { "", hash_enum::default_ },
+    { "Access-Control-Allow-Origin", hash_enum::c_Access_Control_Allow_Origin },
+    { "", hash_enum::default_ },
+    { "Forwarded", hash_enum::c_Forwarded },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "Access-Control-Allow-Headers", hash_enum::c_Access_Control_Allow_Headers },
+    { "Set-Cookie2", hash_enum::c_Set_Cookie2 },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "Via", hash_enum::c_Via },
+}};
+
+} // namespace internal_
+
+constexpr internal_::hash_enum hash( std::string_view s )
+{
+    constexpr size_t MinWordLength = 2;
+    constexpr size_t MaxWordLength = 35;
+    constexpr size_t MaxHashValue = 99;
+
+    if ( s.size() < MinWordLength || s.size() > MaxWordLength )
+    {
+        return internal_::hash_enum::default_;
+    }
+
+    size_t hash_val = s.size();
+    hash_val += internal_::asso_values[ static_cast< unsigned char >( s[ s.size() - 1 ] ) ];
+    switch( s.size() )
+    {
+                       case 35:
+    [[ fallthrough ]]; case 34:
+    [[ fallthrough ]]; case 33:
+    [[ fallthrough ]]; case 32:
+    [[ fallthrough ]]; case 31:
+    [[ fallthrough ]]; case 30:
+    [[ fallthrough ]]; case 29:
+    [[ fallthrough ]]; case 28:
+    [[ fallthrough ]]; case 27:
+    [[ fallthrough ]]; case 26:
+    [[ fallthrough ]]; case 25:
+    [[ fallthrough ]]; case 24:
+    [[ fallthrough ]]; case 23:
+    [[ fallthrough ]]; case 22:
+        hash_val += internal_::asso_values[ static_cast< unsigned char >( s[ 21] ) ];
+    [[ fallthrough ]]; case 21:
+    [[ fallthrough ]]; case 20:
+    [[ fallthrough ]]; case 19:
+    [[ fallthrough ]]; case 18:
+    [[ fallthrough ]]; case 17:
+    [[ fallthrough ]]; case 16:
+    [[ fallthrough ]]; case 15:
+    [[ fallthrough ]]; case 14:
+    [[ fallthrough ]]; case 13:
+    [[ fallthrough ]]; case 12:
+    [[ fallthrough ]]; case 11:
+    [[ fallthrough ]]; case 10:
+    [[ fallthrough ]]; case 9:
+    [[ fallthrough ]]; case 8:
+    [[ fallthrough ]]; case 7:
+    [[ fallthrough ]]; case 6:
+    [[ fallthrough ]]; case 5:
+    [[ fallthrough ]]; case 4:
+    [[ fallthrough ]]; case 3:
+    [[ fallthrough ]]; case 2:
+    [[ fallthrough ]]; case 1:
+        hash_val += internal_::asso_values[ static_cast< unsigned char >( s[ 0] ) ];
+    }
+
+    if ( hash_val <= MaxHashValue )
+    {
+        const size_t slot = hash_val;
+        if ( internal_::wordlist[ slot ].word == s )
+        {
+            return internal_::wordlist[ slot ].enum_val;
+        }
+    }
+    return internal_::hash_enum::default_;
+}
+
+namespace internal_ {
+
+// Masks of buckets having a keyword starting with a byte, by the byte
+constexpr std::array< uint8_t, 256 > first_masks = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0f, 0x00, 0x70, 0x81, 0x06, 0x38, 0x00, 0x40, 0x80, 0x00, 0x01, 0x06, 0x00, 0x00, 0x08,
+    0x30, 0x00, 0xc0, 0x07, 0x78, 0x81, 0x06, 0x18, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+// Masks of buckets having a keyword with a second byte, by the byte
+constexpr std::array< uint8_t, 256 > second_masks = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x53, 0x00, 0x01, 0x00, 0x89, 0x80, 0x02, 0x00, 0x14, 0x00, 0x20, 0x24, 0x00, 0x00, 0x56,
+    0x80, 0x00, 0x78, 0x01, 0x04, 0x28, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+// Masks of buckets by low and high nibbles of first and second bytes
+constexpr std::array< uint8_t, 16 > first_lo_masks = {
+    0x30, 0x0f, 0xc0, 0x77, 0xf9, 0x87, 0x3e, 0x18, 0x60, 0x80, 0x00, 0x01, 0x06, 0x00, 0x00, 0x08,
+};
+
+constexpr std::array< uint8_t, 16 > first_hi_masks = {
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+constexpr std::array< uint8_t, 16 > second_lo_masks = {
+    0x80, 0x53, 0x78, 0x01, 0x06, 0xa9, 0x80, 0x0a, 0x04, 0x14, 0x00, 0x20, 0x24, 0x20, 0x80, 0x56,
+};
+
+constexpr std::array< uint8_t, 16 > second_hi_masks = {
+    0x00, 0x00, 0x20, 0x00, 0x88, 0x0a, 0xff, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+// Bit n is set for keyword lengths n in buckets, last bit for lengths from 63 on
+constexpr std::array< uint64_t, 8 > bucket_lengths = {
+    0x17850EC50ull,
+    0x12218ull,
+    0x20003E8ull,
+    0x16044ull,
+    0xC22C0ull,
+    0x8438014ull,
+    0x8008B74F0ull,
+    0x20AA988ull,
+};
+
+constexpr std::array< size_t, 0 > long_lengths = { };
+
+template < typename Callback >
+inline void hash_confirm_length( std::string_view text, size_t i, size_t length, Callback &callback )
+{
+    if ( length <= text.size() - i )
+    {
+        const auto res = hash( text.substr( i, length ) );
+        if ( res != hash_enum::default_ )
+        {
+            callback( i, res );
+        }
+    }
+}
+
+// Reports keywords starting at text[ i ], of lengths in the buckets of mask
+template < typename Callback >
+inline void hash_confirm( std::string_view text, size_t i, unsigned mask, Callback &callback )
+{
+    uint64_t lengths = 0;
+    for ( ; mask; mask &= mask - 1 )
+    {
+        lengths |= bucket_lengths[ __builtin_ctz( mask ) ];
+    }
+
+    for ( ; lengths; lengths &= lengths - 1 )
+    {
+        const size_t length = __builtin_ctzll( lengths );
+        if ( length < 63 )
+        {
+            hash_confirm_length( text, i, length, callback );
+            continue;
+        }
+
+        for ( size_t long_length : long_lengths )
+        {
+            hash_confirm_length( text, i, long_length, callback );
+        }
+    }
+}
+
+// Checks candidates in text[ i, end ) one by one
+template < typename Callback >
+inline void hash_find_all_scalar( std::string_view text, size_t i, size_t end, Callback &callback )
+{
+    for ( ; i < end; ++i )
+    {
+        unsigned mask = first_masks[ static_cast< unsigned char >( text[ i ] ) ];
+        if ( i + 1 < text.size() )
+        {
+            mask &= second_masks[ static_cast< unsigned char >( text[ i + 1 ] ) ];
+        }
+
+        if ( mask )
+        {
+            hash_confirm( text, i, mask, callback );
+        }
+    }
+}
+
+#if defined( __GNUC__ ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+__attribute__(( target( "ssse3" ) ))
+inline __m128i bucket_masks( __m128i bytes, const std::array< uint8_t, 16 > &lo, const std::array< uint8_t, 16 > &hi )
+{
+    const __m128i nibble = _mm_set1_epi8( 0x0F );
+    const __m128i lo_masks = _mm_shuffle_epi8( _mm_loadu_si128( reinterpret_cast< const __m128i* >( lo.data() ) ), _mm_and_si128( bytes, nibble ) );
+    const __m128i hi_masks = _mm_shuffle_epi8( _mm_loadu_si128( reinterpret_cast< const __m128i* >( hi.data() ) ), _mm_and_si128( _mm_srli_epi16( bytes, 4 ), nibble ) );
+    return _mm_and_si128( lo_masks, hi_masks );
+}
+
+// Filters 16 positions at a time, returns the first position left
+template < typename Callback >
+__attribute__(( target( "ssse3" ) ))
+inline size_t hash_find_all_ssse3( std::string_view text, Callback &callback )
+{
+    size_t i = 0;
+    for ( ; i + 17 <= text.size(); i += 16 )
+    {
+        const __m128i first = _mm_loadu_si128( reinterpret_cast< const __m128i* >( text.data() + i ) );
+        const __m128i second = _mm_loadu_si128( reinterpret_cast< const __m128i* >( text.data() + i + 1 ) );
+        const __m128i masks = _mm_and_si128( bucket_masks( first, first_lo_masks, first_hi_masks ),
+                                             bucket_masks( second, second_lo_masks, second_hi_masks ) );
+
+        unsigned candidates = ~_mm_movemask_epi8( _mm_cmpeq_epi8( masks, _mm_setzero_si128() ) ) & 0xFFFF;
+        if ( candidates )
+        {
+            alignas( 16 ) uint8_t bucket_masks[ 16 ];
+            _mm_store_si128( reinterpret_cast< __m128i* >( bucket_masks ), masks );
+            for ( ; candidates; candidates &= candidates - 1 )
+            {
+                const int k = __builtin_ctz( candidates );
+                hash_confirm( text, i + k, bucket_masks[ k ], callback );
+            }
+        }
+    }
+    return i;
+}
+#endif
+
+} // namespace internal_
+
+// Calls callback( offset, value ) for each occurrence of a keyword in text,
+// by increasing offset, then increasing length
+template < typename Callback >
+inline void hash_find_all( std::string_view text, Callback &&callback )
+{
+    size_t i = 0;
+
+#if defined( __GNUC__ ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+    if ( __builtin_cpu_supports( "ssse3" ) )
+    {
+        i = internal_::hash_find_all_ssse3( text, callback );
+    }
+#endif
+
+    internal_::hash_find_all_scalar( text, i, text.size(), callback );
+}
+
+} // namespace find_all {
+
+// Extra check for safety
+static_assert( find_all::hash( "Age" ) == find_all::internal_::hash_enum::c_Age );
+static_assert( find_all::hash( "Allow" ) == find_all::internal_::hash_enum::c_Allow );
+static_assert( find_all::hash( "Cookie" ) == find_all::internal_::hash_enum::c_Cookie );
+static_assert( find_all::hash( "Accept" ) == find_all::internal_::hash_enum::c_Accept );
+static_assert( find_all::hash( "Connection" ) == find_all::internal_::hash_enum::c_Connection );
+static_assert( find_all::hash( "Content-Type" ) == find_all::internal_::hash_enum::c_Content_Type );
+static_assert( find_all::hash( "Content-Range" ) == find_all::internal_::hash_enum::c_Content_Range );
+static_assert( find_all::hash( "Authorization" ) == find_all::internal_::hash_enum::c_Authorization );
+static_assert( find_all::hash( "Accept-Language" ) == find_all::internal_::hash_enum::c_Accept_Language );
+static_assert( find_all::hash( "Content-Language" ) == find_all::internal_::hash_enum::c_Content_Language );
+static_assert( find_all::hash( "Content-Location" ) == find_all::internal_::hash_enum::c_Content_Location );
+static_assert( find_all::hash( "Accept-Charset" ) == find_all::internal_::hash_enum::c_Accept_Charset );
+static_assert( find_all::hash( "Accept-Ranges" ) == find_all::internal_::hash_enum::c_Accept_Ranges );
+static_assert( find_all::hash( "Content-Disposition" ) == find_all::internal_::hash_enum::c_Content_Disposition );
+static_assert( find_all::hash( "Cache-Control" ) == find_all::internal_::hash_enum::c_Cache_Control );
+static_assert( find_all::hash( "Access-Control-Max-Age" ) == find_all::internal_::hash_enum::c_Access_Control_Max_Age );
+static_assert( find_all::hash( "Accept-Encoding" ) == find_all::internal_::hash_enum::c_Accept_Encoding );
+static_assert( find_all::hash( "Content-Encoding" ) == find_all::internal_::hash_enum::c_Content_Encoding );
+static_assert( find_all::hash( "Expect" ) == find_all::internal_::hash_enum::c_Expect );
+static_assert( find_all::hash( "TE" ) == find_all::internal_::hash_enum::c_TE );
+static_assert( find_all::hash( "ETag" ) == find_all::internal_::hash_enum::c_ETag );
+static_assert( find_all::hash( "Expires" ) == find_all::internal_::hash_enum::c_Expires );
+static_assert( find_all::hash( "Timing-Allow-Origin" ) == find_all::internal_::hash_enum::c_Timing_Allow_Origin );
+static_assert( find_all::hash( "Set-Cookie" ) == find_all::internal_::hash_enum::c_Set_Cookie );
+static_assert( find_all::hash( "Range" ) == find_all::internal_::hash_enum::c_Range );
+static_assert( find_all::hash( "X-XSS-Protection" ) == find_all::internal_::hash_enum::c_X_XSS_Protection );
+static_assert( find_all::hash( "Expect-CT" ) == find_all::internal_::hash_enum::c_Expect_CT );
+static_assert( find_all::hash( "Transfer-Encoding" ) == find_all::internal_::hash_enum::c_Transfer_Encoding );
+static_assert( find_all::hash( "X-Forwarded-Host" ) == find_all::internal_::hash_enum::c_X_Forwarded_Host );
+static_assert( find_all::hash( "X-Frame-Options" ) == find_all::internal_::hash_enum::c_X_Frame_Options );
+static_assert( find_all::hash( "Trailer" ) == find_all::internal_::hash_enum::c_Trailer );
+static_assert( find_all::hash( "Access-Control-Allow-Credentials" ) == find_all::internal_::hash_enum::c_Access_Control_Allow_Credentials );
+static_assert( find_all::hash( "If-Range" ) == find_all::internal_::hash_enum::c_If_Range );
+static_assert( find_all::hash( "Access-Control-Request-Headers" ) == find_all::internal_::hash_enum::c_Access_Control_Request_Headers );
+static_assert( find_all::hash( "Server-Timing" ) == find_all::internal_::hash_enum::c_Server_Timing );
+static_assert( find_all::hash( "Referrer-Policy" ) == find_all::internal_::hash_enum::c_Referrer_Policy );
+static_assert( find_all::hash( "Proxy-Authenticate" ) == find_all::internal_::hash_enum::c_Proxy_Authenticate );
+static_assert( find_all::hash( "Sec-WebSocket-Accept" ) == find_all::internal_::hash_enum::c_Sec_WebSocket_Accept );
+static_assert( find_all::hash( "Proxy-Authorization" ) == find_all::internal_::hash_enum::c_Proxy_Authorization );
+static_assert( find_all::hash( "Public-Key-Pins" ) == find_all::internal_::hash_enum::c_Public_Key_Pins );
+static_assert( find_all::hash( "Server" ) == find_all::internal_::hash_enum::c_Server );
+static_assert( find_all::hash( "If-Modified-Since" ) == find_all::internal_::hash_enum::c_If_Modified_Since );
+static_assert( find_all::hash( "X-Content-Type-Options" ) == find_all::internal_::hash_enum::c_X_Content_Type_Options );
+static_assert( find_all::hash( "If-Unmodified-Since" ) == find_all::internal_::hash_enum::c_If_Unmodified_Since );
+static_assert( find_all::hash( "X-Forwarded-For" ) == find_all::internal_::hash_enum::c_X_Forwarded_For );
+static_assert( find_all::hash( "Content-Length" ) == find_all::internal_::hash_enum::c_Content_Length );
+static_assert( find_all::hash( "X-DNS-Prefetch-Control" ) == find_all::internal_::hash_enum::c_X_DNS_Prefetch_Control );
+static_assert( find_all::hash( "Referer" ) == find_all::internal_::hash_enum::c_Referer );
+static_assert( find_all::hash( "Location" ) == find_all::internal_::hash_enum::c_Location );
+static_assert( find_all::hash( "Clear-Site-Data" ) == find_all::internal_::hash_enum::c_Clear_Site_Data );
+static_assert( find_all::hash( "Public-Key-Pins-Report-Only" ) == find_all::internal_::hash_enum::c_Public_Key_Pins_Report_Only );
+static_assert( find_all::hash( "Retry-After" ) == find_all::internal_::hash_enum::c_Retry_After );
+static_assert( find_all::hash( "Access-Control-Request-Method" ) == find_all::internal_::hash_enum::c_Access_Control_Request_Method );
+static_assert( find_all::hash( "Vary" ) == find_all::internal_::hash_enum::c_Vary );
+static_assert( find_all::hash( "Content-Security-Policy" ) == find_all::internal_::hash_enum::c_Content_Security_Policy );
+static_assert( find_all::hash( "User-Agent" ) == find_all::internal_::hash_enum::c_User_Agent );
+static_assert( find_all::hash( "Large-Allocation" ) == find_all::internal_::hash_enum::c_Large_Allocation );
+static_assert( find_all::hash( "Warning" ) == find_all::internal_::hash_enum::c_Warning );
+static_assert( find_all::hash( "WWW-Authenticate" ) == find_all::internal_::hash_enum::c_WWW_Authenticate );
+static_assert( find_all::hash( "Origin" ) == find_all::internal_::hash_enum::c_Origin );
+static_assert( find_all::hash( "Strict-Transport-Security" ) == find_all::internal_::hash_enum::c_Strict_Transport_Security );
+static_assert( find_all::hash( "Host" ) == find_all::internal_::hash_enum::c_Host );
+static_assert( find_all::hash( "Feature-Policy" ) == find_all::internal_::hash_enum::c_Feature_Policy );
+static_assert( find_all::hash( "Date" ) == find_all::internal_::hash_enum::c_Date );
+static_assert( find_all::hash( "Cookie2" ) == find_all::internal_::hash_enum::c_Cookie2 );
+static_assert( find_all::hash( "Pragma" ) == find_all::internal_::hash_enum::c_Pragma );
+static_assert( find_all::hash( "Content-Security-Policy-Report-Only" ) == find_all::internal_::hash_enum::c_Content_Security_Policy_Report_Only );
+static_assert( find_all::hash( "SourceMap" ) == find_all::internal_::hash_enum::c_SourceMap );
+static_assert( find_all::hash( "X-Forwarded-Proto" ) == find_all::internal_::hash_enum::c_X_Forwarded_Proto );
+static_assert( find_all::hash( "From" ) == find_all::internal_::hash_enum::c_From );
+static_assert( find_all::hash( "If-Match" ) == find_all::internal_::hash_enum::c_If_Match );
+static_assert( find_all::hash( "DNT" ) == find_all::internal_::hash_enum::c_DNT );
+static_assert( find_all::hash( "Upgrade-Insecure-Requests" ) == find_all::internal_::hash_enum::c_Upgrade_Insecure_Requests );
+static_assert( find_all::hash( "Tk" ) == find_all::internal_::hash_enum::c_Tk );
+static_assert( find_all::hash( "Access-Control-Allow-Methods" ) == find_all::internal_::hash_enum::c_Access_Control_Allow_Methods );
+static_assert( find_all::hash( "If-None-Match" ) == find_all::internal_::hash_enum::c_If_None_Match );
+static_assert( find_all::hash( "Keep-Alive" ) == find_all::internal_::hash_enum::c_Keep_Alive );
+static_assert( find_all::hash( "Access-Control-Expose-Headers" ) == find_all::internal_::hash_enum::c_Access_Control_Expose_Headers );
+static_assert( find_all::hash( "Last-Modified" ) == find_all::internal_::hash_enum::c_Last_Modified );
+static_assert( find_all::hash( "Access-Control-Allow-Origin" ) == find_all::internal_::hash_enum::c_Access_Control_Allow_Origin );
+static_assert( find_all::hash( "Forwarded" ) == find_all::internal_::hash_enum::c_Forwarded );
+static_assert( find_all::hash( "Access-Control-Allow-Headers" ) == find_all::internal_::hash_enum::c_Access_Control_Allow_Headers );
+static_assert( find_all::hash( "Set-Cookie2" ) == find_all::internal_::hash_enum::c_Set_Cookie2 );
+static_assert( find_all::hash( "Via" ) == find_all::internal_::hash_enum::c_Via );
+
+#endif // FIND_ALL__HASH_HPP_
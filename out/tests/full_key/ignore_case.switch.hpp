@@ -0,0 +1,483 @@
+#ifndef IGNORE_CASE__HASH_HPP_
+#define IGNORE_CASE__HASH_HPP_
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+namespace ignore_case {
+
+namespace internal_ {
+
+enum class hash_enum
+{
+    default_ = -1,
+    c_If_Range = 0,
+    c_Pragma = 1,
+    c_Content_Language = 2,
+    c_Strict_Transport_Security = 3,
+    c_Upgrade_Insecure_Requests = 4,
+    c_Content_Length = 5,
+    c_Range = 6,
+    c_Content_Type = 7,
+    c_Accept_Ranges = 8,
+    c_Clear_Site_Data = 9,
+    c_If_Modified_Since = 10,
+    c_Accept_Language = 11,
+    c_Cookie2 = 12,
+    c_Server = 13,
+    c_Origin = 14,
+    c_If_Unmodified_Since = 15,
+    c_Proxy_Authenticate = 16,
+    c_User_Agent = 17,
+    c_X_Forwarded_For = 18,
+    c_If_None_Match = 19,
+    c_Timing_Allow_Origin = 20,
+    c_Cookie = 21,
+    c_Accept_Encoding = 22,
+    c_Access_Control_Allow_Methods = 23,
+    c_ETag = 24,
+    c_Host = 25,
+    c_Access_Control_Allow_Credentials = 26,
+    c_Access_Control_Max_Age = 27,
+    c_Cache_Control = 28,
+    c_Feature_Policy = 29,
+    c_X_Forwarded_Proto = 30,
+    c_From = 31,
+    c_Retry_After = 32,
+    c_Referrer_Policy = 33,
+    c_Server_Timing = 34,
+    c_Expires = 35,
+    c_Public_Key_Pins = 36,
+    c_X_Frame_Options = 37,
+    c_Large_Allocation = 38,
+    c_Transfer_Encoding = 39,
+    c_Access_Control_Request_Method = 40,
+    c_Access_Control_Request_Headers = 41,
+    c_Date = 42,
+    c_Content_Security_Policy = 43,
+    c_Proxy_Authorization = 44,
+    c_Content_Security_Policy_Report_Only = 45,
+    c_Warning = 46,
+    c_Trailer = 47,
+    c_TE = 48,
+    c_Via = 49,
+    c_X_XSS_Protection = 50,
+    c_Public_Key_Pins_Report_Only = 51,
+    c_X_Forwarded_Host = 52,
+    c_Vary = 53,
+    c_DNT = 54,
+    c_Set_Cookie = 55,
+    c_Forwarded = 56,
+    c_Content_Location = 57,
+    c_Allow = 58,
+    c_WWW_Authenticate = 59,
+    c_Content_Encoding = 60,
+    c_Accept = 61,
+    c_Age = 62,
+    c_Access_Control_Allow_Origin = 63,
+    c_Expect_CT = 64,
+    c_X_Content_Type_Options = 65,
+    c_Content_Range = 66,
+    c_Keep_Alive = 67,
+    c_Last_Modified = 68,
+    c_Access_Control_Expose_Headers = 69,
+    c_Authorization = 70,
+    c_SourceMap = 71,
+    c_Tk = 72,
+    c_Referer = 73,
+    c_Access_Control_Allow_Headers = 74,
+    c_Set_Cookie2 = 75,
+    c_Connection = 76,
+    c_Sec_WebSocket_Accept = 77,
+    c_If_Match = 78,
+    c_Accept_Charset = 79,
+    c_Content_Disposition = 80,
+    c_Location = 81,
+    c_Expect = 82,
+    c_X_DNS_Prefetch_Control = 83,
+};
+
+} // namespace internal_
+
+// Number of keywords, enum values other than the default are in [ 0, hash_count )
+constexpr size_t hash_count = 84;
+
+constexpr internal_::hash_enum hash( std::string_view s );
+
+namespace internal_ {
+
+constexpr uint64_t load_le8( const char *p )
+{
+    return uint64_t( static_cast< unsigned char >( p[ 0 ] ) )
+         | uint64_t( static_cast< unsigned char >( p[ 1 ] ) ) << 8
+         | uint64_t( static_cast< unsigned char >( p[ 2 ] ) ) << 16
+         | uint64_t( static_cast< unsigned char >( p[ 3 ] ) ) << 24
+         | uint64_t( static_cast< unsigned char >( p[ 4 ] ) ) << 32
+         | uint64_t( static_cast< unsigned char >( p[ 5 ] ) ) << 40
+         | uint64_t( static_cast< unsigned char >( p[ 6 ] ) ) << 48
+         | uint64_t( static_cast< unsigned char >( p[ 7 ] ) ) << 56;
+}
+
+constexpr uint64_t fold_case( uint64_t x )
+{
+    const uint64_t heptets = x & 0x7F7F7F7F7F7F7F7Full;
+    const uint64_t ge_A = heptets + 0x3F3F3F3F3F3F3F3Full; // High bit set if >= 'A'
+    const uint64_t gt_Z = heptets + 0x2525252525252525ull; // High bit set if > 'Z'
+    const uint64_t upper = ge_A & ~gt_Z & ~x & 0x8080808080808080ull;
+    return x | ( upper >> 2 );
+}
+
+constexpr bool equals_ignore_case( std::string_view s, std::string_view lower )
+{
+    if ( s.size() != lower.size() )
+    {
+        return false;
+    }
+
+    if ( s.size() < 8 )
+    {
+        uint64_t a = 0;
+        uint64_t b = 0;
+        for ( size_t i = 0; i < s.size(); ++i )
+        {
+            a |= uint64_t( static_cast< unsigned char >( s[ i ] ) ) << ( i * 8 );
+            b |= uint64_t( static_cast< unsigned char >( lower[ i ] ) ) << ( i * 8 );
+        }
+        return fold_case( a ) == b;
+    }
+
+    // Last 8 bytes overlap with the previous ones, instead of a loop for the tail
+    uint64_t diff = fold_case( load_le8( s.data() + s.size() - 8 ) ) ^ load_le8( lower.data() + s.size() - 8 );
+    for ( size_t i = 0; i + 8 < s.size(); i += 8 )
+    {
+        diff |= fold_case( load_le8( s.data() + i ) ) ^ load_le8( lower.data() + i );
+    }
+    return diff == 0;
+}
+
+constexpr uint64_t mix( uint64_t x )
+{
+    x *= 0xBF58476D1CE4E5B9ull;
+    return x ^ ( x >> 31 );
+}
+
+// Last 8 bytes overlap with the previous ones, instead of a loop for the tail
+constexpr uint64_t full_key_hash( std::string_view s )
+{
+    uint64_t h = 0xE220A8397B1DCDAFull ^ ( s.size() * 0x9E3779B97F4A7C15ull );
+    if ( s.size() < 8 )
+    {
+        uint64_t tail = 0;
+        for ( size_t i = 0; i < s.size(); ++i )
+        {
+            tail |= uint64_t( static_cast< unsigned char >( s[ i ] ) ) << ( i * 8 );
+        }
+        return mix( h ^ fold_case( tail ) );
+    }
+
+    for ( size_t i = 0; i + 8 < s.size(); i += 8 )
+    {
+        h = mix( h ^ fold_case( load_le8( s.data() + i ) ) );
+    }
+    return mix( h ^ fold_case( load_le8( s.data() + s.size() - 8 ) ) );
+}
+
+constexpr std::array< uint8_t, 42 > displacements = {{
+    0, 7, 1, 1, 3, 3, 3, 0, 5, 1, 8, 0, 9, 3, 7, 0,
+    0, 13, 0, 19, 2, 17, 18, 0, 6, 0, 0, 10, 0, 11, 1, 3,
+    26, 13, 110, 1, 0, 5, 61, 10, 134, 0,
+}};
+
+// High bits of the hash pick a bucket, whose displacement is mixed into the
+// hash again for the slot
+constexpr size_t full_key_slot( std::string_view s )
+{
+    const uint64_t h = full_key_hash( s );
+    const uint64_t bucket = ( ( h >> 32 ) * 42 ) >> 32;
+    const uint64_t x = ( h ^ ( displacements[ bucket ] * 0x9E3779B97F4A7C15ull ) ) * 0xD6E8FEB86659FD93ull;
+    return ( ( x >> 32 ) * 84 ) >> 32;
+}
+
+struct word_entry
+{
+    std::string_view word;
+    hash_enum enum_val;
+};
+
+constexpr std::array< word_entry, 84 > wordlist = {{
+    { "if-range", hash_enum::c_If_Range },
+    { "pragma", hash_enum::c_Pragma },
+    { "content-language", hash_enum::c_Content_Language },
+    { "strict-transport-security", hash_enum::c_Strict_Transport_Security },
+    { "upgrade-insecure-requests", hash_enum::c_Upgrade_Insecure_Requests },
+    { "content-length", hash_enum::c_Content_Length },
+    { "range", hash_enum::c_Range },
+    { "content-type", hash_enum::c_Content_Type },
+    { "accept-ranges", hash_enum::c_Accept_Ranges },
+    { "clear-site-data", hash_enum::c_Clear_Site_Data },
+    { "if-modified-since", hash_enum::c_If_Modified_Since },
+    { "accept-language", hash_enum::c_Accept_Language },
+    { "cookie2", hash_enum::c_Cookie2 },
+    { "server", hash_enum::c_Server },
+    { "origin", hash_enum::c_Origin },
+    { "if-unmodified-since", hash_enum::c_If_Unmodified_Since },
+    { "proxy-authenticate", hash_enum::c_Proxy_Authenticate },
+    { "user-agent", hash_enum::c_User_Agent },
+    { "x-forwarded-for", hash_enum::c_X_Forwarded_For },
+    { "if-none-match", hash_enum::c_If_None_Match },
+    { "timing-allow-origin", hash_enum::c_Timing_Allow_Origin },
+    { "cookie", hash_enum::c_Cookie },
+    { "accept-encoding", hash_enum::c_Accept_Encoding },
+    { "access-control-allow-methods", hash_enum::c_Access_Control_Allow_Methods },
+    { "etag", hash_enum::c_ETag },
+    { "host", hash_enum::c_Host },
+    { "access-control-allow-credentials", hash_enum::c_Access_Control_Allow_Credentials },
+    { "access-control-max-age", hash_enum::c_Access_Control_Max_Age },
+    { "cache-control", hash_enum::c_Cache_Control },
+    { "feature-policy", hash_enum::c_Feature_Policy },
+    { "x-forwarded-proto", hash_enum::c_X_Forwarded_Proto },
+    { "from", hash_enum::c_From },
+    { "retry-after", hash_enum::c_Retry_After },
+    { "referrer-policy", hash_enum::c_Referrer_Policy },
+    { "server-timing", hash_enum::c_Server_Timing },
+    { "expires", hash_enum::c_Expires },
+    { "public-key-pins", hash_enum::c_Public_Key_Pins },
+    { "x-frame-options", hash_enum::c_X_Frame_Options },
+    { "large-allocation", hash_enum::c_Large_Allocation },
+    { "transfer-encoding", hash_enum::c_Transfer_Encoding },
+    { "access-control-request-method", hash_enum::c_Access_Control_Request_Method },
+    { "access-control-request-headers", hash_enum::c_Access_Control_Request_Headers },
+    { "date", hash_enum::c_Date },
+    { "content-security-policy", hash_enum::c_Content_Security_Policy },
+    { "proxy-authorization", hash_enum::c_Proxy_Authorization },
+    { "content-security-policy-report-only", hash_enum::c_Content_Security_Policy_Report_Only },
+    { "warning", hash_enum::c_Warning },
+    { "trailer", hash_enum::c_Trailer },
+    { "te", hash_enum::c_TE },
+    { "via", hash_enum::c_Via },
+    { "x-xss-protection", hash_enum::c_X_XSS_Protection },
+    { "public-key-pins-report-only", hash_enum::c_Public_Key_Pins_Report_Only },
+    { "x-forwarded-host", hash_enum::c_X_Forwarded_Host },
+    { "vary", hash_enum::c_Vary },
+    { "dnt", hash_enum::c_DNT },
+    { "set-cookie", hash_enum::c_Set_Cookie },
+    { "forwarded", hash_enum::c_Forwarded },
+    { "content-location", hash_enum::c_Content_Location },
+    { "allow", hash_enum::c_Allow },
+    { "www-authenticate", hash_enum::c_WWW_Authenticate },
+    { "content-encoding", hash_enum::c_Content_Encoding },
+    { "accept", hash_enum::c_Accept },
+    { "age", hash_enum::c_Age },
+    { "access-control-allow-origin", hash_enum::c_Access_Control_Allow_Origin },
+    { "expect-ct", hash_enum::c_Expect_CT },
+    { "x-content-type-options", hash_enum::c_X_Content_Type_Options },
+    { "content-range", hash_enum::c_Content_Range },
+    { "keep-alive", hash_enum::c_Keep_Alive },
+    { "last-modified", hash_enum::c_Last_Modified },
+    { "access-control-expose-headers", hash_enum::c_Access_Control_Expose_Headers },
+    { "authorization", hash_enum::c_Authorization },
+    { "sourcemap", hash_enum::c_SourceMap },
+    { "tk", hash_enum::c_Tk },
+    { "referer", hash_enum::c_Referer },
+    { "access-control-allow-headers", hash_enum::c_Access_Control_Allow_Headers },
+    { "set-cookie2", hash_enum::c_Set_Cookie2 },
+    { "connection", hash_enum::c_Connection },
+    { "sec-websocket-accept", hash_enum::c_Sec_WebSocket_Accept },
+    { "if-match", hash_enum::c_If_Match },
+    { "accept-charset", hash_enum::c_Accept_Charset },
+    { "content-disposition", hash_enum::c_Content_Disposition },
+    { "location", hash_enum::c_Location },
+    { "expect", hash_enum::c_Expect },
+    { "x-dns-prefetch-control", hash_enum::c_X_DNS_Prefetch_Control },
+}};
+
+} // namespace internal_
+
+constexpr internal_::hash_enum hash( std::string_view s )
+{
+    constexpr size_t MinWordLength = 2;
+    constexpr size_t MaxWordLength = 35;
+
+    if ( s.size() < MinWordLength || s.size() > MaxWordLength )
+    {
+        return internal_::hash_enum::default_;
+    }
+
+    const internal_::word_entry &entry = internal_::wordlist[ internal_::full_key_slot( s ) ];
+    return internal_::equals_ignore_case( s, entry.word ) ? entry.enum_val : internal_::hash_enum::default_;
+}
+
+} // namespace ignore_case {
+
+// Extra check for safety
+static_assert( ignore_case::hash( "If-Range" ) == ignore_case::internal_::hash_enum::c_If_Range );
+static_assert( ignore_case::hash( "Pragma" ) == ignore_case::internal_::hash_enum::c_Pragma );
+static_assert( ignore_case::hash( "Content-Language" ) == ignore_case::internal_::hash_enum::c_Content_Language );
+static_assert( ignore_case::hash( "Strict-Transport-Security" ) == ignore_case::internal_::hash_enum::c_Strict_Transport_Security );
+static_assert( ignore_case::hash( "Upgrade-Insecure-Requests" ) == ignore_case::internal_::hash_enum::c_Upgrade_Insecure_Requests );
+static_assert( ignore_case::hash( "Content-Length" ) == ignore_case::internal_::hash_enum::c_Content_Length );
+static_assert( ignore_case::hash( "Range" ) == ignore_case::internal_::hash_enum::c_Range );
+static_assert( ignore_case::hash( "Content-Type" ) == ignore_case::internal_::hash_enum::c_Content_Type );
+static_assert( ignore_case::hash( "Accept-Ranges" ) == ignore_case::internal_::hash_enum::c_Accept_Ranges );
+static_assert( ignore_case::hash( "Clear-Site-Data" ) == ignore_case::internal_::hash_enum::c_Clear_Site_Data );
+static_assert( ignore_case::hash( "If-Modified-Since" ) == ignore_case::internal_::hash_enum::c_If_Modified_Since );
+static_assert( ignore_case::hash( "Accept-Language" ) == ignore_case::internal_::hash_enum::c_Accept_Language );
+static_assert( ignore_case::hash( "Cookie2" ) == ignore_case::internal_::hash_enum::c_Cookie2 );
+static_assert( ignore_case::hash( "Server" ) == ignore_case::internal_::hash_enum::c_Server );
+static_assert( ignore_case::hash( "Origin" ) == ignore_case::internal_::hash_enum::c_Origin );
+static_assert( ignore_case::hash( "If-Unmodified-Since" ) == ignore_case::internal_::hash_enum::c_If_Unmodified_Since );
+static_assert( ignore_case::hash( "Proxy-Authenticate" ) == ignore_case::internal_::hash_enum::c_Proxy_Authenticate );
+static_assert( ignore_case::hash( "User-Agent" ) == ignore_case::internal_::hash_enum::c_User_Agent );
+static_assert( ignore_case::hash( "X-Forwarded-For" ) == ignore_case::internal_::hash_enum::c_X_Forwarded_For );
+static_assert( ignore_case::hash( "If-None-Match" ) == ignore_case::internal_::hash_enum::c_If_None_Match );
+static_assert( ignore_case::hash( "Timing-Allow-Origin" ) == ignore_case::internal_::hash_enum::c_Timing_Allow_Origin );
+static_assert( ignore_case::hash( "Cookie" ) == ignore_case::internal_::hash_enum::c_Cookie );
+static_assert( ignore_case::hash( "Accept-Encoding" ) == ignore_case::internal_::hash_enum::c_Accept_Encoding );
+static_assert( ignore_case::hash( "Access-Control-Allow-Methods" ) == ignore_case::internal_::hash_enum::c_Access_Control_Allow_Methods );
+static_assert( ignore_case::hash( "ETag" ) == ignore_case::internal_::hash_enum::c_ETag );
+static_assert( ignore_case::hash( "Host" ) == ignore_case::internal_::hash_enum::c_Host );
+static_assert( ignore_case::hash( "Access-Control-Allow-Credentials" ) == ignore_case::internal_::hash_enum::c_Access_Control_Allow_Credentials );
+static_assert( ignore_case::hash( "Access-Control-Max-Age" ) == ignore_case::internal_::hash_enum::c_Access_Control_Max_Age );
+static_assert( ignore_case::hash( "Cache-Control" ) == ignore_case::internal_::hash_enum::c_Cache_Control );
+static_assert( ignore_case::hash( "Feature-Policy" ) == ignore_case::internal_::hash_enum::c_Feature_Policy );
+static_assert( ignore_case::hash( "X-Forwarded-Proto" ) == ignore_case::internal_::hash_enum::c_X_Forwarded_Proto );
+static_assert( ignore_case::hash( "From" ) == ignore_case::internal_::hash_enum::c_From );
+static_assert( ignore_case::hash( "Retry-After" ) == ignore_case::internal_::hash_enum::c_Retry_After );
+static_assert( ignore_case::hash( "Referrer-Policy" ) == ignore_case::internal_::hash_enum::c_Referrer_Policy );
+static_assert( ignore_case::hash( "Server-Timing" ) == ignore_case::internal_::hash_enum::c_Server_Timing );
+static_assert( ignore_case::hash( "Expires" ) == ignore_case::internal_::hash_enum::c_Expires );
+static_assert( ignore_case::hash( "Public-Key-Pins" ) == ignore_case::internal_::hash_enum::c_Public_Key_Pins );
+static_assert( ignore_case::hash( "X-Frame-Options" ) == ignore_case::internal_::hash_enum::c_X_Frame_Options );
+static_assert( ignore_case::hash( "Large-Allocation" ) == ignore_case::internal_::hash_enum::c_Large_Allocation );
+static_assert( ignore_case::hash( "Transfer-Encoding" ) == ignore_case::internal_::hash_enum::c_Transfer_Encoding );
+static_assert( ignore_case::hash( "Access-Control-Request-Method" ) == ignore_case::internal_::hash_enum::c_Access_Control_Request_Method );
+static_assert( ignore_case::hash( "Access-Control-Request-Headers" ) == ignore_case::internal_::hash_enum::c_Access_Control_Request_Headers );
+static_assert( ignore_case::hash( "Date" ) == ignore_case::internal_::hash_enum::c_Date );
+static_assert( ignore_case::hash( "Content-Security-Policy" ) == ignore_case::internal_::hash_enum::c_Content_Security_Policy );
+static_assert( ignore_case::hash( "Proxy-Authorization" ) == ignore_case::internal_::hash_enum::c_Proxy_Authorization );
+static_assert( ignore_case::hash( "Content-Security-Policy-Report-Only" ) == ignore_case::internal_::hash_enum::c_Content_Security_Policy_Report_Only );
+static_assert( ignore_case::hash( "Warning" ) == ignore_case::internal_::hash_enum::c_Warning );
+static_assert( ignore_case::hash( "Trailer" ) == ignore_case::internal_::hash_enum::c_Trailer );
+static_assert( ignore_case::hash( "TE" ) == ignore_case::internal_::hash_enum::c_TE );
+static_assert( ignore_case::hash( "Via" ) == ignore_case::internal_::hash_enum::c_Via );
+static_assert( ignore_case::hash( "X-XSS-Protection" ) == ignore_case::internal_::hash_enum::c_X_XSS_Protection );
+static_assert( ignore_case::hash( "Public-Key-Pins-Report-Only" ) == ignore_case::internal_::hash_enum::c_Public_Key_Pins_Report_Only );
+static_assert( ignore_case::hash( "X-Forwarded-Host" ) == ignore_case::internal_::hash_enum::c_X_Forwarded_Host );
+static_assert( ignore_case::hash( "Vary" ) == ignore_case::internal_::hash_enum::c_Vary );
+static_assert( ignore_case::hash( "DNT" ) == ignore_case::internal_::hash_enum::c_DNT );
+static_assert( ignore_case::hash( "Set-Cookie" ) == ignore_case::internal_::hash_enum::c_Set_Cookie );
+static_assert( ignore_case::hash( "Forwarded" ) == ignore_case::internal_::hash_enum::c_Forwarded );
+static_assert( ignore_case::hash( "Content-Location" ) == ignore_case::internal_::hash_enum::c_Content_Location );
+static_assert( ignore_case::hash( "Allow" ) == ignore_case::internal_::hash_enum::c_Allow );
+static_assert( ignore_case::hash( "WWW-Authenticate" ) == ignore_case::internal_::hash_enum::c_WWW_Authenticate );
+static_assert( ignore_case::hash( "Content-Encoding" ) == ignore_case::internal_::hash_enum::c_Content_Encoding );
+static_assert( ignore_case::hash( "Accept" ) == ignore_case::internal_::hash_enum::c_Accept );
+static_assert( ignore_case::hash( "Age" ) == ignore_case::internal_::hash_enum::c_Age );
+static_assert( ignore_case::hash( "Access-Control-Allow-Origin" ) == ignore_case::internal_::hash_enum::c_Access_Control_Allow_Origin );
+static_assert( ignore_case::hash( "Expect-CT" ) == ignore_case::internal_::hash_enum::c_Expect_CT );
+static_assert( ignore_case::hash( "X-Content-Type-Options" ) == ignore_case::internal_::hash_enum::c_X_Content_Type_Options );
+static_assert( ignore_case::hash( "Content-Range" ) == ignore_case::internal_::hash_enum::c_Content_Range );
+static_assert( ignore_case::hash( "Keep-Alive" ) == ignore_case::internal_::hash_enum::c_Keep_Alive );
+static_assert( ignore_case::hash( "Last-Modified" ) == ignore_case::internal_::hash_enum::c_Last_Modified );
+static_assert( ignore_case::hash( "Access-Control-Expose-Headers" ) == ignore_case::internal_::hash_enum::c_Access_Control_Expose_Headers );
+static_assert( ignore_case::hash( "Authorization" ) == ignore_case::internal_::hash_enum::c_Authorization );
+static_assert( ignore_case::hash( "SourceMap" ) == ignore_case::internal_::hash_enum::c_SourceMap );
+static_assert( ignore_case::hash( "Tk" ) == ignore_case::internal_::hash_enum::c_Tk );
+static_assert( ignore_case::hash( "Referer" ) == ignore_case::internal_::hash_enum::c_Referer );
+static_assert( ignore_case::hash( "Access-Control-Allow-Headers" ) == ignore_case::internal_::hash_enum::c_Access_Control_Allow_Headers );
+static_assert( ignore_case::hash( "Set-Cookie2" ) == ignore_case::internal_::hash_enum::c_Set_Cookie2 );
+static_assert( ignore_case::hash( "Connection" ) == ignore_case::internal_::hash_enum::c_Connection );
+static_assert( ignore_case::hash( "Sec-WebSocket-Accept" ) == ignore_case::internal_::hash_enum::c_Sec_WebSocket_Accept );
+static_assert( ignore_case::hash( "If-Match" ) == ignore_case::internal_::hash_enum::c_If_Match );
+static_assert( ignore_case::hash( "Accept-Charset" ) == ignore_case::internal_::hash_enum::c_Accept_Charset );
+static_assert( ignore_case::hash( "Content-Disposition" ) == ignore_case::internal_::hash_enum::c_Content_Disposition );
+static_assert( ignore_case::hash( "Location" ) == ignore_case::internal_::hash_enum::c_Location );
+static_assert( ignore_case::hash( "Expect" ) == ignore_case::internal_::hash_enum::c_Expect );
+static_assert( ignore_case::hash( "X-DNS-Prefetch-Control" ) == ignore_case::internal_::hash_enum::c_X_DNS_Prefetch_Control );
+static_assert( ignore_case::hash( "IF-RANGE" ) == ignore_case::internal_::hash_enum::c_If_Range );
+static_assert( ignore_case::hash( "PRAGMA" ) == ignore_case::internal_::hash_enum::c_Pragma );
+static_assert( ignore_case::hash( "CONTENT-LANGUAGE" ) == ignore_case::internal_::hash_enum::c_Content_Language );
+static_assert( ignore_case::hash( "STRICT-TRANSPORT-SECURITY" ) == ignore_case::internal_::hash_enum::c_Strict_Transport_Security );
+static_assert( ignore_case::hash( "UPGRADE-INSECURE-REQUESTS" ) == ignore_case::internal_::hash_enum::c_Upgrade_Insecure_Requests );
+static_assert( ignore_case::hash( "CONTENT-LENGTH" ) == ignore_case::internal_::hash_enum::c_Content_Length );
+static_assert( ignore_case::hash( "RANGE" ) == ignore_case::internal_::hash_enum::c_Range );
+static_assert( ignore_case::hash( "CONTENT-TYPE" ) == ignore_case::internal_::hash_enum::c_Content_Type );
+static_assert( ignore_case::hash( "ACCEPT-RANGES" ) == ignore_case::internal_::hash_enum::c_Accept_Ranges );
+static_assert( ignore_case::hash( "CLEAR-SITE-DATA" ) == ignore_case::internal_::hash_enum::c_Clear_Site_Data );
+static_assert( ignore_case::hash( "IF-MODIFIED-SINCE" ) == ignore_case::internal_::hash_enum::c_If_Modified_Since );
+static_assert( ignore_case::hash( "ACCEPT-LANGUAGE" ) == ignore_case::internal_::hash_enum::c_Accept_Language );
+static_assert( ignore_case::hash( "COOKIE2" ) == ignore_case::internal_::hash_enum::c_Cookie2 );
+static_assert( ignore_case::hash( "SERVER" ) == ignore_case::internal_::hash_enum::c_Server );
+static_assert( ignore_case::hash( "ORIGIN" ) == ignore_case::internal_::hash_enum::c_Origin );
+static_assert( ignore_case::hash( "IF-UNMODIFIED-SINCE" ) == ignore_case::internal_::hash_enum::c_If_Unmodified_Since );
+static_assert( ignore_case::hash( "PROXY-AUTHENTICATE" ) == ignore_case::internal_::hash_enum::c_Proxy_Authenticate );
+static_assert( ignore_case::hash( "USER-AGENT" ) == ignore_case::internal_::hash_enum::c_User_Agent );
+static_assert( ignore_case::hash( "X-FORWARDED-FOR" ) == ignore_case::internal_::hash_enum::c_X_Forwarded_For );
+static_assert( ignore_case::hash( "IF-NONE-MATCH" ) == ignore_case::internal_::hash_enum::c_If_None_Match );
+static_assert( ignore_case::hash( "TIMING-ALLOW-ORIGIN" ) == ignore_case::internal_::hash_enum::c_Timing_Allow_Origin );
+static_assert( ignore_case::hash( "COOKIE" ) == ignore_case::internal_::hash_enum::c_Cookie );
+static_assert( ignore_case::hash( "ACCEPT-ENCODING" ) == ignore_case::internal_::hash_enum::c_Accept_Encoding );
+static_assert( ignore_case::hash( "ACCESS-CONTROL-ALLOW-METHODS" ) == ignore_case::internal_::hash_enum::c_Access_Control_Allow_Methods );
+static_assert( ignore_case::hash( "ETAG" ) == ignore_case::internal_::hash_enum::c_ETag );
+static_assert( ignore_case::hash( "HOST" ) == ignore_case::internal_::hash_enum::c_Host );
+static_assert( ignore_case::hash( "ACCESS-CONTROL-ALLOW-CREDENTIALS" ) == ignore_case::internal_::hash_enum::c_Access_Control_Allow_Credentials );
+static_assert( ignore_case::hash( "ACCESS-CONTROL-MAX-AGE" ) == ignore_case::internal_::hash_enum::c_Access_Control_Max_Age );
+static_assert( ignore_case::hash( "CACHE-CONTROL" ) == ignore_case::internal_::hash_enum::c_Cache_Control );
+static_assert( ignore_case::hash( "FEATURE-POLICY" ) == ignore_case::internal_::hash_enum::c_Feature_Policy );
+static_assert( ignore_case::hash( "X-FORWARDED-PROTO" ) == ignore_case::internal_::hash_enum::c_X_Forwarded_Proto );
+static_assert( ignore_case::hash( "FROM" ) == ignore_case::internal_::hash_enum::c_From );
+static_assert( ignore_case::hash( "RETRY-AFTER" ) == ignore_case::internal_::hash_enum::c_Retry_After );
+static_assert( ignore_case::hash( "REFERRER-POLICY" ) == ignore_case::internal_::hash_enum::c_Referrer_Policy );
+static_assert( ignore_case::hash( "SERVER-TIMING" ) == ignore_case::internal_::hash_enum::c_Server_Timing );
+static_assert( ignore_case::hash( "EXPIRES" ) == ignore_case::internal_::hash_enum::c_Expires );
+static_assert( ignore_case::hash( "PUBLIC-KEY-PINS" ) == ignore_case::internal_::hash_enum::c_Public_Key_Pins );
+static_assert( ignore_case::hash( "X-FRAME-OPTIONS" ) == ignore_case::internal_::hash_enum::c_X_Frame_Options );
+static_assert( ignore_case::hash( "LARGE-ALLOCATION" ) == ignore_case::internal_::hash_enum::c_Large_Allocation );
+static_assert( ignore_case::hash( "TRANSFER-ENCODING" ) == ignore_case::internal_::hash_enum::c_Transfer_Encoding );
+static_assert( ignore_case::hash( "ACCESS-CONTROL-REQUEST-METHOD" ) == ignore_case::internal_::hash_enum::c_Access_Control_Request_Method );
+static_assert( ignore_case::hash( "ACCESS-CONTROL-REQUEST-HEADERS" ) == ignore_case::internal_::hash_enum::c_Access_Control_Request_Headers );
+static_assert( ignore_case::hash( "DATE" ) == ignore_case::internal_::hash_enum::c_Date );
+static_assert( ignore_case::hash( "CONTENT-SECURITY-POLICY" ) == ignore_case::internal_::hash_enum::c_Content_Security_Policy );
+static_assert( ignore_case::hash( "PROXY-AUTHORIZATION" ) == ignore_case::internal_::hash_enum::c_Proxy_Authorization );
+static_assert( ignore_case::hash( "CONTENT-SECURITY-POLICY-REPORT-ONLY" ) == ignore_case::internal_::hash_enum::c_Content_Security_Policy_Report_Only );
+static_assert( ignore_case::hash( "WARNING" ) == ignore_case::internal_::hash_enum::c_Warning );
+static_assert( ignore_case::hash( "TRAILER" ) == ignore_case::internal_::hash_enum::c_Trailer );
+static_assert( ignore_case::hash( "TE" ) == ignore_case::internal_::hash_enum::c_TE );
+static_assert( ignore_case::hash( "VIA" ) == ignore_case::internal_::hash_enum::c_Via );
+static_assert( ignore_case::hash( "X-XSS-PROTECTION" ) == ignore_case::internal_::hash_enum::c_X_XSS_Protection );
+static_assert( ignore_case::hash( "PUBLIC-KEY-PINS-REPORT-ONLY" ) == ignore_case::internal_::hash_enum::c_Public_Key_Pins_Report_Only );
+static_assert( ignore_case::hash( "X-FORWARDED-HOST" ) == ignore_case::internal_::hash_enum::c_X_Forwarded_Host );
+static_assert( ignore_case::hash( "VARY" ) == ignore_case::internal_::hash_enum::c_Vary );
+static_assert( ignore_case::hash( "DNT" ) == ignore_case::internal_::hash_enum::c_DNT );
+static_assert( ignore_case::hash( "SET-COOKIE" ) == ignore_case::internal_::hash_enum::c_Set_Cookie );
+static_assert( ignore_case::hash( "FORWARDED" ) == ignore_case::internal_::hash_enum::c_Forwarded );
+static_assert( ignore_case::hash( "CONTENT-LOCATION" ) == ignore_case::internal_::hash_enum::c_Content_Location );
+static_assert( ignore_case::hash( "ALLOW" ) == ignore_case::internal_::hash_enum::c_Allow );
+static_assert( ignore_case::hash( "WWW-AUTHENTICATE" ) == ignore_case::internal_::hash_enum::c_WWW_Authenticate );
+static_assert( ignore_case::hash( "CONTENT-ENCODING" ) == ignore_case::internal_::hash_enum::c_Content_Encoding );
+static_assert( ignore_case::hash( "ACCEPT" ) == ignore_case::internal_::hash_enum::c_Accept );
+static_assert( ignore_case::hash( "AGE" ) == ignore_case::internal_::hash_enum::c_Age );
+static_assert( ignore_case::hash( "ACCESS-CONTROL-ALLOW-ORIGIN" ) == ignore_case::internal_::hash_enum::c_Access_Control_Allow_Origin );
+static_assert( ignore_case::hash( "EXPECT-CT" ) == ignore_case::internal_::hash_enum::c_Expect_CT );
+static_assert( ignore_case::hash( "X-CONTENT-TYPE-OPTIONS" ) == ignore_case::internal_::hash_enum::c_X_Content_Type_Options );
+static_assert( ignore_case::hash( "CONTENT-RANGE" ) == ignore_case::internal_::hash_enum::c_Content_Range );
+static_assert( ignore_case::hash( "KEEP-ALIVE" ) == ignore_case::internal_::hash_enum::c_Keep_Alive );
+static_assert( ignore_case::hash( "LAST-MODIFIED" ) == ignore_case::internal_::hash_enum::c_Last_Modified );
+static_assert( ignore_case::hash( "ACCESS-CONTROL-EXPOSE-HEADERS" ) == ignore_case::internal_::hash_enum::c_Access_Control_Expose_Headers );
+static_assert( ignore_case::hash( "AUTHORIZATION" ) == ignore_case::internal_::hash_enum::c_Authorization );
+static_assert( ignore_case::hash( "SOURCEMAP" ) == ignore_case::internal_::hash_enum::c_SourceMap );
+static_assert( ignore_case::hash( "TK" ) == ignore_case::internal_::hash_enum::c_Tk );
+static_assert( ignore_case::hash( "REFERER" ) == ignore_case::internal_::hash_enum::c_Referer );
+static_assert( ignore_case::hash( "ACCESS-CONTROL-ALLOW-HEADERS" ) == ignore_case::internal_::hash_enum::c_Access_Control_Allow_Headers );
+static_assert( ignore_case::hash( "SET-COOKIE2" ) == ignore_case::internal_::hash_enum::c_Set_Cookie2 );
+static_assert( ignore_case::hash( "CONNECTION" ) == ignore_case::internal_::hash_enum::c_Connection );
+static_assert( ignore_case::hash( "SEC-WEBSOCKET-ACCEPT" ) == ignore_case::internal_::hash_enum::c_Sec_WebSocket_Accept );
+static_assert( ignore_case::hash( "IF-MATCH" ) == ignore_case::internal_::hash_enum::c_If_Match );
+static_assert( ignore_case::hash( "ACCEPT-CHARSET" ) == ignore_case::internal_::hash_enum::c_Accept_Charset );
+static_assert( ignore_case::hash( "CONTENT-DISPOSITION" ) == ignore_case::internal_::hash_enum::c_Content_Disposition );
+static_assert( ignore_case::hash( "LOCATION" ) == ignore_case::internal_::hash_enum::c_Location );
+static_assert( ignore_case::hash( "EXPECT" ) == ignore_case::internal_::hash_enum::c_Expect );
+static_assert( ignore_case::hash( "X-DNS-PREFETCH-CONTROL" ) == ignore_case::internal_::hash_enum::c_X_DNS_Prefetch_Control );
+
+#endif // IGNORE_CASE__HASH_HPP_
@@ -0,0 +1,261 @@
+#ifndef STATUS__REASON_HPP_
+#define STATUS__REASON_HPP_
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+namespace status {
+
+namespace internal_ {
+
+enum class reason_enum
+{
+    default_ = -1,
+    c_Created = 0,
+    c_See_Other = 1,
+    c_Bad_Gateway = 2,
+    c_URI_Too_Long = 3,
+    c_Request_Timeout = 4,
+    c_Not_Modified = 5,
+    c_Moved_Permanently = 6,
+    c_OK = 7,
+    c_Continue = 8,
+    c_Bad_Request = 9,
+    c_Switching_Protocols = 10,
+    c_No_Content = 11,
+    c_Multiple_Choices = 12,
+    c_Temporary_Redirect = 13,
+    c_Gone = 14,
+    c_Internal_Server_Error = 15,
+    c_Method_Not_Allowed = 16,
+    c_Not_Found = 17,
+    c_Length_Required = 18,
+    c_Unsupported_Media_Type = 19,
+    c_Conflict = 20,
+    c_Permanent_Redirect = 21,
+    c_Found = 22,
+    c_Unauthorized = 23,
+    c_Forbidden = 24,
+    c_Gateway_Timeout = 25,
+    c_Too_Many_Requests = 26,
+    c_Not_Implemented = 27,
+    c_Partial_Content = 28,
+    c_Service_Unavailable = 29,
+    c_Accepted = 30,
+    c_Payload_Too_Large = 31,
+    c_Not_Acceptable = 32,
+};
+
+} // namespace internal_
+
+// Number of keywords, enum values other than the default are in [ 0, reason_count )
+constexpr size_t reason_count = 33;
+
+constexpr internal_::reason_enum reason( std::string_view s );
+
+using reason_value_type = int;
+
+// Returns the value given to keyword s, nullptr if s is not a keyword
+constexpr const reason_value_type* reason_value( std::string_view s );
+
+namespace internal_ {
+
+constexpr uint64_t load_le8( const char *p )
+{
+    return uint64_t( static_cast< unsigned char >( p[ 0 ] ) )
+         | uint64_t( static_cast< unsigned char >( p[ 1 ] ) ) << 8
+         | uint64_t( static_cast< unsigned char >( p[ 2 ] ) ) << 16
+         | uint64_t( static_cast< unsigned char >( p[ 3 ] ) ) << 24
+         | uint64_t( static_cast< unsigned char >( p[ 4 ] ) ) << 32
+         | uint64_t( static_cast< unsigned char >( p[ 5 ] ) ) << 40
+         | uint64_t( static_cast< unsigned char >( p[ 6 ] ) ) << 48
+         | uint64_t( static_cast< unsigned char >( p[ 7 ] ) ) << 56;
+}
+
+constexpr uint64_t mix( uint64_t x )
+{
+    x *= 0xBF58476D1CE4E5B9ull;
+    return x ^ ( x >> 31 );
+}
+
+// Last 8 bytes overlap with the previous ones, instead of a loop for the tail
+constexpr uint64_t full_key_hash( std::string_view s )
+{
+    uint64_t h = 0xE220A8397B1DCDAFull ^ ( s.size() * 0x9E3779B97F4A7C15ull );
+    if ( s.size() < 8 )
+    {
+        uint64_t tail = 0;
+        for ( size_t i = 0; i < s.size(); ++i )
+        {
+            tail |= uint64_t( static_cast< unsigned char >( s[ i ] ) ) << ( i * 8 );
+        }
+        return mix( h ^ tail );
+    }
+
+    for ( size_t i = 0; i + 8 < s.size(); i += 8 )
+    {
+        h = mix( h ^ load_le8( s.data() + i ) );
+    }
+    return mix( h ^ load_le8( s.data() + s.size() - 8 ) );
+}
+
+constexpr std::array< uint8_t, 17 > displacements = {{
+    5, 17, 3, 2, 17, 0, 10, 42, 0, 15, 1, 26, 0, 0, 0, 53,
+    45,
+}};
+
+// High bits of the hash pick a bucket, whose displacement is mixed into the
+// hash again for the slot
+constexpr size_t full_key_slot( std::string_view s )
+{
+    const uint64_t h = full_key_hash( s );
+    const uint64_t bucket = ( ( h >> 32 ) * 17 ) >> 32;
+    const uint64_t x = ( h ^ ( displacements[ bucket ] * 0x9E3779B97F4A7C15ull ) ) * 0xD6E8FEB86659FD93ull;
+    return ( ( x >> 32 ) * 33 ) >> 32;
+}
+
+struct word_entry
+{
+    std::string_view word;
+    reason_enum enum_val;
+    reason_value_type value;
+};
+
+constexpr std::array< word_entry, 33 > wordlist = {{
+    { "Created", reason_enum::c_Created, 201 },
+    { "See Other", reason_enum::c_See_Other, 303 },
+    { "Bad Gateway", reason_enum::c_Bad_Gateway, 502 },
+    { "URI Too Long", reason_enum::c_URI_Too_Long, 414 },
+    { "Request Timeout", reason_enum::c_Request_Timeout, 408 },
+    { "Not Modified", reason_enum::c_Not_Modified, 304 },
+    { "Moved Permanently", reason_enum::c_Moved_Permanently, 301 },
+    { "OK", reason_enum::c_OK, 200 },
+    { "Continue", reason_enum::c_Continue, 100 },
+    { "Bad Request", reason_enum::c_Bad_Request, 400 },
+    { "Switching Protocols", reason_enum::c_Switching_Protocols, 101 },
+    { "No Content", reason_enum::c_No_Content, 204 },
+    { "Multiple Choices", reason_enum::c_Multiple_Choices, 300 },
+    { "Temporary Redirect", reason_enum::c_Temporary_Redirect, 307 },
+    { "Gone", reason_enum::c_Gone, 410 },
+    { "Internal Server Error", reason_enum::c_Internal_Server_Error, 500 },
+    { "Method Not Allowed", reason_enum::c_Method_Not_Allowed, 405 },
+    { "Not Found", reason_enum::c_Not_Found, 404 },
+    { "Length Required", reason_enum::c_Length_Required, 411 },
+    { "Unsupported Media Type", reason_enum::c_Unsupported_Media_Type, 415 },
+    { "Conflict", reason_enum::c_Conflict, 409 },
+    { "Permanent Redirect", reason_enum::c_Permanent_Redirect, 308 },
+    { "Found", reason_enum::c_Found, 302 },
+    { "Unauthorized", reason_enum::c_Unauthorized, 401 },
+    { "Forbidden", reason_enum::c_Forbidden, 403 },
+    { "Gateway Timeout", reason_enum::c_Gateway_Timeout, 504 },
+    { "Too Many Requests", reason_enum::c_Too_Many_Requests, 429 },
+    { "Not Implemented", reason_enum::c_Not_Implemented, 501 },
+    { "Partial Content", reason_enum::c_Partial_Content, 206 },
+    { "Service Unavailable", reason_enum::c_Service_Unavailable, 503 },
+    { "Accepted", reason_enum::c_Accepted, 202 },
+    { "Payload Too Large", reason_enum::c_Payload_Too_Large, 413 },
+    { "Not Acceptable", reason_enum::c_Not_Acceptable, 406 },
+}};
+
+} // namespace internal_
+
+constexpr internal_::reason_enum reason( std::string_view s )
+{
+    constexpr size_t MinWordLength = 2;
+    constexpr size_t MaxWordLength = 22;
+
+    if ( s.size() < MinWordLength || s.size() > MaxWordLength )
+    {
+        return internal_::reason_enum::default_;
+    }
+
+    const internal_::word_entry &entry = internal_::wordlist[ internal_::full_key_slot( s ) ];
+    return entry.word == s ? entry.enum_val : internal_::reason_enum::default_;
+}
+
+constexpr const reason_value_type* reason_value( std::string_view s )
+{
+    constexpr size_t MinWordLength = 2;
+    constexpr size_t MaxWordLength = 22;
+
+    if ( s.size() < MinWordLength || s.size() > MaxWordLength )
+    {
+        return nullptr;
+    }
+
+    const internal_::word_entry &entry = internal_::wordlist[ internal_::full_key_slot( s ) ];
+    return entry.word == s ? &entry.value : nullptr;
+}
+
+} // namespace status {
+
+// Extra check for safety
+static_assert( status::reason( "Created" ) == status::internal_::reason_enum::c_Created );
+static_assert( status::reason( "See Other" ) == status::internal_::reason_enum::c_See_Other );
+static_assert( status::reason( "Bad Gateway" ) == status::internal_::reason_enum::c_Bad_Gateway );
+static_assert( status::reason( "URI Too Long" ) == status::internal_::reason_enum::c_URI_Too_Long );
+static_assert( status::reason( "Request Timeout" ) == status::internal_::reason_enum::c_Request_Timeout );
+static_assert( status::reason( "Not Modified" ) == status::internal_::reason_enum::c_Not_Modified );
+static_assert( status::reason( "Moved Permanently" ) == status::internal_::reason_enum::c_Moved_Permanently );
+static_assert( status::reason( "OK" ) == status::internal_::reason_enum::c_OK );
+static_assert( status::reason( "Continue" ) == status::internal_::reason_enum::c_Continue );
+static_assert( status::reason( "Bad Request" ) == status::internal_::reason_enum::c_Bad_Request );
+static_assert( status::reason( "Switching Protocols" ) == status::internal_::reason_enum::c_Switching_Protocols );
+static_assert( status::reason( "No Content" ) == status::internal_::reason_enum::c_No_Content );
+static_assert( status::reason( "Multiple Choices" ) == status::internal_::reason_enum::c_Multiple_Choices );
+static_assert( status::reason( "Temporary Redirect" ) == status::internal_::reason_enum::c_Temporary_Redirect );
+static_assert( status::reason( "Gone" ) == status::internal_::reason_enum::c_Gone );
+static_assert( status::reason( "Internal Server Error" ) == status::internal_::reason_enum::c_Internal_Server_Error );
+static_assert( status::reason( "Method Not Allowed" ) == status::internal_::reason_enum::c_Method_Not_Allowed );
+static_assert( status::reason( "Not Found" ) == status::internal_::reason_enum::c_Not_Found );
+static_assert( status::reason( "Length Required" ) == status::internal_::reason_enum::c_Length_Required );
+static_assert( status::reason( "Unsupported Media Type" ) == status::internal_::reason_enum::c_Unsupported_Media_Type );
+static_assert( status::reason( "Conflict" ) == status::internal_::reason_enum::c_Conflict );
+static_assert( status::reason( "Permanent Redirect" ) == status::internal_::reason_enum::c_Permanent_Redirect );
+static_assert( status::reason( "Found" ) == status::internal_::reason_enum::c_Found );
+static_assert( status::reason( "Unauthorized" ) == status::internal_::reason_enum::c_Unauthorized );
+static_assert( status::reason( "Forbidden" ) == status::internal_::reason_enum::c_Forbidden );
+static_assert( status::reason( "Gateway Timeout" ) == status::internal_::reason_enum::c_Gateway_Timeout );
+static_assert( status::reason( "Too Many Requests" ) == status::internal_::reason_enum::c_Too_Many_Requests );
+static_assert( status::reason( "Not Implemented" ) == status::internal_::reason_enum::c_Not_Implemented );
+static_assert( status::reason( "Partial Content" ) == status::internal_::reason_enum::c_Partial_Content );
+static_assert( status::reason( "Service Unavailable" ) == status::internal_::reason_enum::c_Service_Unavailable );
+static_assert( status::reason( "Accepted" ) == status::internal_::reason_enum::c_Accepted );
+static_assert( status::reason( "Payload Too Large" ) == status::internal_::reason_enum::c_Payload_Too_Large );
+static_assert( status::reason( "Not Acceptable" ) == status::internal_::reason_enum::c_Not_Acceptable );
+static_assert( status::reason_value( "Created" ) != nullptr );
+static_assert( status::reason_value( "See Other" ) != nullptr );
+static_assert( status::reason_value( "Bad Gateway" ) != nullptr );
+static_assert( status::reason_value( "URI Too Long" ) != nullptr );
+static_assert( status::reason_value( "Request Timeout" ) != nullptr );
+static_assert( status::reason_value( "Not Modified" ) != nullptr );
+static_assert( status::reason_value( "Moved Permanently" ) != nullptr );
+static_assert( status::reason_value( "OK" ) != nullptr );
+static_assert( status::reason_value( "Continue" ) != nullptr );
+static_assert( status::reason_value( "Bad Request" ) != nullptr );
+static_assert( status::reason_value( "Switching Protocols" ) != nullptr );
+static_assert( status::reason_value( "No Content" ) != nullptr );
+static_assert( status::reason_value( "Multiple Choices" ) != nullptr );
+static_assert( status::reason_value( "Temporary Redirect" ) != nullptr );
+static_assert( status::reason_value( "Gone" ) != nullptr );
+static_assert( status::reason_value( "Internal Server Error" ) != nullptr );
+static_assert( status::reason_value( "Method Not Allowed" ) != nullptr );
+static_assert( status::reason_value( "Not Found" ) != nullptr );
+static_assert( status::reason_value( "Length Required" ) != nullptr );
+static_assert( status::reason_value( "Unsupported Media Type" ) != nullptr );
+static_assert( status::reason_value( "Conflict" ) != nullptr );
+static_assert( status::reason_value( "Permanent Redirect" ) != nullptr );
+static_assert( status::reason_value( "Found" ) != nullptr );
+static_assert( status::reason_value( "Unauthorized" ) != nullptr );
+static_assert( status::reason_value( "Forbidden" ) != nullptr );
+static_assert( status::reason_value( "Gateway Timeout" ) != nullptr );
+static_assert( status::reason_value( "Too Many Requests" ) != nullptr );
+static_assert( status::reason_value( "Not Implemented" ) != nullptr );
+static_assert( status::reason_value( "Partial Content" ) != nullptr );
+static_assert( status::reason_value( "Service Unavailable" ) != nullptr );
+static_assert( status::reason_value( "Accepted" ) != nullptr );
+static_assert( status::reason_value( "Payload Too Large" ) != nullptr );
+static_assert( status::reason_value( "Not Acceptable" ) != nullptr );
+
+#endif // STATUS__REASON_HPP_
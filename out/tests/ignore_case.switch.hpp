@@ -0,0 +1,573 @@
+#ifndef IGNORE_CASE__HASH_HPP_
+#define IGNORE_CASE__HASH_HPP_
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+namespace ignore_case {
+
+namespace internal_ {
+
+enum class hash_enum
+{
+    default_ = -1,
+    c_Age = 0,
+    c_Via = 1,
+    c_Pragma = 2,
+    c_Expires = 3,
+    c_SourceMap = 4,
+    c_Set_Cookie = 5,
+    c_Accept_Ranges = 6,
+    c_TE = 7,
+    c_Accept_Language = 8,
+    c_Public_Key_Pins = 9,
+    c_Accept = 10,
+    c_Expect = 11,
+    c_Proxy_Authenticate = 12,
+    c_Cookie = 13,
+    c_Expect_CT = 14,
+    c_Vary = 15,
+    c_Access_Control_Max_Age = 16,
+    c_User_Agent = 17,
+    c_Accept_Charset = 18,
+    c_Content_Type = 19,
+    c_Content_Range = 20,
+    c_Clear_Site_Data = 21,
+    c_Upgrade_Insecure_Requests = 22,
+    c_Content_Language = 23,
+    c_X_Frame_Options = 24,
+    c_Sec_WebSocket_Accept = 25,
+    c_Authorization = 26,
+    c_Range = 27,
+    c_Server = 28,
+    c_Host = 29,
+    c_Access_Control_Expose_Headers = 30,
+    c_X_Content_Type_Options = 31,
+    c_Proxy_Authorization = 32,
+    c_Feature_Policy = 33,
+    c_Access_Control_Request_Headers = 34,
+    c_X_Forwarded_Host = 35,
+    c_Connection = 36,
+    c_ETag = 37,
+    c_Access_Control_Allow_Credentials = 38,
+    c_Trailer = 39,
+    c_Content_Length = 40,
+    c_Access_Control_Allow_Headers = 41,
+    c_Content_Location = 42,
+    c_Timing_Allow_Origin = 43,
+    c_X_XSS_Protection = 44,
+    c_Content_Disposition = 45,
+    c_Server_Timing = 46,
+    c_Accept_Encoding = 47,
+    c_Public_Key_Pins_Report_Only = 48,
+    c_X_Forwarded_For = 49,
+    c_Referrer_Policy = 50,
+    c_Allow = 51,
+    c_Keep_Alive = 52,
+    c_If_Range = 53,
+    c_Referer = 54,
+    c_Tk = 55,
+    c_Date = 56,
+    c_Content_Security_Policy = 57,
+    c_Retry_After = 58,
+    c_Transfer_Encoding = 59,
+    c_Content_Encoding = 60,
+    c_Strict_Transport_Security = 61,
+    c_If_Modified_Since = 62,
+    c_WWW_Authenticate = 63,
+    c_If_Unmodified_Since = 64,
+    c_Cache_Control = 65,
+    c_DNT = 66,
+    c_Location = 67,
+    c_Origin = 68,
+    c_Content_Security_Policy_Report_Only = 69,
+    c_From = 70,
+    c_Forwarded = 71,
+    c_Set_Cookie2 = 72,
+    c_If_Match = 73,
+    c_X_Forwarded_Proto = 74,
+    c_Large_Allocation = 75,
+    c_If_None_Match = 76,
+    c_Cookie2 = 77,
+    c_Access_Control_Allow_Methods = 78,
+    c_Access_Control_Allow_Origin = 79,
+    c_Access_Control_Request_Method = 80,
+    c_Warning = 81,
+    c_Last_Modified = 82,
+    c_X_DNS_Prefetch_Control = 83,
+};
+
+} // namespace internal_
+
+// Number of keywords, enum values other than the default are in [ 0, hash_count )
+constexpr size_t hash_count = 84;
+
+constexpr internal_::hash_enum hash( std::string_view s );
+
+namespace internal_ {
+
+constexpr uint64_t load_le8( const char *p )
+{
+    return uint64_t( static_cast< unsigned char >( p[ 0 ] ) )
+         | uint64_t( static_cast< unsigned char >( p[ 1 ] ) ) << 8
+         | uint64_t( static_cast< unsigned char >( p[ 2 ] ) ) << 16
+         | uint64_t( static_cast< unsigned char >( p[ 3 ] ) ) << 24
+         | uint64_t( static_cast< unsigned char >( p[ 4 ] ) ) << 32
+         | uint64_t( static_cast< unsigned char >( p[ 5 ] ) ) << 40
+         | uint64_t( static_cast< unsigned char >( p[ 6 ] ) ) << 48
+         | uint64_t( static_cast< unsigned char >( p[ 7 ] ) ) << 56;
+}
+
+constexpr uint64_t fold_case( uint64_t x )
+{
+    const uint64_t heptets = x & 0x7F7F7F7F7F7F7F7Full;
+    const uint64_t ge_A = heptets + 0x3F3F3F3F3F3F3F3Full; // High bit set if >= 'A'
+    const uint64_t gt_Z = heptets + 0x2525252525252525ull; // High bit set if > 'Z'
+    const uint64_t upper = ge_A & ~gt_Z & ~x & 0x8080808080808080ull;
+    return x | ( upper >> 2 );
+}
+
+constexpr bool equals_ignore_case( std::string_view s, std::string_view lower )
+{
+    if ( s.size() != lower.size() )
+    {
+        return false;
+    }
+
+    if ( s.size() < 8 )
+    {
+        uint64_t a = 0;
+        uint64_t b = 0;
+        for ( size_t i = 0; i < s.size(); ++i )
+        {
+            a |= uint64_t( static_cast< unsigned char >( s[ i ] ) ) << ( i * 8 );
+            b |= uint64_t( static_cast< unsigned char >( lower[ i ] ) ) << ( i * 8 );
+        }
+        return fold_case( a ) == b;
+    }
+
+    // Last 8 bytes overlap with the previous ones, instead of a loop for the tail
+    uint64_t diff = fold_case( load_le8( s.data() + s.size() - 8 ) ) ^ load_le8( lower.data() + s.size() - 8 );
+    for ( size_t i = 0; i + 8 < s.size(); i += 8 )
+    {
+        diff |= fold_case( load_le8( s.data() + i ) ) ^ load_le8( lower.data() + i );
+    }
+    return diff == 0;
+}
+
+constexpr std::array< int, 256 > asso_values = {
+       137,   137,   137,   137,   137,   137,   137,   137,   137,   137,
+       137,   137,   137,   137,   137,   137,   137,   137,   137,   137,
+       137,   137,   137,   137,   137,   137,   137,   137,   137,   137,
+       137,   137,   137,   137,   137,   137,   137,   137,   137,   137,
+       137,   137,   137,   137,   137,     8,   137,   137,   137,   137,
+        71,   137,   137,   137,   137,   137,   137,   137,   137,   137,
+       137,   137,   137,   137,   137,     0,   137,    14,    62,     1,
+        11,    41,    21,    55,   137,    52,    49,    66,    21,    52,
+         1,   137,    29,     1,    12,     3,     2,    57,    16,    17,
+       137,   137,   137,   137,   137,   137,   137,     0,   137,    14,
+        62,     1,    11,    41,    21,    55,   137,    52,    49,    66,
+        21,    52,     1,   137,    29,     1,    12,     3,     2,    57,
+        16,    17,   137,   137,   137,   137,   137,   137,   137,   137,
+       137,   137,   137,   137,   137,   137,   137,   137,   137,   137,
+       137,   137,   137,   137,   137,   137,   137,   137,   137,   137,
+       137,   137,   137,   137,   137,   137,   137,   137,   137,   137,
+       137,   137,   137,   137,   137,   137,   137,   137,   137,   137,
+       137,   137,   137,   137,   137,   137,   137,   137,   137,   137,
+       137,   137,   137,   137,   137,   137,   137,   137,   137,   137,
+       137,   137,   137,   137,   137,   137,   137,   137,   137,   137,
+       137,   137,   137,   137,   137,   137,   137,   137,   137,   137,
+       137,   137,   137,   137,   137,   137,   137,   137,   137,   137,
+       137,   137,   137,   137,   137,   137,   137,   137,   137,   137,
+       137,   137,   137,   137,   137,   137,   137,   137,   137,   137,
+       137,   137,   137,   137,   137,   137,   137,   137,   137,   137,
+       137,   137,   137,   137,   137,   137,
+};
+
+struct word_entry
+{
+    std::string_view word;
+    hash_enum enum_val;
+};
+
+constexpr std::array< word_entry, 137 > wordlist = {{
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "age", hash_enum::c_Age },
+    { "via", hash_enum::c_Via },
+    { "", hash_enum::default_ },
+    { "pragma", hash_enum::c_Pragma },
+    { "", hash_enum::default_ },
+    { "expires", hash_enum::c_Expires },
+    { "", hash_enum::default_ },
+    { "sourcemap", hash_enum::c_SourceMap },
+    { "set-cookie", hash_enum::c_Set_Cookie },
+    { "", hash_enum::default_ },
+    { "accept-ranges", hash_enum::c_Accept_Ranges },
+    { "te", hash_enum::c_TE },
+    { "accept-language", hash_enum::c_Accept_Language },
+    { "public-key-pins", hash_enum::c_Public_Key_Pins },
+    { "accept", hash_enum::c_Accept },
+    { "expect", hash_enum::c_Expect },
+    { "proxy-authenticate", hash_enum::c_Proxy_Authenticate },
+    { "cookie", hash_enum::c_Cookie },
+    { "expect-ct", hash_enum::c_Expect_CT },
+    { "vary", hash_enum::c_Vary },
+    { "access-control-max-age", hash_enum::c_Access_Control_Max_Age },
+    { "user-agent", hash_enum::c_User_Agent },
+    { "accept-charset", hash_enum::c_Accept_Charset },
+    { "content-type", hash_enum::c_Content_Type },
+    { "content-range", hash_enum::c_Content_Range },
+    { "clear-site-data", hash_enum::c_Clear_Site_Data },
+    { "upgrade-insecure-requests", hash_enum::c_Upgrade_Insecure_Requests },
+    { "content-language", hash_enum::c_Content_Language },
+    { "x-frame-options", hash_enum::c_X_Frame_Options },
+    { "sec-websocket-accept", hash_enum::c_Sec_WebSocket_Accept },
+    { "authorization", hash_enum::c_Authorization },
+    { "range", hash_enum::c_Range },
+    { "server", hash_enum::c_Server },
+    { "host", hash_enum::c_Host },
+    { "access-control-expose-headers", hash_enum::c_Access_Control_Expose_Headers },
+    { "", hash_enum::default_ },
+    { "x-content-type-options", hash_enum::c_X_Content_Type_Options },
+    { "proxy-authorization", hash_enum::c_Proxy_Authorization },
+    { "feature-policy", hash_enum::c_Feature_Policy },
+    { "access-control-request-headers", hash_enum::c_Access_Control_Request_Headers },
+    { "x-forwarded-host", hash_enum::c_X_Forwarded_Host },
+    { "connection", hash_enum::c_Connection },
+    { "etag", hash_enum::c_ETag },
+    { "access-control-allow-credentials", hash_enum::c_Access_Control_Allow_Credentials },
+    { "trailer", hash_enum::c_Trailer },
+    { "content-length", hash_enum::c_Content_Length },
+    { "access-control-allow-headers", hash_enum::c_Access_Control_Allow_Headers },
+    { "content-location", hash_enum::c_Content_Location },
+    { "timing-allow-origin", hash_enum::c_Timing_Allow_Origin },
+    { "x-xss-protection", hash_enum::c_X_XSS_Protection },
+    { "content-disposition", hash_enum::c_Content_Disposition },
+    { "server-timing", hash_enum::c_Server_Timing },
+    { "accept-encoding", hash_enum::c_Accept_Encoding },
+    { "public-key-pins-report-only", hash_enum::c_Public_Key_Pins_Report_Only },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "x-forwarded-for", hash_enum::c_X_Forwarded_For },
+    { "referrer-policy", hash_enum::c_Referrer_Policy },
+    { "allow", hash_enum::c_Allow },
+    { "keep-alive", hash_enum::c_Keep_Alive },
+    { "if-range", hash_enum::c_If_Range },
+    { "referer", hash_enum::c_Referer },
+    { "tk", hash_enum::c_Tk },
+    { "date", hash_enum::c_Date },
+    { "content-security-policy", hash_enum::c_Content_Security_Policy },
+    { "retry-after", hash_enum::c_Retry_After },
+    { "transfer-encoding", hash_enum::c_Transfer_Encoding },
+    { "content-encoding", hash_enum::c_Content_Encoding },
+    { "strict-transport-security", hash_enum::c_Strict_Transport_Security },
+    { "if-modified-since", hash_enum::c_If_Modified_Since },
+    { "www-authenticate", hash_enum::c_WWW_Authenticate },
+    { "if-unmodified-since", hash_enum::c_If_Unmodified_Since },
+    { "cache-control", hash_enum::c_Cache_Control },
+    { "dnt", hash_enum::c_DNT },
+    { "location", hash_enum::c_Location },
+    { "origin", hash_enum::c_Origin },
+    { "content-security-policy-report-only", hash_enum::c_Content_Security_Policy_Report_Only },
+    { "from", hash_enum::c_From },
+    { "forwarded", hash_enum::c_Forwarded },
+    { "set-cookie2", hash_enum::c_Set_Cookie2 },
+    { "if-match", hash_enum::c_If_Match },
+    { "x-forwarded-proto", hash_enum::c_X_Forwarded_Proto },
+    { "large-allocation", hash_enum::c_Large_Allocation },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "if-none-match", hash_enum::c_If_None_Match },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "cookie2", hash_enum::c_Cookie2 },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "access-control-allow-methods", hash_enum::c_Access_Control_Allow_Methods },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "access-control-allow-origin", hash_enum::c_Access_Control_Allow_Origin },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "access-control-request-method", hash_enum::c_Access_Control_Request_Method },
+    { "", hash_enum::default_ },
+    { "warning", hash_enum::c_Warning },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "last-modified", hash_enum::c_Last_Modified },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "x-dns-prefetch-control", hash_enum::c_X_DNS_Prefetch_Control },
+}};
+
+} // namespace internal_
+
+constexpr internal_::hash_enum hash( std::string_view s )
+{
+    constexpr size_t MinWordLength = 2;
+    constexpr size_t MaxWordLength = 35;
+    constexpr size_t MaxHashValue = 136;
+
+    if ( s.size() < MinWordLength || s.size() > MaxWordLength )
+    {
+        return internal_::hash_enum::default_;
+    }
+
+    size_t hash_val = s.size();
+    hash_val += internal_::asso_values[ static_cast< unsigned char >( s[ s.size() - 1 ] ) ];
+    switch( s.size() )
+    {
+                       case 35:
+    [[ fallthrough ]]; case 34:
+    [[ fallthrough ]]; case 33:
+    [[ fallthrough ]]; case 32:
+    [[ fallthrough ]]; case 31:
+    [[ fallthrough ]]; case 30:
+    [[ fallthrough ]]; case 29:
+    [[ fallthrough ]]; case 28:
+    [[ fallthrough ]]; case 27:
+    [[ fallthrough ]]; case 26:
+    [[ fallthrough ]]; case 25:
+    [[ fallthrough ]]; case 24:
+    [[ fallthrough ]]; case 23:
+    [[ fallthrough ]]; case 22:
+        hash_val += internal_::asso_values[ static_cast< unsigned char >( s[ 21] ) ];
+    [[ fallthrough ]]; case 21:
+    [[ fallthrough ]]; case 20:
+    [[ fallthrough ]]; case 19:
+    [[ fallthrough ]]; case 18:
+    [[ fallthrough ]]; case 17:
+    [[ fallthrough ]]; case 16:
+    [[ fallthrough ]]; case 15:
+    [[ fallthrough ]]; case 14:
+    [[ fallthrough ]]; case 13:
+    [[ fallthrough ]]; case 12:
+    [[ fallthrough ]]; case 11:
+    [[ fallthrough ]]; case 10:
+    [[ fallthrough ]]; case 9:
+    [[ fallthrough ]]; case 8:
+    [[ fallthrough ]]; case 7:
+    [[ fallthrough ]]; case 6:
+    [[ fallthrough ]]; case 5:
+    [[ fallthrough ]]; case 4:
+    [[ fallthrough ]]; case 3:
+    [[ fallthrough ]]; case 2:
+    [[ fallthrough ]]; case 1:
+        hash_val += internal_::asso_values[ static_cast< unsigned char >( s[ 0] ) ];
+    }
+
+    if ( hash_val <= MaxHashValue )
+    {
+        const size_t slot = hash_val;
+        if ( internal_::equals_ignore_case( s, internal_::wordlist[ slot ].word ) )
+        {
+            return internal_::wordlist[ slot ].enum_val;
+        }
+    }
+    return internal_::hash_enum::default_;
+}
+
+} // namespace ignore_case {
+
+// Extra check for safety
+static_assert( ignore_case::hash( "Age" ) == ignore_case::internal_::hash_enum::c_Age );
+static_assert( ignore_case::hash( "Via" ) == ignore_case::internal_::hash_enum::c_Via );
+static_assert( ignore_case::hash( "Pragma" ) == ignore_case::internal_::hash_enum::c_Pragma );
+static_assert( ignore_case::hash( "Expires" ) == ignore_case::internal_::hash_enum::c_Expires );
+static_assert( ignore_case::hash( "SourceMap" ) == ignore_case::internal_::hash_enum::c_SourceMap );
+static_assert( ignore_case::hash( "Set-Cookie" ) == ignore_case::internal_::hash_enum::c_Set_Cookie );
+static_assert( ignore_case::hash( "Accept-Ranges" ) == ignore_case::internal_::hash_enum::c_Accept_Ranges );
+static_assert( ignore_case::hash( "TE" ) == ignore_case::internal_::hash_enum::c_TE );
+static_assert( ignore_case::hash( "Accept-Language" ) == ignore_case::internal_::hash_enum::c_Accept_Language );
+static_assert( ignore_case::hash( "Public-Key-Pins" ) == ignore_case::internal_::hash_enum::c_Public_Key_Pins );
+static_assert( ignore_case::hash( "Accept" ) == ignore_case::internal_::hash_enum::c_Accept );
+static_assert( ignore_case::hash( "Expect" ) == ignore_case::internal_::hash_enum::c_Expect );
+static_assert( ignore_case::hash( "Proxy-Authenticate" ) == ignore_case::internal_::hash_enum::c_Proxy_Authenticate );
+static_assert( ignore_case::hash( "Cookie" ) == ignore_case::internal_::hash_enum::c_Cookie );
+static_assert( ignore_case::hash( "Expect-CT" ) == ignore_case::internal_::hash_enum::c_Expect_CT );
+static_assert( ignore_case::hash( "Vary" ) == ignore_case::internal_::hash_enum::c_Vary );
+static_assert( ignore_case::hash( "Access-Control-Max-Age" ) == ignore_case::internal_::hash_enum::c_Access_Control_Max_Age );
+static_assert( ignore_case::hash( "User-Agent" ) == ignore_case::internal_::hash_enum::c_User_Agent );
+static_assert( ignore_case::hash( "Accept-Charset" ) == ignore_case::internal_::hash_enum::c_Accept_Charset );
+static_assert( ignore_case::hash( "Content-Type" ) == ignore_case::internal_::hash_enum::c_Content_Type );
+static_assert( ignore_case::hash( "Content-Range" ) == ignore_case::internal_::hash_enum::c_Content_Range );
+static_assert( ignore_case::hash( "Clear-Site-Data" ) == ignore_case::internal_::hash_enum::c_Clear_Site_Data );
+static_assert( ignore_case::hash( "Upgrade-Insecure-Requests" ) == ignore_case::internal_::hash_enum::c_Upgrade_Insecure_Requests );
+static_assert( ignore_case::hash( "Content-Language" ) == ignore_case::internal_::hash_enum::c_Content_Language );
+static_assert( ignore_case::hash( "X-Frame-Options" ) == ignore_case::internal_::hash_enum::c_X_Frame_Options );
+static_assert( ignore_case::hash( "Sec-WebSocket-Accept" ) == ignore_case::internal_::hash_enum::c_Sec_WebSocket_Accept );
+static_assert( ignore_case::hash( "Authorization" ) == ignore_case::internal_::hash_enum::c_Authorization );
+static_assert( ignore_case::hash( "Range" ) == ignore_case::internal_::hash_enum::c_Range );
+static_assert( ignore_case::hash( "Server" ) == ignore_case::internal_::hash_enum::c_Server );
+static_assert( ignore_case::hash( "Host" ) == ignore_case::internal_::hash_enum::c_Host );
+static_assert( ignore_case::hash( "Access-Control-Expose-Headers" ) == ignore_case::internal_::hash_enum::c_Access_Control_Expose_Headers );
+static_assert( ignore_case::hash( "X-Content-Type-Options" ) == ignore_case::internal_::hash_enum::c_X_Content_Type_Options );
+static_assert( ignore_case::hash( "Proxy-Authorization" ) == ignore_case::internal_::hash_enum::c_Proxy_Authorization );
+static_assert( ignore_case::hash( "Feature-Policy" ) == ignore_case::internal_::hash_enum::c_Feature_Policy );
+static_assert( ignore_case::hash( "Access-Control-Request-Headers" ) == ignore_case::internal_::hash_enum::c_Access_Control_Request_Headers );
+static_assert( ignore_case::hash( "X-Forwarded-Host" ) == ignore_case::internal_::hash_enum::c_X_Forwarded_Host );
+static_assert( ignore_case::hash( "Connection" ) == ignore_case::internal_::hash_enum::c_Connection );
+static_assert( ignore_case::hash( "ETag" ) == ignore_case::internal_::hash_enum::c_ETag );
+static_assert( ignore_case::hash( "Access-Control-Allow-Credentials" ) == ignore_case::internal_::hash_enum::c_Access_Control_Allow_Credentials );
+static_assert( ignore_case::hash( "Trailer" ) == ignore_case::internal_::hash_enum::c_Trailer );
+static_assert( ignore_case::hash( "Content-Length" ) == ignore_case::internal_::hash_enum::c_Content_Length );
+static_assert( ignore_case::hash( "Access-Control-Allow-Headers" ) == ignore_case::internal_::hash_enum::c_Access_Control_Allow_Headers );
+static_assert( ignore_case::hash( "Content-Location" ) == ignore_case::internal_::hash_enum::c_Content_Location );
+static_assert( ignore_case::hash( "Timing-Allow-Origin" ) == ignore_case::internal_::hash_enum::c_Timing_Allow_Origin );
+static_assert( ignore_case::hash( "X-XSS-Protection" ) == ignore_case::internal_::hash_enum::c_X_XSS_Protection );
+static_assert( ignore_case::hash( "Content-Disposition" ) == ignore_case::internal_::hash_enum::c_Content_Disposition );
+static_assert( ignore_case::hash( "Server-Timing" ) == ignore_case::internal_::hash_enum::c_Server_Timing );
+static_assert( ignore_case::hash( "Accept-Encoding" ) == ignore_case::internal_::hash_enum::c_Accept_Encoding );
+static_assert( ignore_case::hash( "Public-Key-Pins-Report-Only" ) == ignore_case::internal_::hash_enum::c_Public_Key_Pins_Report_Only );
+static_assert( ignore_case::hash( "X-Forwarded-For" ) == ignore_case::internal_::hash_enum::c_X_Forwarded_For );
+static_assert( ignore_case::hash( "Referrer-Policy" ) == ignore_case::internal_::hash_enum::c_Referrer_Policy );
+static_assert( ignore_case::hash( "Allow" ) == ignore_case::internal_::hash_enum::c_Allow );
+static_assert( ignore_case::hash( "Keep-Alive" ) == ignore_case::internal_::hash_enum::c_Keep_Alive );
+static_assert( ignore_case::hash( "If-Range" ) == ignore_case::internal_::hash_enum::c_If_Range );
+static_assert( ignore_case::hash( "Referer" ) == ignore_case::internal_::hash_enum::c_Referer );
+static_assert( ignore_case::hash( "Tk" ) == ignore_case::internal_::hash_enum::c_Tk );
+static_assert( ignore_case::hash( "Date" ) == ignore_case::internal_::hash_enum::c_Date );
+static_assert( ignore_case::hash( "Content-Security-Policy" ) == ignore_case::internal_::hash_enum::c_Content_Security_Policy );
+static_assert( ignore_case::hash( "Retry-After" ) == ignore_case::internal_::hash_enum::c_Retry_After );
+static_assert( ignore_case::hash( "Transfer-Encoding" ) == ignore_case::internal_::hash_enum::c_Transfer_Encoding );
+static_assert( ignore_case::hash( "Content-Encoding" ) == ignore_case::internal_::hash_enum::c_Content_Encoding );
+static_assert( ignore_case::hash( "Strict-Transport-Security" ) == ignore_case::internal_::hash_enum::c_Strict_Transport_Security );
+static_assert( ignore_case::hash( "If-Modified-Since" ) == ignore_case::internal_::hash_enum::c_If_Modified_Since );
+static_assert( ignore_case::hash( "WWW-Authenticate" ) == ignore_case::internal_::hash_enum::c_WWW_Authenticate );
+static_assert( ignore_case::hash( "If-Unmodified-Since" ) == ignore_case::internal_::hash_enum::c_If_Unmodified_Since );
+static_assert( ignore_case::hash( "Cache-Control" ) == ignore_case::internal_::hash_enum::c_Cache_Control );
+static_assert( ignore_case::hash( "DNT" ) == ignore_case::internal_::hash_enum::c_DNT );
+static_assert( ignore_case::hash( "Location" ) == ignore_case::internal_::hash_enum::c_Location );
+static_assert( ignore_case::hash( "Origin" ) == ignore_case::internal_::hash_enum::c_Origin );
+static_assert( ignore_case::hash( "Content-Security-Policy-Report-Only" ) == ignore_case::internal_::hash_enum::c_Content_Security_Policy_Report_Only );
+static_assert( ignore_case::hash( "From" ) == ignore_case::internal_::hash_enum::c_From );
+static_assert( ignore_case::hash( "Forwarded" ) == ignore_case::internal_::hash_enum::c_Forwarded );
+static_assert( ignore_case::hash( "Set-Cookie2" ) == ignore_case::internal_::hash_enum::c_Set_Cookie2 );
+static_assert( ignore_case::hash( "If-Match" ) == ignore_case::internal_::hash_enum::c_If_Match );
+static_assert( ignore_case::hash( "X-Forwarded-Proto" ) == ignore_case::internal_::hash_enum::c_X_Forwarded_Proto );
+static_assert( ignore_case::hash( "Large-Allocation" ) == ignore_case::internal_::hash_enum::c_Large_Allocation );
+static_assert( ignore_case::hash( "If-None-Match" ) == ignore_case::internal_::hash_enum::c_If_None_Match );
+static_assert( ignore_case::hash( "Cookie2" ) == ignore_case::internal_::hash_enum::c_Cookie2 );
+static_assert( ignore_case::hash( "Access-Control-Allow-Methods" ) == ignore_case::internal_::hash_enum::c_Access_Control_Allow_Methods );
+static_assert( ignore_case::hash( "Access-Control-Allow-Origin" ) == ignore_case::internal_::hash_enum::c_Access_Control_Allow_Origin );
+static_assert( ignore_case::hash( "Access-Control-Request-Method" ) == ignore_case::internal_::hash_enum::c_Access_Control_Request_Method );
+static_assert( ignore_case::hash( "Warning" ) == ignore_case::internal_::hash_enum::c_Warning );
+static_assert( ignore_case::hash( "Last-Modified" ) == ignore_case::internal_::hash_enum::c_Last_Modified );
+static_assert( ignore_case::hash( "X-DNS-Prefetch-Control" ) == ignore_case::internal_::hash_enum::c_X_DNS_Prefetch_Control );
+static_assert( ignore_case::hash( "AGE" ) == ignore_case::internal_::hash_enum::c_Age );
+static_assert( ignore_case::hash( "VIA" ) == ignore_case::internal_::hash_enum::c_Via );
+static_assert( ignore_case::hash( "PRAGMA" ) == ignore_case::internal_::hash_enum::c_Pragma );
+static_assert( ignore_case::hash( "EXPIRES" ) == ignore_case::internal_::hash_enum::c_Expires );
+static_assert( ignore_case::hash( "SOURCEMAP" ) == ignore_case::internal_::hash_enum::c_SourceMap );
+static_assert( ignore_case::hash( "SET-COOKIE" ) == ignore_case::internal_::hash_enum::c_Set_Cookie );
+static_assert( ignore_case::hash( "ACCEPT-RANGES" ) == ignore_case::internal_::hash_enum::c_Accept_Ranges );
+static_assert( ignore_case::hash( "TE" ) == ignore_case::internal_::hash_enum::c_TE );
+static_assert( ignore_case::hash( "ACCEPT-LANGUAGE" ) == ignore_case::internal_::hash_enum::c_Accept_Language );
+static_assert( ignore_case::hash( "PUBLIC-KEY-PINS" ) == ignore_case::internal_::hash_enum::c_Public_Key_Pins );
+static_assert( ignore_case::hash( "ACCEPT" ) == ignore_case::internal_::hash_enum::c_Accept );
+static_assert( ignore_case::hash( "EXPECT" ) == ignore_case::internal_::hash_enum::c_Expect );
+static_assert( ignore_case::hash( "PROXY-AUTHENTICATE" ) == ignore_case::internal_::hash_enum::c_Proxy_Authenticate );
+static_assert( ignore_case::hash( "COOKIE" ) == ignore_case::internal_::hash_enum::c_Cookie );
+static_assert( ignore_case::hash( "EXPECT-CT" ) == ignore_case::internal_::hash_enum::c_Expect_CT );
+static_assert( ignore_case::hash( "VARY" ) == ignore_case::internal_::hash_enum::c_Vary );
+static_assert( ignore_case::hash( "ACCESS-CONTROL-MAX-AGE" ) == ignore_case::internal_::hash_enum::c_Access_Control_Max_Age );
+static_assert( ignore_case::hash( "USER-AGENT" ) == ignore_case::internal_::hash_enum::c_User_Agent );
+static_assert( ignore_case::hash( "ACCEPT-CHARSET" ) == ignore_case::internal_::hash_enum::c_Accept_Charset );
+static_assert( ignore_case::hash( "CONTENT-TYPE" ) == ignore_case::internal_::hash_enum::c_Content_Type );
+static_assert( ignore_case::hash( "CONTENT-RANGE" ) == ignore_case::internal_::hash_enum::c_Content_Range );
+static_assert( ignore_case::hash( "CLEAR-SITE-DATA" ) == ignore_case::internal_::hash_enum::c_Clear_Site_Data );
+static_assert( ignore_case::hash( "UPGRADE-INSECURE-REQUESTS" ) == ignore_case::internal_::hash_enum::c_Upgrade_Insecure_Requests );
+static_assert( ignore_case::hash( "CONTENT-LANGUAGE" ) == ignore_case::internal_::hash_enum::c_Content_Language );
+static_assert( ignore_case::hash( "X-FRAME-OPTIONS" ) == ignore_case::internal_::hash_enum::c_X_Frame_Options );
+static_assert( ignore_case::hash( "SEC-WEBSOCKET-ACCEPT" ) == ignore_case::internal_::hash_enum::c_Sec_WebSocket_Accept );
+static_assert( ignore_case::hash( "AUTHORIZATION" ) == ignore_case::internal_::hash_enum::c_Authorization );
+static_assert( ignore_case::hash( "RANGE" ) == ignore_case::internal_::hash_enum::c_Range );
+static_assert( ignore_case::hash( "SERVER" ) == ignore_case::internal_::hash_enum::c_Server );
+static_assert( ignore_case::hash( "HOST" ) == ignore_case::internal_::hash_enum::c_Host );
+static_assert( ignore_case::hash( "ACCESS-CONTROL-EXPOSE-HEADERS" ) == ignore_case::internal_::hash_enum::c_Access_Control_Expose_Headers );
+static_assert( ignore_case::hash( "X-CONTENT-TYPE-OPTIONS" ) == ignore_case::internal_::hash_enum::c_X_Content_Type_Options );
+static_assert( ignore_case::hash( "PROXY-AUTHORIZATION" ) == ignore_case::internal_::hash_enum::c_Proxy_Authorization );
+static_assert( ignore_case::hash( "FEATURE-POLICY" ) == ignore_case::internal_::hash_enum::c_Feature_Policy );
+static_assert( ignore_case::hash( "ACCESS-CONTROL-REQUEST-HEADERS" ) == ignore_case::internal_::hash_enum::c_Access_Control_Request_Headers );
+static_assert( ignore_case::hash( "X-FORWARDED-HOST" ) == ignore_case::internal_::hash_enum::c_X_Forwarded_Host );
+static_assert( ignore_case::hash( "CONNECTION" ) == ignore_case::internal_::hash_enum::c_Connection );
+static_assert( ignore_case::hash( "ETAG" ) == ignore_case::internal_::hash_enum::c_ETag );
+static_assert( ignore_case::hash( "ACCESS-CONTROL-ALLOW-CREDENTIALS" ) == ignore_case::internal_::hash_enum::c_Access_Control_Allow_Credentials );
+static_assert( ignore_case::hash( "TRAILER" ) == ignore_case::internal_::hash_enum::c_Trailer );
+static_assert( ignore_case::hash( "CONTENT-LENGTH" ) == ignore_case::internal_::hash_enum::c_Content_Length );
+static_assert( ignore_case::hash( "ACCESS-CONTROL-ALLOW-HEADERS" ) == ignore_case::internal_::hash_enum::c_Access_Control_Allow_Headers );
+static_assert( ignore_case::hash( "CONTENT-LOCATION" ) == ignore_case::internal_::hash_enum::c_Content_Location );
+static_assert( ignore_case::hash( "TIMING-ALLOW-ORIGIN" ) == ignore_case::internal_::hash_enum::c_Timing_Allow_Origin );
+static_assert( ignore_case::hash( "X-XSS-PROTECTION" ) == ignore_case::internal_::hash_enum::c_X_XSS_Protection );
+static_assert( ignore_case::hash( "CONTENT-DISPOSITION" ) == ignore_case::internal_::hash_enum::c_Content_Disposition );
+static_assert( ignore_case::hash( "SERVER-TIMING" ) == ignore_case::internal_::hash_enum::c_Server_Timing );
+static_assert( ignore_case::hash( "ACCEPT-ENCODING" ) == ignore_case::internal_::hash_enum::c_Accept_Encoding );
+static_assert( ignore_case::hash( "PUBLIC-KEY-PINS-REPORT-ONLY" ) == ignore_case::internal_::hash_enum::c_Public_Key_Pins_Report_Only );
+static_assert( ignore_case::hash( "X-FORWARDED-FOR" ) == ignore_case::internal_::hash_enum::c_X_Forwarded_For );
+static_assert( ignore_case::hash( "REFERRER-POLICY" ) == ignore_case::internal_::hash_enum::c_Referrer_Policy );
+static_assert( ignore_case::hash( "ALLOW" ) == ignore_case::internal_::hash_enum::c_Allow );
+static_assert( ignore_case::hash( "KEEP-ALIVE" ) == ignore_case::internal_::hash_enum::c_Keep_Alive );
+static_assert( ignore_case::hash( "IF-RANGE" ) == ignore_case::internal_::hash_enum::c_If_Range );
+static_assert( ignore_case::hash( "REFERER" ) == ignore_case::internal_::hash_enum::c_Referer );
+static_assert( ignore_case::hash( "TK" ) == ignore_case::internal_::hash_enum::c_Tk );
+static_assert( ignore_case::hash( "DATE" ) == ignore_case::internal_::hash_enum::c_Date );
+static_assert( ignore_case::hash( "CONTENT-SECURITY-POLICY" ) == ignore_case::internal_::hash_enum::c_Content_Security_Policy );
+static_assert( ignore_case::hash( "RETRY-AFTER" ) == ignore_case::internal_::hash_enum::c_Retry_After );
+static_assert( ignore_case::hash( "TRANSFER-ENCODING" ) == ignore_case::internal_::hash_enum::c_Transfer_Encoding );
+static_assert( ignore_case::hash( "CONTENT-ENCODING" ) == ignore_case::internal_::hash_enum::c_Content_Encoding );
+static_assert( ignore_case::hash( "STRICT-TRANSPORT-SECURITY" ) == ignore_case::internal_::hash_enum::c_Strict_Transport_Security );
+static_assert( ignore_case::hash( "IF-MODIFIED-SINCE" ) == ignore_case::internal_::hash_enum::c_If_Modified_Since );
+static_assert( ignore_case::hash( "WWW-AUTHENTICATE" ) == ignore_case::internal_::hash_enum::c_WWW_Authenticate );
+static_assert( ignore_case::hash( "IF-UNMODIFIED-SINCE" ) == ignore_case::internal_::hash_enum::c_If_Unmodified_Since );
+static_assert( ignore_case::hash( "CACHE-CONTROL" ) == ignore_case::internal_::hash_enum::c_Cache_Control );
+static_assert( ignore_case::hash( "DNT" ) == ignore_case::internal_::hash_enum::c_DNT );
+static_assert( ignore_case::hash( "LOCATION" ) == ignore_case::internal_::hash_enum::c_Location );
+static_assert( ignore_case::hash( "ORIGIN" ) == ignore_case::internal_::hash_enum::c_Origin );
+static_assert( ignore_case::hash( "CONTENT-SECURITY-POLICY-REPORT-ONLY" ) == ignore_case::internal_::hash_enum::c_Content_Security_Policy_Report_Only );
+static_assert( ignore_case::hash( "FROM" ) == ignore_case::internal_::hash_enum::c_From );
+static_assert( ignore_case::hash( "FORWARDED" ) == ignore_case::internal_::hash_enum::c_Forwarded );
+static_assert( ignore_case::hash( "SET-COOKIE2" ) == ignore_case::internal_::hash_enum::c_Set_Cookie2 );
+static_assert( ignore_case::hash( "IF-MATCH" ) == ignore_case::internal_::hash_enum::c_If_Match );
+static_assert( ignore_case::hash( "X-FORWARDED-PROTO" ) == ignore_case::internal_::hash_enum::c_X_Forwarded_Proto );
+static_assert( ignore_case::hash( "LARGE-ALLOCATION" ) == ignore_case::internal_::hash_enum::c_Large_Allocation );
+static_assert( ignore_case::hash( "IF-NONE-MATCH" ) == ignore_case::internal_::hash_enum::c_If_None_Match );
+static_assert( ignore_case::hash( "COOKIE2" ) == ignore_case::internal_::hash_enum::c_Cookie2 );
+static_assert( ignore_case::hash( "ACCESS-CONTROL-ALLOW-METHODS" ) == ignore_case::internal_::hash_enum::c_Access_Control_Allow_Methods );
+static_assert( ignore_case::hash( "ACCESS-CONTROL-ALLOW-ORIGIN" ) == ignore_case::internal_::hash_enum::c_Access_Control_Allow_Origin );
+static_assert( ignore_case::hash( "ACCESS-CONTROL-REQUEST-METHOD" ) == ignore_case::internal_::hash_enum::c_Access_Control_Request_Method );
+static_assert( ignore_case::hash( "WARNING" ) == ignore_case::internal_::hash_enum::c_Warning );
+static_assert( ignore_case::hash( "LAST-MODIFIED" ) == ignore_case::internal_::hash_enum::c_Last_Modified );
+static_assert( ignore_case::hash( "X-DNS-PREFETCH-CONTROL" ) == ignore_case::internal_::hash_enum::c_X_DNS_Prefetch_Control );
+
+#endif // IGNORE_CASE__HASH_HPP_
@@ -0,0 +1,604 @@
+#ifndef MATCHER__HASH_HPP_
+#define MATCHER__HASH_HPP_
+
+#include <array>
+#include <string_view>
+
+namespace matcher {
+
+namespace internal_ {
+
+enum class hash_enum
+{
+    default_ = -1,
+    c_A_B = 0,
+    c_Age = 1,
+    c_A_ = 2,
+    c__ = 3,
+    c_Cookie = 4,
+    c___ = 5,
+    c_Allow = 6,
+    c_Origin = 7,
+    c_Accept = 8,
+    c_Connection = 9,
+    c_Content_Type = 10,
+    c_Content_Range = 11,
+    c_Authorization = 12,
+    c_Accept_Language = 13,
+    c_Content_Language = 14,
+    c_Content_Location = 15,
+    c_Accept_Charset = 16,
+    c_Accept_Ranges = 17,
+    c_Content_Disposition = 18,
+    c_X_XSS_Protection = 19,
+    c_Set_Cookie = 20,
+    c_Access_Control_Max_Age = 21,
+    c_X_Forwarded_Host = 22,
+    c_X_Frame_Options = 23,
+    c_Content_Length = 24,
+    c_Accept_Encoding = 25,
+    c_Content_Encoding = 26,
+    c_Server = 27,
+    c_X_Forwarded_For = 28,
+    c_Proxy_Authenticate = 29,
+    c_Expect = 30,
+    c_Proxy_Authorization = 31,
+    c_Public_Key_Pins = 32,
+    c_Expires = 33,
+    c_Sec_WebSocket_Accept = 34,
+    c_Server_Timing = 35,
+    c_ETag = 36,
+    c_X_Content_Type_Options = 37,
+    c_Range = 38,
+    c_Access_Control_Request_Headers = 39,
+    c_Expect_CT = 40,
+    c_Trailer = 41,
+    c_Location = 42,
+    c_Timing_Allow_Origin = 43,
+    c_Public_Key_Pins_Report_Only = 44,
+    c_If_Range = 45,
+    c_Cache_Control = 46,
+    c_Access_Control_Request_Method = 47,
+    c_Strict_Transport_Security = 48,
+    c_Referrer_Policy = 49,
+    c_Large_Allocation = 50,
+    c_Referer = 51,
+    c_Transfer_Encoding = 52,
+    c_Date = 53,
+    c_If_Modified_Since = 54,
+    c_Retry_After = 55,
+    c_If_Unmodified_Since = 56,
+    c_If_Match = 57,
+    c_Content_Security_Policy = 58,
+    c_Vary = 59,
+    c_Clear_Site_Data = 60,
+    c_Last_Modified = 61,
+    c_If_None_Match = 62,
+    c_DNT = 63,
+    c_Pragma = 64,
+    c_User_Agent = 65,
+    c_A__0 = 66,
+    c_Access_Control_Allow_Methods = 67,
+    c____0 = 68,
+    c_WWW_Authenticate = 69,
+    c_Content_Security_Policy_Report_Only = 70,
+    c_Feature_Policy = 71,
+    c_Warning = 72,
+    c_Cookie2 = 73,
+    c_SourceMap = 74,
+    c_TE = 75,
+    c_X_Forwarded_Proto = 76,
+    c_From = 77,
+    c_Tk = 78,
+    c_Access_Control_Allow_Origin = 79,
+    c_Forwarded = 80,
+    c_Keep_Alive = 81,
+    c_Host = 82,
+    c_Upgrade_Insecure_Requests = 83,
+    c_Access_Control_Allow_Headers = 84,
+    c_Access_Control_Allow_Credentials = 85,
+    c_Access_Control_Expose_Headers = 86,
+    c_Set_Cookie2 = 87,
+    c_X_DNS_Prefetch_Control = 88,
+    c_Via = 89,
+};
+
+} // namespace internal_
+
+// Number of keywords, enum values other than the default are in [ 0, hash_count )
+constexpr size_t hash_count = 90;
+
+constexpr internal_::hash_enum hash( std::string_view s );
+
+namespace internal_ {
+
+constexpr std::array< int, 257 > asso_values = {
+       108,   108,   108,   108,   108,   108,   108,   108,   108,   108,
+       108,   108,   108,   108,   108,   108,   108,   108,   108,   108,
+       108,   108,   108,   108,   108,   108,   108,   108,   108,   108,
+       108,   108,   108,   108,   108,   108,   108,   108,   108,   108,
+       108,   108,   108,   108,   108,    53,   108,   108,   108,   108,
+        69,   108,   108,   108,   108,   108,   108,   108,   108,   108,
+       108,   108,   108,   108,   108,   108,     0,    49,     0,    51,
+        22,    58,    52,    76,    39,   108,    73,    35,   108,    53,
+         2,    13,   108,    35,    12,    25,    53,    56,    55,     4,
+       108,   108,   108,   108,   108,   108,   108,    48,   108,    36,
+        16,     1,   108,    13,    13,   108,   108,    54,    36,    18,
+         2,    58,    56,   108,    12,     7,     5,   108,   108,     4,
+       108,     2,   108,   108,   108,   108,   108,   108,   108,   108,
+       108,   108,   108,   108,   108,   108,   108,   108,   108,   108,
+       108,   108,   108,   108,   108,   108,   108,   108,   108,   108,
+       108,   108,   108,   108,   108,   108,   108,   108,   108,   108,
+       108,   108,   108,   108,   108,   108,   108,   108,   108,   108,
+       108,   108,   108,   108,   108,   108,   108,   108,   108,   108,
+       108,   108,   108,   108,   108,   108,   108,   108,   108,   108,
+       108,   108,   108,   108,   108,   108,   108,   108,   108,   108,
+       108,   108,   108,   108,   108,   108,   108,   108,   108,   108,
+       108,   108,   108,   108,   108,   108,   108,   108,   108,   108,
+       108,   108,   108,   108,   108,   108,   108,   108,   108,   108,
+       108,   108,   108,   108,   108,   108,   108,   108,   108,   108,
+       108,   108,   108,   108,   108,   108,   108,   108,   108,   108,
+       108,   108,   108,   108,    67,     3,     2,
+};
+
+struct word_entry
+{
+    std::string_view word;
+    hash_enum enum_val;
+};
+
+constexpr std::array< word_entry, 108 > wordlist = {{
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "A\xFF" "B", hash_enum::c_A_B },
+    { "Age", hash_enum::c_Age },
+    { "A\xFF", hash_enum::c_A_ },
+    { "\xFF", hash_enum::c__ },
+    { "Cookie", hash_enum::c_Cookie },
+    { "\xFE\xFF", hash_enum::c___ },
+    { "Allow", hash_enum::c_Allow },
+    { "Origin", hash_enum::c_Origin },
+    { "Accept", hash_enum::c_Accept },
+    { "Connection", hash_enum::c_Connection },
+    { "Content-Type", hash_enum::c_Content_Type },
+    { "Content-Range", hash_enum::c_Content_Range },
+    { "Authorization", hash_enum::c_Authorization },
+    { "Accept-Language", hash_enum::c_Accept_Language },
+    { "Content-Language", hash_enum::c_Content_Language },
+    { "Content-Location", hash_enum::c_Content_Location },
+    { "Accept-Charset", hash_enum::c_Accept_Charset },
+    { "Accept-Ranges", hash_enum::c_Accept_Ranges },
+    { "Content-Disposition", hash_enum::c_Content_Disposition },
+    { "X-XSS-Protection", hash_enum::c_X_XSS_Protection },
+    { "Set-Cookie", hash_enum::c_Set_Cookie },
+    { "Access-Control-Max-Age", hash_enum::c_Access_Control_Max_Age },
+    { "X-Forwarded-Host", hash_enum::c_X_Forwarded_Host },
+    { "X-Frame-Options", hash_enum::c_X_Frame_Options },
+    { "Content-Length", hash_enum::c_Content_Length },
+    { "Accept-Encoding", hash_enum::c_Accept_Encoding },
+    { "Content-Encoding", hash_enum::c_Content_Encoding },
+    { "Server", hash_enum::c_Server },
+    { "X-Forwarded-For", hash_enum::c_X_Forwarded_For },
+    { "Proxy-Authenticate", hash_enum::c_Proxy_Authenticate },
+    { "Expect", hash_enum::c_Expect },
+    { "Proxy-Authorization", hash_enum::c_Proxy_Authorization },
+    { "Public-Key-Pins", hash_enum::c_Public_Key_Pins },
+    { "Expires", hash_enum::c_Expires },
+    { "Sec-WebSocket-Accept", hash_enum::c_Sec_WebSocket_Accept },
+    { "Server-Timing", hash_enum::c_Server_Timing },
+    { "ETag", hash_enum::c_ETag },
+    { "X-Content-Type-Options", hash_enum::c_X_Content_Type_Options },
+    { "Range", hash_enum::c_Range },
+    { "Access-Control-Request-Headers", hash_enum::c_Access_Control_Request_Headers },
+    { "Expect-CT", hash_enum::c_Expect_CT },
+    { "Trailer", hash_enum::c_Trailer },
+    { "Location", hash_enum::c_Location },
+    { "Timing-Allow-Origin", hash_enum::c_Timing_Allow_Origin },
+    { "Public-Key-Pins-Report-Only", hash_enum::c_Public_Key_Pins_Report_Only },
+    { "If-Range", hash_enum::c_If_Range },
+    { "Cache-Control", hash_enum::c_Cache_Control },
+    { "Access-Control-Request-Method", hash_enum::c_Access_Control_Request_Method },
+    { "Strict-Transport-Security", hash_enum::c_Strict_Transport_Security },
+    { "Referrer-Policy", hash_enum::c_Referrer_Policy },
+    { "Large-Allocation", hash_enum::c_Large_Allocation },
+    { "Referer", hash_enum::c_Referer },
+    { "Transfer-Encoding", hash_enum::c_Transfer_Encoding },
+    { "Date", hash_enum::c_Date },
+    { "If-Modified-Since", hash_enum::c_If_Modified_Since },
+    { "Retry-After", hash_enum::c_Retry_After },
+    { "If-Unmodified-Since", hash_enum::c_If_Unmodified_Since },
+    { "If-Match", hash_enum::c_If_Match },
+    { "Content-Security-Policy", hash_enum::c_Content_Security_Policy },
+    { "Vary", hash_enum::c_Vary },
+    { "Clear-Site-Data", hash_enum::c_Clear_Site_Data },
+    { "Last-Modified", hash_enum::c_Last_Modified },
+    { "If-None-Match", hash_enum::c_If_None_Match },
+    { "DNT", hash_enum::c_DNT },
+    { "Pragma", hash_enum::c_Pragma },
+    { "User-Agent", hash_enum::c_User_Agent },
+    { "A\xFE", hash_enum::c_A__0 },
+    { "Access-Control-Allow-Methods", hash_enum::c_Access_Control_Allow_Methods },
+    { "\xFF\xFE", hash_enum::c____0 },
+    { "WWW-Authenticate", hash_enum::c_WWW_Authenticate },
+    { "Content-Security-Policy-Report-Only", hash_enum::c_Content_Security_Policy_Report_Only },
+    { "Feature-Policy", hash_enum::c_Feature_Policy },
+    { "Warning", hash_enum::c_Warning },
+    { "Cookie2", hash_enum::c_Cookie2 },
+    { "SourceMap", hash_enum::c_SourceMap },
+    { "TE", hash_enum::c_TE },
+    { "X-Forwarded-Proto", hash_enum::c_X_Forwarded_Proto },
+    { "From", hash_enum::c_From },
+    { "Tk", hash_enum::c_Tk },
+    { "Access-Control-Allow-Origin", hash_enum::c_Access_Control_Allow_Origin },
+    { "Forwarded", hash_enum::c_Forwarded },
+    { "Keep-Alive", hash_enum::c_Keep_Alive },
+    { "Host", hash_enum::c_Host },
+    { "Upgrade-Insecure-Requests", hash_enum::c_Upgrade_Insecure_Requests },
+    { "Access-Control-Allow-Headers", hash_enum::c_Access_Control_Allow_Headers },
+    { "Access-Control-Allow-Credentials", hash_enum::c_Access_Control_Allow_Credentials },
+    { "Access-Control-Expose-Headers", hash_enum::c_Access_Control_Expose_Headers },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "Set-Cookie2", hash_enum::c_Set_Cookie2 },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "X-DNS-Prefetch-Control", hash_enum::c_X_DNS_Prefetch_Control },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "Via", hash_enum::c_Via },
+}};
+
+} // namespace internal_
+
+constexpr internal_::hash_enum hash( std::string_view s )
+{
+    constexpr size_t MinWordLength = 1;
+    constexpr size_t MaxWordLength = 35;
+    constexpr size_t MaxHashValue = 107;
+
+    if ( s.size() < MinWordLength || s.size() > MaxWordLength )
+    {
+        return internal_::hash_enum::default_;
+    }
+
+    size_t hash_val = s.size();
+    hash_val += internal_::asso_values[ static_cast< unsigned char >( s[ s.size() - 1 ] ) ];
+    switch( s.size() )
+    {
+                       case 35:
+    [[ fallthrough ]]; case 34:
+    [[ fallthrough ]]; case 33:
+    [[ fallthrough ]]; case 32:
+    [[ fallthrough ]]; case 31:
+    [[ fallthrough ]]; case 30:
+    [[ fallthrough ]]; case 29:
+    [[ fallthrough ]]; case 28:
+    [[ fallthrough ]]; case 27:
+    [[ fallthrough ]]; case 26:
+    [[ fallthrough ]]; case 25:
+    [[ fallthrough ]]; case 24:
+    [[ fallthrough ]]; case 23:
+    [[ fallthrough ]]; case 22:
+        hash_val += internal_::asso_values[ static_cast< unsigned char >( s[ 21] ) ];
+    [[ fallthrough ]]; case 21:
+    [[ fallthrough ]]; case 20:
+    [[ fallthrough ]]; case 19:
+    [[ fallthrough ]]; case 18:
+    [[ fallthrough ]]; case 17:
+    [[ fallthrough ]]; case 16:
+    [[ fallthrough ]]; case 15:
+    [[ fallthrough ]]; case 14:
+    [[ fallthrough ]]; case 13:
+    [[ fallthrough ]]; case 12:
+    [[ fallthrough ]]; case 11:
+    [[ fallthrough ]]; case 10:
+    [[ fallthrough ]]; case 9:
+    [[ fallthrough ]]; case 8:
+    [[ fallthrough ]]; case 7:
+    [[ fallthrough ]]; case 6:
+    [[ fallthrough ]]; case 5:
+    [[ fallthrough ]]; case 4:
+    [[ fallthrough ]]; case 3:
+    [[ fallthrough ]]; case 2:
+    [[ fallthrough ]]; case 1:
+        hash_val += internal_::asso_values[ static_cast< unsigned char >( s[ 0] ) + 1 ];
+    }
+
+    if ( hash_val <= MaxHashValue )
+    {
+        const size_t slot = hash_val;
+        if ( internal_::wordlist[ slot ].word == s )
+        {
+            return internal_::wordlist[ slot ].enum_val;
+        }
+    }
+    return internal_::hash_enum::default_;
+}
+
+namespace internal_ {
+
+struct sorted_entry
+{
+    std::string_view word;
+    hash_enum enum_val;
+};
+
+// Keywords in lexicographic order of unsigned bytes
+constexpr std::array< sorted_entry, 90 > sorted_words = {{
+    { "Accept", hash_enum::c_Accept },
+    { "Accept-Charset", hash_enum::c_Accept_Charset },
+    { "Accept-Encoding", hash_enum::c_Accept_Encoding },
+    { "Accept-Language", hash_enum::c_Accept_Language },
+    { "Accept-Ranges", hash_enum::c_Accept_Ranges },
+    { "Access-Control-Allow-Credentials", hash_enum::c_Access_Control_Allow_Credentials },
+    { "Access-Control-Allow-Headers", hash_enum::c_Access_Control_Allow_Headers },
+    { "Access-Control-Allow-Methods", hash_enum::c_Access_Control_Allow_Methods },
+    { "Access-Control-Allow-Origin", hash_enum::c_Access_Control_Allow_Origin },
+    { "Access-Control-Expose-Headers", hash_enum::c_Access_Control_Expose_Headers },
+    { "Access-Control-Max-Age", hash_enum::c_Access_Control_Max_Age },
+    { "Access-Control-Request-Headers", hash_enum::c_Access_Control_Request_Headers },
+    { "Access-Control-Request-Method", hash_enum::c_Access_Control_Request_Method },
+    { "Age", hash_enum::c_Age },
+    { "Allow", hash_enum::c_Allow },
+    { "Authorization", hash_enum::c_Authorization },
+    { "A\xFE", hash_enum::c_A__0 },
+    { "A\xFF", hash_enum::c_A_ },
+    { "A\xFF" "B", hash_enum::c_A_B },
+    { "Cache-Control", hash_enum::c_Cache_Control },
+    { "Clear-Site-Data", hash_enum::c_Clear_Site_Data },
+    { "Connection", hash_enum::c_Connection },
+    { "Content-Disposition", hash_enum::c_Content_Disposition },
+    { "Content-Encoding", hash_enum::c_Content_Encoding },
+    { "Content-Language", hash_enum::c_Content_Language },
+    { "Content-Length", hash_enum::c_Content_Length },
+    { "Content-Location", hash_enum::c_Content_Location },
+    { "Content-Range", hash_enum::c_Content_Range },
+    { "Content-Security-Policy", hash_enum::c_Content_Security_Policy },
+    { "Content-Security-Policy-Report-Only", hash_enum::c_Content_Security_Policy_Report_Only },
+    { "Content-Type", hash_enum::c_Content_Type },
+    { "Cookie", hash_enum::c_Cookie },
+    { "Cookie2", hash_enum::c_Cookie2 },
+    { "DNT", hash_enum::c_DNT },
+    { "Date", hash_enum::c_Date },
+    { "ETag", hash_enum::c_ETag },
+    { "Expect", hash_enum::c_Expect },
+    { "Expect-CT", hash_enum::c_Expect_CT },
+    { "Expires", hash_enum::c_Expires },
+    { "Feature-Policy", hash_enum::c_Feature_Policy },
+    { "Forwarded", hash_enum::c_Forwarded },
+    { "From", hash_enum::c_From },
+    { "Host", hash_enum::c_Host },
+    { "If-Match", hash_enum::c_If_Match },
+    { "If-Modified-Since", hash_enum::c_If_Modified_Since },
+    { "If-None-Match", hash_enum::c_If_None_Match },
+    { "If-Range", hash_enum::c_If_Range },
+    { "If-Unmodified-Since", hash_enum::c_If_Unmodified_Since },
+    { "Keep-Alive", hash_enum::c_Keep_Alive },
+    { "Large-Allocation", hash_enum::c_Large_Allocation },
+    { "Last-Modified", hash_enum::c_Last_Modified },
+    { "Location", hash_enum::c_Location },
+    { "Origin", hash_enum::c_Origin },
+    { "Pragma", hash_enum::c_Pragma },
+    { "Proxy-Authenticate", hash_enum::c_Proxy_Authenticate },
+    { "Proxy-Authorization", hash_enum::c_Proxy_Authorization },
+    { "Public-Key-Pins", hash_enum::c_Public_Key_Pins },
+    { "Public-Key-Pins-Report-Only", hash_enum::c_Public_Key_Pins_Report_Only },
+    { "Range", hash_enum::c_Range },
+    { "Referer", hash_enum::c_Referer },
+    { "Referrer-Policy", hash_enum::c_Referrer_Policy },
+    { "Retry-After", hash_enum::c_Retry_After },
+    { "Sec-WebSocket-Accept", hash_enum::c_Sec_WebSocket_Accept },
+    { "Server", hash_enum::c_Server },
+    { "Server-Timing", hash_enum::c_Server_Timing },
+    { "Set-Cookie", hash_enum::c_Set_Cookie },
+    { "Set-Cookie2", hash_enum::c_Set_Cookie2 },
+    { "SourceMap", hash_enum::c_SourceMap },
+    { "Strict-Transport-Security", hash_enum::c_Strict_Transport_Security },
+    { "TE", hash_enum::c_TE },
+    { "Timing-Allow-Origin", hash_enum::c_Timing_Allow_Origin },
+    { "Tk", hash_enum::c_Tk },
+    { "Trailer", hash_enum::c_Trailer },
+    { "Transfer-Encoding", hash_enum::c_Transfer_Encoding },
+    { "Upgrade-Insecure-Requests", hash_enum::c_Upgrade_Insecure_Requests },
+    { "User-Agent", hash_enum::c_User_Agent },
+    { "Vary", hash_enum::c_Vary },
+    { "Via", hash_enum::c_Via },
+    { "WWW-Authenticate", hash_enum::c_WWW_Authenticate },
+    { "Warning", hash_enum::c_Warning },
+    { "X-Content-Type-Options", hash_enum::c_X_Content_Type_Options },
+    { "X-DNS-Prefetch-Control", hash_enum::c_X_DNS_Prefetch_Control },
+    { "X-Forwarded-For", hash_enum::c_X_Forwarded_For },
+    { "X-Forwarded-Host", hash_enum::c_X_Forwarded_Host },
+    { "X-Forwarded-Proto", hash_enum::c_X_Forwarded_Proto },
+    { "X-Frame-Options", hash_enum::c_X_Frame_Options },
+    { "X-XSS-Protection", hash_enum::c_X_XSS_Protection },
+    { "\xFE\xFF", hash_enum::c___ },
+    { "\xFF", hash_enum::c__ },
+    { "\xFF\xFE", hash_enum::c____0 },
+}};
+
+} // namespace internal_
+
+// Same as hash(), for keys split into consecutive chunks: feed() the
+// chunks in order, then finish(). Chunks need not outlive the call.
+class hash_matcher
+{
+public:
+    constexpr void feed( std::string_view chunk )
+    {
+        size_t i = 0;
+        while ( i < chunk.size() && m_first + 1 < m_last )
+        {
+            const unsigned char c = static_cast< unsigned char >( chunk[ i ] );
+
+            // Keywords ending at m_size come first in the range, then by their byte at m_size.
+            // Bytes are widened, so that the bound c + 1 does not wrap for 0xFF.
+            auto before = [ this ]( std::string_view word, unsigned c ) {
+                return word.size() <= m_size || static_cast< unsigned char >( word[ m_size ] ) < c;
+            };
+
+            size_t first = m_first;
+            size_t last = m_last;
+            while ( first < last )
+            {
+                const size_t mid = first + ( last - first ) / 2;
+                if ( before( internal_::sorted_words[ mid ].word, c ) )
+                    first = mid + 1;
+                else
+                    last = mid;
+            }
+            m_first = first;
+
+            last = m_last;
+            while ( first < last )
+            {
+                const size_t mid = first + ( last - first ) / 2;
+                if ( before( internal_::sorted_words[ mid ].word, c + 1 ) )
+                    first = mid + 1;
+                else
+                    last = mid;
+            }
+            m_last = first;
+
+            ++i;
+            ++m_size;
+        }
+
+        if ( i == chunk.size() || m_first == m_last )
+        {
+            m_size += chunk.size() - i;
+            return;
+        }
+
+        // Single candidate left, compare rest of the chunk against it
+        const std::string_view word = internal_::sorted_words[ m_first ].word;
+        const std::string_view rest = chunk.substr( i );
+        const bool equal = m_size + rest.size() <= word.size() && word.substr( m_size, rest.size() ) == rest;
+        if ( !equal )
+        {
+            m_last = m_first;
+        }
+        m_size += rest.size();
+    }
+
+    constexpr internal_::hash_enum finish() const
+    {
+        if ( m_first != m_last && internal_::sorted_words[ m_first ].word.size() == m_size )
+        {
+            return internal_::sorted_words[ m_first ].enum_val;
+        }
+        return internal_::hash_enum::default_;
+    }
+
+private:
+    // Keywords in [ m_first, m_last ) of sorted_words start with the m_size bytes fed
+    size_t m_first = 0;
+    size_t m_last = internal_::sorted_words.size();
+    size_t m_size = 0;
+};
+
+} // namespace matcher {
+
+// Extra check for safety
+static_assert( matcher::hash( "A\xFF" "B" ) == matcher::internal_::hash_enum::c_A_B );
+static_assert( matcher::hash( "Age" ) == matcher::internal_::hash_enum::c_Age );
+static_assert( matcher::hash( "A\xFF" ) == matcher::internal_::hash_enum::c_A_ );
+static_assert( matcher::hash( "\xFF" ) == matcher::internal_::hash_enum::c__ );
+static_assert( matcher::hash( "Cookie" ) == matcher::internal_::hash_enum::c_Cookie );
+static_assert( matcher::hash( "\xFE\xFF" ) == matcher::internal_::hash_enum::c___ );
+static_assert( matcher::hash( "Allow" ) == matcher::internal_::hash_enum::c_Allow );
+static_assert( matcher::hash( "Origin" ) == matcher::internal_::hash_enum::c_Origin );
+static_assert( matcher::hash( "Accept" ) == matcher::internal_::hash_enum::c_Accept );
+static_assert( matcher::hash( "Connection" ) == matcher::internal_::hash_enum::c_Connection );
+static_assert( matcher::hash( "Content-Type" ) == matcher::internal_::hash_enum::c_Content_Type );
+static_assert( matcher::hash( "Content-Range" ) == matcher::internal_::hash_enum::c_Content_Range );
+static_assert( matcher::hash( "Authorization" ) == matcher::internal_::hash_enum::c_Authorization );
+static_assert( matcher::hash( "Accept-Language" ) == matcher::internal_::hash_enum::c_Accept_Language );
+static_assert( matcher::hash( "Content-Language" ) == matcher::internal_::hash_enum::c_Content_Language );
+static_assert( matcher::hash( "Content-Location" ) == matcher::internal_::hash_enum::c_Content_Location );
+static_assert( matcher::hash( "Accept-Charset" ) == matcher::internal_::hash_enum::c_Accept_Charset );
+static_assert( matcher::hash( "Accept-Ranges" ) == matcher::internal_::hash_enum::c_Accept_Ranges );
+static_assert( matcher::hash( "Content-Disposition" ) == matcher::internal_::hash_enum::c_Content_Disposition );
+static_assert( matcher::hash( "X-XSS-Protection" ) == matcher::internal_::hash_enum::c_X_XSS_Protection );
+static_assert( matcher::hash( "Set-Cookie" ) == matcher::internal_::hash_enum::c_Set_Cookie );
+static_assert( matcher::hash( "Access-Control-Max-Age" ) == matcher::internal_::hash_enum::c_Access_Control_Max_Age );
+static_assert( matcher::hash( "X-Forwarded-Host" ) == matcher::internal_::hash_enum::c_X_Forwarded_Host );
+static_assert( matcher::hash( "X-Frame-Options" ) == matcher::internal_::hash_enum::c_X_Frame_Options );
+static_assert( matcher::hash( "Content-Length" ) == matcher::internal_::hash_enum::c_Content_Length );
+static_assert( matcher::hash( "Accept-Encoding" ) == matcher::internal_::hash_enum::c_Accept_Encoding );
+static_assert( matcher::hash( "Content-Encoding" ) == matcher::internal_::hash_enum::c_Content_Encoding );
+static_assert( matcher::hash( "Server" ) == matcher::internal_::hash_enum::c_Server );
+static_assert( matcher::hash( "X-Forwarded-For" ) == matcher::internal_::hash_enum::c_X_Forwarded_For );
+static_assert( matcher::hash( "Proxy-Authenticate" ) == matcher::internal_::hash_enum::c_Proxy_Authenticate );
+static_assert( matcher::hash( "Expect" ) == matcher::internal_::hash_enum::c_Expect );
+static_assert( matcher::hash( "Proxy-Authorization" ) == matcher::internal_::hash_enum::c_Proxy_Authorization );
+static_assert( matcher::hash( "Public-Key-Pins" ) == matcher::internal_::hash_enum::c_Public_Key_Pins );
+static_assert( matcher::hash( "Expires" ) == matcher::internal_::hash_enum::c_Expires );
+static_assert( matcher::hash( "Sec-WebSocket-Accept" ) == matcher::internal_::hash_enum::c_Sec_WebSocket_Accept );
+static_assert( matcher::hash( "Server-Timing" ) == matcher::internal_::hash_enum::c_Server_Timing );
+static_assert( matcher::hash( "ETag" ) == matcher::internal_::hash_enum::c_ETag );
+static_assert( matcher::hash( "X-Content-Type-Options" ) == matcher::internal_::hash_enum::c_X_Content_Type_Options );
+static_assert( matcher::hash( "Range" ) == matcher::internal_::hash_enum::c_Range );
+static_assert( matcher::hash( "Access-Control-Request-Headers" ) == matcher::internal_::hash_enum::c_Access_Control_Request_Headers );
+static_assert( matcher::hash( "Expect-CT" ) == matcher::internal_::hash_enum::c_Expect_CT );
+static_assert( matcher::hash( "Trailer" ) == matcher::internal_::hash_enum::c_Trailer );
+static_assert( matcher::hash( "Location" ) == matcher::internal_::hash_enum::c_Location );
+static_assert( matcher::hash( "Timing-Allow-Origin" ) == matcher::internal_::hash_enum::c_Timing_Allow_Origin );
+static_assert( matcher::hash( "Public-Key-Pins-Report-Only" ) == matcher::internal_::hash_enum::c_Public_Key_Pins_Report_Only );
+static_assert( matcher::hash( "If-Range" ) == matcher::internal_::hash_enum::c_If_Range );
+static_assert( matcher::hash( "Cache-Control" ) == matcher::internal_::hash_enum::c_Cache_Control );
+static_assert( matcher::hash( "Access-Control-Request-Method" ) == matcher::internal_::hash_enum::c_Access_Control_Request_Method );
+static_assert( matcher::hash( "Strict-Transport-Security" ) == matcher::internal_::hash_enum::c_Strict_Transport_Security );
+static_assert( matcher::hash( "Referrer-Policy" ) == matcher::internal_::hash_enum::c_Referrer_Policy );
+static_assert( matcher::hash( "Large-Allocation" ) == matcher::internal_::hash_enum::c_Large_Allocation );
+static_assert( matcher::hash( "Referer" ) == matcher::internal_::hash_enum::c_Referer );
+static_assert( matcher::hash( "Transfer-Encoding" ) == matcher::internal_::hash_enum::c_Transfer_Encoding );
+static_assert( matcher::hash( "Date" ) == matcher::internal_::hash_enum::c_Date );
+static_assert( matcher::hash( "If-Modified-Since" ) == matcher::internal_::hash_enum::c_If_Modified_Since );
+static_assert( matcher::hash( "Retry-After" ) == matcher::internal_::hash_enum::c_Retry_After );
+static_assert( matcher::hash( "If-Unmodified-Since" ) == matcher::internal_::hash_enum::c_If_Unmodified_Since );
+static_assert( matcher::hash( "If-Match" ) == matcher::internal_::hash_enum::c_If_Match );
+static_assert( matcher::hash( "Content-Security-Policy" ) == matcher::internal_::hash_enum::c_Content_Security_Policy );
+static_assert( matcher::hash( "Vary" ) == matcher::internal_::hash_enum::c_Vary );
+static_assert( matcher::hash( "Clear-Site-Data" ) == matcher::internal_::hash_enum::c_Clear_Site_Data );
+static_assert( matcher::hash( "Last-Modified" ) == matcher::internal_::hash_enum::c_Last_Modified );
+static_assert( matcher::hash( "If-None-Match" ) == matcher::internal_::hash_enum::c_If_None_Match );
+static_assert( matcher::hash( "DNT" ) == matcher::internal_::hash_enum::c_DNT );
+static_assert( matcher::hash( "Pragma" ) == matcher::internal_::hash_enum::c_Pragma );
+static_assert( matcher::hash( "User-Agent" ) == matcher::internal_::hash_enum::c_User_Agent );
+static_assert( matcher::hash( "A\xFE" ) == matcher::internal_::hash_enum::c_A__0 );
+static_assert( matcher::hash( "Access-Control-Allow-Methods" ) == matcher::internal_::hash_enum::c_Access_Control_Allow_Methods );
+static_assert( matcher::hash( "\xFF\xFE" ) == matcher::internal_::hash_enum::c____0 );
+static_assert( matcher::hash( "WWW-Authenticate" ) == matcher::internal_::hash_enum::c_WWW_Authenticate );
+static_assert( matcher::hash( "Content-Security-Policy-Report-Only" ) == matcher::internal_::hash_enum::c_Content_Security_Policy_Report_Only );
+static_assert( matcher::hash( "Feature-Policy" ) == matcher::internal_::hash_enum::c_Feature_Policy );
+static_assert( matcher::hash( "Warning" ) == matcher::internal_::hash_enum::c_Warning );
+static_assert( matcher::hash( "Cookie2" ) == matcher::internal_::hash_enum::c_Cookie2 );
+static_assert( matcher::hash( "SourceMap" ) == matcher::internal_::hash_enum::c_SourceMap );
+static_assert( matcher::hash( "TE" ) == matcher::internal_::hash_enum::c_TE );
+static_assert( matcher::hash( "X-Forwarded-Proto" ) == matcher::internal_::hash_enum::c_X_Forwarded_Proto );
+static_assert( matcher::hash( "From" ) == matcher::internal_::hash_enum::c_From );
+static_assert( matcher::hash( "Tk" ) == matcher::internal_::hash_enum::c_Tk );
+static_assert( matcher::hash( "Access-Control-Allow-Origin" ) == matcher::internal_::hash_enum::c_Access_Control_Allow_Origin );
+static_assert( matcher::hash( "Forwarded" ) == matcher::internal_::hash_enum::c_Forwarded );
+static_assert( matcher::hash( "Keep-Alive" ) == matcher::internal_::hash_enum::c_Keep_Alive );
+static_assert( matcher::hash( "Host" ) == matcher::internal_::hash_enum::c_Host );
+static_assert( matcher::hash( "Upgrade-Insecure-Requests" ) == matcher::internal_::hash_enum::c_Upgrade_Insecure_Requests );
+static_assert( matcher::hash( "Access-Control-Allow-Headers" ) == matcher::internal_::hash_enum::c_Access_Control_Allow_Headers );
+static_assert( matcher::hash( "Access-Control-Allow-Credentials" ) == matcher::internal_::hash_enum::c_Access_Control_Allow_Credentials );
+static_assert( matcher::hash( "Access-Control-Expose-Headers" ) == matcher::internal_::hash_enum::c_Access_Control_Expose_Headers );
+static_assert( matcher::hash( "Set-Cookie2" ) == matcher::internal_::hash_enum::c_Set_Cookie2 );
+static_assert( matcher::hash( "X-DNS-Prefetch-Control" ) == matcher::internal_::hash_enum::c_X_DNS_Prefetch_Control );
+static_assert( matcher::hash( "Via" ) == matcher::internal_::hash_enum::c_Via );
+
+#endif // MATCHER__HASH_HPP_
@@ -0,0 +1,546 @@
+#ifndef MINIMAL__HASH_HPP_
+#define MINIMAL__HASH_HPP_
+
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <string_view>
+
+namespace minimal {
+
+namespace internal_ {
+
+enum class hash_enum
+{
+    default_ = -1,
+    c_Age = 0,
+    c_Allow = 1,
+    c_Cookie = 2,
+    c_Accept = 3,
+    c_Connection = 4,
+    c_Content_Type = 5,
+    c_Content_Range = 6,
+    c_Authorization = 7,
+    c_Accept_Language = 8,
+    c_Content_Language = 9,
+    c_Content_Location = 10,
+    c_Accept_Charset = 11,
+    c_Accept_Ranges = 12,
+    c_Content_Disposition = 13,
+    c_Cache_Control = 14,
+    c_Access_Control_Max_Age = 15,
+    c_Accept_Encoding = 16,
+    c_Content_Encoding = 17,
+    c_Expect = 18,
+    c_TE = 19,
+    c_ETag = 20,
+    c_Expires = 21,
+    c_Timing_Allow_Origin = 22,
+    c_Set_Cookie = 23,
+    c_Range = 24,
+    c_X_XSS_Protection = 25,
+    c_Expect_CT = 26,
+    c_Transfer_Encoding = 27,
+    c_X_Forwarded_Host = 28,
+    c_X_Frame_Options = 29,
+    c_Trailer = 30,
+    c_Access_Control_Allow_Credentials = 31,
+    c_If_Range = 32,
+    c_Access_Control_Request_Headers = 33,
+    c_Server_Timing = 34,
+    c_Referrer_Policy = 35,
+    c_Proxy_Authenticate = 36,
+    c_Sec_WebSocket_Accept = 37,
+    c_Proxy_Authorization = 38,
+    c_Public_Key_Pins = 39,
+    c_Server = 40,
+    c_If_Modified_Since = 41,
+    c_X_Content_Type_Options = 42,
+    c_If_Unmodified_Since = 43,
+    c_X_Forwarded_For = 44,
+    c_Content_Length = 45,
+    c_X_DNS_Prefetch_Control = 46,
+    c_Referer = 47,
+    c_Location = 48,
+    c_Clear_Site_Data = 49,
+    c_Public_Key_Pins_Report_Only = 50,
+    c_Retry_After = 51,
+    c_Access_Control_Request_Method = 52,
+    c_Vary = 53,
+    c_Content_Security_Policy = 54,
+    c_User_Agent = 55,
+    c_Large_Allocation = 56,
+    c_Warning = 57,
+    c_WWW_Authenticate = 58,
+    c_Origin = 59,
+    c_Strict_Transport_Security = 60,
+    c_Host = 61,
+    c_Feature_Policy = 62,
+    c_Date = 63,
+    c_Cookie2 = 64,
+    c_Pragma = 65,
+    c_Content_Security_Policy_Report_Only = 66,
+    c_SourceMap = 67,
+    c_X_Forwarded_Proto = 68,
+    c_From = 69,
+    c_If_Match = 70,
+    c_DNT = 71,
+    c_Upgrade_Insecure_Requests = 72,
+    c_Tk = 73,
+    c_Access_Control_Allow_Methods = 74,
+    c_If_None_Match = 75,
+    c_Keep_Alive = 76,
+    c_Access_Control_Expose_Headers = 77,
+    c_Last_Modified = 78,
+    c_Access_Control_Allow_Origin = 79,
+    c_Forwarded = 80,
+    c_Access_Control_Allow_Headers = 81,
+    c_Set_Cookie2 = 82,
+    c_Via = 83,
+};
+
+} // namespace internal_
+
+// Number of keywords, enum values other than the default are in [ 0, hash_count )
+constexpr size_t hash_count = 84;
+
+constexpr internal_::hash_enum hash( std::string_view s );
+
+namespace internal_ {
+
+constexpr std::array< int, 256 > asso_values = {
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,    49,   100,   100,   100,   100,
+        64,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,     0,   100,     0,    66,    15,
+        54,   100,    60,    31,   100,    73,    46,    47,   100,    59,
+        25,   100,    26,    20,     9,    48,    55,    49,    15,   100,
+       100,   100,   100,   100,   100,   100,   100,    41,   100,    37,
+        26,     0,   100,     8,    38,   100,   100,    69,     8,    18,
+         1,    43,    45,   100,    21,     6,     4,   100,   100,     0,
+       100,     1,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,
+};
+
+constexpr int popcount( uint64_t x )
+{
+    x = x - ( ( x >> 1 ) & 0x5555555555555555ull );
+    x = ( x & 0x3333333333333333ull ) + ( ( x >> 2 ) & 0x3333333333333333ull );
+    x = ( x + ( x >> 4 ) ) & 0x0F0F0F0F0F0F0F0Full;
+    return ( x * 0x0101010101010101ull ) >> 56;
+}
+
+constexpr std::array< uint64_t, 2 > slot_bitmap = {
+    0xFFFFFFFFFFFFFC68ull,
+    0x00000008C2BFFFFFull,
+};
+
+constexpr std::array< uint16_t, 2 > slot_rank = {
+    0,
+    57,
+};
+
+struct word_entry
+{
+    std::string_view word;
+    hash_enum enum_val;
+};
+
+constexpr std::array< word_entry, 84 > wordlist = {{
+    { "Age", hash_enum::c_Age },
+    { "Allow", hash_enum::c_Allow },
+    { "Cookie", hash_enum::c_Cookie },
+    { "Accept", hash_enum::c_Accept },
+    { "Connection", hash_enum::c_Connection },
+    { "Content-Type", hash_enum::c_Content_Type },
+    { "Content-Range", hash_enum::c_Content_Range },
+    { "Authorization", hash_enum::c_Authorization },
+    { "Accept-Language", hash_enum::c_Accept_Language },
+    { "Content-Language", hash_enum::c_Content_Language },
+    { "Content-Location", hash_enum::c_Content_Location },
+    { "Accept-Charset", hash_enum::c_Accept_Charset },
+    { "Accept-Ranges", hash_enum::c_Accept_Ranges },
+    { "Content-Disposition", hash_enum::c_Content_Disposition },
+    { "Cache-Control", hash_enum::c_Cache_Control },
+    { "Access-Control-Max-Age", hash_enum::c_Access_Control_Max_Age },
+    { "Accept-Encoding", hash_enum::c_Accept_Encoding },
+    { "Content-Encoding", hash_enum::c_Content_Encoding },
+    { "Expect", hash_enum::c_Expect },
+    { "TE", hash_enum::c_TE },
+    { "ETag", hash_enum::c_ETag },
+    { "Expires", hash_enum::c_Expires },
+    { "Timing-Allow-Origin", hash_enum::c_Timing_Allow_Origin },
+    { "Set-Cookie", hash_enum::c_Set_Cookie },
+    { "Range", hash_enum::c_Range },
+    { "X-XSS-Protection", hash_enum::c_X_XSS_Protection },
+    { "Expect-CT", hash_enum::c_Expect_CT },
+    { "Transfer-Encoding", hash_enum::c_Transfer_Encoding },
+    { "X-Forwarded-Host", hash_enum::c_X_Forwarded_Host },
+    { "X-Frame-Options", hash_enum::c_X_Frame_Options },
+    { "Trailer", hash_enum::c_Trailer },
+    { "Access-Control-Allow-Credentials", hash_enum::c_Access_Control_Allow_Credentials },
+    { "If-Range", hash_enum::c_If_Range },
+    { "Access-Control-Request-Headers", hash_enum::c_Access_Control_Request_Headers },
+    { "Server-Timing", hash_enum::c_Server_Timing },
+    { "Referrer-Policy", hash_enum::c_Referrer_Policy },
+    { "Proxy-Authenticate", hash_enum::c_Proxy_Authenticate },
+    { "Sec-WebSocket-Accept", hash_enum::c_Sec_WebSocket_Accept },
+    { "Proxy-Authorization", hash_enum::c_Proxy_Authorization },
+    { "Public-Key-Pins", hash_enum::c_Public_Key_Pins },
+    { "Server", hash_enum::c_Server },
+    { "If-Modified-Since", hash_enum::c_If_Modified_Since },
+    { "X-Content-Type-Options", hash_enum::c_X_Content_Type_Options },
+    { "If-Unmodified-Since", hash_enum::c_If_Unmodified_Since },
+    { "X-Forwarded-For", hash_enum::c_X_Forwarded_For },
+    { "Content-Length", hash_enum::c_Content_Length },
+    { "X-DNS-Prefetch-Control", hash_enum::c_X_DNS_Prefetch_Control },
+    { "Referer", hash_enum::c_Referer },
+    { "Location", hash_enum::c_Location },
+    { "Clear-Site-Data", hash_enum::c_Clear_Site_Data },
+    { "Public-Key-Pins-Report-Only", hash_enum::c_Public_Key_Pins_Report_Only },
+    { "Retry-After", hash_enum::c_Retry_After },
+    { "Access-Control-Request-Method", hash_enum::c_Access_Control_Request_Method },
+    { "Vary", hash_enum::c_Vary },
+    { "Content-Security-Policy", hash_enum::c_Content_Security_Policy },
+    { "User-Agent", hash_enum::c_User_Agent },
+    { "Large-Allocation", hash_enum::c_Large_Allocation },
+    { "Warning", hash_enum::c_Warning },
+    { "WWW-Authenticate", hash_enum::c_WWW_Authenticate },
+    { "Origin", hash_enum::c_Origin },
+    { "Strict-Transport-Security", hash_enum::c_Strict_Transport_Security },
+    { "Host", hash_enum::c_Host },
+    { "Feature-Policy", hash_enum::c_Feature_Policy },
+    { "Date", hash_enum::c_Date },
+    { "Cookie2", hash_enum::c_Cookie2 },
+    { "Pragma", hash_enum::c_Pragma },
+    { "Content-Security-Policy-Report-Only", hash_enum::c_Content_Security_Policy_Report_Only },
+    { "SourceMap", hash_enum::c_SourceMap },
+    { "X-Forwarded-Proto", hash_enum::c_X_Forwarded_Proto },
+    { "From", hash_enum::c_From },
+    { "If-Match", hash_enum::c_If_Match },
+    { "DNT", hash_enum::c_DNT },
+    { "Upgrade-Insecure-Requests", hash_enum::c_Upgrade_Insecure_Requests },
+    { "Tk", hash_enum::c_Tk },
+    { "Access-Control-Allow-Methods", hash_enum::c_Access_Control_Allow_Methods },
+    { "If-None-Match", hash_enum::c_If_None_Match },
+    { "Keep-Alive", hash_enum::c_Keep_Alive },
+    { "Access-Control-Expose-Headers", hash_enum::c_Access_Control_Expose_Headers },
+    { "Last-Modified", hash_enum::c_Last_Modified },
+    { "Access-Control-Allow-Origin", hash_enum::c_Access_Control_Allow_Origin },
+    { "Forwarded", hash_enum::c_Forwarded },
+    { "Access-Control-Allow-Headers", hash_enum::c_Access_Control_Allow_Headers },
+    { "Set-Cookie2", hash_enum::c_Set_Cookie2 },
+    { "Via", hash_enum::c_Via },
+}};
+
+} // namespace internal_
+
+constexpr internal_::hash_enum hash( std::string_view s )
+{
+    constexpr size_t MinWordLength = 2;
+    constexpr size_t MaxWordLength = 35;
+    constexpr size_t MaxHashValue = 99;
+
+    if ( s.size() < MinWordLength || s.size() > MaxWordLength )
+    {
+        return internal_::hash_enum::default_;
+    }
+
+    size_t hash_val = s.size();
+    hash_val += internal_::asso_values[ static_cast< unsigned char >( s[ s.size() - 1 ] ) ];
+    switch( s.size() )
+    {
+                       case 35:
+    [[ fallthrough ]]; case 34:
+    [[ fallthrough ]]; case 33:
+    [[ fallthrough ]]; case 32:
+    [[ fallthrough ]]; case 31:
+    [[ fallthrough ]]; case 30:
+    [[ fallthrough ]]; case 29:
+    [[ fallthrough ]]; case 28:
+    [[ fallthrough ]]; case 27:
+    [[ fallthrough ]]; case 26:
+    [[ fallthrough ]]; case 25:
+    [[ fallthrough ]]; case 24:
+    [[ fallthrough ]]; case 23:
+    [[ fallthrough ]]; case 22:
+        hash_val += internal_::asso_values[ static_cast< unsigned char >( s[ 21] ) ];
+    [[ fallthrough ]]; case 21:
+    [[ fallthrough ]]; case 20:
+    [[ fallthrough ]]; case 19:
+    [[ fallthrough ]]; case 18:
+    [[ fallthrough ]]; case 17:
+    [[ fallthrough ]]; case 16:
+    [[ fallthrough ]]; case 15:
+    [[ fallthrough ]]; case 14:
+    [[ fallthrough ]]; case 13:
+    [[ fallthrough ]]; case 12:
+    [[ fallthrough ]]; case 11:
+    [[ fallthrough ]]; case 10:
+    [[ fallthrough ]]; case 9:
+    [[ fallthrough ]]; case 8:
+    [[ fallthrough ]]; case 7:
+    [[ fallthrough ]]; case 6:
+    [[ fallthrough ]]; case 5:
+    [[ fallthrough ]]; case 4:
+    [[ fallthrough ]]; case 3:
+    [[ fallthrough ]]; case 2:
+    [[ fallthrough ]]; case 1:
+        hash_val += internal_::asso_values[ static_cast< unsigned char >( s[ 0] ) ];
+    }
+
+    if ( hash_val <= MaxHashValue )
+    {
+        const uint64_t bits = internal_::slot_bitmap[ hash_val / 64 ];
+        const uint64_t bit = uint64_t( 1 ) << ( hash_val % 64 );
+        const size_t slot = internal_::slot_rank[ hash_val / 64 ] + internal_::popcount( bits & ( bit - 1 ) );
+        if ( ( bits & bit ) && internal_::wordlist[ slot ].word == s )
+        {
+            return internal_::wordlist[ slot ].enum_val;
+        }
+    }
+    return internal_::hash_enum::default_;
+}
+
+// Same as hash(), but s must be one of the keywords. Only the hash
+// is computed, s is not verified (except by an assertion in debug builds).
+constexpr internal_::hash_enum hash_unchecked( std::string_view s )
+{
+    size_t hash_val = s.size();
+    hash_val += internal_::asso_values[ static_cast< unsigned char >( s[ s.size() - 1 ] ) ];
+    switch( s.size() )
+    {
+                       case 35:
+    [[ fallthrough ]]; case 34:
+    [[ fallthrough ]]; case 33:
+    [[ fallthrough ]]; case 32:
+    [[ fallthrough ]]; case 31:
+    [[ fallthrough ]]; case 30:
+    [[ fallthrough ]]; case 29:
+    [[ fallthrough ]]; case 28:
+    [[ fallthrough ]]; case 27:
+    [[ fallthrough ]]; case 26:
+    [[ fallthrough ]]; case 25:
+    [[ fallthrough ]]; case 24:
+    [[ fallthrough ]]; case 23:
+    [[ fallthrough ]]; case 22:
+        hash_val += internal_::asso_values[ static_cast< unsigned char >( s[ 21] ) ];
+    [[ fallthrough ]]; case 21:
+    [[ fallthrough ]]; case 20:
+    [[ fallthrough ]]; case 19:
+    [[ fallthrough ]]; case 18:
+    [[ fallthrough ]]; case 17:
+    [[ fallthrough ]]; case 16:
+    [[ fallthrough ]]; case 15:
+    [[ fallthrough ]]; case 14:
+    [[ fallthrough ]]; case 13:
+    [[ fallthrough ]]; case 12:
+    [[ fallthrough ]]; case 11:
+    [[ fallthrough ]]; case 10:
+    [[ fallthrough ]]; case 9:
+    [[ fallthrough ]]; case 8:
+    [[ fallthrough ]]; case 7:
+    [[ fallthrough ]]; case 6:
+    [[ fallthrough ]]; case 5:
+    [[ fallthrough ]]; case 4:
+    [[ fallthrough ]]; case 3:
+    [[ fallthrough ]]; case 2:
+    [[ fallthrough ]]; case 1:
+        hash_val += internal_::asso_values[ static_cast< unsigned char >( s[ 0] ) ];
+    }
+
+    const uint64_t bits = internal_::slot_bitmap[ hash_val / 64 ];
+    const uint64_t bit = uint64_t( 1 ) << ( hash_val % 64 );
+    const auto res = static_cast< internal_::hash_enum >( internal_::slot_rank[ hash_val / 64 ] + internal_::popcount( bits & ( bit - 1 ) ) );
+    assert( hash( s ) == res );
+    return res;
+}
+
+} // namespace minimal {
+
+// Extra check for safety
+static_assert( minimal::hash( "Age" ) == minimal::internal_::hash_enum::c_Age );
+static_assert( minimal::hash( "Allow" ) == minimal::internal_::hash_enum::c_Allow );
+static_assert( minimal::hash( "Cookie" ) == minimal::internal_::hash_enum::c_Cookie );
+static_assert( minimal::hash( "Accept" ) == minimal::internal_::hash_enum::c_Accept );
+static_assert( minimal::hash( "Connection" ) == minimal::internal_::hash_enum::c_Connection );
+static_assert( minimal::hash( "Content-Type" ) == minimal::internal_::hash_enum::c_Content_Type );
+static_assert( minimal::hash( "Content-Range" ) == minimal::internal_::hash_enum::c_Content_Range );
+static_assert( minimal::hash( "Authorization" ) == minimal::internal_::hash_enum::c_Authorization );
+static_assert( minimal::hash( "Accept-Language" ) == minimal::internal_::hash_enum::c_Accept_Language );
+static_assert( minimal::hash( "Content-Language" ) == minimal::internal_::hash_enum::c_Content_Language );
+static_assert( minimal::hash( "Content-Location" ) == minimal::internal_::hash_enum::c_Content_Location );
+static_assert( minimal::hash( "Accept-Charset" ) == minimal::internal_::hash_enum::c_Accept_Charset );
+static_assert( minimal::hash( "Accept-Ranges" ) == minimal::internal_::hash_enum::c_Accept_Ranges );
+static_assert( minimal::hash( "Content-Disposition" ) == minimal::internal_::hash_enum::c_Content_Disposition );
+static_assert( minimal::hash( "Cache-Control" ) == minimal::internal_::hash_enum::c_Cache_Control );
+static_assert( minimal::hash( "Access-Control-Max-Age" ) == minimal::internal_::hash_enum::c_Access_Control_Max_Age );
+static_assert( minimal::hash( "Accept-Encoding" ) == minimal::internal_::hash_enum::c_Accept_Encoding );
+static_assert( minimal::hash( "Content-Encoding" ) == minimal::internal_::hash_enum::c_Content_Encoding );
+static_assert( minimal::hash( "Expect" ) == minimal::internal_::hash_enum::c_Expect );
+static_assert( minimal::hash( "TE" ) == minimal::internal_::hash_enum::c_TE );
+static_assert( minimal::hash( "ETag" ) == minimal::internal_::hash_enum::c_ETag );
+static_assert( minimal::hash( "Expires" ) == minimal::internal_::hash_enum::c_Expires );
+static_assert( minimal::hash( "Timing-Allow-Origin" ) == minimal::internal_::hash_enum::c_Timing_Allow_Origin );
+static_assert( minimal::hash( "Set-Cookie" ) == minimal::internal_::hash_enum::c_Set_Cookie );
+static_assert( minimal::hash( "Range" ) == minimal::internal_::hash_enum::c_Range );
+static_assert( minimal::hash( "X-XSS-Protection" ) == minimal::internal_::hash_enum::c_X_XSS_Protection );
+static_assert( minimal::hash( "Expect-CT" ) == minimal::internal_::hash_enum::c_Expect_CT );
+static_assert( minimal::hash( "Transfer-Encoding" ) == minimal::internal_::hash_enum::c_Transfer_Encoding );
+static_assert( minimal::hash( "X-Forwarded-Host" ) == minimal::internal_::hash_enum::c_X_Forwarded_Host );
+static_assert( minimal::hash( "X-Frame-Options" ) == minimal::internal_::hash_enum::c_X_Frame_Options );
+static_assert( minimal::hash( "Trailer" ) == minimal::internal_::hash_enum::c_Trailer );
+static_assert( minimal::hash( "Access-Control-Allow-Credentials" ) == minimal::internal_::hash_enum::c_Access_Control_Allow_Credentials );
+static_assert( minimal::hash( "If-Range" ) == minimal::internal_::hash_enum::c_If_Range );
+static_assert( minimal::hash( "Access-Control-Request-Headers" ) == minimal::internal_::hash_enum::c_Access_Control_Request_Headers );
+static_assert( minimal::hash( "Server-Timing" ) == minimal::internal_::hash_enum::c_Server_Timing );
+static_assert( minimal::hash( "Referrer-Policy" ) == minimal::internal_::hash_enum::c_Referrer_Policy );
+static_assert( minimal::hash( "Proxy-Authenticate" ) == minimal::internal_::hash_enum::c_Proxy_Authenticate );
+static_assert( minimal::hash( "Sec-WebSocket-Accept" ) == minimal::internal_::hash_enum::c_Sec_WebSocket_Accept );
+static_assert( minimal::hash( "Proxy-Authorization" ) == minimal::internal_::hash_enum::c_Proxy_Authorization );
+static_assert( minimal::hash( "Public-Key-Pins" ) == minimal::internal_::hash_enum::c_Public_Key_Pins );
+static_assert( minimal::hash( "Server" ) == minimal::internal_::hash_enum::c_Server );
+static_assert( minimal::hash( "If-Modified-Since" ) == minimal::internal_::hash_enum::c_If_Modified_Since );
+static_assert( minimal::hash( "X-Content-Type-Options" ) == minimal::internal_::hash_enum::c_X_Content_Type_Options );
+static_assert( minimal::hash( "If-Unmodified-Since" ) == minimal::internal_::hash_enum::c_If_Unmodified_Since );
+static_assert( minimal::hash( "X-Forwarded-For" ) == minimal::internal_::hash_enum::c_X_Forwarded_For );
+static_assert( minimal::hash( "Content-Length" ) == minimal::internal_::hash_enum::c_Content_Length );
+static_assert( minimal::hash( "X-DNS-Prefetch-Control" ) == minimal::internal_::hash_enum::c_X_DNS_Prefetch_Control );
+static_assert( minimal::hash( "Referer" ) == minimal::internal_::hash_enum::c_Referer );
+static_assert( minimal::hash( "Location" ) == minimal::internal_::hash_enum::c_Location );
+static_assert( minimal::hash( "Clear-Site-Data" ) == minimal::internal_::hash_enum::c_Clear_Site_Data );
+static_assert( minimal::hash( "Public-Key-Pins-Report-Only" ) == minimal::internal_::hash_enum::c_Public_Key_Pins_Report_Only );
+static_assert( minimal::hash( "Retry-After" ) == minimal::internal_::hash_enum::c_Retry_After );
+static_assert( minimal::hash( "Access-Control-Request-Method" ) == minimal::internal_::hash_enum::c_Access_Control_Request_Method );
+static_assert( minimal::hash( "Vary" ) == minimal::internal_::hash_enum::c_Vary );
+static_assert( minimal::hash( "Content-Security-Policy" ) == minimal::internal_::hash_enum::c_Content_Security_Policy );
+static_assert( minimal::hash( "User-Agent" ) == minimal::internal_::hash_enum::c_User_Agent );
+static_assert( minimal::hash( "Large-Allocation" ) == minimal::internal_::hash_enum::c_Large_Allocation );
+static_assert( minimal::hash( "Warning" ) == minimal::internal_::hash_enum::c_Warning );
+static_assert( minimal::hash( "WWW-Authenticate" ) == minimal::internal_::hash_enum::c_WWW_Authenticate );
+static_assert( minimal::hash( "Origin" ) == minimal::internal_::hash_enum::c_Origin );
+static_assert( minimal::hash( "Strict-Transport-Security" ) == minimal::internal_::hash_enum::c_Strict_Transport_Security );
+static_assert( minimal::hash( "Host" ) == minimal::internal_::hash_enum::c_Host );
+static_assert( minimal::hash( "Feature-Policy" ) == minimal::internal_::hash_enum::c_Feature_Policy );
+static_assert( minimal::hash( "Date" ) == minimal::internal_::hash_enum::c_Date );
+static_assert( minimal::hash( "Cookie2" ) == minimal::internal_::hash_enum::c_Cookie2 );
+static_assert( minimal::hash( "Pragma" ) == minimal::internal_::hash_enum::c_Pragma );
+static_assert( minimal::hash( "Content-Security-Policy-Report-Only" ) == minimal::internal_::hash_enum::c_Content_Security_Policy_Report_Only );
+static_assert( minimal::hash( "SourceMap" ) == minimal::internal_::hash_enum::c_SourceMap );
+static_assert( minimal::hash( "X-Forwarded-Proto" ) == minimal::internal_::hash_enum::c_X_Forwarded_Proto );
+static_assert( minimal::hash( "From" ) == minimal::internal_::hash_enum::c_From );
+static_assert( minimal::hash( "If-Match" ) == minimal::internal_::hash_enum::c_If_Match );
+static_assert( minimal::hash( "DNT" ) == minimal::internal_::hash_enum::c_DNT );
+static_assert( minimal::hash( "Upgrade-Insecure-Requests" ) == minimal::internal_::hash_enum::c_Upgrade_Insecure_Requests );
+static_assert( minimal::hash( "Tk" ) == minimal::internal_::hash_enum::c_Tk );
+static_assert( minimal::hash( "Access-Control-Allow-Methods" ) == minimal::internal_::hash_enum::c_Access_Control_Allow_Methods );
+static_assert( minimal::hash( "If-None-Match" ) == minimal::internal_::hash_enum::c_If_None_Match );
+static_assert( minimal::hash( "Keep-Alive" ) == minimal::internal_::hash_enum::c_Keep_Alive );
+static_assert( minimal::hash( "Access-Control-Expose-Headers" ) == minimal::internal_::hash_enum::c_Access_Control_Expose_Headers );
+static_assert( minimal::hash( "Last-Modified" ) == minimal::internal_::hash_enum::c_Last_Modified );
+static_assert( minimal::hash( "Access-Control-Allow-Origin" ) == minimal::internal_::hash_enum::c_Access_Control_Allow_Origin );
+static_assert( minimal::hash( "Forwarded" ) == minimal::internal_::hash_enum::c_Forwarded );
+static_assert( minimal::hash( "Access-Control-Allow-Headers" ) == minimal::internal_::hash_enum::c_Access_Control_Allow_Headers );
+static_assert( minimal::hash( "Set-Cookie2" ) == minimal::internal_::hash_enum::c_Set_Cookie2 );
+static_assert( minimal::hash( "Via" ) == minimal::internal_::hash_enum::c_Via );
+static_assert( minimal::hash_unchecked( "Age" ) == minimal::internal_::hash_enum::c_Age );
+static_assert( minimal::hash_unchecked( "Allow" ) == minimal::internal_::hash_enum::c_Allow );
+static_assert( minimal::hash_unchecked( "Cookie" ) == minimal::internal_::hash_enum::c_Cookie );
+static_assert( minimal::hash_unchecked( "Accept" ) == minimal::internal_::hash_enum::c_Accept );
+static_assert( minimal::hash_unchecked( "Connection" ) == minimal::internal_::hash_enum::c_Connection );
+static_assert( minimal::hash_unchecked( "Content-Type" ) == minimal::internal_::hash_enum::c_Content_Type );
+static_assert( minimal::hash_unchecked( "Content-Range" ) == minimal::internal_::hash_enum::c_Content_Range );
+static_assert( minimal::hash_unchecked( "Authorization" ) == minimal::internal_::hash_enum::c_Authorization );
+static_assert( minimal::hash_unchecked( "Accept-Language" ) == minimal::internal_::hash_enum::c_Accept_Language );
+static_assert( minimal::hash_unchecked( "Content-Language" ) == minimal::internal_::hash_enum::c_Content_Language );
+static_assert( minimal::hash_unchecked( "Content-Location" ) == minimal::internal_::hash_enum::c_Content_Location );
+static_assert( minimal::hash_unchecked( "Accept-Charset" ) == minimal::internal_::hash_enum::c_Accept_Charset );
+static_assert( minimal::hash_unchecked( "Accept-Ranges" ) == minimal::internal_::hash_enum::c_Accept_Ranges );
+static_assert( minimal::hash_unchecked( "Content-Disposition" ) == minimal::internal_::hash_enum::c_Content_Disposition );
+static_assert( minimal::hash_unchecked( "Cache-Control" ) == minimal::internal_::hash_enum::c_Cache_Control );
+static_assert( minimal::hash_unchecked( "Access-Control-Max-Age" ) == minimal::internal_::hash_enum::c_Access_Control_Max_Age );
+static_assert( minimal::hash_unchecked( "Accept-Encoding" ) == minimal::internal_::hash_enum::c_Accept_Encoding );
+static_assert( minimal::hash_unchecked( "Content-Encoding" ) == minimal::internal_::hash_enum::c_Content_Encoding );
+static_assert( minimal::hash_unchecked( "Expect" ) == minimal::internal_::hash_enum::c_Expect );
+static_assert( minimal::hash_unchecked( "TE" ) == minimal::internal_::hash_enum::c_TE );
+static_assert( minimal::hash_unchecked( "ETag" ) == minimal::internal_::hash_enum::c_ETag );
+static_assert( minimal::hash_unchecked( "Expires" ) == minimal::internal_::hash_enum::c_Expires );
+static_assert( minimal::hash_unchecked( "Timing-Allow-Origin" ) == minimal::internal_::hash_enum::c_Timing_Allow_Origin );
+static_assert( minimal::hash_unchecked( "Set-Cookie" ) == minimal::internal_::hash_enum::c_Set_Cookie );
+static_assert( minimal::hash_unchecked( "Range" ) == minimal::internal_::hash_enum::c_Range );
+static_assert( minimal::hash_unchecked( "X-XSS-Protection" ) == minimal::internal_::hash_enum::c_X_XSS_Protection );
+static_assert( minimal::hash_unchecked( "Expect-CT" ) == minimal::internal_::hash_enum::c_Expect_CT );
+static_assert( minimal::hash_unchecked( "Transfer-Encoding" ) == minimal::internal_::hash_enum::c_Transfer_Encoding );
+static_assert( minimal::hash_unchecked( "X-Forwarded-Host" ) == minimal::internal_::hash_enum::c_X_Forwarded_Host );
+static_assert( minimal::hash_unchecked( "X-Frame-Options" ) == minimal::internal_::hash_enum::c_X_Frame_Options );
+static_assert( minimal::hash_unchecked( "Trailer" ) == minimal::internal_::hash_enum::c_Trailer );
+static_assert( minimal::hash_unchecked( "Access-Control-Allow-Credentials" ) == minimal::internal_::hash_enum::c_Access_Control_Allow_Credentials );
+static_assert( minimal::hash_unchecked( "If-Range" ) == minimal::internal_::hash_enum::c_If_Range );
+static_assert( minimal::hash_unchecked( "Access-Control-Request-Headers" ) == minimal::internal_::hash_enum::c_Access_Control_Request_Headers );
+static_assert( minimal::hash_unchecked( "Server-Timing" ) == minimal::internal_::hash_enum::c_Server_Timing );
+static_assert( minimal::hash_unchecked( "Referrer-Policy" ) == minimal::internal_::hash_enum::c_Referrer_Policy );
+static_assert( minimal::hash_unchecked( "Proxy-Authenticate" ) == minimal::internal_::hash_enum::c_Proxy_Authenticate );
+static_assert( minimal::hash_unchecked( "Sec-WebSocket-Accept" ) == minimal::internal_::hash_enum::c_Sec_WebSocket_Accept );
+static_assert( minimal::hash_unchecked( "Proxy-Authorization" ) == minimal::internal_::hash_enum::c_Proxy_Authorization );
+static_assert( minimal::hash_unchecked( "Public-Key-Pins" ) == minimal::internal_::hash_enum::c_Public_Key_Pins );
+static_assert( minimal::hash_unchecked( "Server" ) == minimal::internal_::hash_enum::c_Server );
+static_assert( minimal::hash_unchecked( "If-Modified-Since" ) == minimal::internal_::hash_enum::c_If_Modified_Since );
+static_assert( minimal::hash_unchecked( "X-Content-Type-Options" ) == minimal::internal_::hash_enum::c_X_Content_Type_Options );
+static_assert( minimal::hash_unchecked( "If-Unmodified-Since" ) == minimal::internal_::hash_enum::c_If_Unmodified_Since );
+static_assert( minimal::hash_unchecked( "X-Forwarded-For" ) == minimal::internal_::hash_enum::c_X_Forwarded_For );
+static_assert( minimal::hash_unchecked( "Content-Length" ) == minimal::internal_::hash_enum::c_Content_Length );
+static_assert( minimal::hash_unchecked( "X-DNS-Prefetch-Control" ) == minimal::internal_::hash_enum::c_X_DNS_Prefetch_Control );
+static_assert( minimal::hash_unchecked( "Referer" ) == minimal::internal_::hash_enum::c_Referer );
+static_assert( minimal::hash_unchecked( "Location" ) == minimal::internal_::hash_enum::c_Location );
+static_assert( minimal::hash_unchecked( "Clear-Site-Data" ) == minimal::internal_::hash_enum::c_Clear_Site_Data );
+static_assert( minimal::hash_unchecked( "Public-Key-Pins-Report-Only" ) == minimal::internal_::hash_enum::c_Public_Key_Pins_Report_Only );
+static_assert( minimal::hash_unchecked( "Retry-After" ) == minimal::internal_::hash_enum::c_Retry_After );
+static_assert( minimal::hash_unchecked( "Access-Control-Request-Method" ) == minimal::internal_::hash_enum::c_Access_Control_Request_Method );
+static_assert( minimal::hash_unchecked( "Vary" ) == minimal::internal_::hash_enum::c_Vary );
+static_assert( minimal::hash_unchecked( "Content-Security-Policy" ) == minimal::internal_::hash_enum::c_Content_Security_Policy );
+static_assert( minimal::hash_unchecked( "User-Agent" ) == minimal::internal_::hash_enum::c_User_Agent );
+static_assert( minimal::hash_unchecked( "Large-Allocation" ) == minimal::internal_::hash_enum::c_Large_Allocation );
+static_assert( minimal::hash_unchecked( "Warning" ) == minimal::internal_::hash_enum::c_Warning );
+static_assert( minimal::hash_unchecked( "WWW-Authenticate" ) == minimal::internal_::hash_enum::c_WWW_Authenticate );
+static_assert( minimal::hash_unchecked( "Origin" ) == minimal::internal_::hash_enum::c_Origin );
+static_assert( minimal::hash_unchecked( "Strict-Transport-Security" ) == minimal::internal_::hash_enum::c_Strict_Transport_Security );
+static_assert( minimal::hash_unchecked( "Host" ) == minimal::internal_::hash_enum::c_Host );
+static_assert( minimal::hash_unchecked( "Feature-Policy" ) == minimal::internal_::hash_enum::c_Feature_Policy );
+static_assert( minimal::hash_unchecked( "Date" ) == minimal::internal_::hash_enum::c_Date );
+static_assert( minimal::hash_unchecked( "Cookie2" ) == minimal::internal_::hash_enum::c_Cookie2 );
+static_assert( minimal::hash_unchecked( "Pragma" ) == minimal::internal_::hash_enum::c_Pragma );
+static_assert( minimal::hash_unchecked( "Content-Security-Policy-Report-Only" ) == minimal::internal_::hash_enum::c_Content_Security_Policy_Report_Only );
+static_assert( minimal::hash_unchecked( "SourceMap" ) == minimal::internal_::hash_enum::c_SourceMap );
+static_assert( minimal::hash_unchecked( "X-Forwarded-Proto" ) == minimal::internal_::hash_enum::c_X_Forwarded_Proto );
+static_assert( minimal::hash_unchecked( "From" ) == minimal::internal_::hash_enum::c_From );
+static_assert( minimal::hash_unchecked( "If-Match" ) == minimal::internal_::hash_enum::c_If_Match );
+static_assert( minimal::hash_unchecked( "DNT" ) == minimal::internal_::hash_enum::c_DNT );
+static_assert( minimal::hash_unchecked( "Upgrade-Insecure-Requests" ) == minimal::internal_::hash_enum::c_Upgrade_Insecure_Requests );
+static_assert( minimal::hash_unchecked( "Tk" ) == minimal::internal_::hash_enum::c_Tk );
+static_assert( minimal::hash_unchecked( "Access-Control-Allow-Methods" ) == minimal::internal_::hash_enum::c_Access_Control_Allow_Methods );
+static_assert( minimal::hash_unchecked( "If-None-Match" ) == minimal::internal_::hash_enum::c_If_None_Match );
+static_assert( minimal::hash_unchecked( "Keep-Alive" ) == minimal::internal_::hash_enum::c_Keep_Alive );
+static_assert( minimal::hash_unchecked( "Access-Control-Expose-Headers" ) == minimal::internal_::hash_enum::c_Access_Control_Expose_Headers );
+static_assert( minimal::hash_unchecked( "Last-Modified" ) == minimal::internal_::hash_enum::c_Last_Modified );
+static_assert( minimal::hash_unchecked( "Access-Control-Allow-Origin" ) == minimal::internal_::hash_enum::c_Access_Control_Allow_Origin );
+static_assert( minimal::hash_unchecked( "Forwarded" ) == minimal::internal_::hash_enum::c_Forwarded );
+static_assert( minimal::hash_unchecked( "Access-Control-Allow-Headers" ) == minimal::internal_::hash_enum::c_Access_Control_Allow_Headers );
+static_assert( minimal::hash_unchecked( "Set-Cookie2" ) == minimal::internal_::hash_enum::c_Set_Cookie2 );
+static_assert( minimal::hash_unchecked( "Via" ) == minimal::internal_::hash_enum::c_Via );
+
+#endif // MINIMAL__HASH_HPP_
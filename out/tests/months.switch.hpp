@@ -0,0 +1,129 @@
+#ifndef MONTHS__MONTH_HPP_
+#define MONTHS__MONTH_HPP_
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+namespace months {
+
+namespace internal_ {
+
+enum class month_enum
+{
+    default_ = -1,
+    c_Oct = 0,
+    c_Jun = 1,
+    c_Nov = 2,
+    c_Apr = 3,
+    c_Sep = 4,
+    c_Dec = 5,
+    c_Jul = 6,
+    c_Jan = 7,
+    c_May = 8,
+    c_Mar = 9,
+    c_Feb = 10,
+    c_Aug = 11,
+};
+
+} // namespace internal_
+
+constexpr internal_::month_enum month( std::string_view s );
+
+using month_value_type = int;
+
+// Returns the value given to keyword s, nullptr if s is not a keyword
+constexpr const month_value_type* month_value( std::string_view s );
+
+namespace internal_ {
+
+constexpr uint64_t load_le3( const char *p )
+{
+    return uint64_t( static_cast< unsigned char >( p[ 0 ] ) )
+         | uint64_t( static_cast< unsigned char >( p[ 1 ] ) ) << 8
+         | uint64_t( static_cast< unsigned char >( p[ 2 ] ) ) << 16;
+}
+
+struct key_entry
+{
+    uint64_t key;
+    month_enum enum_val;
+    month_value_type value;
+};
+
+constexpr std::array< key_entry, 16 > keylist = {{
+    { 0x74634Full, month_enum::c_Oct, 10 }, // Oct
+    { 0x74634Full, month_enum::default_, {} },
+    { 0x74634Full, month_enum::default_, {} },
+    { 0x6E754Aull, month_enum::c_Jun, 6 }, // Jun
+    { 0x766F4Eull, month_enum::c_Nov, 11 }, // Nov
+    { 0x727041ull, month_enum::c_Apr, 4 }, // Apr
+    { 0x706553ull, month_enum::c_Sep, 9 }, // Sep
+    { 0x636544ull, month_enum::c_Dec, 12 }, // Dec
+    { 0x6C754Aull, month_enum::c_Jul, 7 }, // Jul
+    { 0x74634Full, month_enum::default_, {} },
+    { 0x6E614Aull, month_enum::c_Jan, 1 }, // Jan
+    { 0x79614Dull, month_enum::c_May, 5 }, // May
+    { 0x72614Dull, month_enum::c_Mar, 3 }, // Mar
+    { 0x626546ull, month_enum::c_Feb, 2 }, // Feb
+    { 0x677541ull, month_enum::c_Aug, 8 }, // Aug
+    { 0x74634Full, month_enum::default_, {} },
+}};
+
+} // namespace internal_
+
+constexpr internal_::month_enum month( std::string_view s )
+{
+    constexpr size_t WordLength = 3;
+
+    if ( s.size() != WordLength )
+    {
+        return internal_::month_enum::default_;
+    }
+
+    const uint64_t key = internal_::load_le3( s.data() );
+    const internal_::key_entry &entry = internal_::keylist[ ( key * 0x992DD867927B52D9ull ) >> 60 ];
+    return entry.key == key ? entry.enum_val : internal_::month_enum::default_;
+}
+
+constexpr const month_value_type* month_value( std::string_view s )
+{
+    if ( s.size() != 3 )
+    {
+        return nullptr;
+    }
+
+    const uint64_t key = internal_::load_le3( s.data() );
+    const internal_::key_entry &entry = internal_::keylist[ ( key * 0x992DD867927B52D9ull ) >> 60 ];
+    return entry.key == key ? &entry.value : nullptr;
+}
+
+} // namespace months {
+
+// Extra check for safety
+static_assert( months::month( "Oct" ) == months::internal_::month_enum::c_Oct );
+static_assert( months::month( "Jun" ) == months::internal_::month_enum::c_Jun );
+static_assert( months::month( "Nov" ) == months::internal_::month_enum::c_Nov );
+static_assert( months::month( "Apr" ) == months::internal_::month_enum::c_Apr );
+static_assert( months::month( "Sep" ) == months::internal_::month_enum::c_Sep );
+static_assert( months::month( "Dec" ) == months::internal_::month_enum::c_Dec );
+static_assert( months::month( "Jul" ) == months::internal_::month_enum::c_Jul );
+static_assert( months::month( "Jan" ) == months::internal_::month_enum::c_Jan );
+static_assert( months::month( "May" ) == months::internal_::month_enum::c_May );
+static_assert( months::month( "Mar" ) == months::internal_::month_enum::c_Mar );
+static_assert( months::month( "Feb" ) == months::internal_::month_enum::c_Feb );
+static_assert( months::month( "Aug" ) == months::internal_::month_enum::c_Aug );
+static_assert( months::month_value( "Oct" ) != nullptr );
+static_assert( months::month_value( "Jun" ) != nullptr );
+static_assert( months::month_value( "Nov" ) != nullptr );
+static_assert( months::month_value( "Apr" ) != nullptr );
+static_assert( months::month_value( "Sep" ) != nullptr );
+static_assert( months::month_value( "Dec" ) != nullptr );
+static_assert( months::month_value( "Jul" ) != nullptr );
+static_assert( months::month_value( "Jan" ) != nullptr );
+static_assert( months::month_value( "May" ) != nullptr );
+static_assert( months::month_value( "Mar" ) != nullptr );
+static_assert( months::month_value( "Feb" ) != nullptr );
+static_assert( months::month_value( "Aug" ) != nullptr );
+
+#endif // MONTHS__MONTH_HPP_
@@ -0,0 +1,620 @@
+#ifndef PADDED__HASH_HPP_
+#define PADDED__HASH_HPP_
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+#if defined( __BYTE_ORDER__ ) && __BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__
+#error "hash_padded() requires a little endian target"
+#endif
+
+namespace padded {
+
+namespace internal_ {
+
+enum class hash_enum
+{
+    default_ = -1,
+    c_Age = 0,
+    c_Allow = 1,
+    c_Cookie = 2,
+    c_Accept = 3,
+    c_Connection = 4,
+    c_Content_Type = 5,
+    c_Content_Range = 6,
+    c_Authorization = 7,
+    c_Accept_Language = 8,
+    c_Content_Language = 9,
+    c_Content_Location = 10,
+    c_Accept_Charset = 11,
+    c_Accept_Ranges = 12,
+    c_Content_Disposition = 13,
+    c_Cache_Control = 14,
+    c_Access_Control_Max_Age = 15,
+    c_Accept_Encoding = 16,
+    c_Content_Encoding = 17,
+    c_Expect = 18,
+    c_TE = 19,
+    c_ETag = 20,
+    c_Expires = 21,
+    c_Timing_Allow_Origin = 22,
+    c_Set_Cookie = 23,
+    c_Range = 24,
+    c_X_XSS_Protection = 25,
+    c_Expect_CT = 26,
+    c_Transfer_Encoding = 27,
+    c_X_Forwarded_Host = 28,
+    c_X_Frame_Options = 29,
+    c_Trailer = 30,
+    c_Access_Control_Allow_Credentials = 31,
+    c_If_Range = 32,
+    c_Access_Control_Request_Headers = 33,
+    c_Server_Timing = 34,
+    c_Referrer_Policy = 35,
+    c_Proxy_Authenticate = 36,
+    c_Sec_WebSocket_Accept = 37,
+    c_Proxy_Authorization = 38,
+    c_Public_Key_Pins = 39,
+    c_Server = 40,
+    c_If_Modified_Since = 41,
+    c_X_Content_Type_Options = 42,
+    c_If_Unmodified_Since = 43,
+    c_X_Forwarded_For = 44,
+    c_Content_Length = 45,
+    c_X_DNS_Prefetch_Control = 46,
+    c_Referer = 47,
+    c_Location = 48,
+    c_Clear_Site_Data = 49,
+    c_Public_Key_Pins_Report_Only = 50,
+    c_Retry_After = 51,
+    c_Access_Control_Request_Method = 52,
+    c_Vary = 53,
+    c_Content_Security_Policy = 54,
+    c_User_Agent = 55,
+    c_Large_Allocation = 56,
+    c_Warning = 57,
+    c_WWW_Authenticate = 58,
+    c_Origin = 59,
+    c_Strict_Transport_Security = 60,
+    c_Host = 61,
+    c_Feature_Policy = 62,
+    c_Date = 63,
+    c_Cookie2 = 64,
+    c_Pragma = 65,
+    c_Content_Security_Policy_Report_Only = 66,
+    c_SourceMap = 67,
+    c_X_Forwarded_Proto = 68,
+    c_From = 69,
+    c_If_Match = 70,
+    c_DNT = 71,
+    c_Upgrade_Insecure_Requests = 72,
+    c_Tk = 73,
+    c_Access_Control_Allow_Methods = 74,
+    c_If_None_Match = 75,
+    c_Keep_Alive = 76,
+    c_Access_Control_Expose_Headers = 77,
+    c_Last_Modified = 78,
+    c_Access_Control_Allow_Origin = 79,
+    c_Forwarded = 80,
+    c_Access_Control_Allow_Headers = 81,
+    c_Set_Cookie2 = 82,
+    c_Via = 83,
+};
+
+} // namespace internal_
+
+// Number of keywords, enum values other than the default are in [ 0, hash_count )
+constexpr size_t hash_count = 84;
+
+constexpr internal_::hash_enum hash( std::string_view s );
+
+// Number of bytes hash_padded() may read past the end of its input
+constexpr size_t hash_padding = 7;
+
+namespace internal_ {
+
+constexpr std::array< int, 256 > asso_values = {
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,    49,   100,   100,   100,   100,
+        64,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,     0,   100,     0,    66,    15,
+        54,   100,    60,    31,   100,    73,    46,    47,   100,    59,
+        25,   100,    26,    20,     9,    48,    55,    49,    15,   100,
+       100,   100,   100,   100,   100,   100,   100,    41,   100,    37,
+        26,     0,   100,     8,    38,   100,   100,    69,     8,    18,
+         1,    43,    45,   100,    21,     6,     4,   100,   100,     0,
+       100,     1,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,
+};
+
+struct word_entry
+{
+    std::string_view word;
+    hash_enum enum_val;
+};
+
+constexpr std::array< word_entry, 100 > wordlist = {{
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "Age", hash_enum::c_Age },
+    { "", hash_enum::default_ },
+    { "Allow", hash_enum::c_Allow },
+    { "Cookie", hash_enum::c_Cookie },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "Accept", hash_enum::c_Accept },
+    { "Connection", hash_enum::c_Connection },
+    { "Content-Type", hash_enum::c_Content_Type },
+    { "Content-Range", hash_enum::c_Content_Range },
+    { "Authorization", hash_enum::c_Authorization },
+    { "Accept-Language", hash_enum::c_Accept_Language },
+    { "Content-Language", hash_enum::c_Content_Language },
+    { "Content-Location", hash_enum::c_Content_Location },
+    { "Accept-Charset", hash_enum::c_Accept_Charset },
+    { "Accept-Ranges", hash_enum::c_Accept_Ranges },
+    { "Content-Disposition", hash_enum::c_Content_Disposition },
+    { "Cache-Control", hash_enum::c_Cache_Control },
+    { "Access-Control-Max-Age", hash_enum::c_Access_Control_Max_Age },
+    { "Accept-Encoding", hash_enum::c_Accept_Encoding },
+    { "Content-Encoding", hash_enum::c_Content_Encoding },
+    { "Expect", hash_enum::c_Expect },
+    { "TE", hash_enum::c_TE },
+    { "ETag", hash_enum::c_ETag },
+    { "Expires", hash_enum::c_Expires },
+    { "Timing-Allow-Origin", hash_enum::c_Timing_Allow_Origin },
+    { "Set-Cookie", hash_enum::c_Set_Cookie },
+    { "Range", hash_enum::c_Range },
+    { "X-XSS-Protection", hash_enum::c_X_XSS_Protection },
+    { "Expect-CT", hash_enum::c_Expect_CT },
+    { "Transfer-Encoding", hash_enum::c_Transfer_Encoding },
+    { "X-Forwarded-Host", hash_enum::c_X_Forwarded_Host },
+    { "X-Frame-Options", hash_enum::c_X_Frame_Options },
+    { "Trailer", hash_enum::c_Trailer },
+    { "Access-Control-Allow-Credentials", hash_enum::c_Access_Control_Allow_Credentials },
+    { "If-Range", hash_enum::c_If_Range },
+    { "Access-Control-Request-Headers", hash_enum::c_Access_Control_Request_Headers },
+    { "Server-Timing", hash_enum::c_Server_Timing },
+    { "Referrer-Policy", hash_enum::c_Referrer_Policy },
+    { "Proxy-Authenticate", hash_enum::c_Proxy_Authenticate },
+    { "Sec-WebSocket-Accept", hash_enum::c_Sec_WebSocket_Accept },
+    { "Proxy-Authorization", hash_enum::c_Proxy_Authorization },
+    { "Public-Key-Pins", hash_enum::c_Public_Key_Pins },
+    { "Server", hash_enum::c_Server },
+    { "If-Modified-Since", hash_enum::c_If_Modified_Since },
+    { "X-Content-Type-Options", hash_enum::c_X_Content_Type_Options },
+    { "If-Unmodified-Since", hash_enum::c_If_Unmodified_Since },
+    { "X-Forwarded-For", hash_enum::c_X_Forwarded_For },
+    { "Content-Length", hash_enum::c_Content_Length },
+    { "X-DNS-Prefetch-Control", hash_enum::c_X_DNS_Prefetch_Control },
+    { "Referer", hash_enum::c_Referer },
+    { "Location", hash_enum::c_Location },
+    { "Clear-Site-Data", hash_enum::c_Clear_Site_Data },
+    { "Public-Key-Pins-Report-Only", hash_enum::c_Public_Key_Pins_Report_Only },
+    { "Retry-After", hash_enum::c_Retry_After },
+    { "Access-Control-Request-Method", hash_enum::c_Access_Control_Request_Method },
+    { "Vary", hash_enum::c_Vary },
+    { "Content-Security-Policy", hash_enum::c_Content_Security_Policy },
+    { "User-Agent", hash_enum::c_User_Agent },
+    { "Large-Allocation", hash_enum::c_Large_Allocation },
+    { "Warning", hash_enum::c_Warning },
+    { "WWW-Authenticate", hash_enum::c_WWW_Authenticate },
+    { "Origin", hash_enum::c_Origin },
+    { "Strict-Transport-Security", hash_enum::c_Strict_Transport_Security },
+    { "Host", hash_enum::c_Host },
+    { "Feature-Policy", hash_enum::c_Feature_Policy },
+    { "Date", hash_enum::c_Date },
+    { "Cookie2", hash_enum::c_Cookie2 },
+    { "Pragma", hash_enum::c_Pragma },
+    { "Content-Security-Policy-Report-Only", hash_enum::c_Content_Security_Policy_Report_Only },
+    { "SourceMap", hash_enum::c_SourceMap },
+    { "X-Forwarded-Proto", hash_enum::c_X_Forwarded_Proto },
+    { "From", hash_enum::c_From },
+    { "If-Match", hash_enum::c_If_Match },
+    { "DNT", hash_enum::c_DNT },
+    { "Upgrade-Insecure-Requests", hash_enum::c_Upgrade_Insecure_Requests },
+    { "Tk", hash_enum::c_Tk },
+    { "Access-Control-Allow-Methods", hash_enum::c_Access_Control_Allow_Methods },
+    { "If-None-Match", hash_enum::c_If_None_Match },
+    { "Keep-Alive", hash_enum::c_Keep_Alive },
+    { "Access-Control-Expose-Headers", hash_enum::c_Access_Control_Expose_Headers },
+    { "Last-Modified", hash_enum::c_Last_Modified },
+    { "", hash_enum::default_ },
+    { "Access-Control-Allow-Origin", hash_enum::c_Access_Control_Allow_Origin },
+    { "", hash_enum::default_ },
+    { "Forwarded", hash_enum::c_Forwarded },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "Access-Control-Allow-Headers", hash_enum::c_Access_Control_Allow_Headers },
+    { "Set-Cookie2", hash_enum::c_Set_Cookie2 },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "Via", hash_enum::c_Via },
+}};
+
+struct padded_entry
+{
+    std::array< uint64_t, 5 > key;
+    std::array< uint64_t, 5 > mask;
+    uint64_t size;
+    hash_enum enum_val;
+};
+
+constexpr std::array< padded_entry, 100 > padded_keys = {{
+    { {}, {}, 0, hash_enum::default_ },
+    { {}, {}, 0, hash_enum::default_ },
+    { {}, {}, 0, hash_enum::default_ },
+    { { 0x0000000000656741ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, { 0x0000000000FFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, 3, hash_enum::c_Age },
+    { {}, {}, 0, hash_enum::default_ },
+    { { 0x000000776F6C6C41ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, { 0x000000FFFFFFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, 5, hash_enum::c_Allow },
+    { { 0x000065696B6F6F43ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, { 0x0000FFFFFFFFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, 6, hash_enum::c_Cookie },
+    { {}, {}, 0, hash_enum::default_ },
+    { {}, {}, 0, hash_enum::default_ },
+    { {}, {}, 0, hash_enum::default_ },
+    { { 0x0000747065636341ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, { 0x0000FFFFFFFFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, 6, hash_enum::c_Accept },
+    { { 0x697463656E6E6F43ull, 0x0000000000006E6Full, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, { 0xFFFFFFFFFFFFFFFFull, 0x000000000000FFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, 10, hash_enum::c_Connection },
+    { { 0x2D746E65746E6F43ull, 0x0000000065707954ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, { 0xFFFFFFFFFFFFFFFFull, 0x00000000FFFFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, 12, hash_enum::c_Content_Type },
+    { { 0x2D746E65746E6F43ull, 0x00000065676E6152ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, { 0xFFFFFFFFFFFFFFFFull, 0x000000FFFFFFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, 13, hash_enum::c_Content_Range },
+    { { 0x7A69726F68747541ull, 0x0000006E6F697461ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, { 0xFFFFFFFFFFFFFFFFull, 0x000000FFFFFFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, 13, hash_enum::c_Authorization },
+    { { 0x4C2D747065636341ull, 0x0065676175676E61ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, { 0xFFFFFFFFFFFFFFFFull, 0x00FFFFFFFFFFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, 15, hash_enum::c_Accept_Language },
+    { { 0x2D746E65746E6F43ull, 0x65676175676E614Cull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, { 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, 16, hash_enum::c_Content_Language },
+    { { 0x2D746E65746E6F43ull, 0x6E6F697461636F4Cull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, { 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, 16, hash_enum::c_Content_Location },
+    { { 0x432D747065636341ull, 0x0000746573726168ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, { 0xFFFFFFFFFFFFFFFFull, 0x0000FFFFFFFFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, 14, hash_enum::c_Accept_Charset },
+    { { 0x522D747065636341ull, 0x0000007365676E61ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, { 0xFFFFFFFFFFFFFFFFull, 0x000000FFFFFFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, 13, hash_enum::c_Accept_Ranges },
+    { { 0x2D746E65746E6F43ull, 0x7469736F70736944ull, 0x00000000006E6F69ull, 0x0000000000000000ull, 0x0000000000000000ull, }, { 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0x0000000000FFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, }, 19, hash_enum::c_Content_Disposition },
+    { { 0x6F432D6568636143ull, 0x0000006C6F72746Eull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, { 0xFFFFFFFFFFFFFFFFull, 0x000000FFFFFFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, 13, hash_enum::c_Cache_Control },
+    { { 0x432D737365636341ull, 0x4D2D6C6F72746E6Full, 0x00006567412D7861ull, 0x0000000000000000ull, 0x0000000000000000ull, }, { 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0x0000FFFFFFFFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, }, 22, hash_enum::c_Access_Control_Max_Age },
+    { { 0x452D747065636341ull, 0x00676E69646F636Eull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, { 0xFFFFFFFFFFFFFFFFull, 0x00FFFFFFFFFFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, 15, hash_enum::c_Accept_Encoding },
+    { { 0x2D746E65746E6F43ull, 0x676E69646F636E45ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, { 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, 16, hash_enum::c_Content_Encoding },
+    { { 0x0000746365707845ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, { 0x0000FFFFFFFFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, 6, hash_enum::c_Expect },
+    { { 0x0000000000004554ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, { 0x000000000000FFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, 2, hash_enum::c_TE },
+    { { 0x0000000067615445ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, { 0x00000000FFFFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, 4, hash_enum::c_ETag },
+    { { 0x0073657269707845ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, { 0x00FFFFFFFFFFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, 7, hash_enum::c_Expires },
+    { { 0x412D676E696D6954ull, 0x69724F2D776F6C6Cull, 0x00000000006E6967ull, 0x0000000000000000ull, 0x0000000000000000ull, }, { 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0x0000000000FFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, }, 19, hash_enum::c_Timing_Allow_Origin },
+    { { 0x6B6F6F432D746553ull, 0x0000000000006569ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, { 0xFFFFFFFFFFFFFFFFull, 0x000000000000FFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, 10, hash_enum::c_Set_Cookie },
+    { { 0x00000065676E6152ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, { 0x000000FFFFFFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, 5, hash_enum::c_Range },
+    { { 0x72502D5353582D58ull, 0x6E6F69746365746Full, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, { 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, 16, hash_enum::c_X_XSS_Protection },
+    { { 0x432D746365707845ull, 0x0000000000000054ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, { 0xFFFFFFFFFFFFFFFFull, 0x00000000000000FFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, 9, hash_enum::c_Expect_CT },
+    { { 0x726566736E617254ull, 0x6E69646F636E452Dull, 0x0000000000000067ull, 0x0000000000000000ull, 0x0000000000000000ull, }, { 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0x00000000000000FFull, 0x0000000000000000ull, 0x0000000000000000ull, }, 17, hash_enum::c_Transfer_Encoding },
+    { { 0x726177726F462D58ull, 0x74736F482D646564ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, { 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, 16, hash_enum::c_X_Forwarded_Host },
+    { { 0x2D656D6172462D58ull, 0x00736E6F6974704Full, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, { 0xFFFFFFFFFFFFFFFFull, 0x00FFFFFFFFFFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, 15, hash_enum::c_X_Frame_Options },
+    { { 0x0072656C69617254ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, { 0x00FFFFFFFFFFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, 7, hash_enum::c_Trailer },
+    { { 0x432D737365636341ull, 0x412D6C6F72746E6Full, 0x6572432D776F6C6Cull, 0x736C6169746E6564ull, 0x0000000000000000ull, }, { 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0x0000000000000000ull, }, 32, hash_enum::c_Access_Control_Allow_Credentials },
+    { { 0x65676E61522D6649ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, { 0xFFFFFFFFFFFFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, 8, hash_enum::c_If_Range },
+    { { 0x432D737365636341ull, 0x522D6C6F72746E6Full, 0x482D747365757165ull, 0x0000737265646165ull, 0x0000000000000000ull, }, { 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0x0000FFFFFFFFFFFFull, 0x0000000000000000ull, }, 30, hash_enum::c_Access_Control_Request_Headers },
+    { { 0x542D726576726553ull, 0x000000676E696D69ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, { 0xFFFFFFFFFFFFFFFFull, 0x000000FFFFFFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, 13, hash_enum::c_Server_Timing },
+    { { 0x7265727265666552ull, 0x007963696C6F502Dull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, { 0xFFFFFFFFFFFFFFFFull, 0x00FFFFFFFFFFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, 15, hash_enum::c_Referrer_Policy },
+    { { 0x75412D79786F7250ull, 0x616369746E656874ull, 0x0000000000006574ull, 0x0000000000000000ull, 0x0000000000000000ull, }, { 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0x000000000000FFFFull, 0x0000000000000000ull, 0x0000000000000000ull, }, 18, hash_enum::c_Proxy_Authenticate },
+    { { 0x536265572D636553ull, 0x63412D74656B636Full, 0x0000000074706563ull, 0x0000000000000000ull, 0x0000000000000000ull, }, { 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0x00000000FFFFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, }, 20, hash_enum::c_Sec_WebSocket_Accept },
+    { { 0x75412D79786F7250ull, 0x74617A69726F6874ull, 0x00000000006E6F69ull, 0x0000000000000000ull, 0x0000000000000000ull, }, { 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0x0000000000FFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, }, 19, hash_enum::c_Proxy_Authorization },
+    { { 0x4B2D63696C627550ull, 0x00736E69502D7965ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, { 0xFFFFFFFFFFFFFFFFull, 0x00FFFFFFFFFFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, 15, hash_enum::c_Public_Key_Pins },
+    { { 0x0000726576726553ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, { 0x0000FFFFFFFFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, 6, hash_enum::c_Server },
+    { { 0x6669646F4D2D6649ull, 0x636E69532D646569ull, 0x0000000000000065ull, 0x0000000000000000ull, 0x0000000000000000ull, }, { 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0x00000000000000FFull, 0x0000000000000000ull, 0x0000000000000000ull, }, 17, hash_enum::c_If_Modified_Since },
+    { { 0x6E65746E6F432D58ull, 0x4F2D657079542D74ull, 0x0000736E6F697470ull, 0x0000000000000000ull, 0x0000000000000000ull, }, { 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0x0000FFFFFFFFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, }, 22, hash_enum::c_X_Content_Type_Options },
+    { { 0x646F6D6E552D6649ull, 0x69532D6465696669ull, 0x000000000065636Eull, 0x0000000000000000ull, 0x0000000000000000ull, }, { 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0x0000000000FFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, }, 19, hash_enum::c_If_Unmodified_Since },
+    { { 0x726177726F462D58ull, 0x00726F462D646564ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, { 0xFFFFFFFFFFFFFFFFull, 0x00FFFFFFFFFFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, 15, hash_enum::c_X_Forwarded_For },
+    { { 0x2D746E65746E6F43ull, 0x00006874676E654Cull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, { 0xFFFFFFFFFFFFFFFFull, 0x0000FFFFFFFFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, 14, hash_enum::c_Content_Length },
+    { { 0x72502D534E442D58ull, 0x432D686374656665ull, 0x00006C6F72746E6Full, 0x0000000000000000ull, 0x0000000000000000ull, }, { 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0x0000FFFFFFFFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, }, 22, hash_enum::c_X_DNS_Prefetch_Control },
+    { { 0x0072657265666552ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, { 0x00FFFFFFFFFFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, 7, hash_enum::c_Referer },
+    { { 0x6E6F697461636F4Cull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, { 0xFFFFFFFFFFFFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, 8, hash_enum::c_Location },
+    { { 0x69532D7261656C43ull, 0x00617461442D6574ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, { 0xFFFFFFFFFFFFFFFFull, 0x00FFFFFFFFFFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, 15, hash_enum::c_Clear_Site_Data },
+    { { 0x4B2D63696C627550ull, 0x2D736E69502D7965ull, 0x4F2D74726F706552ull, 0x0000000000796C6Eull, 0x0000000000000000ull, }, { 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0x0000000000FFFFFFull, 0x0000000000000000ull, }, 27, hash_enum::c_Public_Key_Pins_Report_Only },
+    { { 0x66412D7972746552ull, 0x0000000000726574ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, { 0xFFFFFFFFFFFFFFFFull, 0x0000000000FFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, 11, hash_enum::c_Retry_After },
+    { { 0x432D737365636341ull, 0x522D6C6F72746E6Full, 0x4D2D747365757165ull, 0x000000646F687465ull, 0x0000000000000000ull, }, { 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0x000000FFFFFFFFFFull, 0x0000000000000000ull, }, 29, hash_enum::c_Access_Control_Request_Method },
+    { { 0x0000000079726156ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, { 0x00000000FFFFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, 4, hash_enum::c_Vary },
+    { { 0x2D746E65746E6F43ull, 0x7974697275636553ull, 0x007963696C6F502Dull, 0x0000000000000000ull, 0x0000000000000000ull, }, { 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0x00FFFFFFFFFFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, }, 23, hash_enum::c_Content_Security_Policy },
+    { { 0x6567412D72657355ull, 0x000000000000746Eull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, { 0xFFFFFFFFFFFFFFFFull, 0x000000000000FFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, 10, hash_enum::c_User_Agent },
+    { { 0x6C412D656772614Cull, 0x6E6F697461636F6Cull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, { 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, 16, hash_enum::c_Large_Allocation },
+    { { 0x00676E696E726157ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, { 0x00FFFFFFFFFFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, 7, hash_enum::c_Warning },
+    { { 0x687475412D575757ull, 0x6574616369746E65ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, { 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, 16, hash_enum::c_WWW_Authenticate },
+    { { 0x00006E696769724Full, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, { 0x0000FFFFFFFFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, 6, hash_enum::c_Origin },
+    { { 0x542D746369727453ull, 0x74726F70736E6172ull, 0x746972756365532Dull, 0x0000000000000079ull, 0x0000000000000000ull, }, { 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0x00000000000000FFull, 0x0000000000000000ull, }, 25, hash_enum::c_Strict_Transport_Security },
+    { { 0x0000000074736F48ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, { 0x00000000FFFFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, 4, hash_enum::c_Host },
+    { { 0x2D65727574616546ull, 0x00007963696C6F50ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, { 0xFFFFFFFFFFFFFFFFull, 0x0000FFFFFFFFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, 14, hash_enum::c_Feature_Policy },
+    { { 0x0000000065746144ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, { 0x00000000FFFFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, 4, hash_enum::c_Date },
+    { { 0x003265696B6F6F43ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, { 0x00FFFFFFFFFFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, 7, hash_enum::c_Cookie2 },
+    { { 0x0000616D67617250ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, { 0x0000FFFFFFFFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, 6, hash_enum::c_Pragma },
+    { { 0x2D746E65746E6F43ull, 0x7974697275636553ull, 0x2D7963696C6F502Dull, 0x4F2D74726F706552ull, 0x0000000000796C6Eull, }, { 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0x0000000000FFFFFFull, }, 35, hash_enum::c_Content_Security_Policy_Report_Only },
+    { { 0x614D656372756F53ull, 0x0000000000000070ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, { 0xFFFFFFFFFFFFFFFFull, 0x00000000000000FFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, 9, hash_enum::c_SourceMap },
+    { { 0x726177726F462D58ull, 0x746F72502D646564ull, 0x000000000000006Full, 0x0000000000000000ull, 0x0000000000000000ull, }, { 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0x00000000000000FFull, 0x0000000000000000ull, 0x0000000000000000ull, }, 17, hash_enum::c_X_Forwarded_Proto },
+    { { 0x000000006D6F7246ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, { 0x00000000FFFFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, 4, hash_enum::c_From },
+    { { 0x686374614D2D6649ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, { 0xFFFFFFFFFFFFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, 8, hash_enum::c_If_Match },
+    { { 0x0000000000544E44ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, { 0x0000000000FFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, 3, hash_enum::c_DNT },
+    { { 0x2D65646172677055ull, 0x6572756365736E49ull, 0x747365757165522Dull, 0x0000000000000073ull, 0x0000000000000000ull, }, { 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0x00000000000000FFull, 0x0000000000000000ull, }, 25, hash_enum::c_Upgrade_Insecure_Requests },
+    { { 0x0000000000006B54ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, { 0x000000000000FFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, 2, hash_enum::c_Tk },
+    { { 0x432D737365636341ull, 0x412D6C6F72746E6Full, 0x74654D2D776F6C6Cull, 0x0000000073646F68ull, 0x0000000000000000ull, }, { 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0x00000000FFFFFFFFull, 0x0000000000000000ull, }, 28, hash_enum::c_Access_Control_Allow_Methods },
+    { { 0x2D656E6F4E2D6649ull, 0x000000686374614Dull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, { 0xFFFFFFFFFFFFFFFFull, 0x000000FFFFFFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, 13, hash_enum::c_If_None_Match },
+    { { 0x696C412D7065654Bull, 0x0000000000006576ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, { 0xFFFFFFFFFFFFFFFFull, 0x000000000000FFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, 10, hash_enum::c_Keep_Alive },
+    { { 0x432D737365636341ull, 0x452D6C6F72746E6Full, 0x65482D65736F7078ull, 0x0000007372656461ull, 0x0000000000000000ull, }, { 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0x000000FFFFFFFFFFull, 0x0000000000000000ull, }, 29, hash_enum::c_Access_Control_Expose_Headers },
+    { { 0x646F4D2D7473614Cull, 0x0000006465696669ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, { 0xFFFFFFFFFFFFFFFFull, 0x000000FFFFFFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, 13, hash_enum::c_Last_Modified },
+    { {}, {}, 0, hash_enum::default_ },
+    { { 0x432D737365636341ull, 0x412D6C6F72746E6Full, 0x69724F2D776F6C6Cull, 0x00000000006E6967ull, 0x0000000000000000ull, }, { 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0x0000000000FFFFFFull, 0x0000000000000000ull, }, 27, hash_enum::c_Access_Control_Allow_Origin },
+    { {}, {}, 0, hash_enum::default_ },
+    { { 0x6564726177726F46ull, 0x0000000000000064ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, { 0xFFFFFFFFFFFFFFFFull, 0x00000000000000FFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, 9, hash_enum::c_Forwarded },
+    { {}, {}, 0, hash_enum::default_ },
+    { {}, {}, 0, hash_enum::default_ },
+    { {}, {}, 0, hash_enum::default_ },
+    { {}, {}, 0, hash_enum::default_ },
+    { { 0x432D737365636341ull, 0x412D6C6F72746E6Full, 0x6165482D776F6C6Cull, 0x0000000073726564ull, 0x0000000000000000ull, }, { 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0x00000000FFFFFFFFull, 0x0000000000000000ull, }, 28, hash_enum::c_Access_Control_Allow_Headers },
+    { { 0x6B6F6F432D746553ull, 0x0000000000326569ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, { 0xFFFFFFFFFFFFFFFFull, 0x0000000000FFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, 11, hash_enum::c_Set_Cookie2 },
+    { {}, {}, 0, hash_enum::default_ },
+    { {}, {}, 0, hash_enum::default_ },
+    { {}, {}, 0, hash_enum::default_ },
+    { { 0x0000000000616956ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, { 0x0000000000FFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, }, 3, hash_enum::c_Via },
+}};
+
+inline bool padded_equals( const padded_entry &entry, std::string_view s )
+{
+    uint64_t diff = s.size() ^ entry.size;
+    {
+        uint64_t word;
+        std::memcpy( &word, s.data(), 8 );
+        diff |= ( word & entry.mask[ 0 ] ) ^ entry.key[ 0 ];
+    }
+    {
+        uint64_t word;
+        std::memcpy( &word, s.data() + ( s.size() > 8 ? 8 : 0 ), 8 );
+        diff |= ( word & entry.mask[ 1 ] ) ^ entry.key[ 1 ];
+    }
+    {
+        uint64_t word;
+        std::memcpy( &word, s.data() + ( s.size() > 16 ? 16 : 0 ), 8 );
+        diff |= ( word & entry.mask[ 2 ] ) ^ entry.key[ 2 ];
+    }
+    {
+        uint64_t word;
+        std::memcpy( &word, s.data() + ( s.size() > 24 ? 24 : 0 ), 8 );
+        diff |= ( word & entry.mask[ 3 ] ) ^ entry.key[ 3 ];
+    }
+    {
+        uint64_t word;
+        std::memcpy( &word, s.data() + ( s.size() > 32 ? 32 : 0 ), 8 );
+        diff |= ( word & entry.mask[ 4 ] ) ^ entry.key[ 4 ];
+    }
+    return diff == 0;
+}
+
+} // namespace internal_
+
+constexpr internal_::hash_enum hash( std::string_view s )
+{
+    constexpr size_t MinWordLength = 2;
+    constexpr size_t MaxWordLength = 35;
+    constexpr size_t MaxHashValue = 99;
+
+    if ( s.size() < MinWordLength || s.size() > MaxWordLength )
+    {
+        return internal_::hash_enum::default_;
+    }
+
+    size_t hash_val = s.size();
+    hash_val += internal_::asso_values[ static_cast< unsigned char >( s[ s.size() - 1 ] ) ];
+    switch( s.size() )
+    {
+                       case 35:
+    [[ fallthrough ]]; case 34:
+    [[ fallthrough ]]; case 33:
+    [[ fallthrough ]]; case 32:
+    [[ fallthrough ]]; case 31:
+    [[ fallthrough ]]; case 30:
+    [[ fallthrough ]]; case 29:
+    [[ fallthrough ]]; case 28:
+    [[ fallthrough ]]; case 27:
+    [[ fallthrough ]]; case 26:
+    [[ fallthrough ]]; case 25:
+    [[ fallthrough ]]; case 24:
+    [[ fallthrough ]]; case 23:
+    [[ fallthrough ]]; case 22:
+        hash_val += internal_::asso_values[ static_cast< unsigned char >( s[ 21] ) ];
+    [[ fallthrough ]]; case 21:
+    [[ fallthrough ]]; case 20:
+    [[ fallthrough ]]; case 19:
+    [[ fallthrough ]]; case 18:
+    [[ fallthrough ]]; case 17:
+    [[ fallthrough ]]; case 16:
+    [[ fallthrough ]]; case 15:
+    [[ fallthrough ]]; case 14:
+    [[ fallthrough ]]; case 13:
+    [[ fallthrough ]]; case 12:
+    [[ fallthrough ]]; case 11:
+    [[ fallthrough ]]; case 10:
+    [[ fallthrough ]]; case 9:
+    [[ fallthrough ]]; case 8:
+    [[ fallthrough ]]; case 7:
+    [[ fallthrough ]]; case 6:
+    [[ fallthrough ]]; case 5:
+    [[ fallthrough ]]; case 4:
+    [[ fallthrough ]]; case 3:
+    [[ fallthrough ]]; case 2:
+    [[ fallthrough ]]; case 1:
+        hash_val += internal_::asso_values[ static_cast< unsigned char >( s[ 0] ) ];
+    }
+
+    if ( hash_val <= MaxHashValue )
+    {
+        const size_t slot = hash_val;
+        if ( internal_::wordlist[ slot ].word == s )
+        {
+            return internal_::wordlist[ slot ].enum_val;
+        }
+    }
+    return internal_::hash_enum::default_;
+}
+
+// Same as hash(), but at least hash_padding bytes past the end of s
+// must be readable. Keys are compared 8 bytes at a time.
+inline internal_::hash_enum hash_padded( std::string_view s )
+{
+    constexpr size_t MinWordLength = 2;
+    constexpr size_t MaxWordLength = 35;
+    constexpr size_t MaxHashValue = 99;
+
+    if ( s.size() < MinWordLength || s.size() > MaxWordLength )
+    {
+        return internal_::hash_enum::default_;
+    }
+
+    size_t hash_val = s.size();
+    hash_val += internal_::asso_values[ static_cast< unsigned char >( s[ s.size() - 1 ] ) ];
+    switch( s.size() )
+    {
+                       case 35:
+    [[ fallthrough ]]; case 34:
+    [[ fallthrough ]]; case 33:
+    [[ fallthrough ]]; case 32:
+    [[ fallthrough ]]; case 31:
+    [[ fallthrough ]]; case 30:
+    [[ fallthrough ]]; case 29:
+    [[ fallthrough ]]; case 28:
+    [[ fallthrough ]]; case 27:
+    [[ fallthrough ]]; case 26:
+    [[ fallthrough ]]; case 25:
+    [[ fallthrough ]]; case 24:
+    [[ fallthrough ]]; case 23:
+    [[ fallthrough ]]; case 22:
+        hash_val += internal_::asso_values[ static_cast< unsigned char >( s[ 21] ) ];
+    [[ fallthrough ]]; case 21:
+    [[ fallthrough ]]; case 20:
+    [[ fallthrough ]]; case 19:
+    [[ fallthrough ]]; case 18:
+    [[ fallthrough ]]; case 17:
+    [[ fallthrough ]]; case 16:
+    [[ fallthrough ]]; case 15:
+    [[ fallthrough ]]; case 14:
+    [[ fallthrough ]]; case 13:
+    [[ fallthrough ]]; case 12:
+    [[ fallthrough ]]; case 11:
+    [[ fallthrough ]]; case 10:
+    [[ fallthrough ]]; case 9:
+    [[ fallthrough ]]; case 8:
+    [[ fallthrough ]]; case 7:
+    [[ fallthrough ]]; case 6:
+    [[ fallthrough ]]; case 5:
+    [[ fallthrough ]]; case 4:
+    [[ fallthrough ]]; case 3:
+    [[ fallthrough ]]; case 2:
+    [[ fallthrough ]]; case 1:
+        hash_val += internal_::asso_values[ static_cast< unsigned char >( s[ 0] ) ];
+    }
+
+    if ( hash_val <= MaxHashValue )
+    {
+        const size_t slot = hash_val;
+        if ( internal_::padded_equals( internal_::padded_keys[ slot ], s ) )
+        {
+            return internal_::padded_keys[ slot ].enum_val;
+        }
+    }
+    return internal_::hash_enum::default_;
+}
+
+} // namespace padded {
+
+// Extra check for safety
+static_assert( padded::hash( "Age" ) == padded::internal_::hash_enum::c_Age );
+static_assert( padded::hash( "Allow" ) == padded::internal_::hash_enum::c_Allow );
+static_assert( padded::hash( "Cookie" ) == padded::internal_::hash_enum::c_Cookie );
+static_assert( padded::hash( "Accept" ) == padded::internal_::hash_enum::c_Accept );
+static_assert( padded::hash( "Connection" ) == padded::internal_::hash_enum::c_Connection );
+static_assert( padded::hash( "Content-Type" ) == padded::internal_::hash_enum::c_Content_Type );
+static_assert( padded::hash( "Content-Range" ) == padded::internal_::hash_enum::c_Content_Range );
+static_assert( padded::hash( "Authorization" ) == padded::internal_::hash_enum::c_Authorization );
+static_assert( padded::hash( "Accept-Language" ) == padded::internal_::hash_enum::c_Accept_Language );
+static_assert( padded::hash( "Content-Language" ) == padded::internal_::hash_enum::c_Content_Language );
+static_assert( padded::hash( "Content-Location" ) == padded::internal_::hash_enum::c_Content_Location );
+static_assert( padded::hash( "Accept-Charset" ) == padded::internal_::hash_enum::c_Accept_Charset );
+static_assert( padded::hash( "Accept-Ranges" ) == padded::internal_::hash_enum::c_Accept_Ranges );
+static_assert( padded::hash( "Content-Disposition" ) == padded::internal_::hash_enum::c_Content_Disposition );
+static_assert( padded::hash( "Cache-Control" ) == padded::internal_::hash_enum::c_Cache_Control );
+static_assert( padded::hash( "Access-Control-Max-Age" ) == padded::internal_::hash_enum::c_Access_Control_Max_Age );
+static_assert( padded::hash( "Accept-Encoding" ) == padded::internal_::hash_enum::c_Accept_Encoding );
+static_assert( padded::hash( "Content-Encoding" ) == padded::internal_::hash_enum::c_Content_Encoding );
+static_assert( padded::hash( "Expect" ) == padded::internal_::hash_enum::c_Expect );
+static_assert( padded::hash( "TE" ) == padded::internal_::hash_enum::c_TE );
+static_assert( padded::hash( "ETag" ) == padded::internal_::hash_enum::c_ETag );
+static_assert( padded::hash( "Expires" ) == padded::internal_::hash_enum::c_Expires );
+static_assert( padded::hash( "Timing-Allow-Origin" ) == padded::internal_::hash_enum::c_Timing_Allow_Origin );
+static_assert( padded::hash( "Set-Cookie" ) == padded::internal_::hash_enum::c_Set_Cookie );
+static_assert( padded::hash( "Range" ) == padded::internal_::hash_enum::c_Range );
+static_assert( padded::hash( "X-XSS-Protection" ) == padded::internal_::hash_enum::c_X_XSS_Protection );
+static_assert( padded::hash( "Expect-CT" ) == padded::internal_::hash_enum::c_Expect_CT );
+static_assert( padded::hash( "Transfer-Encoding" ) == padded::internal_::hash_enum::c_Transfer_Encoding );
+static_assert( padded::hash( "X-Forwarded-Host" ) == padded::internal_::hash_enum::c_X_Forwarded_Host );
+static_assert( padded::hash( "X-Frame-Options" ) == padded::internal_::hash_enum::c_X_Frame_Options );
+static_assert( padded::hash( "Trailer" ) == padded::internal_::hash_enum::c_Trailer );
+static_assert( padded::hash( "Access-Control-Allow-Credentials" ) == padded::internal_::hash_enum::c_Access_Control_Allow_Credentials );
+static_assert( padded::hash( "If-Range" ) == padded::internal_::hash_enum::c_If_Range );
+static_assert( padded::hash( "Access-Control-Request-Headers" ) == padded::internal_::hash_enum::c_Access_Control_Request_Headers );
+static_assert( padded::hash( "Server-Timing" ) == padded::internal_::hash_enum::c_Server_Timing );
+static_assert( padded::hash( "Referrer-Policy" ) == padded::internal_::hash_enum::c_Referrer_Policy );
+static_assert( padded::hash( "Proxy-Authenticate" ) == padded::internal_::hash_enum::c_Proxy_Authenticate );
+static_assert( padded::hash( "Sec-WebSocket-Accept" ) == padded::internal_::hash_enum::c_Sec_WebSocket_Accept );
+static_assert( padded::hash( "Proxy-Authorization" ) == padded::internal_::hash_enum::c_Proxy_Authorization );
+static_assert( padded::hash( "Public-Key-Pins" ) == padded::internal_::hash_enum::c_Public_Key_Pins );
+static_assert( padded::hash( "Server" ) == padded::internal_::hash_enum::c_Server );
+static_assert( padded::hash( "If-Modified-Since" ) == padded::internal_::hash_enum::c_If_Modified_Since );
+static_assert( padded::hash( "X-Content-Type-Options" ) == padded::internal_::hash_enum::c_X_Content_Type_Options );
+static_assert( padded::hash( "If-Unmodified-Since" ) == padded::internal_::hash_enum::c_If_Unmodified_Since );
+static_assert( padded::hash( "X-Forwarded-For" ) == padded::internal_::hash_enum::c_X_Forwarded_For );
+static_assert( padded::hash( "Content-Length" ) == padded::internal_::hash_enum::c_Content_Length );
+static_assert( padded::hash( "X-DNS-Prefetch-Control" ) == padded::internal_::hash_enum::c_X_DNS_Prefetch_Control );
+static_assert( padded::hash( "Referer" ) == padded::internal_::hash_enum::c_Referer );
+static_assert( padded::hash( "Location" ) == padded::internal_::hash_enum::c_Location );
+static_assert( padded::hash( "Clear-Site-Data" ) == padded::internal_::hash_enum::c_Clear_Site_Data );
+static_assert( padded::hash( "Public-Key-Pins-Report-Only" ) == padded::internal_::hash_enum::c_Public_Key_Pins_Report_Only );
+static_assert( padded::hash( "Retry-After" ) == padded::internal_::hash_enum::c_Retry_After );
+static_assert( padded::hash( "Access-Control-Request-Method" ) == padded::internal_::hash_enum::c_Access_Control_Request_Method );
+static_assert( padded::hash( "Vary" ) == padded::internal_::hash_enum::c_Vary );
+static_assert( padded::hash( "Content-Security-Policy" ) == padded::internal_::hash_enum::c_Content_Security_Policy );
+static_assert( padded::hash( "User-Agent" ) == padded::internal_::hash_enum::c_User_Agent );
+static_assert( padded::hash( "Large-Allocation" ) == padded::internal_::hash_enum::c_Large_Allocation );
+static_assert( padded::hash( "Warning" ) == padded::internal_::hash_enum::c_Warning );
+static_assert( padded::hash( "WWW-Authenticate" ) == padded::internal_::hash_enum::c_WWW_Authenticate );
+static_assert( padded::hash( "Origin" ) == padded::internal_::hash_enum::c_Origin );
+static_assert( padded::hash( "Strict-Transport-Security" ) == padded::internal_::hash_enum::c_Strict_Transport_Security );
+static_assert( padded::hash( "Host" ) == padded::internal_::hash_enum::c_Host );
+static_assert( padded::hash( "Feature-Policy" ) == padded::internal_::hash_enum::c_Feature_Policy );
+static_assert( padded::hash( "Date" ) == padded::internal_::hash_enum::c_Date );
+static_assert( padded::hash( "Cookie2" ) == padded::internal_::hash_enum::c_Cookie2 );
+static_assert( padded::hash( "Pragma" ) == padded::internal_::hash_enum::c_Pragma );
+static_assert( padded::hash( "Content-Security-Policy-Report-Only" ) == padded::internal_::hash_enum::c_Content_Security_Policy_Report_Only );
+static_assert( padded::hash( "SourceMap" ) == padded::internal_::hash_enum::c_SourceMap );
+static_assert( padded::hash( "X-Forwarded-Proto" ) == padded::internal_::hash_enum::c_X_Forwarded_Proto );
+static_assert( padded::hash( "From" ) == padded::internal_::hash_enum::c_From );
+static_assert( padded::hash( "If-Match" ) == padded::internal_::hash_enum::c_If_Match );
+static_assert( padded::hash( "DNT" ) == padded::internal_::hash_enum::c_DNT );
+static_assert( padded::hash( "Upgrade-Insecure-Requests" ) == padded::internal_::hash_enum::c_Upgrade_Insecure_Requests );
+static_assert( padded::hash( "Tk" ) == padded::internal_::hash_enum::c_Tk );
+static_assert( padded::hash( "Access-Control-Allow-Methods" ) == padded::internal_::hash_enum::c_Access_Control_Allow_Methods );
+static_assert( padded::hash( "If-None-Match" ) == padded::internal_::hash_enum::c_If_None_Match );
+static_assert( padded::hash( "Keep-Alive" ) == padded::internal_::hash_enum::c_Keep_Alive );
+static_assert( padded::hash( "Access-Control-Expose-Headers" ) == padded::internal_::hash_enum::c_Access_Control_Expose_Headers );
+static_assert( padded::hash( "Last-Modified" ) == padded::internal_::hash_enum::c_Last_Modified );
+static_assert( padded::hash( "Access-Control-Allow-Origin" ) == padded::internal_::hash_enum::c_Access_Control_Allow_Origin );
+static_assert( padded::hash( "Forwarded" ) == padded::internal_::hash_enum::c_Forwarded );
+static_assert( padded::hash( "Access-Control-Allow-Headers" ) == padded::internal_::hash_enum::c_Access_Control_Allow_Headers );
+static_assert( padded::hash( "Set-Cookie2" ) == padded::internal_::hash_enum::c_Set_Cookie2 );
+static_assert( padded::hash( "Via" ) == padded::internal_::hash_enum::c_Via );
+
+#endif // PADDED__HASH_HPP_
@@ -0,0 +1,954 @@
+#ifndef __HASH_HPP_
+#define __HASH_HPP_
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+
+namespace internal_ {
+
+enum class hash_enum
+{
+    default_ = -1,
+    c_qwe_qwe = 0,
+    c_qwe_qwe_0 = 1,
+    c_qwe_qwe_1 = 2,
+    c_qwe_qwe_2 = 3,
+    c_default_ = 4,
+    c_222222222 = 5,
+    c_123123132 = 6,
+    c_Quotes___ = 7,
+    c_Backslash__ = 8,
+    c_String_with_tabs = 9,
+    c_String_with_spaces = 10,
+    c_Some_punctuation_chars________________ = 11,
+    c_UTF_8_stuff__emoji__________________________________________ = 12,
+    c_Control_chars_________________________________except_newline___ = 13,
+};
+
+} // namespace internal_
+
+// Number of keywords, enum values other than the default are in [ 0, hash_count )
+constexpr size_t hash_count = 14;
+
+constexpr internal_::hash_enum hash( std::string_view s );
+
+namespace internal_ {
+
+constexpr uint64_t load_le4( const char *p )
+{
+    return uint64_t( static_cast< unsigned char >( p[ 0 ] ) )
+         | uint64_t( static_cast< unsigned char >( p[ 1 ] ) ) << 8
+         | uint64_t( static_cast< unsigned char >( p[ 2 ] ) ) << 16
+         | uint64_t( static_cast< unsigned char >( p[ 3 ] ) ) << 24;
+}
+
+constexpr uint64_t load_le8( const char *p )
+{
+    return uint64_t( static_cast< unsigned char >( p[ 0 ] ) )
+         | uint64_t( static_cast< unsigned char >( p[ 1 ] ) ) << 8
+         | uint64_t( static_cast< unsigned char >( p[ 2 ] ) ) << 16
+         | uint64_t( static_cast< unsigned char >( p[ 3 ] ) ) << 24
+         | uint64_t( static_cast< unsigned char >( p[ 4 ] ) ) << 32
+         | uint64_t( static_cast< unsigned char >( p[ 5 ] ) ) << 40
+         | uint64_t( static_cast< unsigned char >( p[ 6 ] ) ) << 48
+         | uint64_t( static_cast< unsigned char >( p[ 7 ] ) ) << 56;
+}
+
+struct word_entry
+{
+    std::string_view word;
+    hash_enum enum_val;
+};
+
+// Keywords of 7 to 7 bytes
+constexpr std::array< int, 256 > asso_values_0 = {
+        11,    11,    11,    11,    11,    11,    11,    11,    11,    11,
+         3,    11,    11,    11,    11,    11,    11,    11,    11,    11,
+        11,    11,    11,    11,    11,    11,    11,    11,    11,    11,
+        11,    11,    11,    11,    11,    11,    11,    11,    11,    11,
+        11,    11,    11,    11,    11,    11,    11,    11,    11,    11,
+        11,    11,     2,    11,    11,    11,    11,    11,    11,    11,
+        11,    11,    11,    11,    11,    11,    11,    11,    11,    11,
+         1,    11,    11,    11,    11,    11,    11,    11,    11,    11,
+        11,    11,    11,    11,    11,    11,    11,    11,    11,    11,
+        11,    11,    11,    11,    11,    11,    11,    11,    11,    11,
+        11,    11,    11,    11,    11,    11,    11,    11,    11,    11,
+        11,    11,    11,    11,    11,    11,    11,    11,    11,    11,
+        11,    11,    11,    11,    11,    11,    11,    11,    11,    11,
+        11,    11,    11,    11,    11,    11,    11,    11,    11,    11,
+        11,    11,     0,    11,    11,    11,    11,    11,    11,    11,
+        11,    11,    11,    11,    11,    11,    11,    11,    11,    11,
+        11,    11,    11,    11,    11,    11,    11,    11,    11,    11,
+        11,    11,    11,    11,    11,    11,    11,    11,    11,    11,
+        11,    11,    11,    11,    11,    11,    11,    11,    11,    11,
+        11,    11,    11,    11,    11,    11,    11,    11,    11,    11,
+        11,    11,    11,    11,    11,    11,    11,    11,    11,    11,
+        11,    11,    11,    11,    11,    11,    11,    11,    11,    11,
+        11,    11,    11,    11,    11,    11,    11,    11,    11,    11,
+        11,    11,    11,    11,    11,    11,    11,    11,    11,    11,
+        11,    11,    11,    11,    11,    11,    11,    11,    11,    11,
+        11,    11,    11,    11,    11,    11,
+};
+
+constexpr std::array< word_entry, 11 > wordlist_0 = {{
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "qwe qwe", hash_enum::c_qwe_qwe },
+    { "qwe+qwe", hash_enum::c_qwe_qwe_0 },
+    { "qwe_qwe", hash_enum::c_qwe_qwe_1 },
+    { "qwe-qwe", hash_enum::c_qwe_qwe_2 },
+}};
+
+constexpr hash_enum hash_0( std::string_view s )
+{
+    constexpr size_t MinWordLength = 7;
+    constexpr size_t MaxWordLength = 7;
+    constexpr size_t MaxHashValue = 10;
+
+    if ( s.size() < MinWordLength || s.size() > MaxWordLength )
+    {
+        return internal_::hash_enum::default_;
+    }
+
+    size_t hash_val = s.size();
+    hash_val += internal_::asso_values_0[ 0 + ( ( internal_::load_le4( s.data() + s.size() - 4 ) * 0xE220A8397B1DCDAFull ) >> 56 ) ];
+    switch( s.size() )
+    {
+                       case 7:
+    [[ fallthrough ]]; case 6:
+    [[ fallthrough ]]; case 5:
+    [[ fallthrough ]]; case 4:
+    [[ fallthrough ]]; case 3:
+    [[ fallthrough ]]; case 2:
+    [[ fallthrough ]]; case 1:
+        ; // Prevent compiler error
+    }
+
+    if ( hash_val <= MaxHashValue )
+    {
+        const size_t slot = hash_val;
+        if ( internal_::wordlist_0[ slot ].word == s )
+        {
+            return internal_::wordlist_0[ slot ].enum_val;
+        }
+    }
+    return internal_::hash_enum::default_;
+}
+
+// Keywords of 8 to 8 bytes
+constexpr std::array< int, 0 > asso_values_1 = {
+};
+
+constexpr std::array< word_entry, 9 > wordlist_1 = {{
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "default_", hash_enum::c_default_ },
+}};
+
+constexpr hash_enum hash_1( std::string_view s )
+{
+    constexpr size_t MinWordLength = 8;
+    constexpr size_t MaxWordLength = 8;
+    constexpr size_t MaxHashValue = 8;
+
+    if ( s.size() < MinWordLength || s.size() > MaxWordLength )
+    {
+        return internal_::hash_enum::default_;
+    }
+
+    size_t hash_val = s.size();
+    switch( s.size() )
+    {
+                       case 8:
+    [[ fallthrough ]]; case 7:
+    [[ fallthrough ]]; case 6:
+    [[ fallthrough ]]; case 5:
+    [[ fallthrough ]]; case 4:
+    [[ fallthrough ]]; case 3:
+    [[ fallthrough ]]; case 2:
+    [[ fallthrough ]]; case 1:
+        ; // Prevent compiler error
+    }
+
+    if ( hash_val <= MaxHashValue )
+    {
+        const size_t slot = hash_val;
+        if ( internal_::wordlist_1[ slot ].word == s )
+        {
+            return internal_::wordlist_1[ slot ].enum_val;
+        }
+    }
+    return internal_::hash_enum::default_;
+}
+
+// Keywords of 9 to 9 bytes
+constexpr std::array< int, 256 > asso_values_2 = {
+        12,    12,    12,    12,    12,    12,    12,    12,    12,    12,
+        12,    12,    12,    12,    12,    12,    12,    12,    12,    12,
+        12,    12,    12,    12,    12,    12,    12,    12,    12,    12,
+        12,    12,    12,    12,    12,    12,    12,    12,    12,    12,
+        12,    12,    12,    12,    12,    12,    12,    12,    12,    12,
+        12,    12,    12,    12,    12,    12,    12,    12,    12,    12,
+        12,    12,    12,    12,    12,    12,    12,    12,    12,    12,
+        12,    12,    12,    12,    12,    12,    12,    12,    12,    12,
+        12,    12,    12,    12,    12,    12,    12,    12,    12,    12,
+        12,    12,    12,    12,    12,    12,    12,    12,    12,    12,
+        12,    12,    12,    12,    12,    12,    12,     2,    12,    12,
+        12,    12,    12,    12,    12,    12,    12,    12,    12,    12,
+        12,    12,    12,    12,     1,    12,    12,    12,    12,    12,
+        12,    12,    12,    12,    12,    12,    12,    12,    12,    12,
+        12,    12,    12,    12,    12,    12,    12,    12,    12,    12,
+        12,    12,    12,    12,    12,    12,    12,    12,    12,    12,
+        12,    12,    12,    12,    12,    12,    12,    12,    12,    12,
+        12,    12,    12,    12,    12,    12,    12,    12,    12,    12,
+        12,    12,    12,    12,    12,    12,    12,    12,    12,    12,
+        12,    12,    12,    12,    12,    12,    12,    12,    12,    12,
+        12,    12,    12,    12,    12,    12,    12,    12,    12,    12,
+        12,    12,    12,    12,    12,    12,     0,    12,    12,    12,
+        12,    12,    12,    12,    12,    12,    12,    12,    12,    12,
+        12,    12,    12,    12,    12,    12,    12,    12,    12,    12,
+        12,    12,    12,    12,    12,    12,    12,    12,    12,    12,
+        12,    12,    12,    12,    12,    12,
+};
+
+constexpr std::array< word_entry, 12 > wordlist_2 = {{
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "222222222", hash_enum::c_222222222 },
+    { "123123132", hash_enum::c_123123132 },
+    { "Quotes \"\'", hash_enum::c_Quotes___ },
+}};
+
+constexpr hash_enum hash_2( std::string_view s )
+{
+    constexpr size_t MinWordLength = 9;
+    constexpr size_t MaxWordLength = 9;
+    constexpr size_t MaxHashValue = 11;
+
+    if ( s.size() < MinWordLength || s.size() > MaxWordLength )
+    {
+        return internal_::hash_enum::default_;
+    }
+
+    size_t hash_val = s.size();
+    hash_val += internal_::asso_values_2[ 0 + ( ( internal_::load_le8( s.data() + s.size() - 8 ) * 0xE220A8397B1DCDAFull ) >> 56 ) ];
+    switch( s.size() )
+    {
+                       case 9:
+    [[ fallthrough ]]; case 8:
+    [[ fallthrough ]]; case 7:
+    [[ fallthrough ]]; case 6:
+    [[ fallthrough ]]; case 5:
+    [[ fallthrough ]]; case 4:
+    [[ fallthrough ]]; case 3:
+    [[ fallthrough ]]; case 2:
+    [[ fallthrough ]]; case 1:
+        ; // Prevent compiler error
+    }
+
+    if ( hash_val <= MaxHashValue )
+    {
+        const size_t slot = hash_val;
+        if ( internal_::wordlist_2[ slot ].word == s )
+        {
+            return internal_::wordlist_2[ slot ].enum_val;
+        }
+    }
+    return internal_::hash_enum::default_;
+}
+
+// Keywords of 11 to 11 bytes
+constexpr std::array< int, 0 > asso_values_3 = {
+};
+
+constexpr std::array< word_entry, 12 > wordlist_3 = {{
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "Backslash \\", hash_enum::c_Backslash__ },
+}};
+
+constexpr hash_enum hash_3( std::string_view s )
+{
+    constexpr size_t MinWordLength = 11;
+    constexpr size_t MaxWordLength = 11;
+    constexpr size_t MaxHashValue = 11;
+
+    if ( s.size() < MinWordLength || s.size() > MaxWordLength )
+    {
+        return internal_::hash_enum::default_;
+    }
+
+    size_t hash_val = s.size();
+    switch( s.size() )
+    {
+                       case 11:
+    [[ fallthrough ]]; case 10:
+    [[ fallthrough ]]; case 9:
+    [[ fallthrough ]]; case 8:
+    [[ fallthrough ]]; case 7:
+    [[ fallthrough ]]; case 6:
+    [[ fallthrough ]]; case 5:
+    [[ fallthrough ]]; case 4:
+    [[ fallthrough ]]; case 3:
+    [[ fallthrough ]]; case 2:
+    [[ fallthrough ]]; case 1:
+        ; // Prevent compiler error
+    }
+
+    if ( hash_val <= MaxHashValue )
+    {
+        const size_t slot = hash_val;
+        if ( internal_::wordlist_3[ slot ].word == s )
+        {
+            return internal_::wordlist_3[ slot ].enum_val;
+        }
+    }
+    return internal_::hash_enum::default_;
+}
+
+// Keywords of 16 to 16 bytes
+constexpr std::array< int, 0 > asso_values_4 = {
+};
+
+constexpr std::array< word_entry, 17 > wordlist_4 = {{
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "String\x09with\x09tabs", hash_enum::c_String_with_tabs },
+}};
+
+constexpr hash_enum hash_4( std::string_view s )
+{
+    constexpr size_t MinWordLength = 16;
+    constexpr size_t MaxWordLength = 16;
+    constexpr size_t MaxHashValue = 16;
+
+    if ( s.size() < MinWordLength || s.size() > MaxWordLength )
+    {
+        return internal_::hash_enum::default_;
+    }
+
+    size_t hash_val = s.size();
+    switch( s.size() )
+    {
+                       case 16:
+    [[ fallthrough ]]; case 15:
+    [[ fallthrough ]]; case 14:
+    [[ fallthrough ]]; case 13:
+    [[ fallthrough ]]; case 12:
+    [[ fallthrough ]]; case 11:
+    [[ fallthrough ]]; case 10:
+    [[ fallthrough ]]; case 9:
+    [[ fallthrough ]]; case 8:
+    [[ fallthrough ]]; case 7:
+    [[ fallthrough ]]; case 6:
+    [[ fallthrough ]]; case 5:
+    [[ fallthrough ]]; case 4:
+    [[ fallthrough ]]; case 3:
+    [[ fallthrough ]]; case 2:
+    [[ fallthrough ]]; case 1:
+        ; // Prevent compiler error
+    }
+
+    if ( hash_val <= MaxHashValue )
+    {
+        const size_t slot = hash_val;
+        if ( internal_::wordlist_4[ slot ].word == s )
+        {
+            return internal_::wordlist_4[ slot ].enum_val;
+        }
+    }
+    return internal_::hash_enum::default_;
+}
+
+// Keywords of 18 to 18 bytes
+constexpr std::array< int, 0 > asso_values_5 = {
+};
+
+constexpr std::array< word_entry, 19 > wordlist_5 = {{
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "String with spaces", hash_enum::c_String_with_spaces },
+}};
+
+constexpr hash_enum hash_5( std::string_view s )
+{
+    constexpr size_t MinWordLength = 18;
+    constexpr size_t MaxWordLength = 18;
+    constexpr size_t MaxHashValue = 18;
+
+    if ( s.size() < MinWordLength || s.size() > MaxWordLength )
+    {
+        return internal_::hash_enum::default_;
+    }
+
+    size_t hash_val = s.size();
+    switch( s.size() )
+    {
+                       case 18:
+    [[ fallthrough ]]; case 17:
+    [[ fallthrough ]]; case 16:
+    [[ fallthrough ]]; case 15:
+    [[ fallthrough ]]; case 14:
+    [[ fallthrough ]]; case 13:
+    [[ fallthrough ]]; case 12:
+    [[ fallthrough ]]; case 11:
+    [[ fallthrough ]]; case 10:
+    [[ fallthrough ]]; case 9:
+    [[ fallthrough ]]; case 8:
+    [[ fallthrough ]]; case 7:
+    [[ fallthrough ]]; case 6:
+    [[ fallthrough ]]; case 5:
+    [[ fallthrough ]]; case 4:
+    [[ fallthrough ]]; case 3:
+    [[ fallthrough ]]; case 2:
+    [[ fallthrough ]]; case 1:
+        ; // Prevent compiler error
+    }
+
+    if ( hash_val <= MaxHashValue )
+    {
+        const size_t slot = hash_val;
+        if ( internal_::wordlist_5[ slot ].word == s )
+        {
+            return internal_::wordlist_5[ slot ].enum_val;
+        }
+    }
+    return internal_::hash_enum::default_;
+}
+
+// Keywords of 38 to 38 bytes
+constexpr std::array< int, 0 > asso_values_6 = {
+};
+
+constexpr std::array< word_entry, 39 > wordlist_6 = {{
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "Some punctuation chars: !@#$%^&*(){}[]", hash_enum::c_Some_punctuation_chars________________ },
+}};
+
+constexpr hash_enum hash_6( std::string_view s )
+{
+    constexpr size_t MinWordLength = 38;
+    constexpr size_t MaxWordLength = 38;
+    constexpr size_t MaxHashValue = 38;
+
+    if ( s.size() < MinWordLength || s.size() > MaxWordLength )
+    {
+        return internal_::hash_enum::default_;
+    }
+
+    size_t hash_val = s.size();
+    switch( s.size() )
+    {
+                       case 38:
+    [[ fallthrough ]]; case 37:
+    [[ fallthrough ]]; case 36:
+    [[ fallthrough ]]; case 35:
+    [[ fallthrough ]]; case 34:
+    [[ fallthrough ]]; case 33:
+    [[ fallthrough ]]; case 32:
+    [[ fallthrough ]]; case 31:
+    [[ fallthrough ]]; case 30:
+    [[ fallthrough ]]; case 29:
+    [[ fallthrough ]]; case 28:
+    [[ fallthrough ]]; case 27:
+    [[ fallthrough ]]; case 26:
+    [[ fallthrough ]]; case 25:
+    [[ fallthrough ]]; case 24:
+    [[ fallthrough ]]; case 23:
+    [[ fallthrough ]]; case 22:
+    [[ fallthrough ]]; case 21:
+    [[ fallthrough ]]; case 20:
+    [[ fallthrough ]]; case 19:
+    [[ fallthrough ]]; case 18:
+    [[ fallthrough ]]; case 17:
+    [[ fallthrough ]]; case 16:
+    [[ fallthrough ]]; case 15:
+    [[ fallthrough ]]; case 14:
+    [[ fallthrough ]]; case 13:
+    [[ fallthrough ]]; case 12:
+    [[ fallthrough ]]; case 11:
+    [[ fallthrough ]]; case 10:
+    [[ fallthrough ]]; case 9:
+    [[ fallthrough ]]; case 8:
+    [[ fallthrough ]]; case 7:
+    [[ fallthrough ]]; case 6:
+    [[ fallthrough ]]; case 5:
+    [[ fallthrough ]]; case 4:
+    [[ fallthrough ]]; case 3:
+    [[ fallthrough ]]; case 2:
+    [[ fallthrough ]]; case 1:
+        ; // Prevent compiler error
+    }
+
+    if ( hash_val <= MaxHashValue )
+    {
+        const size_t slot = hash_val;
+        if ( internal_::wordlist_6[ slot ].word == s )
+        {
+            return internal_::wordlist_6[ slot ].enum_val;
+        }
+    }
+    return internal_::hash_enum::default_;
+}
+
+// Keywords of 60 to 60 bytes
+constexpr std::array< int, 0 > asso_values_7 = {
+};
+
+constexpr std::array< word_entry, 61 > wordlist_7 = {{
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "UTF-8 stuff (emoji): \xF0\x9F\xA4\x90 \xF0\x9F\xA4\x91 \xF0\x9F\xA4\x92 \xF0\x9F\xA4\x93 \xF0\x9F\xA4\x94 \xF0\x9F\xA4\x95 \xF0\x9F\xA4\x96 \xF0\x9F\xA4\x97", hash_enum::c_UTF_8_stuff__emoji__________________________________________ },
+}};
+
+constexpr hash_enum hash_7( std::string_view s )
+{
+    constexpr size_t MinWordLength = 60;
+    constexpr size_t MaxWordLength = 60;
+    constexpr size_t MaxHashValue = 60;
+
+    if ( s.size() < MinWordLength || s.size() > MaxWordLength )
+    {
+        return internal_::hash_enum::default_;
+    }
+
+    size_t hash_val = s.size();
+    switch( s.size() )
+    {
+                       case 60:
+    [[ fallthrough ]]; case 59:
+    [[ fallthrough ]]; case 58:
+    [[ fallthrough ]]; case 57:
+    [[ fallthrough ]]; case 56:
+    [[ fallthrough ]]; case 55:
+    [[ fallthrough ]]; case 54:
+    [[ fallthrough ]]; case 53:
+    [[ fallthrough ]]; case 52:
+    [[ fallthrough ]]; case 51:
+    [[ fallthrough ]]; case 50:
+    [[ fallthrough ]]; case 49:
+    [[ fallthrough ]]; case 48:
+    [[ fallthrough ]]; case 47:
+    [[ fallthrough ]]; case 46:
+    [[ fallthrough ]]; case 45:
+    [[ fallthrough ]]; case 44:
+    [[ fallthrough ]]; case 43:
+    [[ fallthrough ]]; case 42:
+    [[ fallthrough ]]; case 41:
+    [[ fallthrough ]]; case 40:
+    [[ fallthrough ]]; case 39:
+    [[ fallthrough ]]; case 38:
+    [[ fallthrough ]]; case 37:
+    [[ fallthrough ]]; case 36:
+    [[ fallthrough ]]; case 35:
+    [[ fallthrough ]]; case 34:
+    [[ fallthrough ]]; case 33:
+    [[ fallthrough ]]; case 32:
+    [[ fallthrough ]]; case 31:
+    [[ fallthrough ]]; case 30:
+    [[ fallthrough ]]; case 29:
+    [[ fallthrough ]]; case 28:
+    [[ fallthrough ]]; case 27:
+    [[ fallthrough ]]; case 26:
+    [[ fallthrough ]]; case 25:
+    [[ fallthrough ]]; case 24:
+    [[ fallthrough ]]; case 23:
+    [[ fallthrough ]]; case 22:
+    [[ fallthrough ]]; case 21:
+    [[ fallthrough ]]; case 20:
+    [[ fallthrough ]]; case 19:
+    [[ fallthrough ]]; case 18:
+    [[ fallthrough ]]; case 17:
+    [[ fallthrough ]]; case 16:
+    [[ fallthrough ]]; case 15:
+    [[ fallthrough ]]; case 14:
+    [[ fallthrough ]]; case 13:
+    [[ fallthrough ]]; case 12:
+    [[ fallthrough ]]; case 11:
+    [[ fallthrough ]]; case 10:
+    [[ fallthrough ]]; case 9:
+    [[ fallthrough ]]; case 8:
+    [[ fallthrough ]]; case 7:
+    [[ fallthrough ]]; case 6:
+    [[ fallthrough ]]; case 5:
+    [[ fallthrough ]]; case 4:
+    [[ fallthrough ]]; case 3:
+    [[ fallthrough ]]; case 2:
+    [[ fallthrough ]]; case 1:
+        ; // Prevent compiler error
+    }
+
+    if ( hash_val <= MaxHashValue )
+    {
+        const size_t slot = hash_val;
+        if ( internal_::wordlist_7[ slot ].word == s )
+        {
+            return internal_::wordlist_7[ slot ].enum_val;
+        }
+    }
+    return internal_::hash_enum::default_;
+}
+
+// Keywords of 63 to 63 bytes
+constexpr std::array< int, 0 > asso_values_8 = {
+};
+
+constexpr std::array< word_entry, 64 > wordlist_8 = {{
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "Control chars \x01\x02\x03\x04\x05\x06\x07\x08\x09\x0B\x0C\x0D\x0E\x0F\x10\x11\x12\x13\x14\x15\x16\x17\x18\x19\x1A\x1B\x1C\x1D\x1E\x1F (except newline) !", hash_enum::c_Control_chars_________________________________except_newline___ },
+}};
+
+constexpr hash_enum hash_8( std::string_view s )
+{
+    constexpr size_t MinWordLength = 63;
+    constexpr size_t MaxWordLength = 63;
+    constexpr size_t MaxHashValue = 63;
+
+    if ( s.size() < MinWordLength || s.size() > MaxWordLength )
+    {
+        return internal_::hash_enum::default_;
+    }
+
+    size_t hash_val = s.size();
+    switch( s.size() )
+    {
+                       case 63:
+    [[ fallthrough ]]; case 62:
+    [[ fallthrough ]]; case 61:
+    [[ fallthrough ]]; case 60:
+    [[ fallthrough ]]; case 59:
+    [[ fallthrough ]]; case 58:
+    [[ fallthrough ]]; case 57:
+    [[ fallthrough ]]; case 56:
+    [[ fallthrough ]]; case 55:
+    [[ fallthrough ]]; case 54:
+    [[ fallthrough ]]; case 53:
+    [[ fallthrough ]]; case 52:
+    [[ fallthrough ]]; case 51:
+    [[ fallthrough ]]; case 50:
+    [[ fallthrough ]]; case 49:
+    [[ fallthrough ]]; case 48:
+    [[ fallthrough ]]; case 47:
+    [[ fallthrough ]]; case 46:
+    [[ fallthrough ]]; case 45:
+    [[ fallthrough ]]; case 44:
+    [[ fallthrough ]]; case 43:
+    [[ fallthrough ]]; case 42:
+    [[ fallthrough ]]; case 41:
+    [[ fallthrough ]]; case 40:
+    [[ fallthrough ]]; case 39:
+    [[ fallthrough ]]; case 38:
+    [[ fallthrough ]]; case 37:
+    [[ fallthrough ]]; case 36:
+    [[ fallthrough ]]; case 35:
+    [[ fallthrough ]]; case 34:
+    [[ fallthrough ]]; case 33:
+    [[ fallthrough ]]; case 32:
+    [[ fallthrough ]]; case 31:
+    [[ fallthrough ]]; case 30:
+    [[ fallthrough ]]; case 29:
+    [[ fallthrough ]]; case 28:
+    [[ fallthrough ]]; case 27:
+    [[ fallthrough ]]; case 26:
+    [[ fallthrough ]]; case 25:
+    [[ fallthrough ]]; case 24:
+    [[ fallthrough ]]; case 23:
+    [[ fallthrough ]]; case 22:
+    [[ fallthrough ]]; case 21:
+    [[ fallthrough ]]; case 20:
+    [[ fallthrough ]]; case 19:
+    [[ fallthrough ]]; case 18:
+    [[ fallthrough ]]; case 17:
+    [[ fallthrough ]]; case 16:
+    [[ fallthrough ]]; case 15:
+    [[ fallthrough ]]; case 14:
+    [[ fallthrough ]]; case 13:
+    [[ fallthrough ]]; case 12:
+    [[ fallthrough ]]; case 11:
+    [[ fallthrough ]]; case 10:
+    [[ fallthrough ]]; case 9:
+    [[ fallthrough ]]; case 8:
+    [[ fallthrough ]]; case 7:
+    [[ fallthrough ]]; case 6:
+    [[ fallthrough ]]; case 5:
+    [[ fallthrough ]]; case 4:
+    [[ fallthrough ]]; case 3:
+    [[ fallthrough ]]; case 2:
+    [[ fallthrough ]]; case 1:
+        ; // Prevent compiler error
+    }
+
+    if ( hash_val <= MaxHashValue )
+    {
+        const size_t slot = hash_val;
+        if ( internal_::wordlist_8[ slot ].word == s )
+        {
+            return internal_::wordlist_8[ slot ].enum_val;
+        }
+    }
+    return internal_::hash_enum::default_;
+}
+
+} // namespace internal_
+
+constexpr internal_::hash_enum hash( std::string_view s )
+{
+    switch ( s.size() )
+    {
+    case 7:
+        return internal_::hash_0( s );
+    case 8:
+        return internal_::hash_1( s );
+    case 9:
+        return internal_::hash_2( s );
+    case 11:
+        return internal_::hash_3( s );
+    case 16:
+        return internal_::hash_4( s );
+    case 18:
+        return internal_::hash_5( s );
+    case 38:
+        return internal_::hash_6( s );
+    case 60:
+        return internal_::hash_7( s );
+    case 63:
+        return internal_::hash_8( s );
+    }
+
+    return internal_::hash_enum::default_;
+}
+
+
+// Extra check for safety
+static_assert( ::hash( "qwe qwe" ) == ::internal_::hash_enum::c_qwe_qwe );
+static_assert( ::hash( "qwe+qwe" ) == ::internal_::hash_enum::c_qwe_qwe_0 );
+static_assert( ::hash( "qwe_qwe" ) == ::internal_::hash_enum::c_qwe_qwe_1 );
+static_assert( ::hash( "qwe-qwe" ) == ::internal_::hash_enum::c_qwe_qwe_2 );
+static_assert( ::hash( "default_" ) == ::internal_::hash_enum::c_default_ );
+static_assert( ::hash( "222222222" ) == ::internal_::hash_enum::c_222222222 );
+static_assert( ::hash( "123123132" ) == ::internal_::hash_enum::c_123123132 );
+static_assert( ::hash( "Quotes \"\'" ) == ::internal_::hash_enum::c_Quotes___ );
+static_assert( ::hash( "Backslash \\" ) == ::internal_::hash_enum::c_Backslash__ );
+static_assert( ::hash( "String\x09with\x09tabs" ) == ::internal_::hash_enum::c_String_with_tabs );
+static_assert( ::hash( "String with spaces" ) == ::internal_::hash_enum::c_String_with_spaces );
+static_assert( ::hash( "Some punctuation chars: !@#$%^&*(){}[]" ) == ::internal_::hash_enum::c_Some_punctuation_chars________________ );
+static_assert( ::hash( "UTF-8 stuff (emoji): \xF0\x9F\xA4\x90 \xF0\x9F\xA4\x91 \xF0\x9F\xA4\x92 \xF0\x9F\xA4\x93 \xF0\x9F\xA4\x94 \xF0\x9F\xA4\x95 \xF0\x9F\xA4\x96 \xF0\x9F\xA4\x97" ) == ::internal_::hash_enum::c_UTF_8_stuff__emoji__________________________________________ );
+static_assert( ::hash( "Control chars \x01\x02\x03\x04\x05\x06\x07\x08\x09\x0B\x0C\x0D\x0E\x0F\x10\x11\x12\x13\x14\x15\x16\x17\x18\x19\x1A\x1B\x1C\x1D\x1E\x1F (except newline) !" ) == ::internal_::hash_enum::c_Control_chars_________________________________except_newline___ );
+
+#endif // __HASH_HPP_
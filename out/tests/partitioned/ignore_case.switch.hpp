@@ -0,0 +1,1270 @@
+#ifndef IGNORE_CASE__HASH_HPP_
+#define IGNORE_CASE__HASH_HPP_
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+namespace ignore_case {
+
+namespace internal_ {
+
+enum class hash_enum
+{
+    default_ = -1,
+    c_TE = 0,
+    c_Age = 1,
+    c_Date = 2,
+    c_DNT = 3,
+    c_Host = 4,
+    c_Vary = 5,
+    c_From = 6,
+    c_Tk = 7,
+    c_ETag = 8,
+    c_Via = 9,
+    c_Allow = 10,
+    c_Accept = 11,
+    c_Server = 12,
+    c_Range = 13,
+    c_Pragma = 14,
+    c_Origin = 15,
+    c_Expect = 16,
+    c_Cookie = 17,
+    c_Warning = 18,
+    c_Cookie2 = 19,
+    c_Referer = 20,
+    c_Trailer = 21,
+    c_If_Range = 22,
+    c_Expires = 23,
+    c_If_Match = 24,
+    c_Location = 25,
+    c_Forwarded = 26,
+    c_User_Agent = 27,
+    c_SourceMap = 28,
+    c_Set_Cookie = 29,
+    c_Set_Cookie2 = 30,
+    c_Retry_After = 31,
+    c_Keep_Alive = 32,
+    c_Expect_CT = 33,
+    c_Connection = 34,
+    c_Content_Type = 35,
+    c_Accept_Ranges = 36,
+    c_Authorization = 37,
+    c_Cache_Control = 38,
+    c_If_None_Match = 39,
+    c_Server_Timing = 40,
+    c_Content_Range = 41,
+    c_Last_Modified = 42,
+    c_Feature_Policy = 43,
+    c_Clear_Site_Data = 44,
+    c_X_Frame_Options = 45,
+    c_Accept_Encoding = 46,
+    c_Content_Length = 47,
+    c_Accept_Charset = 48,
+    c_Public_Key_Pins = 49,
+    c_X_Forwarded_For = 50,
+    c_Accept_Language = 51,
+    c_Referrer_Policy = 52,
+    c_Content_Encoding = 53,
+    c_X_Forwarded_Host = 54,
+    c_X_Forwarded_Proto = 55,
+    c_Content_Language = 56,
+    c_Transfer_Encoding = 57,
+    c_WWW_Authenticate = 58,
+    c_X_XSS_Protection = 59,
+    c_Content_Location = 60,
+    c_Large_Allocation = 61,
+    c_If_Modified_Since = 62,
+    c_Proxy_Authenticate = 63,
+    c_Proxy_Authorization = 64,
+    c_If_Unmodified_Since = 65,
+    c_Content_Disposition = 66,
+    c_X_Content_Type_Options = 67,
+    c_X_DNS_Prefetch_Control = 68,
+    c_Timing_Allow_Origin = 69,
+    c_Access_Control_Max_Age = 70,
+    c_Sec_WebSocket_Accept = 71,
+    c_Content_Security_Policy = 72,
+    c_Strict_Transport_Security = 73,
+    c_Upgrade_Insecure_Requests = 74,
+    c_Public_Key_Pins_Report_Only = 75,
+    c_Access_Control_Allow_Origin = 76,
+    c_Access_Control_Request_Method = 77,
+    c_Access_Control_Request_Headers = 78,
+    c_Access_Control_Allow_Methods = 79,
+    c_Access_Control_Allow_Credentials = 80,
+    c_Access_Control_Allow_Headers = 81,
+    c_Access_Control_Expose_Headers = 82,
+    c_Content_Security_Policy_Report_Only = 83,
+};
+
+} // namespace internal_
+
+// Number of keywords, enum values other than the default are in [ 0, hash_count )
+constexpr size_t hash_count = 84;
+
+constexpr internal_::hash_enum hash( std::string_view s );
+
+namespace internal_ {
+
+constexpr uint64_t load_le8( const char *p )
+{
+    return uint64_t( static_cast< unsigned char >( p[ 0 ] ) )
+         | uint64_t( static_cast< unsigned char >( p[ 1 ] ) ) << 8
+         | uint64_t( static_cast< unsigned char >( p[ 2 ] ) ) << 16
+         | uint64_t( static_cast< unsigned char >( p[ 3 ] ) ) << 24
+         | uint64_t( static_cast< unsigned char >( p[ 4 ] ) ) << 32
+         | uint64_t( static_cast< unsigned char >( p[ 5 ] ) ) << 40
+         | uint64_t( static_cast< unsigned char >( p[ 6 ] ) ) << 48
+         | uint64_t( static_cast< unsigned char >( p[ 7 ] ) ) << 56;
+}
+
+constexpr uint64_t fold_case( uint64_t x )
+{
+    const uint64_t heptets = x & 0x7F7F7F7F7F7F7F7Full;
+    const uint64_t ge_A = heptets + 0x3F3F3F3F3F3F3F3Full; // High bit set if >= 'A'
+    const uint64_t gt_Z = heptets + 0x2525252525252525ull; // High bit set if > 'Z'
+    const uint64_t upper = ge_A & ~gt_Z & ~x & 0x8080808080808080ull;
+    return x | ( upper >> 2 );
+}
+
+constexpr bool equals_ignore_case( std::string_view s, std::string_view lower )
+{
+    if ( s.size() != lower.size() )
+    {
+        return false;
+    }
+
+    if ( s.size() < 8 )
+    {
+        uint64_t a = 0;
+        uint64_t b = 0;
+        for ( size_t i = 0; i < s.size(); ++i )
+        {
+            a |= uint64_t( static_cast< unsigned char >( s[ i ] ) ) << ( i * 8 );
+            b |= uint64_t( static_cast< unsigned char >( lower[ i ] ) ) << ( i * 8 );
+        }
+        return fold_case( a ) == b;
+    }
+
+    // Last 8 bytes overlap with the previous ones, instead of a loop for the tail
+    uint64_t diff = fold_case( load_le8( s.data() + s.size() - 8 ) ) ^ load_le8( lower.data() + s.size() - 8 );
+    for ( size_t i = 0; i + 8 < s.size(); i += 8 )
+    {
+        diff |= fold_case( load_le8( s.data() + i ) ) ^ load_le8( lower.data() + i );
+    }
+    return diff == 0;
+}
+
+struct word_entry
+{
+    std::string_view word;
+    hash_enum enum_val;
+};
+
+// Keywords of 2 to 4 bytes
+constexpr std::array< int, 256 > asso_values_0 = {
+        12,    12,    12,    12,    12,    12,    12,    12,    12,    12,
+        12,    12,    12,    12,    12,    12,    12,    12,    12,    12,
+        12,    12,    12,    12,    12,    12,    12,    12,    12,    12,
+        12,    12,    12,    12,    12,    12,    12,    12,    12,    12,
+        12,    12,    12,    12,    12,    12,    12,    12,    12,    12,
+        12,    12,    12,    12,    12,    12,    12,    12,    12,    12,
+        12,    12,    12,    12,    12,     8,    12,    12,    12,     0,
+        12,     6,    12,    12,    12,     7,    12,     4,    12,    12,
+        12,    12,    12,    12,     2,    12,    12,    12,    12,     3,
+        12,    12,    12,    12,    12,    12,    12,     8,    12,    12,
+        12,     0,    12,     6,    12,    12,    12,     7,    12,     4,
+        12,    12,    12,    12,    12,    12,     2,    12,    12,    12,
+        12,     3,    12,    12,    12,    12,    12,    12,    12,    12,
+        12,    12,    12,    12,    12,    12,    12,    12,    12,    12,
+        12,    12,    12,    12,    12,    12,    12,    12,    12,    12,
+        12,    12,    12,    12,    12,    12,    12,    12,    12,    12,
+        12,    12,    12,    12,    12,    12,    12,    12,    12,    12,
+        12,    12,    12,    12,    12,    12,    12,    12,    12,    12,
+        12,    12,    12,    12,    12,    12,    12,    12,    12,    12,
+        12,    12,    12,    12,    12,    12,    12,    12,    12,    12,
+        12,    12,    12,    12,    12,    12,    12,    12,    12,    12,
+        12,    12,    12,    12,    12,    12,    12,    12,    12,    12,
+        12,    12,    12,    12,    12,    12,    12,    12,    12,    12,
+        12,    12,    12,    12,    12,    12,    12,    12,    12,    12,
+        12,    12,    12,    12,    12,    12,    12,    12,    12,    12,
+        12,    12,    12,    12,    12,    12,
+};
+
+constexpr std::array< word_entry, 12 > wordlist_0 = {{
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "te", hash_enum::c_TE },
+    { "age", hash_enum::c_Age },
+    { "date", hash_enum::c_Date },
+    { "dnt", hash_enum::c_DNT },
+    { "host", hash_enum::c_Host },
+    { "vary", hash_enum::c_Vary },
+    { "from", hash_enum::c_From },
+    { "tk", hash_enum::c_Tk },
+    { "etag", hash_enum::c_ETag },
+    { "via", hash_enum::c_Via },
+}};
+
+constexpr hash_enum hash_0( std::string_view s )
+{
+    constexpr size_t MinWordLength = 2;
+    constexpr size_t MaxWordLength = 4;
+    constexpr size_t MaxHashValue = 11;
+
+    if ( s.size() < MinWordLength || s.size() > MaxWordLength )
+    {
+        return internal_::hash_enum::default_;
+    }
+
+    size_t hash_val = s.size();
+    hash_val += internal_::asso_values_0[ static_cast< unsigned char >( s[ s.size() - 1 ] ) ];
+    switch( s.size() )
+    {
+                       case 4:
+    [[ fallthrough ]]; case 3:
+    [[ fallthrough ]]; case 2:
+    [[ fallthrough ]]; case 1:
+        ; // Prevent compiler error
+    }
+
+    if ( hash_val <= MaxHashValue )
+    {
+        const size_t slot = hash_val;
+        if ( internal_::equals_ignore_case( s, internal_::wordlist_0[ slot ].word ) )
+        {
+            return internal_::wordlist_0[ slot ].enum_val;
+        }
+    }
+    return internal_::hash_enum::default_;
+}
+
+// Keywords of 5 to 6 bytes
+constexpr std::array< int, 256 > asso_values_1 = {
+        13,    13,    13,    13,    13,    13,    13,    13,    13,    13,
+        13,    13,    13,    13,    13,    13,    13,    13,    13,    13,
+        13,    13,    13,    13,    13,    13,    13,    13,    13,    13,
+        13,    13,    13,    13,    13,    13,    13,    13,    13,    13,
+        13,    13,    13,    13,    13,    13,    13,    13,    13,    13,
+        13,    13,    13,    13,    13,    13,    13,    13,    13,    13,
+        13,    13,    13,    13,    13,     0,    13,     6,    13,     5,
+        13,    13,    13,    13,    13,    13,    13,    13,    13,     4,
+         3,    13,     3,     1,    13,    13,    13,    13,    13,    13,
+        13,    13,    13,    13,    13,    13,    13,     0,    13,     6,
+        13,     5,    13,    13,    13,    13,    13,    13,    13,    13,
+        13,     4,     3,    13,     3,     1,    13,    13,    13,    13,
+        13,    13,    13,    13,    13,    13,    13,    13,    13,    13,
+        13,    13,    13,    13,    13,    13,    13,    13,    13,    13,
+        13,    13,    13,    13,    13,    13,    13,    13,    13,    13,
+        13,    13,    13,    13,    13,    13,    13,    13,    13,    13,
+        13,    13,    13,    13,    13,    13,    13,    13,    13,    13,
+        13,    13,    13,    13,    13,    13,    13,    13,    13,    13,
+        13,    13,    13,    13,    13,    13,    13,    13,    13,    13,
+        13,    13,    13,    13,    13,    13,    13,    13,    13,    13,
+        13,    13,    13,    13,    13,    13,    13,    13,    13,    13,
+        13,    13,    13,    13,    13,    13,    13,    13,    13,    13,
+        13,    13,    13,    13,    13,    13,    13,    13,    13,    13,
+        13,    13,    13,    13,    13,    13,    13,    13,    13,    13,
+        13,    13,    13,    13,    13,    13,    13,    13,    13,    13,
+        13,    13,    13,    13,    13,    13,
+};
+
+constexpr std::array< word_entry, 13 > wordlist_1 = {{
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "allow", hash_enum::c_Allow },
+    { "accept", hash_enum::c_Accept },
+    { "server", hash_enum::c_Server },
+    { "range", hash_enum::c_Range },
+    { "pragma", hash_enum::c_Pragma },
+    { "origin", hash_enum::c_Origin },
+    { "expect", hash_enum::c_Expect },
+    { "cookie", hash_enum::c_Cookie },
+}};
+
+constexpr hash_enum hash_1( std::string_view s )
+{
+    constexpr size_t MinWordLength = 5;
+    constexpr size_t MaxWordLength = 6;
+    constexpr size_t MaxHashValue = 12;
+
+    if ( s.size() < MinWordLength || s.size() > MaxWordLength )
+    {
+        return internal_::hash_enum::default_;
+    }
+
+    size_t hash_val = s.size();
+    switch( s.size() )
+    {
+                       case 6:
+    [[ fallthrough ]]; case 5:
+    [[ fallthrough ]]; case 4:
+    [[ fallthrough ]]; case 3:
+    [[ fallthrough ]]; case 2:
+    [[ fallthrough ]]; case 1:
+        hash_val += internal_::asso_values_1[ static_cast< unsigned char >( s[ 0] ) ];
+    }
+
+    if ( hash_val <= MaxHashValue )
+    {
+        const size_t slot = hash_val;
+        if ( internal_::equals_ignore_case( s, internal_::wordlist_1[ slot ].word ) )
+        {
+            return internal_::wordlist_1[ slot ].enum_val;
+        }
+    }
+    return internal_::hash_enum::default_;
+}
+
+// Keywords of 7 to 8 bytes
+constexpr std::array< int, 256 > asso_values_2 = {
+        15,    15,    15,    15,    15,    15,    15,    15,    15,    15,
+        15,    15,    15,    15,    15,    15,    15,    15,    15,    15,
+        15,    15,    15,    15,    15,    15,    15,    15,    15,    15,
+        15,    15,    15,    15,    15,    15,    15,    15,    15,    15,
+        15,    15,    15,    15,    15,    15,    15,    15,    15,    15,
+        15,    15,    15,    15,    15,    15,    15,    15,    15,    15,
+        15,    15,    15,    15,    15,     3,    15,     1,    15,     2,
+        15,    15,    15,     3,    15,     0,     3,     2,     0,    15,
+        15,    15,     0,    15,     0,    15,    15,     0,    15,    15,
+        15,    15,    15,    15,    15,    15,    15,     3,    15,     1,
+        15,     2,    15,    15,    15,     3,    15,     0,     3,     2,
+         0,    15,    15,    15,     0,    15,     0,    15,    15,     0,
+        15,    15,    15,    15,    15,    15,    15,    15,    15,    15,
+        15,    15,    15,    15,    15,    15,    15,    15,    15,    15,
+        15,    15,    15,    15,    15,    15,    15,    15,    15,    15,
+        15,    15,    15,    15,    15,    15,    15,    15,    15,    15,
+        15,    15,    15,    15,    15,    15,    15,    15,    15,    15,
+        15,    15,    15,    15,    15,    15,    15,    15,    15,    15,
+        15,    15,    15,    15,    15,    15,    15,    15,    15,    15,
+        15,    15,    15,    15,    15,    15,    15,    15,    15,    15,
+        15,    15,    15,    15,    15,    15,    15,    15,    15,    15,
+        15,    15,    15,    15,    15,    15,    15,    15,    15,    15,
+        15,    15,    15,    15,    15,    15,    15,    15,    15,    15,
+        15,    15,    15,    15,    15,    15,    15,    15,    15,    15,
+        15,    15,    15,    15,    15,    15,    15,    15,    15,    15,
+        15,    15,    15,    15,    15,    15,
+};
+
+constexpr std::array< word_entry, 15 > wordlist_2 = {{
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "warning", hash_enum::c_Warning },
+    { "cookie2", hash_enum::c_Cookie2 },
+    { "referer", hash_enum::c_Referer },
+    { "trailer", hash_enum::c_Trailer },
+    { "if-range", hash_enum::c_If_Range },
+    { "expires", hash_enum::c_Expires },
+    { "if-match", hash_enum::c_If_Match },
+    { "location", hash_enum::c_Location },
+}};
+
+constexpr hash_enum hash_2( std::string_view s )
+{
+    constexpr size_t MinWordLength = 7;
+    constexpr size_t MaxWordLength = 8;
+    constexpr size_t MaxHashValue = 14;
+
+    if ( s.size() < MinWordLength || s.size() > MaxWordLength )
+    {
+        return internal_::hash_enum::default_;
+    }
+
+    size_t hash_val = s.size();
+    switch( s.size() )
+    {
+                       case 8:
+    [[ fallthrough ]]; case 7:
+    [[ fallthrough ]]; case 6:
+    [[ fallthrough ]]; case 5:
+    [[ fallthrough ]]; case 4:
+        hash_val += internal_::asso_values_2[ static_cast< unsigned char >( s[ 3] ) ];
+    [[ fallthrough ]]; case 3:
+    [[ fallthrough ]]; case 2:
+    [[ fallthrough ]]; case 1:
+        hash_val += internal_::asso_values_2[ static_cast< unsigned char >( s[ 0] ) ];
+    }
+
+    if ( hash_val <= MaxHashValue )
+    {
+        const size_t slot = hash_val;
+        if ( internal_::equals_ignore_case( s, internal_::wordlist_2[ slot ].word ) )
+        {
+            return internal_::wordlist_2[ slot ].enum_val;
+        }
+    }
+    return internal_::hash_enum::default_;
+}
+
+// Keywords of 9 to 11 bytes
+constexpr std::array< int, 256 > asso_values_3 = {
+        18,    18,    18,    18,    18,    18,    18,    18,    18,    18,
+        18,    18,    18,    18,    18,    18,    18,    18,    18,    18,
+        18,    18,    18,    18,    18,    18,    18,    18,    18,    18,
+        18,    18,    18,    18,    18,    18,    18,    18,    18,    18,
+        18,    18,    18,    18,    18,    18,    18,    18,    18,    18,
+        18,    18,    18,    18,    18,    18,    18,    18,    18,    18,
+        18,    18,    18,    18,    18,    18,    18,     7,    18,     7,
+         0,    18,    18,    18,    18,     5,    18,    18,    18,    18,
+        18,    18,     3,     2,    18,     0,    18,    18,    18,    18,
+        18,    18,    18,    18,    18,    18,    18,    18,    18,     7,
+        18,     7,     0,    18,    18,    18,    18,     5,    18,    18,
+        18,    18,    18,    18,     3,     2,    18,     0,    18,    18,
+        18,    18,    18,    18,    18,    18,    18,    18,    18,    18,
+        18,    18,    18,    18,    18,    18,    18,    18,    18,    18,
+        18,    18,    18,    18,    18,    18,    18,    18,    18,    18,
+        18,    18,    18,    18,    18,    18,    18,    18,    18,    18,
+        18,    18,    18,    18,    18,    18,    18,    18,    18,    18,
+        18,    18,    18,    18,    18,    18,    18,    18,    18,    18,
+        18,    18,    18,    18,    18,    18,    18,    18,    18,    18,
+        18,    18,    18,    18,    18,    18,    18,    18,    18,    18,
+        18,    18,    18,    18,    18,    18,    18,    18,    18,    18,
+        18,    18,    18,    18,    18,    18,    18,    18,    18,    18,
+        18,    18,    18,    18,    18,    18,    18,    18,    18,    18,
+        18,    18,    18,    18,    18,    18,    18,    18,    18,    18,
+        18,    18,    18,    18,    18,    18,    18,    18,    18,    18,
+        18,    18,    18,    18,    18,    18,
+};
+
+constexpr std::array< word_entry, 18 > wordlist_3 = {{
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "forwarded", hash_enum::c_Forwarded },
+    { "user-agent", hash_enum::c_User_Agent },
+    { "sourcemap", hash_enum::c_SourceMap },
+    { "set-cookie", hash_enum::c_Set_Cookie },
+    { "set-cookie2", hash_enum::c_Set_Cookie2 },
+    { "retry-after", hash_enum::c_Retry_After },
+    { "keep-alive", hash_enum::c_Keep_Alive },
+    { "expect-ct", hash_enum::c_Expect_CT },
+    { "connection", hash_enum::c_Connection },
+}};
+
+constexpr hash_enum hash_3( std::string_view s )
+{
+    constexpr size_t MinWordLength = 9;
+    constexpr size_t MaxWordLength = 11;
+    constexpr size_t MaxHashValue = 17;
+
+    if ( s.size() < MinWordLength || s.size() > MaxWordLength )
+    {
+        return internal_::hash_enum::default_;
+    }
+
+    size_t hash_val = s.size();
+    switch( s.size() )
+    {
+                       case 11:
+    [[ fallthrough ]]; case 10:
+    [[ fallthrough ]]; case 9:
+    [[ fallthrough ]]; case 8:
+    [[ fallthrough ]]; case 7:
+    [[ fallthrough ]]; case 6:
+    [[ fallthrough ]]; case 5:
+    [[ fallthrough ]]; case 4:
+    [[ fallthrough ]]; case 3:
+    [[ fallthrough ]]; case 2:
+    [[ fallthrough ]]; case 1:
+        hash_val += internal_::asso_values_3[ static_cast< unsigned char >( s[ 0] ) ];
+    }
+
+    if ( hash_val <= MaxHashValue )
+    {
+        const size_t slot = hash_val;
+        if ( internal_::equals_ignore_case( s, internal_::wordlist_3[ slot ].word ) )
+        {
+            return internal_::wordlist_3[ slot ].enum_val;
+        }
+    }
+    return internal_::hash_enum::default_;
+}
+
+// Keywords of 12 to 13 bytes
+constexpr std::array< int, 256 > asso_values_4 = {
+        20,    20,    20,    20,    20,    20,    20,    20,    20,    20,
+        20,    20,    20,    20,    20,    20,    20,    20,    20,    20,
+        20,    20,    20,    20,    20,    20,    20,    20,    20,    20,
+        20,    20,    20,    20,    20,    20,    20,    20,    20,    20,
+        20,    20,    20,    20,    20,    20,    20,    20,    20,    20,
+        20,    20,    20,    20,    20,    20,    20,    20,    20,    20,
+        20,    20,    20,    20,    20,    20,    20,    20,     6,     5,
+        20,     4,     3,    20,    20,    20,     2,    20,     1,    20,
+        20,    20,    20,     0,    20,    20,    20,    20,    20,    20,
+        20,    20,    20,    20,    20,    20,    20,    20,    20,    20,
+         6,     5,    20,     4,     3,    20,    20,    20,     2,    20,
+         1,    20,    20,    20,    20,     0,    20,    20,    20,    20,
+        20,    20,    20,    20,    20,    20,    20,    20,    20,    20,
+        20,    20,    20,    20,    20,    20,    20,    20,    20,    20,
+        20,    20,    20,    20,    20,    20,    20,    20,    20,    20,
+        20,    20,    20,    20,    20,    20,    20,    20,    20,    20,
+        20,    20,    20,    20,    20,    20,    20,    20,    20,    20,
+        20,    20,    20,    20,    20,    20,    20,    20,    20,    20,
+        20,    20,    20,    20,    20,    20,    20,    20,    20,    20,
+        20,    20,    20,    20,    20,    20,    20,    20,    20,    20,
+        20,    20,    20,    20,    20,    20,    20,    20,    20,    20,
+        20,    20,    20,    20,    20,    20,    20,    20,    20,    20,
+        20,    20,    20,    20,    20,    20,    20,    20,    20,    20,
+        20,    20,    20,    20,    20,    20,    20,    20,    20,    20,
+        20,    20,    20,    20,    20,    20,    20,    20,    20,    20,
+        20,    20,    20,    20,    20,    20,
+};
+
+constexpr std::array< word_entry, 20 > wordlist_4 = {{
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "content-type", hash_enum::c_Content_Type },
+    { "accept-ranges", hash_enum::c_Accept_Ranges },
+    { "authorization", hash_enum::c_Authorization },
+    { "cache-control", hash_enum::c_Cache_Control },
+    { "if-none-match", hash_enum::c_If_None_Match },
+    { "server-timing", hash_enum::c_Server_Timing },
+    { "content-range", hash_enum::c_Content_Range },
+    { "last-modified", hash_enum::c_Last_Modified },
+}};
+
+constexpr hash_enum hash_4( std::string_view s )
+{
+    constexpr size_t MinWordLength = 12;
+    constexpr size_t MaxWordLength = 13;
+    constexpr size_t MaxHashValue = 19;
+
+    if ( s.size() < MinWordLength || s.size() > MaxWordLength )
+    {
+        return internal_::hash_enum::default_;
+    }
+
+    size_t hash_val = s.size();
+    switch( s.size() )
+    {
+                       case 13:
+        hash_val += internal_::asso_values_4[ static_cast< unsigned char >( s[ 12] ) ];
+    [[ fallthrough ]]; case 12:
+    [[ fallthrough ]]; case 11:
+    [[ fallthrough ]]; case 10:
+    [[ fallthrough ]]; case 9:
+    [[ fallthrough ]]; case 8:
+    [[ fallthrough ]]; case 7:
+    [[ fallthrough ]]; case 6:
+    [[ fallthrough ]]; case 5:
+    [[ fallthrough ]]; case 4:
+    [[ fallthrough ]]; case 3:
+    [[ fallthrough ]]; case 2:
+    [[ fallthrough ]]; case 1:
+        ; // Prevent compiler error
+    }
+
+    if ( hash_val <= MaxHashValue )
+    {
+        const size_t slot = hash_val;
+        if ( internal_::equals_ignore_case( s, internal_::wordlist_4[ slot ].word ) )
+        {
+            return internal_::wordlist_4[ slot ].enum_val;
+        }
+    }
+    return internal_::hash_enum::default_;
+}
+
+// Keywords of 14 to 15 bytes
+constexpr std::array< int, 256 > asso_values_5 = {
+        24,    24,    24,    24,    24,    24,    24,    24,    24,    24,
+        24,    24,    24,    24,    24,    24,    24,    24,    24,    24,
+        24,    24,    24,    24,    24,    24,    24,    24,    24,    24,
+        24,    24,    24,    24,    24,    24,    24,    24,    24,    24,
+        24,    24,    24,    24,    24,     8,    24,    24,    24,    24,
+        24,    24,    24,    24,    24,    24,    24,    24,    24,    24,
+        24,    24,    24,    24,    24,     7,    24,    24,     6,     5,
+        24,    24,     5,    24,    24,    24,     4,    24,     2,     1,
+         0,    24,    24,    24,     0,    24,    24,    24,    24,    24,
+        24,    24,    24,    24,    24,    24,    24,     7,    24,    24,
+         6,     5,    24,    24,     5,    24,    24,    24,     4,    24,
+         2,     1,     0,    24,    24,    24,     0,    24,    24,    24,
+        24,    24,    24,    24,    24,    24,    24,    24,    24,    24,
+        24,    24,    24,    24,    24,    24,    24,    24,    24,    24,
+        24,    24,    24,    24,    24,    24,    24,    24,    24,    24,
+        24,    24,    24,    24,    24,    24,    24,    24,    24,    24,
+        24,    24,    24,    24,    24,    24,    24,    24,    24,    24,
+        24,    24,    24,    24,    24,    24,    24,    24,    24,    24,
+        24,    24,    24,    24,    24,    24,    24,    24,    24,    24,
+        24,    24,    24,    24,    24,    24,    24,    24,    24,    24,
+        24,    24,    24,    24,    24,    24,    24,    24,    24,    24,
+        24,    24,    24,    24,    24,    24,    24,    24,    24,    24,
+        24,    24,    24,    24,    24,    24,    24,    24,    24,    24,
+        24,    24,    24,    24,    24,    24,    24,    24,    24,    24,
+        24,    24,    24,    24,    24,    24,    24,    24,    24,    24,
+        24,    24,    24,    24,    24,    24,
+};
+
+constexpr std::array< word_entry, 24 > wordlist_5 = {{
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "feature-policy", hash_enum::c_Feature_Policy },
+    { "clear-site-data", hash_enum::c_Clear_Site_Data },
+    { "x-frame-options", hash_enum::c_X_Frame_Options },
+    { "accept-encoding", hash_enum::c_Accept_Encoding },
+    { "content-length", hash_enum::c_Content_Length },
+    { "accept-charset", hash_enum::c_Accept_Charset },
+    { "public-key-pins", hash_enum::c_Public_Key_Pins },
+    { "x-forwarded-for", hash_enum::c_X_Forwarded_For },
+    { "accept-language", hash_enum::c_Accept_Language },
+    { "referrer-policy", hash_enum::c_Referrer_Policy },
+}};
+
+constexpr hash_enum hash_5( std::string_view s )
+{
+    constexpr size_t MinWordLength = 14;
+    constexpr size_t MaxWordLength = 15;
+    constexpr size_t MaxHashValue = 23;
+
+    if ( s.size() < MinWordLength || s.size() > MaxWordLength )
+    {
+        return internal_::hash_enum::default_;
+    }
+
+    size_t hash_val = s.size();
+    switch( s.size() )
+    {
+                       case 15:
+    [[ fallthrough ]]; case 14:
+    [[ fallthrough ]]; case 13:
+    [[ fallthrough ]]; case 12:
+    [[ fallthrough ]]; case 11:
+    [[ fallthrough ]]; case 10:
+    [[ fallthrough ]]; case 9:
+        hash_val += internal_::asso_values_5[ static_cast< unsigned char >( s[ 8] ) ];
+    [[ fallthrough ]]; case 8:
+    [[ fallthrough ]]; case 7:
+    [[ fallthrough ]]; case 6:
+    [[ fallthrough ]]; case 5:
+    [[ fallthrough ]]; case 4:
+    [[ fallthrough ]]; case 3:
+    [[ fallthrough ]]; case 2:
+    [[ fallthrough ]]; case 1:
+        ; // Prevent compiler error
+    }
+
+    if ( hash_val <= MaxHashValue )
+    {
+        const size_t slot = hash_val;
+        if ( internal_::equals_ignore_case( s, internal_::wordlist_5[ slot ].word ) )
+        {
+            return internal_::wordlist_5[ slot ].enum_val;
+        }
+    }
+    return internal_::hash_enum::default_;
+}
+
+// Keywords of 16 to 17 bytes
+constexpr std::array< int, 256 > asso_values_6 = {
+        26,    26,    26,    26,    26,    26,    26,    26,    26,    26,
+        26,    26,    26,    26,    26,    26,    26,    26,    26,    26,
+        26,    26,    26,    26,    26,    26,    26,    26,    26,    26,
+        26,    26,    26,    26,    26,    26,    26,    26,    26,    26,
+        26,    26,    26,    26,    26,     8,    26,    26,    26,    26,
+        26,    26,    26,    26,    26,    26,    26,    26,    26,    26,
+        26,    26,    26,    26,    26,     3,    26,    26,    26,     0,
+         1,    26,    26,    26,    26,    26,    26,    26,     0,     7,
+        26,    26,     1,    26,     3,    26,    26,     5,     3,    26,
+        26,    26,    26,    26,    26,    26,    26,     3,    26,    26,
+        26,     0,     1,    26,    26,    26,    26,    26,    26,    26,
+         0,     7,    26,    26,     1,    26,     3,    26,    26,     5,
+         3,    26,    26,    26,    26,    26,    26,    26,    26,    26,
+        26,    26,    26,    26,    26,    26,    26,    26,    26,    26,
+        26,    26,    26,    26,    26,    26,    26,    26,    26,    26,
+        26,    26,    26,    26,    26,    26,    26,    26,    26,    26,
+        26,    26,    26,    26,    26,    26,    26,    26,    26,    26,
+        26,    26,    26,    26,    26,    26,    26,    26,    26,    26,
+        26,    26,    26,    26,    26,    26,    26,    26,    26,    26,
+        26,    26,    26,    26,    26,    26,    26,    26,    26,    26,
+        26,    26,    26,    26,    26,    26,    26,    26,    26,    26,
+        26,    26,    26,    26,    26,    26,    26,    26,    26,    26,
+        26,    26,    26,    26,    26,    26,    26,    26,    26,    26,
+        26,    26,    26,    26,    26,    26,    26,    26,    26,    26,
+        26,    26,    26,    26,    26,    26,    26,    26,    26,    26,
+        26,    26,    26,    26,    26,    26,
+};
+
+constexpr std::array< word_entry, 26 > wordlist_6 = {{
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "content-encoding", hash_enum::c_Content_Encoding },
+    { "x-forwarded-host", hash_enum::c_X_Forwarded_Host },
+    { "x-forwarded-proto", hash_enum::c_X_Forwarded_Proto },
+    { "content-language", hash_enum::c_Content_Language },
+    { "transfer-encoding", hash_enum::c_Transfer_Encoding },
+    { "www-authenticate", hash_enum::c_WWW_Authenticate },
+    { "x-xss-protection", hash_enum::c_X_XSS_Protection },
+    { "content-location", hash_enum::c_Content_Location },
+    { "large-allocation", hash_enum::c_Large_Allocation },
+    { "if-modified-since", hash_enum::c_If_Modified_Since },
+}};
+
+constexpr hash_enum hash_6( std::string_view s )
+{
+    constexpr size_t MinWordLength = 16;
+    constexpr size_t MaxWordLength = 17;
+    constexpr size_t MaxHashValue = 25;
+
+    if ( s.size() < MinWordLength || s.size() > MaxWordLength )
+    {
+        return internal_::hash_enum::default_;
+    }
+
+    size_t hash_val = s.size();
+    switch( s.size() )
+    {
+                       case 17:
+    [[ fallthrough ]]; case 16:
+    [[ fallthrough ]]; case 15:
+    [[ fallthrough ]]; case 14:
+    [[ fallthrough ]]; case 13:
+    [[ fallthrough ]]; case 12:
+    [[ fallthrough ]]; case 11:
+    [[ fallthrough ]]; case 10:
+        hash_val += internal_::asso_values_6[ static_cast< unsigned char >( s[ 9] ) ];
+    [[ fallthrough ]]; case 9:
+    [[ fallthrough ]]; case 8:
+    [[ fallthrough ]]; case 7:
+    [[ fallthrough ]]; case 6:
+    [[ fallthrough ]]; case 5:
+    [[ fallthrough ]]; case 4:
+    [[ fallthrough ]]; case 3:
+        hash_val += internal_::asso_values_6[ static_cast< unsigned char >( s[ 2] ) ];
+    [[ fallthrough ]]; case 2:
+    [[ fallthrough ]]; case 1:
+        ; // Prevent compiler error
+    }
+
+    if ( hash_val <= MaxHashValue )
+    {
+        const size_t slot = hash_val;
+        if ( internal_::equals_ignore_case( s, internal_::wordlist_6[ slot ].word ) )
+        {
+            return internal_::wordlist_6[ slot ].enum_val;
+        }
+    }
+    return internal_::hash_enum::default_;
+}
+
+// Keywords of 18 to 22 bytes
+constexpr std::array< int, 256 > asso_values_7 = {
+        27,    27,    27,    27,    27,    27,    27,    27,    27,    27,
+        27,    27,    27,    27,    27,    27,    27,    27,    27,    27,
+        27,    27,    27,    27,    27,    27,    27,    27,    27,    27,
+        27,    27,    27,    27,    27,    27,    27,    27,    27,    27,
+        27,    27,    27,    27,    27,     6,    27,    27,    27,    27,
+        27,    27,    27,    27,    27,    27,    27,    27,    27,    27,
+        27,    27,    27,    27,    27,    27,    27,    27,    27,     3,
+        27,    27,    27,     5,    27,    27,    27,    27,     1,     0,
+        27,    27,    27,    27,     2,     1,    27,    27,     0,    27,
+        27,    27,    27,    27,    27,    27,    27,    27,    27,    27,
+        27,     3,    27,    27,    27,     5,    27,    27,    27,    27,
+         1,     0,    27,    27,    27,    27,     2,     1,    27,    27,
+         0,    27,    27,    27,    27,    27,    27,    27,    27,    27,
+        27,    27,    27,    27,    27,    27,    27,    27,    27,    27,
+        27,    27,    27,    27,    27,    27,    27,    27,    27,    27,
+        27,    27,    27,    27,    27,    27,    27,    27,    27,    27,
+        27,    27,    27,    27,    27,    27,    27,    27,    27,    27,
+        27,    27,    27,    27,    27,    27,    27,    27,    27,    27,
+        27,    27,    27,    27,    27,    27,    27,    27,    27,    27,
+        27,    27,    27,    27,    27,    27,    27,    27,    27,    27,
+        27,    27,    27,    27,    27,    27,    27,    27,    27,    27,
+        27,    27,    27,    27,    27,    27,    27,    27,    27,    27,
+        27,    27,    27,    27,    27,    27,    27,    27,    27,    27,
+        27,    27,    27,    27,    27,    27,    27,    27,    27,    27,
+        27,    27,    27,    27,    27,    27,    27,    27,    27,    27,
+        27,    27,    27,    27,    27,    27,
+};
+
+constexpr std::array< word_entry, 27 > wordlist_7 = {{
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "proxy-authenticate", hash_enum::c_Proxy_Authenticate },
+    { "proxy-authorization", hash_enum::c_Proxy_Authorization },
+    { "if-unmodified-since", hash_enum::c_If_Unmodified_Since },
+    { "content-disposition", hash_enum::c_Content_Disposition },
+    { "x-content-type-options", hash_enum::c_X_Content_Type_Options },
+    { "x-dns-prefetch-control", hash_enum::c_X_DNS_Prefetch_Control },
+    { "timing-allow-origin", hash_enum::c_Timing_Allow_Origin },
+    { "access-control-max-age", hash_enum::c_Access_Control_Max_Age },
+    { "sec-websocket-accept", hash_enum::c_Sec_WebSocket_Accept },
+}};
+
+constexpr hash_enum hash_7( std::string_view s )
+{
+    constexpr size_t MinWordLength = 18;
+    constexpr size_t MaxWordLength = 22;
+    constexpr size_t MaxHashValue = 26;
+
+    if ( s.size() < MinWordLength || s.size() > MaxWordLength )
+    {
+        return internal_::hash_enum::default_;
+    }
+
+    size_t hash_val = s.size();
+    switch( s.size() )
+    {
+                       case 22:
+    [[ fallthrough ]]; case 21:
+    [[ fallthrough ]]; case 20:
+    [[ fallthrough ]]; case 19:
+    [[ fallthrough ]]; case 18:
+    [[ fallthrough ]]; case 17:
+    [[ fallthrough ]]; case 16:
+    [[ fallthrough ]]; case 15:
+    [[ fallthrough ]]; case 14:
+    [[ fallthrough ]]; case 13:
+    [[ fallthrough ]]; case 12:
+    [[ fallthrough ]]; case 11:
+    [[ fallthrough ]]; case 10:
+    [[ fallthrough ]]; case 9:
+    [[ fallthrough ]]; case 8:
+    [[ fallthrough ]]; case 7:
+    [[ fallthrough ]]; case 6:
+    [[ fallthrough ]]; case 5:
+    [[ fallthrough ]]; case 4:
+        hash_val += internal_::asso_values_7[ static_cast< unsigned char >( s[ 3] ) ];
+    [[ fallthrough ]]; case 3:
+    [[ fallthrough ]]; case 2:
+    [[ fallthrough ]]; case 1:
+        ; // Prevent compiler error
+    }
+
+    if ( hash_val <= MaxHashValue )
+    {
+        const size_t slot = hash_val;
+        if ( internal_::equals_ignore_case( s, internal_::wordlist_7[ slot ].word ) )
+        {
+            return internal_::wordlist_7[ slot ].enum_val;
+        }
+    }
+    return internal_::hash_enum::default_;
+}
+
+// Keywords of 23 to 35 bytes
+constexpr std::array< int, 256 > asso_values_8 = {
+        36,    36,    36,    36,    36,    36,    36,    36,    36,    36,
+        36,    36,    36,    36,    36,    36,    36,    36,    36,    36,
+        36,    36,    36,    36,    36,    36,    36,    36,    36,    36,
+        36,    36,    36,    36,    36,    36,    36,    36,    36,    36,
+        36,    36,    36,    36,    36,     5,    36,    36,    36,    36,
+        36,    36,    36,    36,    36,    36,    36,    36,    36,    36,
+        36,    36,    36,    36,    36,    36,    36,     0,    36,     1,
+        36,    36,     5,    36,    36,    36,    36,     3,    36,     1,
+        36,    36,     0,    36,     0,    36,    36,    36,    36,    36,
+        36,    36,    36,    36,    36,    36,    36,    36,    36,     0,
+        36,     1,    36,    36,     5,    36,    36,    36,    36,     3,
+        36,     1,    36,    36,     0,    36,     0,    36,    36,    36,
+        36,    36,    36,    36,    36,    36,    36,    36,    36,    36,
+        36,    36,    36,    36,    36,    36,    36,    36,    36,    36,
+        36,    36,    36,    36,    36,    36,    36,    36,    36,    36,
+        36,    36,    36,    36,    36,    36,    36,    36,    36,    36,
+        36,    36,    36,    36,    36,    36,    36,    36,    36,    36,
+        36,    36,    36,    36,    36,    36,    36,    36,    36,    36,
+        36,    36,    36,    36,    36,    36,    36,    36,    36,    36,
+        36,    36,    36,    36,    36,    36,    36,    36,    36,    36,
+        36,    36,    36,    36,    36,    36,    36,    36,    36,    36,
+        36,    36,    36,    36,    36,    36,    36,    36,    36,    36,
+        36,    36,    36,    36,    36,    36,    36,    36,    36,    36,
+        36,    36,    36,    36,    36,    36,    36,    36,    36,    36,
+        36,    36,    36,    36,    36,    36,    36,    36,    36,    36,
+        36,    36,    36,    36,    36,    36,
+};
+
+constexpr std::array< word_entry, 36 > wordlist_8 = {{
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "content-security-policy", hash_enum::c_Content_Security_Policy },
+    { "", hash_enum::default_ },
+    { "strict-transport-security", hash_enum::c_Strict_Transport_Security },
+    { "upgrade-insecure-requests", hash_enum::c_Upgrade_Insecure_Requests },
+    { "public-key-pins-report-only", hash_enum::c_Public_Key_Pins_Report_Only },
+    { "access-control-allow-origin", hash_enum::c_Access_Control_Allow_Origin },
+    { "access-control-request-method", hash_enum::c_Access_Control_Request_Method },
+    { "access-control-request-headers", hash_enum::c_Access_Control_Request_Headers },
+    { "access-control-allow-methods", hash_enum::c_Access_Control_Allow_Methods },
+    { "access-control-allow-credentials", hash_enum::c_Access_Control_Allow_Credentials },
+    { "access-control-allow-headers", hash_enum::c_Access_Control_Allow_Headers },
+    { "access-control-expose-headers", hash_enum::c_Access_Control_Expose_Headers },
+    { "content-security-policy-report-only", hash_enum::c_Content_Security_Policy_Report_Only },
+}};
+
+constexpr hash_enum hash_8( std::string_view s )
+{
+    constexpr size_t MinWordLength = 23;
+    constexpr size_t MaxWordLength = 35;
+    constexpr size_t MaxHashValue = 35;
+
+    if ( s.size() < MinWordLength || s.size() > MaxWordLength )
+    {
+        return internal_::hash_enum::default_;
+    }
+
+    size_t hash_val = s.size();
+    switch( s.size() )
+    {
+                       case 35:
+    [[ fallthrough ]]; case 34:
+    [[ fallthrough ]]; case 33:
+    [[ fallthrough ]]; case 32:
+    [[ fallthrough ]]; case 31:
+    [[ fallthrough ]]; case 30:
+    [[ fallthrough ]]; case 29:
+    [[ fallthrough ]]; case 28:
+    [[ fallthrough ]]; case 27:
+    [[ fallthrough ]]; case 26:
+    [[ fallthrough ]]; case 25:
+    [[ fallthrough ]]; case 24:
+    [[ fallthrough ]]; case 23:
+    [[ fallthrough ]]; case 22:
+        hash_val += internal_::asso_values_8[ static_cast< unsigned char >( s[ 21] ) ];
+    [[ fallthrough ]]; case 21:
+    [[ fallthrough ]]; case 20:
+    [[ fallthrough ]]; case 19:
+    [[ fallthrough ]]; case 18:
+    [[ fallthrough ]]; case 17:
+    [[ fallthrough ]]; case 16:
+    [[ fallthrough ]]; case 15:
+    [[ fallthrough ]]; case 14:
+    [[ fallthrough ]]; case 13:
+    [[ fallthrough ]]; case 12:
+    [[ fallthrough ]]; case 11:
+    [[ fallthrough ]]; case 10:
+    [[ fallthrough ]]; case 9:
+    [[ fallthrough ]]; case 8:
+    [[ fallthrough ]]; case 7:
+    [[ fallthrough ]]; case 6:
+    [[ fallthrough ]]; case 5:
+    [[ fallthrough ]]; case 4:
+    [[ fallthrough ]]; case 3:
+    [[ fallthrough ]]; case 2:
+    [[ fallthrough ]]; case 1:
+        ; // Prevent compiler error
+    }
+
+    if ( hash_val <= MaxHashValue )
+    {
+        const size_t slot = hash_val;
+        if ( internal_::equals_ignore_case( s, internal_::wordlist_8[ slot ].word ) )
+        {
+            return internal_::wordlist_8[ slot ].enum_val;
+        }
+    }
+    return internal_::hash_enum::default_;
+}
+
+} // namespace internal_
+
+constexpr internal_::hash_enum hash( std::string_view s )
+{
+    switch ( s.size() )
+    {
+    case 2:
+    case 3:
+    case 4:
+        return internal_::hash_0( s );
+    case 5:
+    case 6:
+        return internal_::hash_1( s );
+    case 7:
+    case 8:
+        return internal_::hash_2( s );
+    case 9:
+    case 10:
+    case 11:
+        return internal_::hash_3( s );
+    case 12:
+    case 13:
+        return internal_::hash_4( s );
+    case 14:
+    case 15:
+        return internal_::hash_5( s );
+    case 16:
+    case 17:
+        return internal_::hash_6( s );
+    case 18:
+    case 19:
+    case 20:
+    case 21:
+    case 22:
+        return internal_::hash_7( s );
+    case 23:
+    case 24:
+    case 25:
+    case 26:
+    case 27:
+    case 28:
+    case 29:
+    case 30:
+    case 31:
+    case 32:
+    case 33:
+    case 34:
+    case 35:
+        return internal_::hash_8( s );
+    }
+
+    return internal_::hash_enum::default_;
+}
+
+} // namespace ignore_case {
+
+// Extra check for safety
+static_assert( ignore_case::hash( "TE" ) == ignore_case::internal_::hash_enum::c_TE );
+static_assert( ignore_case::hash( "Age" ) == ignore_case::internal_::hash_enum::c_Age );
+static_assert( ignore_case::hash( "Date" ) == ignore_case::internal_::hash_enum::c_Date );
+static_assert( ignore_case::hash( "DNT" ) == ignore_case::internal_::hash_enum::c_DNT );
+static_assert( ignore_case::hash( "Host" ) == ignore_case::internal_::hash_enum::c_Host );
+static_assert( ignore_case::hash( "Vary" ) == ignore_case::internal_::hash_enum::c_Vary );
+static_assert( ignore_case::hash( "From" ) == ignore_case::internal_::hash_enum::c_From );
+static_assert( ignore_case::hash( "Tk" ) == ignore_case::internal_::hash_enum::c_Tk );
+static_assert( ignore_case::hash( "ETag" ) == ignore_case::internal_::hash_enum::c_ETag );
+static_assert( ignore_case::hash( "Via" ) == ignore_case::internal_::hash_enum::c_Via );
+static_assert( ignore_case::hash( "Allow" ) == ignore_case::internal_::hash_enum::c_Allow );
+static_assert( ignore_case::hash( "Accept" ) == ignore_case::internal_::hash_enum::c_Accept );
+static_assert( ignore_case::hash( "Server" ) == ignore_case::internal_::hash_enum::c_Server );
+static_assert( ignore_case::hash( "Range" ) == ignore_case::internal_::hash_enum::c_Range );
+static_assert( ignore_case::hash( "Pragma" ) == ignore_case::internal_::hash_enum::c_Pragma );
+static_assert( ignore_case::hash( "Origin" ) == ignore_case::internal_::hash_enum::c_Origin );
+static_assert( ignore_case::hash( "Expect" ) == ignore_case::internal_::hash_enum::c_Expect );
+static_assert( ignore_case::hash( "Cookie" ) == ignore_case::internal_::hash_enum::c_Cookie );
+static_assert( ignore_case::hash( "Warning" ) == ignore_case::internal_::hash_enum::c_Warning );
+static_assert( ignore_case::hash( "Cookie2" ) == ignore_case::internal_::hash_enum::c_Cookie2 );
+static_assert( ignore_case::hash( "Referer" ) == ignore_case::internal_::hash_enum::c_Referer );
+static_assert( ignore_case::hash( "Trailer" ) == ignore_case::internal_::hash_enum::c_Trailer );
+static_assert( ignore_case::hash( "If-Range" ) == ignore_case::internal_::hash_enum::c_If_Range );
+static_assert( ignore_case::hash( "Expires" ) == ignore_case::internal_::hash_enum::c_Expires );
+static_assert( ignore_case::hash( "If-Match" ) == ignore_case::internal_::hash_enum::c_If_Match );
+static_assert( ignore_case::hash( "Location" ) == ignore_case::internal_::hash_enum::c_Location );
+static_assert( ignore_case::hash( "Forwarded" ) == ignore_case::internal_::hash_enum::c_Forwarded );
+static_assert( ignore_case::hash( "User-Agent" ) == ignore_case::internal_::hash_enum::c_User_Agent );
+static_assert( ignore_case::hash( "SourceMap" ) == ignore_case::internal_::hash_enum::c_SourceMap );
+static_assert( ignore_case::hash( "Set-Cookie" ) == ignore_case::internal_::hash_enum::c_Set_Cookie );
+static_assert( ignore_case::hash( "Set-Cookie2" ) == ignore_case::internal_::hash_enum::c_Set_Cookie2 );
+static_assert( ignore_case::hash( "Retry-After" ) == ignore_case::internal_::hash_enum::c_Retry_After );
+static_assert( ignore_case::hash( "Keep-Alive" ) == ignore_case::internal_::hash_enum::c_Keep_Alive );
+static_assert( ignore_case::hash( "Expect-CT" ) == ignore_case::internal_::hash_enum::c_Expect_CT );
+static_assert( ignore_case::hash( "Connection" ) == ignore_case::internal_::hash_enum::c_Connection );
+static_assert( ignore_case::hash( "Content-Type" ) == ignore_case::internal_::hash_enum::c_Content_Type );
+static_assert( ignore_case::hash( "Accept-Ranges" ) == ignore_case::internal_::hash_enum::c_Accept_Ranges );
+static_assert( ignore_case::hash( "Authorization" ) == ignore_case::internal_::hash_enum::c_Authorization );
+static_assert( ignore_case::hash( "Cache-Control" ) == ignore_case::internal_::hash_enum::c_Cache_Control );
+static_assert( ignore_case::hash( "If-None-Match" ) == ignore_case::internal_::hash_enum::c_If_None_Match );
+static_assert( ignore_case::hash( "Server-Timing" ) == ignore_case::internal_::hash_enum::c_Server_Timing );
+static_assert( ignore_case::hash( "Content-Range" ) == ignore_case::internal_::hash_enum::c_Content_Range );
+static_assert( ignore_case::hash( "Last-Modified" ) == ignore_case::internal_::hash_enum::c_Last_Modified );
+static_assert( ignore_case::hash( "Feature-Policy" ) == ignore_case::internal_::hash_enum::c_Feature_Policy );
+static_assert( ignore_case::hash( "Clear-Site-Data" ) == ignore_case::internal_::hash_enum::c_Clear_Site_Data );
+static_assert( ignore_case::hash( "X-Frame-Options" ) == ignore_case::internal_::hash_enum::c_X_Frame_Options );
+static_assert( ignore_case::hash( "Accept-Encoding" ) == ignore_case::internal_::hash_enum::c_Accept_Encoding );
+static_assert( ignore_case::hash( "Content-Length" ) == ignore_case::internal_::hash_enum::c_Content_Length );
+static_assert( ignore_case::hash( "Accept-Charset" ) == ignore_case::internal_::hash_enum::c_Accept_Charset );
+static_assert( ignore_case::hash( "Public-Key-Pins" ) == ignore_case::internal_::hash_enum::c_Public_Key_Pins );
+static_assert( ignore_case::hash( "X-Forwarded-For" ) == ignore_case::internal_::hash_enum::c_X_Forwarded_For );
+static_assert( ignore_case::hash( "Accept-Language" ) == ignore_case::internal_::hash_enum::c_Accept_Language );
+static_assert( ignore_case::hash( "Referrer-Policy" ) == ignore_case::internal_::hash_enum::c_Referrer_Policy );
+static_assert( ignore_case::hash( "Content-Encoding" ) == ignore_case::internal_::hash_enum::c_Content_Encoding );
+static_assert( ignore_case::hash( "X-Forwarded-Host" ) == ignore_case::internal_::hash_enum::c_X_Forwarded_Host );
+static_assert( ignore_case::hash( "X-Forwarded-Proto" ) == ignore_case::internal_::hash_enum::c_X_Forwarded_Proto );
+static_assert( ignore_case::hash( "Content-Language" ) == ignore_case::internal_::hash_enum::c_Content_Language );
+static_assert( ignore_case::hash( "Transfer-Encoding" ) == ignore_case::internal_::hash_enum::c_Transfer_Encoding );
+static_assert( ignore_case::hash( "WWW-Authenticate" ) == ignore_case::internal_::hash_enum::c_WWW_Authenticate );
+static_assert( ignore_case::hash( "X-XSS-Protection" ) == ignore_case::internal_::hash_enum::c_X_XSS_Protection );
+static_assert( ignore_case::hash( "Content-Location" ) == ignore_case::internal_::hash_enum::c_Content_Location );
+static_assert( ignore_case::hash( "Large-Allocation" ) == ignore_case::internal_::hash_enum::c_Large_Allocation );
+static_assert( ignore_case::hash( "If-Modified-Since" ) == ignore_case::internal_::hash_enum::c_If_Modified_Since );
+static_assert( ignore_case::hash( "Proxy-Authenticate" ) == ignore_case::internal_::hash_enum::c_Proxy_Authenticate );
+static_assert( ignore_case::hash( "Proxy-Authorization" ) == ignore_case::internal_::hash_enum::c_Proxy_Authorization );
+static_assert( ignore_case::hash( "If-Unmodified-Since" ) == ignore_case::internal_::hash_enum::c_If_Unmodified_Since );
+static_assert( ignore_case::hash( "Content-Disposition" ) == ignore_case::internal_::hash_enum::c_Content_Disposition );
+static_assert( ignore_case::hash( "X-Content-Type-Options" ) == ignore_case::internal_::hash_enum::c_X_Content_Type_Options );
+static_assert( ignore_case::hash( "X-DNS-Prefetch-Control" ) == ignore_case::internal_::hash_enum::c_X_DNS_Prefetch_Control );
+static_assert( ignore_case::hash( "Timing-Allow-Origin" ) == ignore_case::internal_::hash_enum::c_Timing_Allow_Origin );
+static_assert( ignore_case::hash( "Access-Control-Max-Age" ) == ignore_case::internal_::hash_enum::c_Access_Control_Max_Age );
+static_assert( ignore_case::hash( "Sec-WebSocket-Accept" ) == ignore_case::internal_::hash_enum::c_Sec_WebSocket_Accept );
+static_assert( ignore_case::hash( "Content-Security-Policy" ) == ignore_case::internal_::hash_enum::c_Content_Security_Policy );
+static_assert( ignore_case::hash( "Strict-Transport-Security" ) == ignore_case::internal_::hash_enum::c_Strict_Transport_Security );
+static_assert( ignore_case::hash( "Upgrade-Insecure-Requests" ) == ignore_case::internal_::hash_enum::c_Upgrade_Insecure_Requests );
+static_assert( ignore_case::hash( "Public-Key-Pins-Report-Only" ) == ignore_case::internal_::hash_enum::c_Public_Key_Pins_Report_Only );
+static_assert( ignore_case::hash( "Access-Control-Allow-Origin" ) == ignore_case::internal_::hash_enum::c_Access_Control_Allow_Origin );
+static_assert( ignore_case::hash( "Access-Control-Request-Method" ) == ignore_case::internal_::hash_enum::c_Access_Control_Request_Method );
+static_assert( ignore_case::hash( "Access-Control-Request-Headers" ) == ignore_case::internal_::hash_enum::c_Access_Control_Request_Headers );
+static_assert( ignore_case::hash( "Access-Control-Allow-Methods" ) == ignore_case::internal_::hash_enum::c_Access_Control_Allow_Methods );
+static_assert( ignore_case::hash( "Access-Control-Allow-Credentials" ) == ignore_case::internal_::hash_enum::c_Access_Control_Allow_Credentials );
+static_assert( ignore_case::hash( "Access-Control-Allow-Headers" ) == ignore_case::internal_::hash_enum::c_Access_Control_Allow_Headers );
+static_assert( ignore_case::hash( "Access-Control-Expose-Headers" ) == ignore_case::internal_::hash_enum::c_Access_Control_Expose_Headers );
+static_assert( ignore_case::hash( "Content-Security-Policy-Report-Only" ) == ignore_case::internal_::hash_enum::c_Content_Security_Policy_Report_Only );
+static_assert( ignore_case::hash( "TE" ) == ignore_case::internal_::hash_enum::c_TE );
+static_assert( ignore_case::hash( "AGE" ) == ignore_case::internal_::hash_enum::c_Age );
+static_assert( ignore_case::hash( "DATE" ) == ignore_case::internal_::hash_enum::c_Date );
+static_assert( ignore_case::hash( "DNT" ) == ignore_case::internal_::hash_enum::c_DNT );
+static_assert( ignore_case::hash( "HOST" ) == ignore_case::internal_::hash_enum::c_Host );
+static_assert( ignore_case::hash( "VARY" ) == ignore_case::internal_::hash_enum::c_Vary );
+static_assert( ignore_case::hash( "FROM" ) == ignore_case::internal_::hash_enum::c_From );
+static_assert( ignore_case::hash( "TK" ) == ignore_case::internal_::hash_enum::c_Tk );
+static_assert( ignore_case::hash( "ETAG" ) == ignore_case::internal_::hash_enum::c_ETag );
+static_assert( ignore_case::hash( "VIA" ) == ignore_case::internal_::hash_enum::c_Via );
+static_assert( ignore_case::hash( "ALLOW" ) == ignore_case::internal_::hash_enum::c_Allow );
+static_assert( ignore_case::hash( "ACCEPT" ) == ignore_case::internal_::hash_enum::c_Accept );
+static_assert( ignore_case::hash( "SERVER" ) == ignore_case::internal_::hash_enum::c_Server );
+static_assert( ignore_case::hash( "RANGE" ) == ignore_case::internal_::hash_enum::c_Range );
+static_assert( ignore_case::hash( "PRAGMA" ) == ignore_case::internal_::hash_enum::c_Pragma );
+static_assert( ignore_case::hash( "ORIGIN" ) == ignore_case::internal_::hash_enum::c_Origin );
+static_assert( ignore_case::hash( "EXPECT" ) == ignore_case::internal_::hash_enum::c_Expect );
+static_assert( ignore_case::hash( "COOKIE" ) == ignore_case::internal_::hash_enum::c_Cookie );
+static_assert( ignore_case::hash( "WARNING" ) == ignore_case::internal_::hash_enum::c_Warning );
+static_assert( ignore_case::hash( "COOKIE2" ) == ignore_case::internal_::hash_enum::c_Cookie2 );
+static_assert( ignore_case::hash( "REFERER" ) == ignore_case::internal_::hash_enum::c_Referer );
+static_assert( ignore_case::hash( "TRAILER" ) == ignore_case::internal_::hash_enum::c_Trailer );
+static_assert( ignore_case::hash( "IF-RANGE" ) == ignore_case::internal_::hash_enum::c_If_Range );
+static_assert( ignore_case::hash( "EXPIRES" ) == ignore_case::internal_::hash_enum::c_Expires );
+static_assert( ignore_case::hash( "IF-MATCH" ) == ignore_case::internal_::hash_enum::c_If_Match );
+static_assert( ignore_case::hash( "LOCATION" ) == ignore_case::internal_::hash_enum::c_Location );
+static_assert( ignore_case::hash( "FORWARDED" ) == ignore_case::internal_::hash_enum::c_Forwarded );
+static_assert( ignore_case::hash( "USER-AGENT" ) == ignore_case::internal_::hash_enum::c_User_Agent );
+static_assert( ignore_case::hash( "SOURCEMAP" ) == ignore_case::internal_::hash_enum::c_SourceMap );
+static_assert( ignore_case::hash( "SET-COOKIE" ) == ignore_case::internal_::hash_enum::c_Set_Cookie );
+static_assert( ignore_case::hash( "SET-COOKIE2" ) == ignore_case::internal_::hash_enum::c_Set_Cookie2 );
+static_assert( ignore_case::hash( "RETRY-AFTER" ) == ignore_case::internal_::hash_enum::c_Retry_After );
+static_assert( ignore_case::hash( "KEEP-ALIVE" ) == ignore_case::internal_::hash_enum::c_Keep_Alive );
+static_assert( ignore_case::hash( "EXPECT-CT" ) == ignore_case::internal_::hash_enum::c_Expect_CT );
+static_assert( ignore_case::hash( "CONNECTION" ) == ignore_case::internal_::hash_enum::c_Connection );
+static_assert( ignore_case::hash( "CONTENT-TYPE" ) == ignore_case::internal_::hash_enum::c_Content_Type );
+static_assert( ignore_case::hash( "ACCEPT-RANGES" ) == ignore_case::internal_::hash_enum::c_Accept_Ranges );
+static_assert( ignore_case::hash( "AUTHORIZATION" ) == ignore_case::internal_::hash_enum::c_Authorization );
+static_assert( ignore_case::hash( "CACHE-CONTROL" ) == ignore_case::internal_::hash_enum::c_Cache_Control );
+static_assert( ignore_case::hash( "IF-NONE-MATCH" ) == ignore_case::internal_::hash_enum::c_If_None_Match );
+static_assert( ignore_case::hash( "SERVER-TIMING" ) == ignore_case::internal_::hash_enum::c_Server_Timing );
+static_assert( ignore_case::hash( "CONTENT-RANGE" ) == ignore_case::internal_::hash_enum::c_Content_Range );
+static_assert( ignore_case::hash( "LAST-MODIFIED" ) == ignore_case::internal_::hash_enum::c_Last_Modified );
+static_assert( ignore_case::hash( "FEATURE-POLICY" ) == ignore_case::internal_::hash_enum::c_Feature_Policy );
+static_assert( ignore_case::hash( "CLEAR-SITE-DATA" ) == ignore_case::internal_::hash_enum::c_Clear_Site_Data );
+static_assert( ignore_case::hash( "X-FRAME-OPTIONS" ) == ignore_case::internal_::hash_enum::c_X_Frame_Options );
+static_assert( ignore_case::hash( "ACCEPT-ENCODING" ) == ignore_case::internal_::hash_enum::c_Accept_Encoding );
+static_assert( ignore_case::hash( "CONTENT-LENGTH" ) == ignore_case::internal_::hash_enum::c_Content_Length );
+static_assert( ignore_case::hash( "ACCEPT-CHARSET" ) == ignore_case::internal_::hash_enum::c_Accept_Charset );
+static_assert( ignore_case::hash( "PUBLIC-KEY-PINS" ) == ignore_case::internal_::hash_enum::c_Public_Key_Pins );
+static_assert( ignore_case::hash( "X-FORWARDED-FOR" ) == ignore_case::internal_::hash_enum::c_X_Forwarded_For );
+static_assert( ignore_case::hash( "ACCEPT-LANGUAGE" ) == ignore_case::internal_::hash_enum::c_Accept_Language );
+static_assert( ignore_case::hash( "REFERRER-POLICY" ) == ignore_case::internal_::hash_enum::c_Referrer_Policy );
+static_assert( ignore_case::hash( "CONTENT-ENCODING" ) == ignore_case::internal_::hash_enum::c_Content_Encoding );
+static_assert( ignore_case::hash( "X-FORWARDED-HOST" ) == ignore_case::internal_::hash_enum::c_X_Forwarded_Host );
+static_assert( ignore_case::hash( "X-FORWARDED-PROTO" ) == ignore_case::internal_::hash_enum::c_X_Forwarded_Proto );
+static_assert( ignore_case::hash( "CONTENT-LANGUAGE" ) == ignore_case::internal_::hash_enum::c_Content_Language );
+static_assert( ignore_case::hash( "TRANSFER-ENCODING" ) == ignore_case::internal_::hash_enum::c_Transfer_Encoding );
+static_assert( ignore_case::hash( "WWW-AUTHENTICATE" ) == ignore_case::internal_::hash_enum::c_WWW_Authenticate );
+static_assert( ignore_case::hash( "X-XSS-PROTECTION" ) == ignore_case::internal_::hash_enum::c_X_XSS_Protection );
+static_assert( ignore_case::hash( "CONTENT-LOCATION" ) == ignore_case::internal_::hash_enum::c_Content_Location );
+static_assert( ignore_case::hash( "LARGE-ALLOCATION" ) == ignore_case::internal_::hash_enum::c_Large_Allocation );
+static_assert( ignore_case::hash( "IF-MODIFIED-SINCE" ) == ignore_case::internal_::hash_enum::c_If_Modified_Since );
+static_assert( ignore_case::hash( "PROXY-AUTHENTICATE" ) == ignore_case::internal_::hash_enum::c_Proxy_Authenticate );
+static_assert( ignore_case::hash( "PROXY-AUTHORIZATION" ) == ignore_case::internal_::hash_enum::c_Proxy_Authorization );
+static_assert( ignore_case::hash( "IF-UNMODIFIED-SINCE" ) == ignore_case::internal_::hash_enum::c_If_Unmodified_Since );
+static_assert( ignore_case::hash( "CONTENT-DISPOSITION" ) == ignore_case::internal_::hash_enum::c_Content_Disposition );
+static_assert( ignore_case::hash( "X-CONTENT-TYPE-OPTIONS" ) == ignore_case::internal_::hash_enum::c_X_Content_Type_Options );
+static_assert( ignore_case::hash( "X-DNS-PREFETCH-CONTROL" ) == ignore_case::internal_::hash_enum::c_X_DNS_Prefetch_Control );
+static_assert( ignore_case::hash( "TIMING-ALLOW-ORIGIN" ) == ignore_case::internal_::hash_enum::c_Timing_Allow_Origin );
+static_assert( ignore_case::hash( "ACCESS-CONTROL-MAX-AGE" ) == ignore_case::internal_::hash_enum::c_Access_Control_Max_Age );
+static_assert( ignore_case::hash( "SEC-WEBSOCKET-ACCEPT" ) == ignore_case::internal_::hash_enum::c_Sec_WebSocket_Accept );
+static_assert( ignore_case::hash( "CONTENT-SECURITY-POLICY" ) == ignore_case::internal_::hash_enum::c_Content_Security_Policy );
+static_assert( ignore_case::hash( "STRICT-TRANSPORT-SECURITY" ) == ignore_case::internal_::hash_enum::c_Strict_Transport_Security );
+static_assert( ignore_case::hash( "UPGRADE-INSECURE-REQUESTS" ) == ignore_case::internal_::hash_enum::c_Upgrade_Insecure_Requests );
+static_assert( ignore_case::hash( "PUBLIC-KEY-PINS-REPORT-ONLY" ) == ignore_case::internal_::hash_enum::c_Public_Key_Pins_Report_Only );
+static_assert( ignore_case::hash( "ACCESS-CONTROL-ALLOW-ORIGIN" ) == ignore_case::internal_::hash_enum::c_Access_Control_Allow_Origin );
+static_assert( ignore_case::hash( "ACCESS-CONTROL-REQUEST-METHOD" ) == ignore_case::internal_::hash_enum::c_Access_Control_Request_Method );
+static_assert( ignore_case::hash( "ACCESS-CONTROL-REQUEST-HEADERS" ) == ignore_case::internal_::hash_enum::c_Access_Control_Request_Headers );
+static_assert( ignore_case::hash( "ACCESS-CONTROL-ALLOW-METHODS" ) == ignore_case::internal_::hash_enum::c_Access_Control_Allow_Methods );
+static_assert( ignore_case::hash( "ACCESS-CONTROL-ALLOW-CREDENTIALS" ) == ignore_case::internal_::hash_enum::c_Access_Control_Allow_Credentials );
+static_assert( ignore_case::hash( "ACCESS-CONTROL-ALLOW-HEADERS" ) == ignore_case::internal_::hash_enum::c_Access_Control_Allow_Headers );
+static_assert( ignore_case::hash( "ACCESS-CONTROL-EXPOSE-HEADERS" ) == ignore_case::internal_::hash_enum::c_Access_Control_Expose_Headers );
+static_assert( ignore_case::hash( "CONTENT-SECURITY-POLICY-REPORT-ONLY" ) == ignore_case::internal_::hash_enum::c_Content_Security_Policy_Report_Only );
+
+#endif // IGNORE_CASE__HASH_HPP_
@@ -0,0 +1,1020 @@
+#ifndef STATUS__REASON_HPP_
+#define STATUS__REASON_HPP_
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+namespace status {
+
+namespace internal_ {
+
+enum class reason_enum
+{
+    default_ = -1,
+    c_OK = 0,
+    c_Gone = 1,
+    c_Found = 2,
+    c_Created = 3,
+    c_Accepted = 4,
+    c_Continue = 5,
+    c_Forbidden = 6,
+    c_Conflict = 7,
+    c_See_Other = 8,
+    c_Not_Found = 9,
+    c_No_Content = 10,
+    c_Bad_Request = 11,
+    c_Unauthorized = 12,
+    c_URI_Too_Long = 13,
+    c_Not_Modified = 14,
+    c_Bad_Gateway = 15,
+    c_Not_Acceptable = 16,
+    c_Not_Implemented = 17,
+    c_Request_Timeout = 18,
+    c_Partial_Content = 19,
+    c_Length_Required = 20,
+    c_Gateway_Timeout = 21,
+    c_Multiple_Choices = 22,
+    c_Moved_Permanently = 23,
+    c_Too_Many_Requests = 24,
+    c_Payload_Too_Large = 25,
+    c_Method_Not_Allowed = 26,
+    c_Permanent_Redirect = 27,
+    c_Service_Unavailable = 28,
+    c_Internal_Server_Error = 29,
+    c_Unsupported_Media_Type = 30,
+    c_Temporary_Redirect = 31,
+    c_Switching_Protocols = 32,
+};
+
+} // namespace internal_
+
+// Number of keywords, enum values other than the default are in [ 0, reason_count )
+constexpr size_t reason_count = 33;
+
+constexpr internal_::reason_enum reason( std::string_view s );
+
+using reason_value_type = int;
+
+// Returns the value given to keyword s, nullptr if s is not a keyword
+constexpr const reason_value_type* reason_value( std::string_view s );
+
+namespace internal_ {
+
+struct word_entry
+{
+    std::string_view word;
+    reason_enum enum_val;
+    reason_value_type value;
+};
+
+// Keywords of 2 to 7 bytes
+constexpr std::array< int, 256 > asso_values_0 = {
+         8,     8,     8,     8,     8,     8,     8,     8,     8,     8,
+         8,     8,     8,     8,     8,     8,     8,     8,     8,     8,
+         8,     8,     8,     8,     8,     8,     8,     8,     8,     8,
+         8,     8,     8,     8,     8,     8,     8,     8,     8,     8,
+         8,     8,     8,     8,     8,     8,     8,     8,     8,     8,
+         8,     8,     8,     8,     8,     8,     8,     8,     8,     8,
+         8,     8,     8,     8,     8,     8,     8,     8,     8,     8,
+         8,     8,     8,     8,     8,     8,     8,     8,     8,     8,
+         8,     8,     8,     8,     8,     8,     8,     8,     8,     8,
+         8,     8,     8,     8,     8,     8,     8,     8,     8,     8,
+         8,     8,     8,     8,     8,     8,     8,     8,     8,     8,
+         8,     8,     8,     8,     8,     8,     8,     8,     8,     8,
+         8,     8,     8,     8,     8,     8,     8,     8,     8,     8,
+         8,     8,     8,     8,     8,     8,     8,     8,     8,     8,
+         8,     8,     8,     8,     8,     8,     8,     8,     8,     8,
+         8,     8,     8,     8,     8,     8,     8,     8,     8,     8,
+         8,     8,     8,     8,     8,     8,     8,     8,     8,     8,
+         8,     8,     8,     8,     8,     8,     8,     8,     8,     8,
+         8,     8,     8,     8,     8,     8,     8,     8,     8,     8,
+         8,     8,     8,     8,     8,     8,     8,     8,     8,     8,
+         8,     8,     8,     8,     8,     8,     8,     8,     8,     8,
+         8,     8,     8,     8,     8,     8,     8,     8,     8,     8,
+         8,     8,     8,     8,     8,     8,     8,     8,     8,     8,
+         8,     8,     8,     8,     8,     8,     8,     8,     8,     8,
+         8,     8,     8,     8,     8,     8,     8,     8,     8,     8,
+         8,     8,     8,     8,     8,     8,
+};
+
+constexpr std::array< word_entry, 8 > wordlist_0 = {{
+    { "", reason_enum::default_, {} },
+    { "", reason_enum::default_, {} },
+    { "OK", reason_enum::c_OK, 200 },
+    { "", reason_enum::default_, {} },
+    { "Gone", reason_enum::c_Gone, 410 },
+    { "Found", reason_enum::c_Found, 302 },
+    { "", reason_enum::default_, {} },
+    { "Created", reason_enum::c_Created, 201 },
+}};
+
+constexpr reason_enum reason_0( std::string_view s )
+{
+    constexpr size_t MinWordLength = 2;
+    constexpr size_t MaxWordLength = 7;
+    constexpr size_t MaxHashValue = 7;
+
+    if ( s.size() < MinWordLength || s.size() > MaxWordLength )
+    {
+        return internal_::reason_enum::default_;
+    }
+
+    size_t hash_val = s.size();
+    switch( s.size() )
+    {
+                       case 7:
+    [[ fallthrough ]]; case 6:
+    [[ fallthrough ]]; case 5:
+    [[ fallthrough ]]; case 4:
+    [[ fallthrough ]]; case 3:
+    [[ fallthrough ]]; case 2:
+    [[ fallthrough ]]; case 1:
+        ; // Prevent compiler error
+    }
+
+    if ( hash_val <= MaxHashValue )
+    {
+        const size_t slot = hash_val;
+        if ( internal_::wordlist_0[ slot ].word == s )
+        {
+            return internal_::wordlist_0[ slot ].enum_val;
+        }
+    }
+    return internal_::reason_enum::default_;
+}
+
+constexpr const reason_value_type* reason_value_0( std::string_view s )
+{
+    constexpr size_t MinWordLength = 2;
+    constexpr size_t MaxWordLength = 7;
+    constexpr size_t MaxHashValue = 7;
+
+    if ( s.size() < MinWordLength || s.size() > MaxWordLength )
+    {
+        return nullptr;
+    }
+
+    size_t hash_val = s.size();
+    switch( s.size() )
+    {
+                       case 7:
+    [[ fallthrough ]]; case 6:
+    [[ fallthrough ]]; case 5:
+    [[ fallthrough ]]; case 4:
+    [[ fallthrough ]]; case 3:
+    [[ fallthrough ]]; case 2:
+    [[ fallthrough ]]; case 1:
+        ; // Prevent compiler error
+    }
+
+    if ( hash_val <= MaxHashValue )
+    {
+        const size_t slot = hash_val;
+        if ( internal_::wordlist_0[ slot ].word == s )
+        {
+            return &internal_::wordlist_0[ slot ].value;
+        }
+    }
+    return nullptr;
+}
+
+// Keywords of 8 to 9 bytes
+constexpr std::array< int, 256 > asso_values_1 = {
+        14,    14,    14,    14,    14,    14,    14,    14,    14,    14,
+        14,    14,    14,    14,    14,    14,    14,    14,    14,    14,
+        14,    14,    14,    14,    14,    14,    14,    14,    14,    14,
+        14,    14,    14,    14,    14,    14,    14,    14,    14,    14,
+        14,    14,    14,    14,    14,    14,    14,    14,    14,    14,
+        14,    14,    14,    14,    14,    14,    14,    14,    14,    14,
+        14,    14,    14,    14,    14,    14,    14,    14,    14,    14,
+         4,    14,    14,    14,    14,    14,    14,    14,    14,     3,
+        14,    14,    14,    14,    14,    14,    14,    14,    14,    14,
+        14,    14,    14,    14,    14,    14,    14,    14,    14,    14,
+        14,    14,    14,    14,    14,     1,    14,    14,     3,    14,
+        14,    14,     0,    14,    14,    14,    14,    14,    14,    14,
+        14,    14,    14,    14,    14,    14,    14,    14,    14,    14,
+        14,    14,    14,    14,    14,    14,    14,    14,    14,    14,
+        14,    14,    14,    14,    14,    14,    14,    14,    14,    14,
+        14,    14,    14,    14,    14,    14,    14,    14,    14,    14,
+        14,    14,    14,    14,    14,    14,    14,    14,    14,    14,
+        14,    14,    14,    14,    14,    14,    14,    14,    14,    14,
+        14,    14,    14,    14,    14,    14,    14,    14,    14,    14,
+        14,    14,    14,    14,    14,    14,    14,    14,    14,    14,
+        14,    14,    14,    14,    14,    14,    14,    14,    14,    14,
+        14,    14,    14,    14,    14,    14,    14,    14,    14,    14,
+        14,    14,    14,    14,    14,    14,    14,    14,    14,    14,
+        14,    14,    14,    14,    14,    14,    14,    14,    14,    14,
+        14,    14,    14,    14,    14,    14,    14,    14,    14,    14,
+        14,    14,    14,    14,    14,    14,
+};
+
+constexpr std::array< word_entry, 14 > wordlist_1 = {{
+    { "", reason_enum::default_, {} },
+    { "", reason_enum::default_, {} },
+    { "", reason_enum::default_, {} },
+    { "", reason_enum::default_, {} },
+    { "", reason_enum::default_, {} },
+    { "", reason_enum::default_, {} },
+    { "", reason_enum::default_, {} },
+    { "", reason_enum::default_, {} },
+    { "Accepted", reason_enum::c_Accepted, 202 },
+    { "Continue", reason_enum::c_Continue, 100 },
+    { "Forbidden", reason_enum::c_Forbidden, 403 },
+    { "Conflict", reason_enum::c_Conflict, 409 },
+    { "See Other", reason_enum::c_See_Other, 303 },
+    { "Not Found", reason_enum::c_Not_Found, 404 },
+}};
+
+constexpr reason_enum reason_1( std::string_view s )
+{
+    constexpr size_t MinWordLength = 8;
+    constexpr size_t MaxWordLength = 9;
+    constexpr size_t MaxHashValue = 13;
+
+    if ( s.size() < MinWordLength || s.size() > MaxWordLength )
+    {
+        return internal_::reason_enum::default_;
+    }
+
+    size_t hash_val = s.size();
+    switch( s.size() )
+    {
+                       case 9:
+    [[ fallthrough ]]; case 8:
+    [[ fallthrough ]]; case 7:
+    [[ fallthrough ]]; case 6:
+    [[ fallthrough ]]; case 5:
+        hash_val += internal_::asso_values_1[ static_cast< unsigned char >( s[ 4] ) ];
+    [[ fallthrough ]]; case 4:
+    [[ fallthrough ]]; case 3:
+    [[ fallthrough ]]; case 2:
+    [[ fallthrough ]]; case 1:
+        ; // Prevent compiler error
+    }
+
+    if ( hash_val <= MaxHashValue )
+    {
+        const size_t slot = hash_val;
+        if ( internal_::wordlist_1[ slot ].word == s )
+        {
+            return internal_::wordlist_1[ slot ].enum_val;
+        }
+    }
+    return internal_::reason_enum::default_;
+}
+
+constexpr const reason_value_type* reason_value_1( std::string_view s )
+{
+    constexpr size_t MinWordLength = 8;
+    constexpr size_t MaxWordLength = 9;
+    constexpr size_t MaxHashValue = 13;
+
+    if ( s.size() < MinWordLength || s.size() > MaxWordLength )
+    {
+        return nullptr;
+    }
+
+    size_t hash_val = s.size();
+    switch( s.size() )
+    {
+                       case 9:
+    [[ fallthrough ]]; case 8:
+    [[ fallthrough ]]; case 7:
+    [[ fallthrough ]]; case 6:
+    [[ fallthrough ]]; case 5:
+        hash_val += internal_::asso_values_1[ static_cast< unsigned char >( s[ 4] ) ];
+    [[ fallthrough ]]; case 4:
+    [[ fallthrough ]]; case 3:
+    [[ fallthrough ]]; case 2:
+    [[ fallthrough ]]; case 1:
+        ; // Prevent compiler error
+    }
+
+    if ( hash_val <= MaxHashValue )
+    {
+        const size_t slot = hash_val;
+        if ( internal_::wordlist_1[ slot ].word == s )
+        {
+            return &internal_::wordlist_1[ slot ].value;
+        }
+    }
+    return nullptr;
+}
+
+// Keywords of 10 to 12 bytes
+constexpr std::array< int, 256 > asso_values_2 = {
+        16,    16,    16,    16,    16,    16,    16,    16,    16,    16,
+        16,    16,    16,    16,    16,    16,    16,    16,    16,    16,
+        16,    16,    16,    16,    16,    16,    16,    16,    16,    16,
+        16,    16,    16,    16,    16,    16,    16,    16,    16,    16,
+        16,    16,    16,    16,    16,    16,    16,    16,    16,    16,
+        16,    16,    16,    16,    16,    16,    16,    16,    16,    16,
+        16,    16,    16,    16,    16,    16,    16,    16,    16,    16,
+        16,     4,    16,    16,    16,    16,    16,     2,    16,    16,
+        16,    16,     0,    16,     1,    16,    16,    16,    16,    16,
+        16,    16,    16,    16,    16,    16,    16,    16,    16,    16,
+        16,    16,    16,    16,    16,    16,    16,    16,    16,    16,
+        16,     0,    16,    16,    16,    16,     0,    16,    16,    16,
+        16,    16,    16,    16,    16,    16,    16,    16,    16,    16,
+        16,    16,    16,    16,    16,    16,    16,    16,    16,    16,
+        16,    16,    16,    16,    16,    16,    16,    16,    16,    16,
+        16,    16,    16,    16,    16,    16,    16,    16,    16,    16,
+        16,    16,    16,    16,    16,    16,    16,    16,    16,    16,
+        16,    16,    16,    16,    16,    16,    16,    16,    16,    16,
+        16,    16,    16,    16,    16,    16,    16,    16,    16,    16,
+        16,    16,    16,    16,    16,    16,    16,    16,    16,    16,
+        16,    16,    16,    16,    16,    16,    16,    16,    16,    16,
+        16,    16,    16,    16,    16,    16,    16,    16,    16,    16,
+        16,    16,    16,    16,    16,    16,    16,    16,    16,    16,
+        16,    16,    16,    16,    16,    16,    16,    16,    16,    16,
+        16,    16,    16,    16,    16,    16,    16,    16,    16,    16,
+        16,    16,    16,    16,    16,    16,
+};
+
+constexpr std::array< word_entry, 16 > wordlist_2 = {{
+    { "", reason_enum::default_, {} },
+    { "", reason_enum::default_, {} },
+    { "", reason_enum::default_, {} },
+    { "", reason_enum::default_, {} },
+    { "", reason_enum::default_, {} },
+    { "", reason_enum::default_, {} },
+    { "", reason_enum::default_, {} },
+    { "", reason_enum::default_, {} },
+    { "", reason_enum::default_, {} },
+    { "", reason_enum::default_, {} },
+    { "No Content", reason_enum::c_No_Content, 204 },
+    { "Bad Request", reason_enum::c_Bad_Request, 400 },
+    { "Unauthorized", reason_enum::c_Unauthorized, 401 },
+    { "URI Too Long", reason_enum::c_URI_Too_Long, 414 },
+    { "Not Modified", reason_enum::c_Not_Modified, 304 },
+    { "Bad Gateway", reason_enum::c_Bad_Gateway, 502 },
+}};
+
+constexpr reason_enum reason_2( std::string_view s )
+{
+    constexpr size_t MinWordLength = 10;
+    constexpr size_t MaxWordLength = 12;
+    constexpr size_t MaxHashValue = 15;
+
+    if ( s.size() < MinWordLength || s.size() > MaxWordLength )
+    {
+        return internal_::reason_enum::default_;
+    }
+
+    size_t hash_val = s.size();
+    switch( s.size() )
+    {
+                       case 12:
+    [[ fallthrough ]]; case 11:
+    [[ fallthrough ]]; case 10:
+    [[ fallthrough ]]; case 9:
+    [[ fallthrough ]]; case 8:
+    [[ fallthrough ]]; case 7:
+    [[ fallthrough ]]; case 6:
+    [[ fallthrough ]]; case 5:
+        hash_val += internal_::asso_values_2[ static_cast< unsigned char >( s[ 4] ) ];
+    [[ fallthrough ]]; case 4:
+    [[ fallthrough ]]; case 3:
+    [[ fallthrough ]]; case 2:
+    [[ fallthrough ]]; case 1:
+        ; // Prevent compiler error
+    }
+
+    if ( hash_val <= MaxHashValue )
+    {
+        const size_t slot = hash_val;
+        if ( internal_::wordlist_2[ slot ].word == s )
+        {
+            return internal_::wordlist_2[ slot ].enum_val;
+        }
+    }
+    return internal_::reason_enum::default_;
+}
+
+constexpr const reason_value_type* reason_value_2( std::string_view s )
+{
+    constexpr size_t MinWordLength = 10;
+    constexpr size_t MaxWordLength = 12;
+    constexpr size_t MaxHashValue = 15;
+
+    if ( s.size() < MinWordLength || s.size() > MaxWordLength )
+    {
+        return nullptr;
+    }
+
+    size_t hash_val = s.size();
+    switch( s.size() )
+    {
+                       case 12:
+    [[ fallthrough ]]; case 11:
+    [[ fallthrough ]]; case 10:
+    [[ fallthrough ]]; case 9:
+    [[ fallthrough ]]; case 8:
+    [[ fallthrough ]]; case 7:
+    [[ fallthrough ]]; case 6:
+    [[ fallthrough ]]; case 5:
+        hash_val += internal_::asso_values_2[ static_cast< unsigned char >( s[ 4] ) ];
+    [[ fallthrough ]]; case 4:
+    [[ fallthrough ]]; case 3:
+    [[ fallthrough ]]; case 2:
+    [[ fallthrough ]]; case 1:
+        ; // Prevent compiler error
+    }
+
+    if ( hash_val <= MaxHashValue )
+    {
+        const size_t slot = hash_val;
+        if ( internal_::wordlist_2[ slot ].word == s )
+        {
+            return &internal_::wordlist_2[ slot ].value;
+        }
+    }
+    return nullptr;
+}
+
+// Keywords of 14 to 15 bytes
+constexpr std::array< int, 256 > asso_values_3 = {
+        20,    20,    20,    20,    20,    20,    20,    20,    20,    20,
+        20,    20,    20,    20,    20,    20,    20,    20,    20,    20,
+        20,    20,    20,    20,    20,    20,    20,    20,    20,    20,
+        20,    20,    20,    20,    20,    20,    20,    20,    20,    20,
+        20,    20,    20,    20,    20,    20,    20,    20,    20,    20,
+        20,    20,    20,    20,    20,    20,    20,    20,    20,    20,
+        20,    20,    20,    20,    20,    20,    20,    20,    20,    20,
+        20,     4,    20,    20,    20,    20,     3,    20,     0,    20,
+         2,    20,     1,    20,    20,    20,    20,    20,    20,    20,
+        20,    20,    20,    20,    20,    20,    20,    20,    20,    20,
+        20,    20,    20,    20,    20,    20,    20,    20,    20,    20,
+        20,    20,    20,    20,    20,    20,    20,    20,    20,    20,
+        20,    20,    20,    20,    20,    20,    20,    20,    20,    20,
+        20,    20,    20,    20,    20,    20,    20,    20,    20,    20,
+        20,    20,    20,    20,    20,    20,    20,    20,    20,    20,
+        20,    20,    20,    20,    20,    20,    20,    20,    20,    20,
+        20,    20,    20,    20,    20,    20,    20,    20,    20,    20,
+        20,    20,    20,    20,    20,    20,    20,    20,    20,    20,
+        20,    20,    20,    20,    20,    20,    20,    20,    20,    20,
+        20,    20,    20,    20,    20,    20,    20,    20,    20,    20,
+        20,    20,    20,    20,    20,    20,    20,    20,    20,    20,
+        20,    20,    20,    20,    20,    20,    20,    20,    20,    20,
+        20,    20,    20,    20,    20,    20,    20,    20,    20,    20,
+        20,    20,    20,    20,    20,    20,    20,    20,    20,    20,
+        20,    20,    20,    20,    20,    20,    20,    20,    20,    20,
+        20,    20,    20,    20,    20,    20,
+};
+
+constexpr std::array< word_entry, 20 > wordlist_3 = {{
+    { "", reason_enum::default_, {} },
+    { "", reason_enum::default_, {} },
+    { "", reason_enum::default_, {} },
+    { "", reason_enum::default_, {} },
+    { "", reason_enum::default_, {} },
+    { "", reason_enum::default_, {} },
+    { "", reason_enum::default_, {} },
+    { "", reason_enum::default_, {} },
+    { "", reason_enum::default_, {} },
+    { "", reason_enum::default_, {} },
+    { "", reason_enum::default_, {} },
+    { "", reason_enum::default_, {} },
+    { "", reason_enum::default_, {} },
+    { "", reason_enum::default_, {} },
+    { "Not Acceptable", reason_enum::c_Not_Acceptable, 406 },
+    { "Not Implemented", reason_enum::c_Not_Implemented, 501 },
+    { "Request Timeout", reason_enum::c_Request_Timeout, 408 },
+    { "Partial Content", reason_enum::c_Partial_Content, 206 },
+    { "Length Required", reason_enum::c_Length_Required, 411 },
+    { "Gateway Timeout", reason_enum::c_Gateway_Timeout, 504 },
+}};
+
+constexpr reason_enum reason_3( std::string_view s )
+{
+    constexpr size_t MinWordLength = 14;
+    constexpr size_t MaxWordLength = 15;
+    constexpr size_t MaxHashValue = 19;
+
+    if ( s.size() < MinWordLength || s.size() > MaxWordLength )
+    {
+        return internal_::reason_enum::default_;
+    }
+
+    size_t hash_val = s.size();
+    switch( s.size() )
+    {
+                       case 15:
+    [[ fallthrough ]]; case 14:
+    [[ fallthrough ]]; case 13:
+    [[ fallthrough ]]; case 12:
+    [[ fallthrough ]]; case 11:
+    [[ fallthrough ]]; case 10:
+    [[ fallthrough ]]; case 9:
+    [[ fallthrough ]]; case 8:
+    [[ fallthrough ]]; case 7:
+    [[ fallthrough ]]; case 6:
+    [[ fallthrough ]]; case 5:
+    [[ fallthrough ]]; case 4:
+    [[ fallthrough ]]; case 3:
+    [[ fallthrough ]]; case 2:
+    [[ fallthrough ]]; case 1:
+        hash_val += internal_::asso_values_3[ static_cast< unsigned char >( s[ 0] ) ];
+    }
+
+    if ( hash_val <= MaxHashValue )
+    {
+        const size_t slot = hash_val;
+        if ( internal_::wordlist_3[ slot ].word == s )
+        {
+            return internal_::wordlist_3[ slot ].enum_val;
+        }
+    }
+    return internal_::reason_enum::default_;
+}
+
+constexpr const reason_value_type* reason_value_3( std::string_view s )
+{
+    constexpr size_t MinWordLength = 14;
+    constexpr size_t MaxWordLength = 15;
+    constexpr size_t MaxHashValue = 19;
+
+    if ( s.size() < MinWordLength || s.size() > MaxWordLength )
+    {
+        return nullptr;
+    }
+
+    size_t hash_val = s.size();
+    switch( s.size() )
+    {
+                       case 15:
+    [[ fallthrough ]]; case 14:
+    [[ fallthrough ]]; case 13:
+    [[ fallthrough ]]; case 12:
+    [[ fallthrough ]]; case 11:
+    [[ fallthrough ]]; case 10:
+    [[ fallthrough ]]; case 9:
+    [[ fallthrough ]]; case 8:
+    [[ fallthrough ]]; case 7:
+    [[ fallthrough ]]; case 6:
+    [[ fallthrough ]]; case 5:
+    [[ fallthrough ]]; case 4:
+    [[ fallthrough ]]; case 3:
+    [[ fallthrough ]]; case 2:
+    [[ fallthrough ]]; case 1:
+        hash_val += internal_::asso_values_3[ static_cast< unsigned char >( s[ 0] ) ];
+    }
+
+    if ( hash_val <= MaxHashValue )
+    {
+        const size_t slot = hash_val;
+        if ( internal_::wordlist_3[ slot ].word == s )
+        {
+            return &internal_::wordlist_3[ slot ].value;
+        }
+    }
+    return nullptr;
+}
+
+// Keywords of 16 to 17 bytes
+constexpr std::array< int, 256 > asso_values_4 = {
+        20,    20,    20,    20,    20,    20,    20,    20,    20,    20,
+        20,    20,    20,    20,    20,    20,    20,    20,    20,    20,
+        20,    20,    20,    20,    20,    20,    20,    20,    20,    20,
+        20,    20,    20,    20,    20,    20,    20,    20,    20,    20,
+        20,    20,    20,    20,    20,    20,    20,    20,    20,    20,
+        20,    20,    20,    20,    20,    20,    20,    20,    20,    20,
+        20,    20,    20,    20,    20,    20,    20,    20,    20,    20,
+        20,    20,    20,    20,    20,    20,    20,     0,    20,    20,
+         2,    20,    20,    20,     1,    20,    20,    20,    20,    20,
+        20,    20,    20,    20,    20,    20,    20,    20,    20,    20,
+        20,    20,    20,    20,    20,    20,    20,    20,    20,    20,
+        20,    20,    20,    20,    20,    20,    20,    20,    20,    20,
+        20,    20,    20,    20,    20,    20,    20,    20,    20,    20,
+        20,    20,    20,    20,    20,    20,    20,    20,    20,    20,
+        20,    20,    20,    20,    20,    20,    20,    20,    20,    20,
+        20,    20,    20,    20,    20,    20,    20,    20,    20,    20,
+        20,    20,    20,    20,    20,    20,    20,    20,    20,    20,
+        20,    20,    20,    20,    20,    20,    20,    20,    20,    20,
+        20,    20,    20,    20,    20,    20,    20,    20,    20,    20,
+        20,    20,    20,    20,    20,    20,    20,    20,    20,    20,
+        20,    20,    20,    20,    20,    20,    20,    20,    20,    20,
+        20,    20,    20,    20,    20,    20,    20,    20,    20,    20,
+        20,    20,    20,    20,    20,    20,    20,    20,    20,    20,
+        20,    20,    20,    20,    20,    20,    20,    20,    20,    20,
+        20,    20,    20,    20,    20,    20,    20,    20,    20,    20,
+        20,    20,    20,    20,    20,    20,
+};
+
+constexpr std::array< word_entry, 20 > wordlist_4 = {{
+    { "", reason_enum::default_, {} },
+    { "", reason_enum::default_, {} },
+    { "", reason_enum::default_, {} },
+    { "", reason_enum::default_, {} },
+    { "", reason_enum::default_, {} },
+    { "", reason_enum::default_, {} },
+    { "", reason_enum::default_, {} },
+    { "", reason_enum::default_, {} },
+    { "", reason_enum::default_, {} },
+    { "", reason_enum::default_, {} },
+    { "", reason_enum::default_, {} },
+    { "", reason_enum::default_, {} },
+    { "", reason_enum::default_, {} },
+    { "", reason_enum::default_, {} },
+    { "", reason_enum::default_, {} },
+    { "", reason_enum::default_, {} },
+    { "Multiple Choices", reason_enum::c_Multiple_Choices, 300 },
+    { "Moved Permanently", reason_enum::c_Moved_Permanently, 301 },
+    { "Too Many Requests", reason_enum::c_Too_Many_Requests, 429 },
+    { "Payload Too Large", reason_enum::c_Payload_Too_Large, 413 },
+}};
+
+constexpr reason_enum reason_4( std::string_view s )
+{
+    constexpr size_t MinWordLength = 16;
+    constexpr size_t MaxWordLength = 17;
+    constexpr size_t MaxHashValue = 19;
+
+    if ( s.size() < MinWordLength || s.size() > MaxWordLength )
+    {
+        return internal_::reason_enum::default_;
+    }
+
+    size_t hash_val = s.size();
+    switch( s.size() )
+    {
+                       case 17:
+    [[ fallthrough ]]; case 16:
+    [[ fallthrough ]]; case 15:
+    [[ fallthrough ]]; case 14:
+    [[ fallthrough ]]; case 13:
+    [[ fallthrough ]]; case 12:
+    [[ fallthrough ]]; case 11:
+    [[ fallthrough ]]; case 10:
+    [[ fallthrough ]]; case 9:
+    [[ fallthrough ]]; case 8:
+    [[ fallthrough ]]; case 7:
+    [[ fallthrough ]]; case 6:
+    [[ fallthrough ]]; case 5:
+    [[ fallthrough ]]; case 4:
+    [[ fallthrough ]]; case 3:
+    [[ fallthrough ]]; case 2:
+    [[ fallthrough ]]; case 1:
+        hash_val += internal_::asso_values_4[ static_cast< unsigned char >( s[ 0] ) ];
+    }
+
+    if ( hash_val <= MaxHashValue )
+    {
+        const size_t slot = hash_val;
+        if ( internal_::wordlist_4[ slot ].word == s )
+        {
+            return internal_::wordlist_4[ slot ].enum_val;
+        }
+    }
+    return internal_::reason_enum::default_;
+}
+
+constexpr const reason_value_type* reason_value_4( std::string_view s )
+{
+    constexpr size_t MinWordLength = 16;
+    constexpr size_t MaxWordLength = 17;
+    constexpr size_t MaxHashValue = 19;
+
+    if ( s.size() < MinWordLength || s.size() > MaxWordLength )
+    {
+        return nullptr;
+    }
+
+    size_t hash_val = s.size();
+    switch( s.size() )
+    {
+                       case 17:
+    [[ fallthrough ]]; case 16:
+    [[ fallthrough ]]; case 15:
+    [[ fallthrough ]]; case 14:
+    [[ fallthrough ]]; case 13:
+    [[ fallthrough ]]; case 12:
+    [[ fallthrough ]]; case 11:
+    [[ fallthrough ]]; case 10:
+    [[ fallthrough ]]; case 9:
+    [[ fallthrough ]]; case 8:
+    [[ fallthrough ]]; case 7:
+    [[ fallthrough ]]; case 6:
+    [[ fallthrough ]]; case 5:
+    [[ fallthrough ]]; case 4:
+    [[ fallthrough ]]; case 3:
+    [[ fallthrough ]]; case 2:
+    [[ fallthrough ]]; case 1:
+        hash_val += internal_::asso_values_4[ static_cast< unsigned char >( s[ 0] ) ];
+    }
+
+    if ( hash_val <= MaxHashValue )
+    {
+        const size_t slot = hash_val;
+        if ( internal_::wordlist_4[ slot ].word == s )
+        {
+            return &internal_::wordlist_4[ slot ].value;
+        }
+    }
+    return nullptr;
+}
+
+// Keywords of 18 to 22 bytes
+constexpr std::array< int, 256 > asso_values_5 = {
+        25,    25,    25,    25,    25,    25,    25,    25,    25,    25,
+        25,    25,    25,    25,    25,    25,    25,    25,    25,    25,
+        25,    25,    25,    25,    25,    25,    25,    25,    25,    25,
+        25,    25,    25,    25,    25,    25,    25,    25,    25,    25,
+        25,    25,    25,    25,    25,    25,    25,    25,    25,    25,
+        25,    25,    25,    25,    25,    25,    25,    25,    25,    25,
+        25,    25,    25,    25,    25,    25,    25,    25,    25,    25,
+        25,    25,    25,    25,    25,    25,    25,    25,    25,    25,
+        25,    25,    25,    25,    25,    25,    25,    25,    25,    25,
+        25,    25,    25,    25,    25,    25,    25,    25,    25,    25,
+        25,    25,    25,    25,    25,     5,    25,    25,    25,     5,
+        25,    25,    25,    25,     1,     0,     0,    25,    25,    25,
+        25,    25,    25,    25,    25,    25,    25,    25,    25,    25,
+        25,    25,    25,    25,    25,    25,    25,    25,    25,    25,
+        25,    25,    25,    25,    25,    25,    25,    25,    25,    25,
+        25,    25,    25,    25,    25,    25,    25,    25,    25,    25,
+        25,    25,    25,    25,    25,    25,    25,    25,    25,    25,
+        25,    25,    25,    25,    25,    25,    25,    25,    25,    25,
+        25,    25,    25,    25,    25,    25,    25,    25,    25,    25,
+        25,    25,    25,    25,    25,    25,    25,    25,    25,    25,
+        25,    25,    25,    25,    25,    25,    25,    25,    25,    25,
+        25,    25,    25,    25,    25,    25,    25,    25,    25,    25,
+        25,    25,    25,    25,    25,    25,    25,    25,    25,    25,
+        25,    25,    25,    25,    25,    25,    25,    25,    25,    25,
+        25,    25,    25,    25,    25,    25,    25,    25,    25,    25,
+        25,    25,    25,    25,    25,    25,
+};
+
+constexpr std::array< word_entry, 25 > wordlist_5 = {{
+    { "", reason_enum::default_, {} },
+    { "", reason_enum::default_, {} },
+    { "", reason_enum::default_, {} },
+    { "", reason_enum::default_, {} },
+    { "", reason_enum::default_, {} },
+    { "", reason_enum::default_, {} },
+    { "", reason_enum::default_, {} },
+    { "", reason_enum::default_, {} },
+    { "", reason_enum::default_, {} },
+    { "", reason_enum::default_, {} },
+    { "", reason_enum::default_, {} },
+    { "", reason_enum::default_, {} },
+    { "", reason_enum::default_, {} },
+    { "", reason_enum::default_, {} },
+    { "", reason_enum::default_, {} },
+    { "", reason_enum::default_, {} },
+    { "", reason_enum::default_, {} },
+    { "", reason_enum::default_, {} },
+    { "Method Not Allowed", reason_enum::c_Method_Not_Allowed, 405 },
+    { "Permanent Redirect", reason_enum::c_Permanent_Redirect, 308 },
+    { "Service Unavailable", reason_enum::c_Service_Unavailable, 503 },
+    { "Internal Server Error", reason_enum::c_Internal_Server_Error, 500 },
+    { "Unsupported Media Type", reason_enum::c_Unsupported_Media_Type, 415 },
+    { "Temporary Redirect", reason_enum::c_Temporary_Redirect, 307 },
+    { "Switching Protocols", reason_enum::c_Switching_Protocols, 101 },
+}};
+
+constexpr reason_enum reason_5( std::string_view s )
+{
+    constexpr size_t MinWordLength = 18;
+    constexpr size_t MaxWordLength = 22;
+    constexpr size_t MaxHashValue = 24;
+
+    if ( s.size() < MinWordLength || s.size() > MaxWordLength )
+    {
+        return internal_::reason_enum::default_;
+    }
+
+    size_t hash_val = s.size();
+    switch( s.size() )
+    {
+                       case 22:
+    [[ fallthrough ]]; case 21:
+    [[ fallthrough ]]; case 20:
+    [[ fallthrough ]]; case 19:
+    [[ fallthrough ]]; case 18:
+    [[ fallthrough ]]; case 17:
+    [[ fallthrough ]]; case 16:
+    [[ fallthrough ]]; case 15:
+    [[ fallthrough ]]; case 14:
+    [[ fallthrough ]]; case 13:
+    [[ fallthrough ]]; case 12:
+    [[ fallthrough ]]; case 11:
+    [[ fallthrough ]]; case 10:
+    [[ fallthrough ]]; case 9:
+    [[ fallthrough ]]; case 8:
+    [[ fallthrough ]]; case 7:
+    [[ fallthrough ]]; case 6:
+    [[ fallthrough ]]; case 5:
+    [[ fallthrough ]]; case 4:
+    [[ fallthrough ]]; case 3:
+        hash_val += internal_::asso_values_5[ static_cast< unsigned char >( s[ 2] ) ];
+    [[ fallthrough ]]; case 2:
+    [[ fallthrough ]]; case 1:
+        ; // Prevent compiler error
+    }
+
+    if ( hash_val <= MaxHashValue )
+    {
+        const size_t slot = hash_val;
+        if ( internal_::wordlist_5[ slot ].word == s )
+        {
+            return internal_::wordlist_5[ slot ].enum_val;
+        }
+    }
+    return internal_::reason_enum::default_;
+}
+
+constexpr const reason_value_type* reason_value_5( std::string_view s )
+{
+    constexpr size_t MinWordLength = 18;
+    constexpr size_t MaxWordLength = 22;
+    constexpr size_t MaxHashValue = 24;
+
+    if ( s.size() < MinWordLength || s.size() > MaxWordLength )
+    {
+        return nullptr;
+    }
+
+    size_t hash_val = s.size();
+    switch( s.size() )
+    {
+                       case 22:
+    [[ fallthrough ]]; case 21:
+    [[ fallthrough ]]; case 20:
+    [[ fallthrough ]]; case 19:
+    [[ fallthrough ]]; case 18:
+    [[ fallthrough ]]; case 17:
+    [[ fallthrough ]]; case 16:
+    [[ fallthrough ]]; case 15:
+    [[ fallthrough ]]; case 14:
+    [[ fallthrough ]]; case 13:
+    [[ fallthrough ]]; case 12:
+    [[ fallthrough ]]; case 11:
+    [[ fallthrough ]]; case 10:
+    [[ fallthrough ]]; case 9:
+    [[ fallthrough ]]; case 8:
+    [[ fallthrough ]]; case 7:
+    [[ fallthrough ]]; case 6:
+    [[ fallthrough ]]; case 5:
+    [[ fallthrough ]]; case 4:
+    [[ fallthrough ]]; case 3:
+        hash_val += internal_::asso_values_5[ static_cast< unsigned char >( s[ 2] ) ];
+    [[ fallthrough ]]; case 2:
+    [[ fallthrough ]]; case 1:
+        ; // Prevent compiler error
+    }
+
+    if ( hash_val <= MaxHashValue )
+    {
+        const size_t slot = hash_val;
+        if ( internal_::wordlist_5[ slot ].word == s )
+        {
+            return &internal_::wordlist_5[ slot ].value;
+        }
+    }
+    return nullptr;
+}
+
+} // namespace internal_
+
+constexpr internal_::reason_enum reason( std::string_view s )
+{
+    switch ( s.size() )
+    {
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+    case 6:
+    case 7:
+        return internal_::reason_0( s );
+    case 8:
+    case 9:
+        return internal_::reason_1( s );
+    case 10:
+    case 11:
+    case 12:
+        return internal_::reason_2( s );
+    case 14:
+    case 15:
+        return internal_::reason_3( s );
+    case 16:
+    case 17:
+        return internal_::reason_4( s );
+    case 18:
+    case 19:
+    case 20:
+    case 21:
+    case 22:
+        return internal_::reason_5( s );
+    }
+
+    return internal_::reason_enum::default_;
+}
+
+constexpr const reason_value_type* reason_value( std::string_view s )
+{
+    switch ( s.size() )
+    {
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+    case 6:
+    case 7:
+        return internal_::reason_value_0( s );
+    case 8:
+    case 9:
+        return internal_::reason_value_1( s );
+    case 10:
+    case 11:
+    case 12:
+        return internal_::reason_value_2( s );
+    case 14:
+    case 15:
+        return internal_::reason_value_3( s );
+    case 16:
+    case 17:
+        return internal_::reason_value_4( s );
+    case 18:
+    case 19:
+    case 20:
+    case 21:
+    case 22:
+        return internal_::reason_value_5( s );
+    }
+
+    return nullptr;
+}
+
+} // namespace status {
+
+// Extra check for safety
+static_assert( status::reason( "OK" ) == status::internal_::reason_enum::c_OK );
+static_assert( status::reason( "Gone" ) == status::internal_::reason_enum::c_Gone );
+static_assert( status::reason( "Found" ) == status::internal_::reason_enum::c_Found );
+static_assert( status::reason( "Created" ) == status::internal_::reason_enum::c_Created );
+static_assert( status::reason( "Accepted" ) == status::internal_::reason_enum::c_Accepted );
+static_assert( status::reason( "Continue" ) == status::internal_::reason_enum::c_Continue );
+static_assert( status::reason( "Forbidden" ) == status::internal_::reason_enum::c_Forbidden );
+static_assert( status::reason( "Conflict" ) == status::internal_::reason_enum::c_Conflict );
+static_assert( status::reason( "See Other" ) == status::internal_::reason_enum::c_See_Other );
+static_assert( status::reason( "Not Found" ) == status::internal_::reason_enum::c_Not_Found );
+static_assert( status::reason( "No Content" ) == status::internal_::reason_enum::c_No_Content );
+static_assert( status::reason( "Bad Request" ) == status::internal_::reason_enum::c_Bad_Request );
+static_assert( status::reason( "Unauthorized" ) == status::internal_::reason_enum::c_Unauthorized );
+static_assert( status::reason( "URI Too Long" ) == status::internal_::reason_enum::c_URI_Too_Long );
+static_assert( status::reason( "Not Modified" ) == status::internal_::reason_enum::c_Not_Modified );
+static_assert( status::reason( "Bad Gateway" ) == status::internal_::reason_enum::c_Bad_Gateway );
+static_assert( status::reason( "Not Acceptable" ) == status::internal_::reason_enum::c_Not_Acceptable );
+static_assert( status::reason( "Not Implemented" ) == status::internal_::reason_enum::c_Not_Implemented );
+static_assert( status::reason( "Request Timeout" ) == status::internal_::reason_enum::c_Request_Timeout );
+static_assert( status::reason( "Partial Content" ) == status::internal_::reason_enum::c_Partial_Content );
+static_assert( status::reason( "Length Required" ) == status::internal_::reason_enum::c_Length_Required );
+static_assert( status::reason( "Gateway Timeout" ) == status::internal_::reason_enum::c_Gateway_Timeout );
+static_assert( status::reason( "Multiple Choices" ) == status::internal_::reason_enum::c_Multiple_Choices );
+static_assert( status::reason( "Moved Permanently" ) == status::internal_::reason_enum::c_Moved_Permanently );
+static_assert( status::reason( "Too Many Requests" ) == status::internal_::reason_enum::c_Too_Many_Requests );
+static_assert( status::reason( "Payload Too Large" ) == status::internal_::reason_enum::c_Payload_Too_Large );
+static_assert( status::reason( "Method Not Allowed" ) == status::internal_::reason_enum::c_Method_Not_Allowed );
+static_assert( status::reason( "Permanent Redirect" ) == status::internal_::reason_enum::c_Permanent_Redirect );
+static_assert( status::reason( "Service Unavailable" ) == status::internal_::reason_enum::c_Service_Unavailable );
+static_assert( status::reason( "Internal Server Error" ) == status::internal_::reason_enum::c_Internal_Server_Error );
+static_assert( status::reason( "Unsupported Media Type" ) == status::internal_::reason_enum::c_Unsupported_Media_Type );
+static_assert( status::reason( "Temporary Redirect" ) == status::internal_::reason_enum::c_Temporary_Redirect );
+static_assert( status::reason( "Switching Protocols" ) == status::internal_::reason_enum::c_Switching_Protocols );
+static_assert( status::reason_value( "OK" ) != nullptr );
+static_assert( status::reason_value( "Gone" ) != nullptr );
+static_assert( status::reason_value( "Found" ) != nullptr );
+static_assert( status::reason_value( "Created" ) != nullptr );
+static_assert( status::reason_value( "Accepted" ) != nullptr );
+static_assert( status::reason_value( "Continue" ) != nullptr );
+static_assert( status::reason_value( "Forbidden" ) != nullptr );
+static_assert( status::reason_value( "Conflict" ) != nullptr );
+static_assert( status::reason_value( "See Other" ) != nullptr );
+static_assert( status::reason_value( "Not Found" ) != nullptr );
+static_assert( status::reason_value( "No Content" ) != nullptr );
+static_assert( status::reason_value( "Bad Request" ) != nullptr );
+static_assert( status::reason_value( "Unauthorized" ) != nullptr );
+static_assert( status::reason_value( "URI Too Long" ) != nullptr );
+static_assert( status::reason_value( "Not Modified" ) != nullptr );
+static_assert( status::reason_value( "Bad Gateway" ) != nullptr );
+static_assert( status::reason_value( "Not Acceptable" ) != nullptr );
+static_assert( status::reason_value( "Not Implemented" ) != nullptr );
+static_assert( status::reason_value( "Request Timeout" ) != nullptr );
+static_assert( status::reason_value( "Partial Content" ) != nullptr );
+static_assert( status::reason_value( "Length Required" ) != nullptr );
+static_assert( status::reason_value( "Gateway Timeout" ) != nullptr );
+static_assert( status::reason_value( "Multiple Choices" ) != nullptr );
+static_assert( status::reason_value( "Moved Permanently" ) != nullptr );
+static_assert( status::reason_value( "Too Many Requests" ) != nullptr );
+static_assert( status::reason_value( "Payload Too Large" ) != nullptr );
+static_assert( status::reason_value( "Method Not Allowed" ) != nullptr );
+static_assert( status::reason_value( "Permanent Redirect" ) != nullptr );
+static_assert( status::reason_value( "Service Unavailable" ) != nullptr );
+static_assert( status::reason_value( "Internal Server Error" ) != nullptr );
+static_assert( status::reason_value( "Unsupported Media Type" ) != nullptr );
+static_assert( status::reason_value( "Temporary Redirect" ) != nullptr );
+static_assert( status::reason_value( "Switching Protocols" ) != nullptr );
+
+#endif // STATUS__REASON_HPP_
@@ -0,0 +1,279 @@
+#ifndef ROUTES__ROUTE_HPP_
+#define ROUTES__ROUTE_HPP_
+
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <string_view>
+
+namespace routes {
+
+namespace internal_ {
+
+enum class route_enum
+{
+    default_ = -1,
+    c__metrics_jvm_memory_used_bytes = 0,
+    c__api_v1_organizations__id_ = 1,
+    c__api_v1_organizations__id__projects__project_id__issues = 2,
+    c__api_v1_users__id__profile = 3,
+    c__metrics_http_server_requests_seconds_count = 4,
+    c__api_v2_users = 5,
+    c__api_v1_users__id__posts__post_id_ = 6,
+    c__health_readiness = 7,
+    c__api_v1_organizations = 8,
+    c__metrics_http_server_requests_seconds_sum = 9,
+    c__api_v2_users__id__settings = 10,
+    c__api_v1_users__id__posts = 11,
+    c__api_v1_organizations__id__projects__project_id_ = 12,
+    c__metrics_http_server_requests_seconds_max = 13,
+    c__api_v1_users__id__settings_privacy = 14,
+    c__api_v1_organizations__id__projects = 15,
+    c__ = 16,
+    c__api_v2_users__id__profile = 17,
+    c__api_v1_organizations__id__members = 18,
+    c__api_v1_users = 19,
+    c__api_v2_users__id_ = 20,
+    c__metrics_http_client_requests_seconds_sum = 21,
+    c__metrics_jvm_memory_committed_bytes = 22,
+    c__api_v2_organizations__id_ = 23,
+    c__api_v1_users__id__posts__post_id__comments = 24,
+    c__metrics_jvm_memory_max_bytes = 25,
+    c__api_v1_users__id__settings = 26,
+    c__api_v2_organizations = 27,
+    c__api_v1_users__id_ = 28,
+    c__api_v1_users__id__posts__post_id__likes = 29,
+    c__api_v1_users__id__following = 30,
+    c__api_v1_users__id__settings_notifications = 31,
+    c__api_v1_organizations__id__members__member_id_ = 32,
+    c__api_v1_organizations__id__projects__project_id__releases = 33,
+    c__api_v2_organizations__id__projects = 34,
+    c__health_liveness = 35,
+    c__health = 36,
+    c__api_v2_organizations__id__members = 37,
+    c__metrics_http_client_requests_seconds_count = 38,
+    c__api_v1_users__id__followers = 39,
+};
+
+} // namespace internal_
+
+// Number of keywords, enum values other than the default are in [ 0, route_count )
+constexpr size_t route_count = 40;
+
+constexpr internal_::route_enum route( std::string_view s );
+
+namespace internal_ {
+
+constexpr uint64_t load_le8( const char *p )
+{
+    return uint64_t( static_cast< unsigned char >( p[ 0 ] ) )
+         | uint64_t( static_cast< unsigned char >( p[ 1 ] ) ) << 8
+         | uint64_t( static_cast< unsigned char >( p[ 2 ] ) ) << 16
+         | uint64_t( static_cast< unsigned char >( p[ 3 ] ) ) << 24
+         | uint64_t( static_cast< unsigned char >( p[ 4 ] ) ) << 32
+         | uint64_t( static_cast< unsigned char >( p[ 5 ] ) ) << 40
+         | uint64_t( static_cast< unsigned char >( p[ 6 ] ) ) << 48
+         | uint64_t( static_cast< unsigned char >( p[ 7 ] ) ) << 56;
+}
+
+constexpr uint64_t mix( uint64_t x )
+{
+    x *= 0xBF58476D1CE4E5B9ull;
+    return x ^ ( x >> 31 );
+}
+
+// Last 8 bytes overlap with the previous ones, instead of a loop for the tail
+constexpr uint64_t full_key_hash( std::string_view s )
+{
+    uint64_t h = 0xE220A8397B1DCDAFull ^ ( s.size() * 0x9E3779B97F4A7C15ull );
+    if ( s.size() < 8 )
+    {
+        uint64_t tail = 0;
+        for ( size_t i = 0; i < s.size(); ++i )
+        {
+            tail |= uint64_t( static_cast< unsigned char >( s[ i ] ) ) << ( i * 8 );
+        }
+        return mix( h ^ tail );
+    }
+
+    for ( size_t i = 0; i + 8 < s.size(); i += 8 )
+    {
+        h = mix( h ^ load_le8( s.data() + i ) );
+    }
+    return mix( h ^ load_le8( s.data() + s.size() - 8 ) );
+}
+
+constexpr std::array< uint8_t, 20 > displacements = {{
+    0, 7, 0, 9, 0, 4, 8, 0, 2, 1, 0, 6, 27, 0, 2, 42,
+    8, 15, 118, 5,
+}};
+
+// High bits of the hash pick a bucket, whose displacement is mixed into the
+// hash again for the slot
+constexpr size_t full_key_slot( std::string_view s )
+{
+    const uint64_t h = full_key_hash( s );
+    const uint64_t bucket = ( ( h >> 32 ) * 20 ) >> 32;
+    const uint64_t x = ( h ^ ( displacements[ bucket ] * 0x9E3779B97F4A7C15ull ) ) * 0xD6E8FEB86659FD93ull;
+    return ( ( x >> 32 ) * 40 ) >> 32;
+}
+
+struct word_entry
+{
+    std::string_view word;
+    route_enum enum_val;
+};
+
+constexpr std::array< word_entry, 40 > wordlist = {{
+    { "/metrics/jvm_memory_used_bytes", route_enum::c__metrics_jvm_memory_used_bytes },
+    { "/api/v1/organizations/{id}", route_enum::c__api_v1_organizations__id_ },
+    { "/api/v1/organizations/{id}/projects/{project_id}/issues", route_enum::c__api_v1_organizations__id__projects__project_id__issues },
+    { "/api/v1/users/{id}/profile", route_enum::c__api_v1_users__id__profile },
+    { "/metrics/http_server_requests_seconds_count", route_enum::c__metrics_http_server_requests_seconds_count },
+    { "/api/v2/users", route_enum::c__api_v2_users },
+    { "/api/v1/users/{id}/posts/{post_id}", route_enum::c__api_v1_users__id__posts__post_id_ },
+    { "/health/readiness", route_enum::c__health_readiness },
+    { "/api/v1/organizations", route_enum::c__api_v1_organizations },
+    { "/metrics/http_server_requests_seconds_sum", route_enum::c__metrics_http_server_requests_seconds_sum },
+    { "/api/v2/users/{id}/settings", route_enum::c__api_v2_users__id__settings },
+    { "/api/v1/users/{id}/posts", route_enum::c__api_v1_users__id__posts },
+    { "/api/v1/organizations/{id}/projects/{project_id}", route_enum::c__api_v1_organizations__id__projects__project_id_ },
+    { "/metrics/http_server_requests_seconds_max", route_enum::c__metrics_http_server_requests_seconds_max },
+    { "/api/v1/users/{id}/settings/privacy", route_enum::c__api_v1_users__id__settings_privacy },
+    { "/api/v1/organizations/{id}/projects", route_enum::c__api_v1_organizations__id__projects },
+    { "/", route_enum::c__ },
+    { "/api/v2/users/{id}/profile", route_enum::c__api_v2_users__id__profile },
+    { "/api/v1/organizations/{id}/members", route_enum::c__api_v1_organizations__id__members },
+    { "/api/v1/users", route_enum::c__api_v1_users },
+    { "/api/v2/users/{id}", route_enum::c__api_v2_users__id_ },
+    { "/metrics/http_client_requests_seconds_sum", route_enum::c__metrics_http_client_requests_seconds_sum },
+    { "/metrics/jvm_memory_committed_bytes", route_enum::c__metrics_jvm_memory_committed_bytes },
+    { "/api/v2/organizations/{id}", route_enum::c__api_v2_organizations__id_ },
+    { "/api/v1/users/{id}/posts/{post_id}/comments", route_enum::c__api_v1_users__id__posts__post_id__comments },
+    { "/metrics/jvm_memory_max_bytes", route_enum::c__metrics_jvm_memory_max_bytes },
+    { "/api/v1/users/{id}/settings", route_enum::c__api_v1_users__id__settings },
+    { "/api/v2/organizations", route_enum::c__api_v2_organizations },
+    { "/api/v1/users/{id}", route_enum::c__api_v1_users__id_ },
+    { "/api/v1/users/{id}/posts/{post_id}/likes", route_enum::c__api_v1_users__id__posts__post_id__likes },
+    { "/api/v1/users/{id}/following", route_enum::c__api_v1_users__id__following },
+    { "/api/v1/users/{id}/settings/notifications", route_enum::c__api_v1_users__id__settings_notifications },
+    { "/api/v1/organizations/{id}/members/{member_id}", route_enum::c__api_v1_organizations__id__members__member_id_ },
+    { "/api/v1/organizations/{id}/projects/{project_id}/releases", route_enum::c__api_v1_organizations__id__projects__project_id__releases },
+    { "/api/v2/organizations/{id}/projects", route_enum::c__api_v2_organizations__id__projects },
+    { "/health/liveness", route_enum::c__health_liveness },
+    { "/health", route_enum::c__health },
+    { "/api/v2/organizations/{id}/members", route_enum::c__api_v2_organizations__id__members },
+    { "/metrics/http_client_requests_seconds_count", route_enum::c__metrics_http_client_requests_seconds_count },
+    { "/api/v1/users/{id}/followers", route_enum::c__api_v1_users__id__followers },
+}};
+
+} // namespace internal_
+
+constexpr internal_::route_enum route( std::string_view s )
+{
+    constexpr size_t MinWordLength = 1;
+    constexpr size_t MaxWordLength = 57;
+
+    if ( s.size() < MinWordLength || s.size() > MaxWordLength )
+    {
+        return internal_::route_enum::default_;
+    }
+
+    const internal_::word_entry &entry = internal_::wordlist[ internal_::full_key_slot( s ) ];
+    return entry.word == s ? entry.enum_val : internal_::route_enum::default_;
+}
+
+// Same as route(), but s must be one of the keywords. Only the hash
+// is computed, s is not verified (except by an assertion in debug builds).
+constexpr internal_::route_enum route_unchecked( std::string_view s )
+{
+    const auto res = internal_::wordlist[ internal_::full_key_slot( s ) ].enum_val;
+    assert( route( s ) == res );
+    return res;
+}
+
+} // namespace routes {
+
+// Extra check for safety
+static_assert( routes::route( "/metrics/jvm_memory_used_bytes" ) == routes::internal_::route_enum::c__metrics_jvm_memory_used_bytes );
+static_assert( routes::route( "/api/v1/organizations/{id}" ) == routes::internal_::route_enum::c__api_v1_organizations__id_ );
+static_assert( routes::route( "/api/v1/organizations/{id}/projects/{project_id}/issues" ) == routes::internal_::route_enum::c__api_v1_organizations__id__projects__project_id__issues );
+static_assert( routes::route( "/api/v1/users/{id}/profile" ) == routes::internal_::route_enum::c__api_v1_users__id__profile );
+static_assert( routes::route( "/metrics/http_server_requests_seconds_count" ) == routes::internal_::route_enum::c__metrics_http_server_requests_seconds_count );
+static_assert( routes::route( "/api/v2/users" ) == routes::internal_::route_enum::c__api_v2_users );
+static_assert( routes::route( "/api/v1/users/{id}/posts/{post_id}" ) == routes::internal_::route_enum::c__api_v1_users__id__posts__post_id_ );
+static_assert( routes::route( "/health/readiness" ) == routes::internal_::route_enum::c__health_readiness );
+static_assert( routes::route( "/api/v1/organizations" ) == routes::internal_::route_enum::c__api_v1_organizations );
+static_assert( routes::route( "/metrics/http_server_requests_seconds_sum" ) == routes::internal_::route_enum::c__metrics_http_server_requests_seconds_sum );
+static_assert( routes::route( "/api/v2/users/{id}/settings" ) == routes::internal_::route_enum::c__api_v2_users__id__settings );
+static_assert( routes::route( "/api/v1/users/{id}/posts" ) == routes::internal_::route_enum::c__api_v1_users__id__posts );
+static_assert( routes::route( "/api/v1/organizations/{id}/projects/{project_id}" ) == routes::internal_::route_enum::c__api_v1_organizations__id__projects__project_id_ );
+static_assert( routes::route( "/metrics/http_server_requests_seconds_max" ) == routes::internal_::route_enum::c__metrics_http_server_requests_seconds_max );
+static_assert( routes::route( "/api/v1/users/{id}/settings/privacy" ) == routes::internal_::route_enum::c__api_v1_users__id__settings_privacy );
+static_assert( routes::route( "/api/v1/organizations/{id}/projects" ) == routes::internal_::route_enum::c__api_v1_organizations__id__projects );
+static_assert( routes::route( "/" ) == routes::internal_::route_enum::c__ );
+static_assert( routes::route( "/api/v2/users/{id}/profile" ) == routes::internal_::route_enum::c__api_v2_users__id__profile );
+static_assert( routes::route( "/api/v1/organizations/{id}/members" ) == routes::internal_::route_enum::c__api_v1_organizations__id__members );
+static_assert( routes::route( "/api/v1/users" ) == routes::internal_::route_enum::c__api_v1_users );
+static_assert( routes::route( "/api/v2/users/{id}" ) == routes::internal_::route_enum::c__api_v2_users__id_ );
+static_assert( routes::route( "/metrics/http_client_requests_seconds_sum" ) == routes::internal_::route_enum::c__metrics_http_client_requests_seconds_sum );
+static_assert( routes::route( "/metrics/jvm_memory_committed_bytes" ) == routes::internal_::route_enum::c__metrics_jvm_memory_committed_bytes );
+static_assert( routes::route( "/api/v2/organizations/{id}" ) == routes::internal_::route_enum::c__api_v2_organizations__id_ );
+static_assert( routes::route( "/api/v1/users/{id}/posts/{post_id}/comments" ) == routes::internal_::route_enum::c__api_v1_users__id__posts__post_id__comments );
+static_assert( routes::route( "/metrics/jvm_memory_max_bytes" ) == routes::internal_::route_enum::c__metrics_jvm_memory_max_bytes );
+static_assert( routes::route( "/api/v1/users/{id}/settings" ) == routes::internal_::route_enum::c__api_v1_users__id__settings );
+static_assert( routes::route( "/api/v2/organizations" ) == routes::internal_::route_enum::c__api_v2_organizations );
+static_assert( routes::route( "/api/v1/users/{id}" ) == routes::internal_::route_enum::c__api_v1_users__id_ );
+static_assert( routes::route( "/api/v1/users/{id}/posts/{post_id}/likes" ) == routes::internal_::route_enum::c__api_v1_users__id__posts__post_id__likes );
+static_assert( routes::route( "/api/v1/users/{id}/following" ) == routes::internal_::route_enum::c__api_v1_users__id__following );
+static_assert( routes::route( "/api/v1/users/{id}/settings/notifications" ) == routes::internal_::route_enum::c__api_v1_users__id__settings_notifications );
+static_assert( routes::route( "/api/v1/organizations/{id}/members/{member_id}" ) == routes::internal_::route_enum::c__api_v1_organizations__id__members__member_id_ );
+static_assert( routes::route( "/api/v1/organizations/{id}/projects/{project_id}/releases" ) == routes::internal_::route_enum::c__api_v1_organizations__id__projects__project_id__releases );
+static_assert( routes::route( "/api/v2/organizations/{id}/projects" ) == routes::internal_::route_enum::c__api_v2_organizations__id__projects );
+static_assert( routes::route( "/health/liveness" ) == routes::internal_::route_enum::c__health_liveness );
+static_assert( routes::route( "/health" ) == routes::internal_::route_enum::c__health );
+static_assert( routes::route( "/api/v2/organizations/{id}/members" ) == routes::internal_::route_enum::c__api_v2_organizations__id__members );
+static_assert( routes::route( "/metrics/http_client_requests_seconds_count" ) == routes::internal_::route_enum::c__metrics_http_client_requests_seconds_count );
+static_assert( routes::route( "/api/v1/users/{id}/followers" ) == routes::internal_::route_enum::c__api_v1_users__id__followers );
+static_assert( routes::route_unchecked( "/metrics/jvm_memory_used_bytes" ) == routes::internal_::route_enum::c__metrics_jvm_memory_used_bytes );
+static_assert( routes::route_unchecked( "/api/v1/organizations/{id}" ) == routes::internal_::route_enum::c__api_v1_organizations__id_ );
+static_assert( routes::route_unchecked( "/api/v1/organizations/{id}/projects/{project_id}/issues" ) == routes::internal_::route_enum::c__api_v1_organizations__id__projects__project_id__issues );
+static_assert( routes::route_unchecked( "/api/v1/users/{id}/profile" ) == routes::internal_::route_enum::c__api_v1_users__id__profile );
+static_assert( routes::route_unchecked( "/metrics/http_server_requests_seconds_count" ) == routes::internal_::route_enum::c__metrics_http_server_requests_seconds_count );
+static_assert( routes::route_unchecked( "/api/v2/users" ) == routes::internal_::route_enum::c__api_v2_users );
+static_assert( routes::route_unchecked( "/api/v1/users/{id}/posts/{post_id}" ) == routes::internal_::route_enum::c__api_v1_users__id__posts__post_id_ );
+static_assert( routes::route_unchecked( "/health/readiness" ) == routes::internal_::route_enum::c__health_readiness );
+static_assert( routes::route_unchecked( "/api/v1/organizations" ) == routes::internal_::route_enum::c__api_v1_organizations );
+static_assert( routes::route_unchecked( "/metrics/http_server_requests_seconds_sum" ) == routes::internal_::route_enum::c__metrics_http_server_requests_seconds_sum );
+static_assert( routes::route_unchecked( "/api/v2/users/{id}/settings" ) == routes::internal_::route_enum::c__api_v2_users__id__settings );
+static_assert( routes::route_unchecked( "/api/v1/users/{id}/posts" ) == routes::internal_::route_enum::c__api_v1_users__id__posts );
+static_assert( routes::route_unchecked( "/api/v1/organizations/{id}/projects/{project_id}" ) == routes::internal_::route_enum::c__api_v1_organizations__id__projects__project_id_ );
+static_assert( routes::route_unchecked( "/metrics/http_server_requests_seconds_max" ) == routes::internal_::route_enum::c__metrics_http_server_requests_seconds_max );
+static_assert( routes::route_unchecked( "/api/v1/users/{id}/settings/privacy" ) == routes::internal_::route_enum::c__api_v1_users__id__settings_privacy );
+static_assert( routes::route_unchecked( "/api/v1/organizations/{id}/projects" ) == routes::internal_::route_enum::c__api_v1_organizations__id__projects );
+static_assert( routes::route_unchecked( "/" ) == routes::internal_::route_enum::c__ );
+static_assert( routes::route_unchecked( "/api/v2/users/{id}/profile" ) == routes::internal_::route_enum::c__api_v2_users__id__profile );
+static_assert( routes::route_unchecked( "/api/v1/organizations/{id}/members" ) == routes::internal_::route_enum::c__api_v1_organizations__id__members );
+static_assert( routes::route_unchecked( "/api/v1/users" ) == routes::internal_::route_enum::c__api_v1_users );
+static_assert( routes::route_unchecked( "/api/v2/users/{id}" ) == routes::internal_::route_enum::c__api_v2_users__id_ );
+static_assert( routes::route_unchecked( "/metrics/http_client_requests_seconds_sum" ) == routes::internal_::route_enum::c__metrics_http_client_requests_seconds_sum );
+static_assert( routes::route_unchecked( "/metrics/jvm_memory_committed_bytes" ) == routes::internal_::route_enum::c__metrics_jvm_memory_committed_bytes );
+static_assert( routes::route_unchecked( "/api/v2/organizations/{id}" ) == routes::internal_::route_enum::c__api_v2_organizations__id_ );
+static_assert( routes::route_unchecked( "/api/v1/users/{id}/posts/{post_id}/comments" ) == routes::internal_::route_enum::c__api_v1_users__id__posts__post_id__comments );
+static_assert( routes::route_unchecked( "/metrics/jvm_memory_max_bytes" ) == routes::internal_::route_enum::c__metrics_jvm_memory_max_bytes );
+static_assert( routes::route_unchecked( "/api/v1/users/{id}/settings" ) == routes::internal_::route_enum::c__api_v1_users__id__settings );
+static_assert( routes::route_unchecked( "/api/v2/organizations" ) == routes::internal_::route_enum::c__api_v2_organizations );
+static_assert( routes::route_unchecked( "/api/v1/users/{id}" ) == routes::internal_::route_enum::c__api_v1_users__id_ );
+static_assert( routes::route_unchecked( "/api/v1/users/{id}/posts/{post_id}/likes" ) == routes::internal_::route_enum::c__api_v1_users__id__posts__post_id__likes );
+static_assert( routes::route_unchecked( "/api/v1/users/{id}/following" ) == routes::internal_::route_enum::c__api_v1_users__id__following );
+static_assert( routes::route_unchecked( "/api/v1/users/{id}/settings/notifications" ) == routes::internal_::route_enum::c__api_v1_users__id__settings_notifications );
+static_assert( routes::route_unchecked( "/api/v1/organizations/{id}/members/{member_id}" ) == routes::internal_::route_enum::c__api_v1_organizations__id__members__member_id_ );
+static_assert( routes::route_unchecked( "/api/v1/organizations/{id}/projects/{project_id}/releases" ) == routes::internal_::route_enum::c__api_v1_organizations__id__projects__project_id__releases );
+static_assert( routes::route_unchecked( "/api/v2/organizations/{id}/projects" ) == routes::internal_::route_enum::c__api_v2_organizations__id__projects );
+static_assert( routes::route_unchecked( "/health/liveness" ) == routes::internal_::route_enum::c__health_liveness );
+static_assert( routes::route_unchecked( "/health" ) == routes::internal_::route_enum::c__health );
+static_assert( routes::route_unchecked( "/api/v2/organizations/{id}/members" ) == routes::internal_::route_enum::c__api_v2_organizations__id__members );
+static_assert( routes::route_unchecked( "/metrics/http_client_requests_seconds_count" ) == routes::internal_::route_enum::c__metrics_http_client_requests_seconds_count );
+static_assert( routes::route_unchecked( "/api/v1/users/{id}/followers" ) == routes::internal_::route_enum::c__api_v1_users__id__followers );
+
+#endif // ROUTES__ROUTE_HPP_
@@ -0,0 +1,439 @@
+#ifndef SCAN__HASH_HPP_
+#define SCAN__HASH_HPP_
+
+#include <array>
+#include <string_view>
+
+#if defined( __SSE2__ )
+#include <emmintrin.h>
+#endif
+
+namespace scan {
+
+namespace internal_ {
+
+enum class hash_enum
+{
+    default_ = -1,
+    c_Age = 0,
+    c_Allow = 1,
+    c_Cookie = 2,
+    c_Accept = 3,
+    c_Connection = 4,
+    c_Content_Type = 5,
+    c_Content_Range = 6,
+    c_Authorization = 7,
+    c_Accept_Language = 8,
+    c_Content_Language = 9,
+    c_Content_Location = 10,
+    c_Accept_Charset = 11,
+    c_Accept_Ranges = 12,
+    c_Content_Disposition = 13,
+    c_Cache_Control = 14,
+    c_Access_Control_Max_Age = 15,
+    c_Accept_Encoding = 16,
+    c_Content_Encoding = 17,
+    c_Expect = 18,
+    c_TE = 19,
+    c_ETag = 20,
+    c_Expires = 21,
+    c_Timing_Allow_Origin = 22,
+    c_Set_Cookie = 23,
+    c_Range = 24,
+    c_X_XSS_Protection = 25,
+    c_Expect_CT = 26,
+    c_Transfer_Encoding = 27,
+    c_X_Forwarded_Host = 28,
+    c_X_Frame_Options = 29,
+    c_Trailer = 30,
+    c_Access_Control_Allow_Credentials = 31,
+    c_If_Range = 32,
+    c_Access_Control_Request_Headers = 33,
+    c_Server_Timing = 34,
+    c_Referrer_Policy = 35,
+    c_Proxy_Authenticate = 36,
+    c_Sec_WebSocket_Accept = 37,
+    c_Proxy_Authorization = 38,
+    c_Public_Key_Pins = 39,
+    c_Server = 40,
+    c_If_Modified_Since = 41,
+    c_X_Content_Type_Options = 42,
+    c_If_Unmodified_Since = 43,
+    c_X_Forwarded_For = 44,
+    c_Content_Length = 45,
+    c_X_DNS_Prefetch_Control = 46,
+    c_Referer = 47,
+    c_Location = 48,
+    c_Clear_Site_Data = 49,
+    c_Public_Key_Pins_Report_Only = 50,
+    c_Retry_After = 51,
+    c_Access_Control_Request_Method = 52,
+    c_Vary = 53,
+    c_Content_Security_Policy = 54,
+    c_User_Agent = 55,
+    c_Large_Allocation = 56,
+    c_Warning = 57,
+    c_WWW_Authenticate = 58,
+    c_Origin = 59,
+    c_Strict_Transport_Security = 60,
+    c_Host = 61,
+    c_Feature_Policy = 62,
+    c_Date = 63,
+    c_Cookie2 = 64,
+    c_Pragma = 65,
+    c_Content_Security_Policy_Report_Only = 66,
+    c_SourceMap = 67,
+    c_X_Forwarded_Proto = 68,
+    c_From = 69,
+    c_If_Match = 70,
+    c_DNT = 71,
+    c_Upgrade_Insecure_Requests = 72,
+    c_Tk = 73,
+    c_Access_Control_Allow_Methods = 74,
+    c_If_None_Match = 75,
+    c_Keep_Alive = 76,
+    c_Access_Control_Expose_Headers = 77,
+    c_Last_Modified = 78,
+    c_Access_Control_Allow_Origin = 79,
+    c_Forwarded = 80,
+    c_Access_Control_Allow_Headers = 81,
+    c_Set_Cookie2 = 82,
+    c_Via = 83,
+};
+
+} // namespace internal_
+
+// Number of keywords, enum values other than the default are in [ 0, hash_count )
+constexpr size_t hash_count = 84;
+
+constexpr internal_::hash_enum hash( std::string_view s );
+
+namespace internal_ {
+
+constexpr std::array< int, 256 > asso_values = {
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,    49,   100,   100,   100,   100,
+        64,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,     0,   100,     0,    66,    15,
+        54,   100,    60,    31,   100,    73,    46,    47,   100,    59,
+        25,   100,    26,    20,     9,    48,    55,    49,    15,   100,
+       100,   100,   100,   100,   100,   100,   100,    41,   100,    37,
+        26,     0,   100,     8,    38,   100,   100,    69,     8,    18,
+         1,    43,    45,   100,    21,     6,     4,   100,   100,     0,
+       100,     1,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,   100,   100,   100,   100,
+       100,   100,   100,   100,   100,   100,
+};
+
+struct word_entry
+{
+    std::string_view word;
+    hash_enum enum_val;
+};
+
+constexpr std::array< word_entry, 100 > wordlist = {{
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "Age", hash_enum::c_Age },
+    { "", hash_enum::default_ },
+    { "Allow", hash_enum::c_Allow },
+    { "Cookie", hash_enum::c_Cookie },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "Accept", hash_enum::c_Accept },
+    { "Connection", hash_enum::c_Connection },
+    { "Content-Type", hash_enum::c_Content_Type },
+    { "Content-Range", hash_enum::c_Content_Range },
+    { "Authorization", hash_enum::c_Authorization },
+    { "Accept-Language", hash_enum::c_Accept_Language },
+    { "Content-Language", hash_enum::c_Content_Language },
+    { "Content-Location", hash_enum::c_Content_Location },
+    { "Accept-Charset", hash_enum::c_Accept_Charset },
+    { "Accept-Ranges", hash_enum::c_Accept_Ranges },
+    { "Content-Disposition", hash_enum::c_Content_Disposition },
+    { "Cache-Control", hash_enum::c_Cache_Control },
+    { "Access-Control-Max-Age", hash_enum::c_Access_Control_Max_Age },
+    { "Accept-Encoding", hash_enum::c_Accept_Encoding },
+    { "Content-Encoding", hash_enum::c_Content_Encoding },
+    { "Expect", hash_enum::c_Expect },
+    { "TE", hash_enum::c_TE },
+    { "ETag", hash_enum::c_ETag },
+    { "Expires", hash_enum::c_Expires },
+    { "Timing-Allow-Origin", hash_enum::c_Timing_Allow_Origin },
+    { "Set-Cookie", hash_enum::c_Set_Cookie },
+    { "Range", hash_enum::c_Range },
+    { "X-XSS-Protection", hash_enum::c_X_XSS_Protection },
+    { "Expect-CT", hash_enum::c_Expect_CT },
+    { "Transfer-Encoding", hash_enum::c_Transfer_Encoding },
+    { "X-Forwarded-Host", hash_enum::c_X_Forwarded_Host },
+    { "X-Frame-Options", hash_enum::c_X_Frame_Options },
+    { "Trailer", hash_enum::c_Trailer },
+    { "Access-Control-Allow-Credentials", hash_enum::c_Access_Control_Allow_Credentials },
+    { "If-Range", hash_enum::c_If_Range },
+    { "Access-Control-Request-Headers", hash_enum::c_Access_Control_Request_Headers },
+    { "Server-Timing", hash_enum::c_Server_Timing },
+    { "Referrer-Policy", hash_enum::c_Referrer_Policy },
+    { "Proxy-Authenticate", hash_enum::c_Proxy_Authenticate },
+    { "Sec-WebSocket-Accept", hash_enum::c_Sec_WebSocket_Accept },
+    { "Proxy-Authorization", hash_enum::c_Proxy_Authorization },
+    { "Public-Key-Pins", hash_enum::c_Public_Key_Pins },
+    { "Server", hash_enum::c_Server },
+    { "If-Modified-Since", hash_enum::c_If_Modified_Since },
+    { "X-Content-Type-Options", hash_enum::c_X_Content_Type_Options },
+    { "If-Unmodified-Since", hash_enum::c_If_Unmodified_Since },
+    { "X-Forwarded-For", hash_enum::c_X_Forwarded_For },
+    { "Content-Length", hash_enum::c_Content_Length },
+    { "X-DNS-Prefetch-Control", hash_enum::c_X_DNS_Prefetch_Control },
+    { "Referer", hash_enum::c_Referer },
+    { "Location", hash_enum::c_Location },
+    { "Clear-Site-Data", hash_enum::c_Clear_Site_Data },
+    { "Public-Key-Pins-Report-Only", hash_enum::c_Public_Key_Pins_Report_Only },
+    { "Retry-After", hash_enum::c_Retry_After },
+    { "Access-Control-Request-Method", hash_enum::c_Access_Control_Request_Method },
+    { "Vary", hash_enum::c_Vary },
+    { "Content-Security-Policy", hash_enum::c_Content_Security_Policy },
+    { "User-Agent", hash_enum::c_User_Agent },
+    { "Large-Allocation", hash_enum::c_Large_Allocation },
+    { "Warning", hash_enum::c_Warning },
+    { "WWW-Authenticate", hash_enum::c_WWW_Authenticate },
+    { "Origin", hash_enum::c_Origin },
+    { "Strict-Transport-Security", hash_enum::c_Strict_Transport_Security },
+    { "Host", hash_enum::c_Host },
+    { "Feature-Policy", hash_enum::c_Feature_Policy },
+    { "Date", hash_enum::c_Date },
+    { "Cookie2", hash_enum::c_Cookie2 },
+    { "Pragma", hash_enum::c_Pragma },
+    { "Content-Security-Policy-Report-Only", hash_enum::c_Content_Security_Policy_Report_Only },
+    { "SourceMap", hash_enum::c_SourceMap },
+    { "X-Forwarded-Proto", hash_enum::c_X_Forwarded_Proto },
+    { "From", hash_enum::c_From },
+    { "If-Match", hash_enum::c_If_Match },
+    { "DNT", hash_enum::c_DNT },
+    { "Upgrade-Insecure-Requests", hash_enum::c_Upgrade_Insecure_Requests },
+    { "Tk", hash_enum::c_Tk },
+    { "Access-Control-Allow-Methods", hash_enum::c_Access_Control_Allow_Methods },
+    { "If-None-Match", hash_enum::c_If_None_Match },
+    { "Keep-Alive", hash_enum::c_Keep_Alive },
+    { "Access-Control-Expose-Headers", hash_enum::c_Access_Control_Expose_Headers },
+    { "Last-Modified", hash_enum::c_Last_Modified },
+    { "", hash_enum::default_ },
+    { "Access-Control-Allow-Origin", hash_enum::c_Access_Control_Allow_Origin },
+    { "", hash_enum::default_ },
+    { "Forwarded", hash_enum::c_Forwarded },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "Access-Control-Allow-Headers", hash_enum::c_Access_Control_Allow_Headers },
+    { "Set-Cookie2", hash_enum::c_Set_Cookie2 },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "", hash_enum::default_ },
+    { "Via", hash_enum::c_Via },
+}};
+
+} // namespace internal_
+
+constexpr internal_::hash_enum hash( std::string_view s )
+{
+    constexpr size_t MinWordLength = 2;
+    constexpr size_t MaxWordLength = 35;
+    constexpr size_t MaxHashValue = 99;
+
+    if ( s.size() < MinWordLength || s.size() > MaxWordLength )
+    {
+        return internal_::hash_enum::default_;
+    }
+
+    size_t hash_val = s.size();
+    hash_val += internal_::asso_values[ static_cast< unsigned char >( s[ s.size() - 1 ] ) ];
+    switch( s.size() )
+    {
+                       case 35:
+    [[ fallthrough ]]; case 34:
+    [[ fallthrough ]]; case 33:
+    [[ fallthrough ]]; case 32:
+    [[ fallthrough ]]; case 31:
+    [[ fallthrough ]]; case 30:
+    [[ fallthrough ]]; case 29:
+    [[ fallthrough ]]; case 28:
+    [[ fallthrough ]]; case 27:
+    [[ fallthrough ]]; case 26:
+    [[ fallthrough ]]; case 25:
+    [[ fallthrough ]]; case 24:
+    [[ fallthrough ]]; case 23:
+    [[ fallthrough ]]; case 22:
+        hash_val += internal_::asso_values[ static_cast< unsigned char >( s[ 21] ) ];
+    [[ fallthrough ]]; case 21:
+    [[ fallthrough ]]; case 20:
+    [[ fallthrough ]]; case 19:
+    [[ fallthrough ]]; case 18:
+    [[ fallthrough ]]; case 17:
+    [[ fallthrough ]]; case 16:
+    [[ fallthrough ]]; case 15:
+    [[ fallthrough ]]; case 14:
+    [[ fallthrough ]]; case 13:
+    [[ fallthrough ]]; case 12:
+    [[ fallthrough ]]; case 11:
+    [[ fallthrough ]]; case 10:
+    [[ fallthrough ]]; case 9:
+    [[ fallthrough ]]; case 8:
+    [[ fallthrough ]]; case 7:
+    [[ fallthrough ]]; case 6:
+    [[ fallthrough ]]; case 5:
+    [[ fallthrough ]]; case 4:
+    [[ fallthrough ]]; case 3:
+    [[ fallthrough ]]; case 2:
+    [[ fallthrough ]]; case 1:
+        hash_val += internal_::asso_values[ static_cast< unsigned char >( s[ 0] ) ];
+    }
+
+    if ( hash_val <= MaxHashValue )
+    {
+        const size_t slot = hash_val;
+        if ( internal_::wordlist[ slot ].word == s )
+        {
+            return internal_::wordlist[ slot ].enum_val;
+        }
+    }
+    return internal_::hash_enum::default_;
+}
+
+struct hash_scan_result
+{
+    internal_::hash_enum value;
+    const char *stop; // First delimiter, end if there is none
+};
+
+// Looks up [ p, stop ), stop being the first delim in [ p, end ). Saves a
+// separate search for the delimiter when parsing `key<delim>value` input.
+inline hash_scan_result hash_scan( const char *p, const char *end, char delim )
+{
+    const char *stop = p;
+
+#if defined( __SSE2__ )
+    const __m128i pattern = _mm_set1_epi8( delim );
+    for ( ; end - stop >= 16; stop += 16 )
+    {
+        const __m128i chunk = _mm_loadu_si128( reinterpret_cast< const __m128i* >( stop ) );
+        const int mask = _mm_movemask_epi8( _mm_cmpeq_epi8( chunk, pattern ) );
+        if ( mask )
+        {
+            stop += __builtin_ctz( mask );
+            return { hash( std::string_view( p, stop - p ) ), stop };
+        }
+    }
+#endif
+
+    while ( stop != end && *stop != delim )
+    {
+        ++stop;
+    }
+    return { hash( std::string_view( p, stop - p ) ), stop };
+}
+
+} // namespace scan {
+
+// Extra check for safety
+static_assert( scan::hash( "Age" ) == scan::internal_::hash_enum::c_Age );
+static_assert( scan::hash( "Allow" ) == scan::internal_::hash_enum::c_Allow );
+static_assert( scan::hash( "Cookie" ) == scan::internal_::hash_enum::c_Cookie );
+static_assert( scan::hash( "Accept" ) == scan::internal_::hash_enum::c_Accept );
+static_assert( scan::hash( "Connection" ) == scan::internal_::hash_enum::c_Connection );
+static_assert( scan::hash( "Content-Type" ) == scan::internal_::hash_enum::c_Content_Type );
+static_assert( scan::hash( "Content-Range" ) == scan::internal_::hash_enum::c_Content_Range );
+static_assert( scan::hash( "Authorization" ) == scan::internal_::hash_enum::c_Authorization );
+static_assert( scan::hash( "Accept-Language" ) == scan::internal_::hash_enum::c_Accept_Language );
+static_assert( scan::hash( "Content-Language" ) == scan::internal_::hash_enum::c_Content_Language );
+static_assert( scan::hash( "Content-Location" ) == scan::internal_::hash_enum::c_Content_Location );
+static_assert( scan::hash( "Accept-Charset" ) == scan::internal_::hash_enum::c_Accept_Charset );
+static_assert( scan::hash( "Accept-Ranges" ) == scan::internal_::hash_enum::c_Accept_Ranges );
+static_assert( scan::hash( "Content-Disposition" ) == scan::internal_::hash_enum::c_Content_Disposition );
+static_assert( scan::hash( "Cache-Control" ) == scan::internal_::hash_enum::c_Cache_Control );
+static_assert( scan::hash( "Access-Control-Max-Age" ) == scan::internal_::hash_enum::c_Access_Control_Max_Age );
+static_assert( scan::hash( "Accept-Encoding" ) == scan::internal_::hash_enum::c_Accept_Encoding );
+static_assert( scan::hash( "Content-Encoding" ) == scan::internal_::hash_enum::c_Content_Encoding );
+static_assert( scan::hash( "Expect" ) == scan::internal_::hash_enum::c_Expect );
+static_assert( scan::hash( "TE" ) == scan::internal_::hash_enum::c_TE );
+static_assert( scan::hash( "ETag" ) == scan::internal_::hash_enum::c_ETag );
+static_assert( scan::hash( "Expires" ) == scan::internal_::hash_enum::c_Expires );
+static_assert( scan::hash( "Timing-Allow-Origin" ) == scan::internal_::hash_enum::c_Timing_Allow_Origin );
+static_assert( scan::hash( "Set-Cookie" ) == scan::internal_::hash_enum::c_Set_Cookie );
+static_assert( scan::hash( "Range" ) == scan::internal_::hash_enum::c_Range );
+static_assert( scan::hash( "X-XSS-Protection" ) == scan::internal_::hash_enum::c_X_XSS_Protection );
+static_assert( scan::hash( "Expect-CT" ) == scan::internal_::hash_enum::c_Expect_CT );
+static_assert( scan::hash( "Transfer-Encoding" ) == scan::internal_::hash_enum::c_Transfer_Encoding );
+static_assert( scan::hash( "X-Forwarded-Host" ) == scan::internal_::hash_enum::c_X_Forwarded_Host );
+static_assert( scan::hash( "X-Frame-Options" ) == scan::internal_::hash_enum::c_X_Frame_Options );
+static_assert( scan::hash( "Trailer" ) == scan::internal_::hash_enum::c_Trailer );
+static_assert( scan::hash( "Access-Control-Allow-Credentials" ) == scan::internal_::hash_enum::c_Access_Control_Allow_Credentials );
+static_assert( scan::hash( "If-Range" ) == scan::internal_::hash_enum::c_If_Range );
+static_assert( scan::hash( "Access-Control-Request-Headers" ) == scan::internal_::hash_enum::c_Access_Control_Request_Headers );
+static_assert( scan::hash( "Server-Timing" ) == scan::internal_::hash_enum::c_Server_Timing );
+static_assert( scan::hash( "Referrer-Policy" ) == scan::internal_::hash_enum::c_Referrer_Policy );
+static_assert( scan::hash( "Proxy-Authenticate" ) == scan::internal_::hash_enum::c_Proxy_Authenticate );
+static_assert( scan::hash( "Sec-WebSocket-Accept" ) == scan::internal_::hash_enum::c_Sec_WebSocket_Accept );
+static_assert( scan::hash( "Proxy-Authorization" ) == scan::internal_::hash_enum::c_Proxy_Authorization );
+static_assert( scan::hash( "Public-Key-Pins" ) == scan::internal_::hash_enum::c_Public_Key_Pins );
+static_assert( scan::hash( "Server" ) == scan::internal_::hash_enum::c_Server );
+static_assert( scan::hash( "If-Modified-Since" ) == scan::internal_::hash_enum::c_If_Modified_Since );
+static_assert( scan::hash( "X-Content-Type-Options" ) == scan::internal_::hash_enum::c_X_Content_Type_Options );
+static_assert( scan::hash( "If-Unmodified-Since" ) == scan::internal_::hash_enum::c_If_Unmodified_Since );
+static_assert( scan::hash( "X-Forwarded-For" ) == scan::internal_::hash_enum::c_X_Forwarded_For );
+static_assert( scan::hash( "Content-Length" ) == scan::internal_::hash_enum::c_Content_Length );
+static_assert( scan::hash( "X-DNS-Prefetch-Control" ) == scan::internal_::hash_enum::c_X_DNS_Prefetch_Control );
+static_assert( scan::hash( "Referer" ) == scan::internal_::hash_enum::c_Referer );
+static_assert( scan::hash( "Location" ) == scan::internal_::hash_enum::c_Location );
+static_assert( scan::hash( "Clear-Site-Data" ) == scan::internal_::hash_enum::c_Clear_Site_Data );
+static_assert( scan::hash( "Public-Key-Pins-Report-Only" ) == scan::internal_::hash_enum::c_Public_Key_Pins_Report_Only );
+static_assert( scan::hash( "Retry-After" ) == scan::internal_::hash_enum::c_Retry_After );
+static_assert( scan::hash( "Access-Control-Request-Method" ) == scan::internal_::hash_enum::c_Access_Control_Request_Method );
+static_assert( scan::hash( "Vary" ) == scan::internal_::hash_enum::c_Vary );
+static_assert( scan::hash( "Content-Security-Policy" ) == scan::internal_::hash_enum::c_Content_Security_Policy );
+static_assert( scan::hash( "User-Agent" ) == scan::internal_::hash_enum::c_User_Agent );
+static_assert( scan::hash( "Large-Allocation" ) == scan::internal_::hash_enum::c_Large_Allocation );
+static_assert( scan::hash( "Warning" ) == scan::internal_::hash_enum::c_Warning );
+static_assert( scan::hash( "WWW-Authenticate" ) == scan::internal_::hash_enum::c_WWW_Authenticate );
+static_assert( scan::hash( "Origin" ) == scan::internal_::hash_enum::c_Origin );
+static_assert( scan::hash( "Strict-Transport-Security" ) == scan::internal_::hash_enum::c_Strict_Transport_Security );
+static_assert( scan::hash( "Host" ) == scan::internal_::hash_enum::c_Host );
+static_assert( scan::hash( "Feature-Policy" ) == scan::internal_::hash_enum::c_Feature_Policy );
+static_assert( scan::hash( "Date" ) == scan::internal_::hash_enum::c_Date );
+static_assert( scan::hash( "Cookie2" ) == scan::internal_::hash_enum::c_Cookie2 );
+static_assert( scan::hash( "Pragma" ) == scan::internal_::hash_enum::c_Pragma );
+static_assert( scan::hash( "Content-Security-Policy-Report-Only" ) == scan::internal_::hash_enum::c_Content_Security_Policy_Report_Only );
+static_assert( scan::hash( "SourceMap" ) == scan::internal_::hash_enum::c_SourceMap );
+static_assert( scan::hash( "X-Forwarded-Proto" ) == scan::internal_::hash_enum::c_X_Forwarded_Proto );
+static_assert( scan::hash( "From" ) == scan::internal_::hash_enum::c_From );
+static_assert( scan::hash( "If-Match" ) == scan::internal_::hash_enum::c_If_Match );
+static_assert( scan::hash( "DNT" ) == scan::internal_::hash_enum::c_DNT );
+static_assert( scan::hash( "Upgrade-Insecure-Requests" ) == scan::internal_::hash_enum::c_Upgrade_Insecure_Requests );
+static_assert( scan::hash( "Tk" ) == scan::internal_::hash_enum::c_Tk );
+static_assert( scan::hash( "Access-Control-Allow-Methods" ) == scan::internal_::hash_enum::c_Access_Control_Allow_Methods );
+static_assert( scan::hash( "If-None-Match" ) == scan::internal_::hash_enum::c_If_None_Match );
+static_assert( scan::hash( "Keep-Alive" ) == scan::internal_::hash_enum::c_Keep_Alive );
+static_assert( scan::hash( "Access-Control-Expose-Headers" ) == scan::internal_::hash_enum::c_Access_Control_Expose_Headers );
+static_assert( scan::hash( "Last-Modified" ) == scan::internal_::hash_enum::c_Last_Modified );
+static_assert( scan::hash( "Access-Control-Allow-Origin" ) == scan::internal_::hash_enum::c_Access_Control_Allow_Origin );
+static_assert( scan::hash( "Forwarded" ) == scan::internal_::hash_enum::c_Forwarded );
+static_assert( scan::hash( "Access-Control-Allow-Headers" ) == scan::internal_::hash_enum::c_Access_Control_Allow_Headers );
+static_assert( scan::hash( "Set-Cookie2" ) == scan::internal_::hash_enum::c_Set_Cookie2 );
+static_assert( scan::hash( "Via" ) == scan::internal_::hash_enum::c_Via );
+
+#endif // SCAN__HASH_HPP_
@@ -0,0 +1,147 @@
+#ifndef SIMD__LOOKUP_HPP_
+#define SIMD__LOOKUP_HPP_
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+#if defined( __GNUC__ ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+#include <immintrin.h>
+#endif
+
+#if defined( __SSE2__ )
+#include <emmintrin.h>
+#endif
+
+namespace simd {
+
+namespace internal_ {
+
+enum class lookup_enum
+{
+    default_ = -1,
+    c_GET = 0,
+    c_HEAD = 1,
+    c_POST = 2,
+    c_PUT = 3,
+    c_DELETE = 4,
+    c_CONNECT = 5,
+    c_OPTIONS = 6,
+    c_TRACE = 7,
+    c_PATCH = 8,
+};
+
+} // namespace internal_
+
+// Number of keywords, enum values other than the default are in [ 0, lookup_count )
+constexpr size_t lookup_count = 9;
+
+constexpr internal_::lookup_enum lookup( std::string_view s );
+
+namespace internal_ {
+
+// Byte j of key k is key_columns[ j ][ k ], zero past its end.
+// Unused lanes have a size no input matches.
+alignas( 32 ) constexpr std::array< std::array< uint8_t, 16 >, 7 > key_columns = {{
+    {{ 71, 72, 80, 80, 68, 67, 79, 84, 80, 0, 0, 0, 0, 0, 0, 0 }},
+    {{ 69, 69, 79, 85, 69, 79, 80, 82, 65, 0, 0, 0, 0, 0, 0, 0 }},
+    {{ 84, 65, 83, 84, 76, 78, 84, 65, 84, 0, 0, 0, 0, 0, 0, 0 }},
+    {{ 0, 68, 84, 0, 69, 78, 73, 67, 67, 0, 0, 0, 0, 0, 0, 0 }},
+    {{ 0, 0, 0, 0, 84, 69, 79, 69, 72, 0, 0, 0, 0, 0, 0, 0 }},
+    {{ 0, 0, 0, 0, 69, 67, 78, 0, 0, 0, 0, 0, 0, 0, 0, 0 }},
+    {{ 0, 0, 0, 0, 0, 84, 83, 0, 0, 0, 0, 0, 0, 0, 0, 0 }},
+}};
+
+alignas( 32 ) constexpr std::array< uint8_t, 16 > key_sizes = {{ 3, 4, 4, 3, 6, 7, 7, 5, 5, 255, 255, 255, 255, 255, 255, 255 }};
+
+constexpr lookup_enum lookup_scalar( std::string_view s )
+{
+    for ( size_t k = 0; k < 9; ++k )
+    {
+        bool match = key_sizes[ k ] == s.size();
+        for ( size_t j = 0; j < s.size() && match; ++j )
+        {
+            uint8_t c = static_cast< uint8_t >( s[ j ] );
+            match = key_columns[ j ][ k ] == c;
+        }
+
+        if ( match )
+        {
+            return static_cast< lookup_enum >( k );
+        }
+    }
+
+    return lookup_enum::default_;
+}
+
+#if defined( __SSE2__ )
+inline lookup_enum lookup_simd( std::string_view s )
+{
+    constexpr size_t MaxWordLength = 7;
+
+    if ( s.size() > MaxWordLength )
+    {
+        return lookup_enum::default_;
+    }
+
+    auto byte = [ s ]( size_t j ) -> char {
+        uint8_t c = j < s.size() ? static_cast< uint8_t >( s[ j ] ) : 0;
+        return char( c );
+    };
+
+    constexpr size_t Registers = 1;
+
+    __m128i match[ Registers ];
+    for ( size_t r = 0; r < Registers; ++r )
+    {
+        match[ r ] = _mm_cmpeq_epi8( _mm_load_si128( reinterpret_cast< const __m128i* >( key_sizes.data() + 16 * r ) ), _mm_set1_epi8( char( s.size() ) ) );
+    }
+    for ( size_t j = 0; j < MaxWordLength; ++j )
+    {
+        const __m128i broadcast = _mm_set1_epi8( byte( j ) );
+        for ( size_t r = 0; r < Registers; ++r )
+        {
+            const __m128i column = _mm_load_si128( reinterpret_cast< const __m128i* >( key_columns[ j ].data() + 16 * r ) );
+            match[ r ] = _mm_and_si128( match[ r ], _mm_cmpeq_epi8( column, broadcast ) );
+        }
+    }
+    uint32_t bits = 0;
+    for ( size_t r = 0; r < Registers; ++r )
+    {
+        bits |= uint32_t( _mm_movemask_epi8( match[ r ] ) ) << ( 16 * r );
+    }
+
+    return bits ? static_cast< lookup_enum >( __builtin_ctz( bits ) ) : lookup_enum::default_;
+}
+#endif
+
+} // namespace internal_
+
+constexpr internal_::lookup_enum lookup( std::string_view s )
+{
+#if defined( __SSE2__ ) && defined( __has_builtin )
+#if __has_builtin( __builtin_is_constant_evaluated )
+    if ( !__builtin_is_constant_evaluated() )
+    {
+        return internal_::lookup_simd( s );
+    }
+#endif
+#endif
+
+    return internal_::lookup_scalar( s );
+}
+
+} // namespace simd {
+
+// Extra check for safety
+static_assert( simd::lookup( "GET" ) == simd::internal_::lookup_enum::c_GET );
+static_assert( simd::lookup( "HEAD" ) == simd::internal_::lookup_enum::c_HEAD );
+static_assert( simd::lookup( "POST" ) == simd::internal_::lookup_enum::c_POST );
+static_assert( simd::lookup( "PUT" ) == simd::internal_::lookup_enum::c_PUT );
+static_assert( simd::lookup( "DELETE" ) == simd::internal_::lookup_enum::c_DELETE );
+static_assert( simd::lookup( "CONNECT" ) == simd::internal_::lookup_enum::c_CONNECT );
+static_assert( simd::lookup( "OPTIONS" ) == simd::internal_::lookup_enum::c_OPTIONS );
+static_assert( simd::lookup( "TRACE" ) == simd::internal_::lookup_enum::c_TRACE );
+static_assert( simd::lookup( "PATCH" ) == simd::internal_::lookup_enum::c_PATCH );
+
+#endif // SIMD__LOOKUP_HPP_
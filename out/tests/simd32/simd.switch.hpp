@@ -0,0 +1,233 @@
+#ifndef SIMD__LOOKUP_HPP_
+#define SIMD__LOOKUP_HPP_
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+#if defined( __GNUC__ ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+#include <immintrin.h>
+#endif
+
+#if defined( __SSE2__ )
+#include <emmintrin.h>
+#endif
+
+namespace simd {
+
+namespace internal_ {
+
+enum class lookup_enum
+{
+    default_ = -1,
+    c_USD = 0,
+    c_EUR = 1,
+    c_JPY = 2,
+    c_GBP = 3,
+    c_CHF = 4,
+    c_CAD = 5,
+    c_AUD = 6,
+    c_NZD = 7,
+    c_CNY = 8,
+    c_HKD = 9,
+    c_SGD = 10,
+    c_SEK = 11,
+    c_NOK = 12,
+    c_DKK = 13,
+    c_PLN = 14,
+    c_CZK = 15,
+    c_HUF = 16,
+    c_RUB = 17,
+    c_TRY = 18,
+    c_INR = 19,
+    c_BRL = 20,
+    c_MXN = 21,
+    c_ZAR = 22,
+    c_KRW = 23,
+    c_TWD = 24,
+    c_THB = 25,
+    c_IDR = 26,
+    c_MYR = 27,
+    c_PHP = 28,
+    c_ILS = 29,
+    c_AED = 30,
+    c_SAR = 31,
+};
+
+} // namespace internal_
+
+// Number of keywords, enum values other than the default are in [ 0, lookup_count )
+constexpr size_t lookup_count = 32;
+
+constexpr internal_::lookup_enum lookup( std::string_view s );
+
+namespace internal_ {
+
+// Byte j of key k is key_columns[ j ][ k ], zero past its end, in lower case.
+// Unused lanes have a size no input matches.
+alignas( 32 ) constexpr std::array< std::array< uint8_t, 32 >, 3 > key_columns = {{
+    {{ 117, 101, 106, 103, 99, 99, 97, 110, 99, 104, 115, 115, 110, 100, 112, 99, 104, 114, 116, 105, 98, 109, 122, 107, 116, 116, 105, 109, 112, 105, 97, 115 }},
+    {{ 115, 117, 112, 98, 104, 97, 117, 122, 110, 107, 103, 101, 111, 107, 108, 122, 117, 117, 114, 110, 114, 120, 97, 114, 119, 104, 100, 121, 104, 108, 101, 97 }},
+    {{ 100, 114, 121, 112, 102, 100, 100, 100, 121, 100, 100, 107, 107, 107, 110, 107, 102, 98, 121, 114, 108, 110, 114, 119, 100, 98, 114, 114, 112, 115, 100, 114 }},
+}};
+
+alignas( 32 ) constexpr std::array< uint8_t, 32 > key_sizes = {{ 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3 }};
+
+constexpr lookup_enum lookup_scalar( std::string_view s )
+{
+    for ( size_t k = 0; k < 32; ++k )
+    {
+        bool match = key_sizes[ k ] == s.size();
+        for ( size_t j = 0; j < s.size() && match; ++j )
+        {
+            uint8_t c = static_cast< uint8_t >( s[ j ] );
+            c |= uint8_t( c - 'A' ) < 26 ? 0x20 : 0;
+            match = key_columns[ j ][ k ] == c;
+        }
+
+        if ( match )
+        {
+            return static_cast< lookup_enum >( k );
+        }
+    }
+
+    return lookup_enum::default_;
+}
+
+#if defined( __SSE2__ )
+inline lookup_enum lookup_simd( std::string_view s )
+{
+    constexpr size_t MaxWordLength = 3;
+
+    if ( s.size() > MaxWordLength )
+    {
+        return lookup_enum::default_;
+    }
+
+    auto byte = [ s ]( size_t j ) -> char {
+        uint8_t c = j < s.size() ? static_cast< uint8_t >( s[ j ] ) : 0;
+        c |= uint8_t( c - 'A' ) < 26 ? 0x20 : 0;
+        return char( c );
+    };
+
+#if defined( __AVX2__ )
+    __m256i match = _mm256_cmpeq_epi8( _mm256_load_si256( reinterpret_cast< const __m256i* >( key_sizes.data() ) ), _mm256_set1_epi8( char( s.size() ) ) );
+    for ( size_t j = 0; j < MaxWordLength; ++j )
+    {
+        const __m256i column = _mm256_load_si256( reinterpret_cast< const __m256i* >( key_columns[ j ].data() ) );
+        match = _mm256_and_si256( match, _mm256_cmpeq_epi8( column, _mm256_set1_epi8( byte( j ) ) ) );
+    }
+    const uint32_t bits = _mm256_movemask_epi8( match );
+#else
+    constexpr size_t Registers = 2;
+
+    __m128i match[ Registers ];
+    for ( size_t r = 0; r < Registers; ++r )
+    {
+        match[ r ] = _mm_cmpeq_epi8( _mm_load_si128( reinterpret_cast< const __m128i* >( key_sizes.data() + 16 * r ) ), _mm_set1_epi8( char( s.size() ) ) );
+    }
+    for ( size_t j = 0; j < MaxWordLength; ++j )
+    {
+        const __m128i broadcast = _mm_set1_epi8( byte( j ) );
+        for ( size_t r = 0; r < Registers; ++r )
+        {
+            const __m128i column = _mm_load_si128( reinterpret_cast< const __m128i* >( key_columns[ j ].data() + 16 * r ) );
+            match[ r ] = _mm_and_si128( match[ r ], _mm_cmpeq_epi8( column, broadcast ) );
+        }
+    }
+    uint32_t bits = 0;
+    for ( size_t r = 0; r < Registers; ++r )
+    {
+        bits |= uint32_t( _mm_movemask_epi8( match[ r ] ) ) << ( 16 * r );
+    }
+#endif
+
+    return bits ? static_cast< lookup_enum >( __builtin_ctz( bits ) ) : lookup_enum::default_;
+}
+#endif
+
+} // namespace internal_
+
+constexpr internal_::lookup_enum lookup( std::string_view s )
+{
+#if defined( __SSE2__ ) && defined( __has_builtin )
+#if __has_builtin( __builtin_is_constant_evaluated )
+    if ( !__builtin_is_constant_evaluated() )
+    {
+        return internal_::lookup_simd( s );
+    }
+#endif
+#endif
+
+    return internal_::lookup_scalar( s );
+}
+
+} // namespace simd {
+
+// Extra check for safety
+static_assert( simd::lookup( "USD" ) == simd::internal_::lookup_enum::c_USD );
+static_assert( simd::lookup( "EUR" ) == simd::internal_::lookup_enum::c_EUR );
+static_assert( simd::lookup( "JPY" ) == simd::internal_::lookup_enum::c_JPY );
+static_assert( simd::lookup( "GBP" ) == simd::internal_::lookup_enum::c_GBP );
+static_assert( simd::lookup( "CHF" ) == simd::internal_::lookup_enum::c_CHF );
+static_assert( simd::lookup( "CAD" ) == simd::internal_::lookup_enum::c_CAD );
+static_assert( simd::lookup( "AUD" ) == simd::internal_::lookup_enum::c_AUD );
+static_assert( simd::lookup( "NZD" ) == simd::internal_::lookup_enum::c_NZD );
+static_assert( simd::lookup( "CNY" ) == simd::internal_::lookup_enum::c_CNY );
+static_assert( simd::lookup( "HKD" ) == simd::internal_::lookup_enum::c_HKD );
+static_assert( simd::lookup( "SGD" ) == simd::internal_::lookup_enum::c_SGD );
+static_assert( simd::lookup( "SEK" ) == simd::internal_::lookup_enum::c_SEK );
+static_assert( simd::lookup( "NOK" ) == simd::internal_::lookup_enum::c_NOK );
+static_assert( simd::lookup( "DKK" ) == simd::internal_::lookup_enum::c_DKK );
+static_assert( simd::lookup( "PLN" ) == simd::internal_::lookup_enum::c_PLN );
+static_assert( simd::lookup( "CZK" ) == simd::internal_::lookup_enum::c_CZK );
+static_assert( simd::lookup( "HUF" ) == simd::internal_::lookup_enum::c_HUF );
+static_assert( simd::lookup( "RUB" ) == simd::internal_::lookup_enum::c_RUB );
+static_assert( simd::lookup( "TRY" ) == simd::internal_::lookup_enum::c_TRY );
+static_assert( simd::lookup( "INR" ) == simd::internal_::lookup_enum::c_INR );
+static_assert( simd::lookup( "BRL" ) == simd::internal_::lookup_enum::c_BRL );
+static_assert( simd::lookup( "MXN" ) == simd::internal_::lookup_enum::c_MXN );
+static_assert( simd::lookup( "ZAR" ) == simd::internal_::lookup_enum::c_ZAR );
+static_assert( simd::lookup( "KRW" ) == simd::internal_::lookup_enum::c_KRW );
+static_assert( simd::lookup( "TWD" ) == simd::internal_::lookup_enum::c_TWD );
+static_assert( simd::lookup( "THB" ) == simd::internal_::lookup_enum::c_THB );
+static_assert( simd::lookup( "IDR" ) == simd::internal_::lookup_enum::c_IDR );
+static_assert( simd::lookup( "MYR" ) == simd::internal_::lookup_enum::c_MYR );
+static_assert( simd::lookup( "PHP" ) == simd::internal_::lookup_enum::c_PHP );
+static_assert( simd::lookup( "ILS" ) == simd::internal_::lookup_enum::c_ILS );
+static_assert( simd::lookup( "AED" ) == simd::internal_::lookup_enum::c_AED );
+static_assert( simd::lookup( "SAR" ) == simd::internal_::lookup_enum::c_SAR );
+static_assert( simd::lookup( "USD" ) == simd::internal_::lookup_enum::c_USD );
+static_assert( simd::lookup( "EUR" ) == simd::internal_::lookup_enum::c_EUR );
+static_assert( simd::lookup( "JPY" ) == simd::internal_::lookup_enum::c_JPY );
+static_assert( simd::lookup( "GBP" ) == simd::internal_::lookup_enum::c_GBP );
+static_assert( simd::lookup( "CHF" ) == simd::internal_::lookup_enum::c_CHF );
+static_assert( simd::lookup( "CAD" ) == simd::internal_::lookup_enum::c_CAD );
+static_assert( simd::lookup( "AUD" ) == simd::internal_::lookup_enum::c_AUD );
+static_assert( simd::lookup( "NZD" ) == simd::internal_::lookup_enum::c_NZD );
+static_assert( simd::lookup( "CNY" ) == simd::internal_::lookup_enum::c_CNY );
+static_assert( simd::lookup( "HKD" ) == simd::internal_::lookup_enum::c_HKD );
+static_assert( simd::lookup( "SGD" ) == simd::internal_::lookup_enum::c_SGD );
+static_assert( simd::lookup( "SEK" ) == simd::internal_::lookup_enum::c_SEK );
+static_assert( simd::lookup( "NOK" ) == simd::internal_::lookup_enum::c_NOK );
+static_assert( simd::lookup( "DKK" ) == simd::internal_::lookup_enum::c_DKK );
+static_assert( simd::lookup( "PLN" ) == simd::internal_::lookup_enum::c_PLN );
+static_assert( simd::lookup( "CZK" ) == simd::internal_::lookup_enum::c_CZK );
+static_assert( simd::lookup( "HUF" ) == simd::internal_::lookup_enum::c_HUF );
+static_assert( simd::lookup( "RUB" ) == simd::internal_::lookup_enum::c_RUB );
+static_assert( simd::lookup( "TRY" ) == simd::internal_::lookup_enum::c_TRY );
+static_assert( simd::lookup( "INR" ) == simd::internal_::lookup_enum::c_INR );
+static_assert( simd::lookup( "BRL" ) == simd::internal_::lookup_enum::c_BRL );
+static_assert( simd::lookup( "MXN" ) == simd::internal_::lookup_enum::c_MXN );
+static_assert( simd::lookup( "ZAR" ) == simd::internal_::lookup_enum::c_ZAR );
+static_assert( simd::lookup( "KRW" ) == simd::internal_::lookup_enum::c_KRW );
+static_assert( simd::lookup( "TWD" ) == simd::internal_::lookup_enum::c_TWD );
+static_assert( simd::lookup( "THB" ) == simd::internal_::lookup_enum::c_THB );
+static_assert( simd::lookup( "IDR" ) == simd::internal_::lookup_enum::c_IDR );
+static_assert( simd::lookup( "MYR" ) == simd::internal_::lookup_enum::c_MYR );
+static_assert( simd::lookup( "PHP" ) == simd::internal_::lookup_enum::c_PHP );
+static_assert( simd::lookup( "ILS" ) == simd::internal_::lookup_enum::c_ILS );
+static_assert( simd::lookup( "AED" ) == simd::internal_::lookup_enum::c_AED );
+static_assert( simd::lookup( "SAR" ) == simd::internal_::lookup_enum::c_SAR );
+
+#endif // SIMD__LOOKUP_HPP_
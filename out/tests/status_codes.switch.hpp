@@ -0,0 +1,237 @@
+#ifndef STATUS_CODES__CODE_HPP_
+#define STATUS_CODES__CODE_HPP_
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+namespace status_codes {
+
+namespace internal_ {
+
+enum class code_enum
+{
+    default_ = -1,
+    c_307 = 0,
+    c_308 = 1,
+    c_429 = 2,
+    c_400 = 3,
+    c_200 = 4,
+    c_401 = 5,
+    c_201 = 6,
+    c_202 = 7,
+    c_403 = 8,
+    c_404 = 9,
+    c_204 = 10,
+    c_405 = 11,
+    c_410 = 12,
+    c_406 = 13,
+    c_411 = 14,
+    c_206 = 15,
+    c_408 = 16,
+    c_413 = 17,
+    c_409 = 18,
+    c_414 = 19,
+    c_500 = 20,
+    c_415 = 21,
+    c_300 = 22,
+    c_501 = 23,
+    c_301 = 24,
+    c_502 = 25,
+    c_302 = 26,
+    c_503 = 27,
+    c_303 = 28,
+    c_504 = 29,
+    c_304 = 30,
+};
+
+} // namespace internal_
+
+// Number of keywords, enum values other than the default are in [ 0, code_count )
+constexpr size_t code_count = 31;
+
+constexpr internal_::code_enum code( std::string_view s );
+
+using code_value_type = const char*;
+
+// Returns the value given to keyword s, nullptr if s is not a keyword
+constexpr const code_value_type* code_value( std::string_view s );
+
+namespace internal_ {
+
+constexpr uint64_t load_le3( const char *p )
+{
+    return uint64_t( static_cast< unsigned char >( p[ 0 ] ) )
+         | uint64_t( static_cast< unsigned char >( p[ 1 ] ) ) << 8
+         | uint64_t( static_cast< unsigned char >( p[ 2 ] ) ) << 16;
+}
+
+struct key_entry
+{
+    uint64_t key;
+    code_enum enum_val;
+    code_value_type value;
+};
+
+constexpr std::array< key_entry, 64 > keylist = {{
+    { 0x373033ull, code_enum::default_, {} },
+    { 0x373033ull, code_enum::default_, {} },
+    { 0x373033ull, code_enum::default_, {} },
+    { 0x373033ull, code_enum::c_307, "Temporary Redirect" }, // 307
+    { 0x373033ull, code_enum::default_, {} },
+    { 0x373033ull, code_enum::default_, {} },
+    { 0x383033ull, code_enum::c_308, "Permanent Redirect" }, // 308
+    { 0x373033ull, code_enum::default_, {} },
+    { 0x373033ull, code_enum::default_, {} },
+    { 0x373033ull, code_enum::default_, {} },
+    { 0x393234ull, code_enum::c_429, "Too Many Requests" }, // 429
+    { 0x373033ull, code_enum::default_, {} },
+    { 0x303034ull, code_enum::c_400, "Bad Request" }, // 400
+    { 0x373033ull, code_enum::default_, {} },
+    { 0x303032ull, code_enum::c_200, "OK" }, // 200
+    { 0x313034ull, code_enum::c_401, "Unauthorized" }, // 401
+    { 0x373033ull, code_enum::default_, {} },
+    { 0x313032ull, code_enum::c_201, "Created" }, // 201
+    { 0x373033ull, code_enum::default_, {} },
+    { 0x373033ull, code_enum::default_, {} },
+    { 0x323032ull, code_enum::c_202, "Accepted" }, // 202
+    { 0x333034ull, code_enum::c_403, "Forbidden" }, // 403
+    { 0x373033ull, code_enum::default_, {} },
+    { 0x373033ull, code_enum::default_, {} },
+    { 0x373033ull, code_enum::default_, {} },
+    { 0x343034ull, code_enum::c_404, "Not Found" }, // 404
+    { 0x343032ull, code_enum::c_204, "No Content" }, // 204
+    { 0x373033ull, code_enum::default_, {} },
+    { 0x353034ull, code_enum::c_405, "Method Not Allowed" }, // 405
+    { 0x303134ull, code_enum::c_410, "Gone" }, // 410
+    { 0x373033ull, code_enum::default_, {} },
+    { 0x363034ull, code_enum::c_406, "Not Acceptable" }, // 406
+    { 0x313134ull, code_enum::c_411, "Length Required" }, // 411
+    { 0x363032ull, code_enum::c_206, "Partial Content" }, // 206
+    { 0x373033ull, code_enum::default_, {} },
+    { 0x373033ull, code_enum::default_, {} },
+    { 0x373033ull, code_enum::default_, {} },
+    { 0x383034ull, code_enum::c_408, "Request Timeout" }, // 408
+    { 0x333134ull, code_enum::c_413, "Payload Too Large" }, // 413
+    { 0x373033ull, code_enum::default_, {} },
+    { 0x393034ull, code_enum::c_409, "Conflict" }, // 409
+    { 0x343134ull, code_enum::c_414, "URI Too Long" }, // 414
+    { 0x373033ull, code_enum::default_, {} },
+    { 0x303035ull, code_enum::c_500, "Internal Server Error" }, // 500
+    { 0x353134ull, code_enum::c_415, "Unsupported Media Type" }, // 415
+    { 0x303033ull, code_enum::c_300, "Multiple Choices" }, // 300
+    { 0x313035ull, code_enum::c_501, "Not Implemented" }, // 501
+    { 0x373033ull, code_enum::default_, {} },
+    { 0x313033ull, code_enum::c_301, "Moved Permanently" }, // 301
+    { 0x323035ull, code_enum::c_502, "Bad Gateway" }, // 502
+    { 0x373033ull, code_enum::default_, {} },
+    { 0x323033ull, code_enum::c_302, "Found" }, // 302
+    { 0x333035ull, code_enum::c_503, "Service Unavailable" }, // 503
+    { 0x373033ull, code_enum::default_, {} },
+    { 0x333033ull, code_enum::c_303, "See Other" }, // 303
+    { 0x373033ull, code_enum::default_, {} },
+    { 0x343035ull, code_enum::c_504, "Gateway Timeout" }, // 504
+    { 0x343033ull, code_enum::c_304, "Not Modified" }, // 304
+    { 0x373033ull, code_enum::default_, {} },
+    { 0x373033ull, code_enum::default_, {} },
+    { 0x373033ull, code_enum::default_, {} },
+    { 0x373033ull, code_enum::default_, {} },
+    { 0x373033ull, code_enum::default_, {} },
+    { 0x373033ull, code_enum::default_, {} },
+}};
+
+} // namespace internal_
+
+constexpr internal_::code_enum code( std::string_view s )
+{
+    constexpr size_t WordLength = 3;
+
+    if ( s.size() != WordLength )
+    {
+        return internal_::code_enum::default_;
+    }
+
+    const uint64_t key = internal_::load_le3( s.data() );
+    const internal_::key_entry &entry = internal_::keylist[ ( key * 0x7C430CB1EDCD01EDull ) >> 58 ];
+    return entry.key == key ? entry.enum_val : internal_::code_enum::default_;
+}
+
+constexpr const code_value_type* code_value( std::string_view s )
+{
+    if ( s.size() != 3 )
+    {
+        return nullptr;
+    }
+
+    const uint64_t key = internal_::load_le3( s.data() );
+    const internal_::key_entry &entry = internal_::keylist[ ( key * 0x7C430CB1EDCD01EDull ) >> 58 ];
+    return entry.key == key ? &entry.value : nullptr;
+}
+
+} // namespace status_codes {
+
+// Extra check for safety
+static_assert( status_codes::code( "307" ) == status_codes::internal_::code_enum::c_307 );
+static_assert( status_codes::code( "308" ) == status_codes::internal_::code_enum::c_308 );
+static_assert( status_codes::code( "429" ) == status_codes::internal_::code_enum::c_429 );
+static_assert( status_codes::code( "400" ) == status_codes::internal_::code_enum::c_400 );
+static_assert( status_codes::code( "200" ) == status_codes::internal_::code_enum::c_200 );
+static_assert( status_codes::code( "401" ) == status_codes::internal_::code_enum::c_401 );
+static_assert( status_codes::code( "201" ) == status_codes::internal_::code_enum::c_201 );
+static_assert( status_codes::code( "202" ) == status_codes::internal_::code_enum::c_202 );
+static_assert( status_codes::code( "403" ) == status_codes::internal_::code_enum::c_403 );
+static_assert( status_codes::code( "404" ) == status_codes::internal_::code_enum::c_404 );
+static_assert( status_codes::code( "204" ) == status_codes::internal_::code_enum::c_204 );
+static_assert( status_codes::code( "405" ) == status_codes::internal_::code_enum::c_405 );
+static_assert( status_codes::code( "410" ) == status_codes::internal_::code_enum::c_410 );
+static_assert( status_codes::code( "406" ) == status_codes::internal_::code_enum::c_406 );
+static_assert( status_codes::code( "411" ) == status_codes::internal_::code_enum::c_411 );
+static_assert( status_codes::code( "206" ) == status_codes::internal_::code_enum::c_206 );
+static_assert( status_codes::code( "408" ) == status_codes::internal_::code_enum::c_408 );
+static_assert( status_codes::code( "413" ) == status_codes::internal_::code_enum::c_413 );
+static_assert( status_codes::code( "409" ) == status_codes::internal_::code_enum::c_409 );
+static_assert( status_codes::code( "414" ) == status_codes::internal_::code_enum::c_414 );
+static_assert( status_codes::code( "500" ) == status_codes::internal_::code_enum::c_500 );
+static_assert( status_codes::code( "415" ) == status_codes::internal_::code_enum::c_415 );
+static_assert( status_codes::code( "300" ) == status_codes::internal_::code_enum::c_300 );
+static_assert( status_codes::code( "501" ) == status_codes::internal_::code_enum::c_501 );
+static_assert( status_codes::code( "301" ) == status_codes::internal_::code_enum::c_301 );
+static_assert( status_codes::code( "502" ) == status_codes::internal_::code_enum::c_502 );
+static_assert( status_codes::code( "302" ) == status_codes::internal_::code_enum::c_302 );
+static_assert( status_codes::code( "503" ) == status_codes::internal_::code_enum::c_503 );
+static_assert( status_codes::code( "303" ) == status_codes::internal_::code_enum::c_303 );
+static_assert( status_codes::code( "504" ) == status_codes::internal_::code_enum::c_504 );
+static_assert( status_codes::code( "304" ) == status_codes::internal_::code_enum::c_304 );
+static_assert( status_codes::code_value( "307" ) != nullptr );
+static_assert( status_codes::code_value( "308" ) != nullptr );
+static_assert( status_codes::code_value( "429" ) != nullptr );
+static_assert( status_codes::code_value( "400" ) != nullptr );
+static_assert( status_codes::code_value( "200" ) != nullptr );
+static_assert( status_codes::code_value( "401" ) != nullptr );
+static_assert( status_codes::code_value( "201" ) != nullptr );
+static_assert( status_codes::code_value( "202" ) != nullptr );
+static_assert( status_codes::code_value( "403" ) != nullptr );
+static_assert( status_codes::code_value( "404" ) != nullptr );
+static_assert( status_codes::code_value( "204" ) != nullptr );
+static_assert( status_codes::code_value( "405" ) != nullptr );
+static_assert( status_codes::code_value( "410" ) != nullptr );
+static_assert( status_codes::code_value( "406" ) != nullptr );
+static_assert( status_codes::code_value( "411" ) != nullptr );
+static_assert( status_codes::code_value( "206" ) != nullptr );
+static_assert( status_codes::code_value( "408" ) != nullptr );
+static_assert( status_codes::code_value( "413" ) != nullptr );
+static_assert( status_codes::code_value( "409" ) != nullptr );
+static_assert( status_codes::code_value( "414" ) != nullptr );
+static_assert( status_codes::code_value( "500" ) != nullptr );
+static_assert( status_codes::code_value( "415" ) != nullptr );
+static_assert( status_codes::code_value( "300" ) != nullptr );
+static_assert( status_codes::code_value( "501" ) != nullptr );
+static_assert( status_codes::code_value( "301" ) != nullptr );
+static_assert( status_codes::code_value( "502" ) != nullptr );
+static_assert( status_codes::code_value( "302" ) != nullptr );
+static_assert( status_codes::code_value( "503" ) != nullptr );
+static_assert( status_codes::code_value( "303" ) != nullptr );
+static_assert( status_codes::code_value( "504" ) != nullptr );
+static_assert( status_codes::code_value( "304" ) != nullptr );
+
+#endif // STATUS_CODES__CODE_HPP_
@@ -0,0 +1,246 @@
+#ifndef __HASH_HPP_
+#define __HASH_HPP_
+
+#include <array>
+#include <cassert>
+#include <string_view>
+
+
+namespace internal_ {
+
+enum class hash_enum
+{
+    default_ = -1,
+    c_String_with_spaces = 0,
+    c_String_with_tabs = 1,
+    c_Some_punctuation_chars________________ = 2,
+    c_Backslash__ = 3,
+    c_Quotes___ = 4,
+    c_Control_chars_________________________________except_newline___ = 5,
+    c_UTF_8_stuff__emoji__________________________________________ = 6,
+    c_123123132 = 7,
+    c_222222222 = 8,
+    c_qwe_qwe = 9,
+    c_qwe_qwe_0 = 10,
+    c_qwe_qwe_1 = 11,
+    c_qwe_qwe_2 = 12,
+    c_default_ = 13,
+};
+
+} // namespace internal_
+
+// Number of keywords, enum values other than the default are in [ 0, hash_count )
+constexpr size_t hash_count = 14;
+
+constexpr internal_::hash_enum hash( std::string_view s );
+
+constexpr internal_::hash_enum hash( std::string_view s )
+{
+    switch ( s.size() )
+    {
+    case 7:
+        switch ( s[ 3 ] )
+        {
+        case ' ':
+            if ( s == "qwe qwe" )
+            {
+                return internal_::hash_enum::c_qwe_qwe_1;
+            }
+            break;
+        case '+':
+            if ( s == "qwe+qwe" )
+            {
+                return internal_::hash_enum::c_qwe_qwe_2;
+            }
+            break;
+        case '-':
+            if ( s == "qwe-qwe" )
+            {
+                return internal_::hash_enum::c_qwe_qwe;
+            }
+            break;
+        case '_':
+            if ( s == "qwe_qwe" )
+            {
+                return internal_::hash_enum::c_qwe_qwe_0;
+            }
+            break;
+        }
+        break;
+    case 8:
+        if ( s == "default_" )
+        {
+            return internal_::hash_enum::c_default_;
+        }
+        break;
+    case 9:
+        switch ( s[ 0 ] )
+        {
+        case '1':
+            if ( s == "123123132" )
+            {
+                return internal_::hash_enum::c_123123132;
+            }
+            break;
+        case '2':
+            if ( s == "222222222" )
+            {
+                return internal_::hash_enum::c_222222222;
+            }
+            break;
+        case 'Q':
+            if ( s == "Quotes \"\'" )
+            {
+                return internal_::hash_enum::c_Quotes___;
+            }
+            break;
+        }
+        break;
+    case 11:
+        if ( s == "Backslash \\" )
+        {
+            return internal_::hash_enum::c_Backslash__;
+        }
+        break;
+    case 16:
+        if ( s == "String\x09with\x09tabs" )
+        {
+            return internal_::hash_enum::c_String_with_tabs;
+        }
+        break;
+    case 18:
+        if ( s == "String with spaces" )
+        {
+            return internal_::hash_enum::c_String_with_spaces;
+        }
+        break;
+    case 38:
+        if ( s == "Some punctuation chars: !@#$%^&*(){}[]" )
+        {
+            return internal_::hash_enum::c_Some_punctuation_chars________________;
+        }
+        break;
+    case 60:
+        if ( s == "UTF-8 stuff (emoji): \xF0\x9F\xA4\x90 \xF0\x9F\xA4\x91 \xF0\x9F\xA4\x92 \xF0\x9F\xA4\x93 \xF0\x9F\xA4\x94 \xF0\x9F\xA4\x95 \xF0\x9F\xA4\x96 \xF0\x9F\xA4\x97" )
+        {
+            return internal_::hash_enum::c_UTF_8_stuff__emoji__________________________________________;
+        }
+        break;
+    case 63:
+        if ( s == "Control chars \x01\x02\x03\x04\x05\x06\x07\x08\x09\x0B\x0C\x0D\x0E\x0F\x10\x11\x12\x13\x14\x15\x16\x17\x18\x19\x1A\x1B\x1C\x1D\x1E\x1F (except newline) !" )
+        {
+            return internal_::hash_enum::c_Control_chars_________________________________except_newline___;
+        }
+        break;
+    }
+
+    return internal_::hash_enum::default_;
+}
+
+namespace internal_ {
+
+// Lookup through the tree only, keywords are not compared
+constexpr hash_enum hash_find_unchecked( std::string_view s )
+{
+    switch ( s.size() )
+    {
+    case 7:
+        switch ( s[ 3 ] )
+        {
+        case ' ':
+            return internal_::hash_enum::c_qwe_qwe_1;
+            break;
+        case '+':
+            return internal_::hash_enum::c_qwe_qwe_2;
+            break;
+        case '-':
+            return internal_::hash_enum::c_qwe_qwe;
+            break;
+        case '_':
+            return internal_::hash_enum::c_qwe_qwe_0;
+            break;
+        }
+        break;
+    case 8:
+        return internal_::hash_enum::c_default_;
+        break;
+    case 9:
+        switch ( s[ 0 ] )
+        {
+        case '1':
+            return internal_::hash_enum::c_123123132;
+            break;
+        case '2':
+            return internal_::hash_enum::c_222222222;
+            break;
+        case 'Q':
+            return internal_::hash_enum::c_Quotes___;
+            break;
+        }
+        break;
+    case 11:
+        return internal_::hash_enum::c_Backslash__;
+        break;
+    case 16:
+        return internal_::hash_enum::c_String_with_tabs;
+        break;
+    case 18:
+        return internal_::hash_enum::c_String_with_spaces;
+        break;
+    case 38:
+        return internal_::hash_enum::c_Some_punctuation_chars________________;
+        break;
+    case 60:
+        return internal_::hash_enum::c_UTF_8_stuff__emoji__________________________________________;
+        break;
+    case 63:
+        return internal_::hash_enum::c_Control_chars_________________________________except_newline___;
+        break;
+    }
+
+    return internal_::hash_enum::default_;
+}
+
+} // namespace internal_
+
+// Same as hash(), but s must be one of the keywords. Only the hash
+// is computed, s is not verified (except by an assertion in debug builds).
+constexpr internal_::hash_enum hash_unchecked( std::string_view s )
+{
+    const auto res = internal_::hash_find_unchecked( s );
+    assert( hash( s ) == res );
+    return res;
+}
+
+
+// Extra check for safety
+static_assert( ::hash( "String with spaces" ) == ::internal_::hash_enum::c_String_with_spaces );
+static_assert( ::hash( "String\x09with\x09tabs" ) == ::internal_::hash_enum::c_String_with_tabs );
+static_assert( ::hash( "Some punctuation chars: !@#$%^&*(){}[]" ) == ::internal_::hash_enum::c_Some_punctuation_chars________________ );
+static_assert( ::hash( "Backslash \\" ) == ::internal_::hash_enum::c_Backslash__ );
+static_assert( ::hash( "Quotes \"\'" ) == ::internal_::hash_enum::c_Quotes___ );
+static_assert( ::hash( "Control chars \x01\x02\x03\x04\x05\x06\x07\x08\x09\x0B\x0C\x0D\x0E\x0F\x10\x11\x12\x13\x14\x15\x16\x17\x18\x19\x1A\x1B\x1C\x1D\x1E\x1F (except newline) !" ) == ::internal_::hash_enum::c_Control_chars_________________________________except_newline___ );
+static_assert( ::hash( "UTF-8 stuff (emoji): \xF0\x9F\xA4\x90 \xF0\x9F\xA4\x91 \xF0\x9F\xA4\x92 \xF0\x9F\xA4\x93 \xF0\x9F\xA4\x94 \xF0\x9F\xA4\x95 \xF0\x9F\xA4\x96 \xF0\x9F\xA4\x97" ) == ::internal_::hash_enum::c_UTF_8_stuff__emoji__________________________________________ );
+static_assert( ::hash( "123123132" ) == ::internal_::hash_enum::c_123123132 );
+static_assert( ::hash( "222222222" ) == ::internal_::hash_enum::c_222222222 );
+static_assert( ::hash( "qwe-qwe" ) == ::internal_::hash_enum::c_qwe_qwe );
+static_assert( ::hash( "qwe_qwe" ) == ::internal_::hash_enum::c_qwe_qwe_0 );
+static_assert( ::hash( "qwe qwe" ) == ::internal_::hash_enum::c_qwe_qwe_1 );
+static_assert( ::hash( "qwe+qwe" ) == ::internal_::hash_enum::c_qwe_qwe_2 );
+static_assert( ::hash( "default_" ) == ::internal_::hash_enum::c_default_ );
+static_assert( ::hash_unchecked( "String with spaces" ) == ::internal_::hash_enum::c_String_with_spaces );
+static_assert( ::hash_unchecked( "String\x09with\x09tabs" ) == ::internal_::hash_enum::c_String_with_tabs );
+static_assert( ::hash_unchecked( "Some punctuation chars: !@#$%^&*(){}[]" ) == ::internal_::hash_enum::c_Some_punctuation_chars________________ );
+static_assert( ::hash_unchecked( "Backslash \\" ) == ::internal_::hash_enum::c_Backslash__ );
+static_assert( ::hash_unchecked( "Quotes \"\'" ) == ::internal_::hash_enum::c_Quotes___ );
+static_assert( ::hash_unchecked( "Control chars \x01\x02\x03\x04\x05\x06\x07\x08\x09\x0B\x0C\x0D\x0E\x0F\x10\x11\x12\x13\x14\x15\x16\x17\x18\x19\x1A\x1B\x1C\x1D\x1E\x1F (except newline) !" ) == ::internal_::hash_enum::c_Control_chars_________________________________except_newline___ );
+static_assert( ::hash_unchecked( "UTF-8 stuff (emoji): \xF0\x9F\xA4\x90 \xF0\x9F\xA4\x91 \xF0\x9F\xA4\x92 \xF0\x9F\xA4\x93 \xF0\x9F\xA4\x94 \xF0\x9F\xA4\x95 \xF0\x9F\xA4\x96 \xF0\x9F\xA4\x97" ) == ::internal_::hash_enum::c_UTF_8_stuff__emoji__________________________________________ );
+static_assert( ::hash_unchecked( "123123132" ) == ::internal_::hash_enum::c_123123132 );
+static_assert( ::hash_unchecked( "222222222" ) == ::internal_::hash_enum::c_222222222 );
+static_assert( ::hash_unchecked( "qwe-qwe" ) == ::internal_::hash_enum::c_qwe_qwe );
+static_assert( ::hash_unchecked( "qwe_qwe" ) == ::internal_::hash_enum::c_qwe_qwe_0 );
+static_assert( ::hash_unchecked( "qwe qwe" ) == ::internal_::hash_enum::c_qwe_qwe_1 );
+static_assert( ::hash_unchecked( "qwe+qwe" ) == ::internal_::hash_enum::c_qwe_qwe_2 );
+static_assert( ::hash_unchecked( "default_" ) == ::internal_::hash_enum::c_default_ );
+
+#endif // __HASH_HPP_
@@ -0,0 +1,1032 @@
+#ifndef IGNORE_CASE__HASH_HPP_
+#define IGNORE_CASE__HASH_HPP_
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+namespace ignore_case {
+
+namespace internal_ {
+
+enum class hash_enum
+{
+    default_ = -1,
+    c_Accept = 0,
+    c_Accept_Charset = 1,
+    c_Accept_Encoding = 2,
+    c_Accept_Language = 3,
+    c_Accept_Ranges = 4,
+    c_Access_Control_Allow_Credentials = 5,
+    c_Access_Control_Allow_Headers = 6,
+    c_Access_Control_Allow_Methods = 7,
+    c_Access_Control_Allow_Origin = 8,
+    c_Access_Control_Expose_Headers = 9,
+    c_Access_Control_Max_Age = 10,
+    c_Access_Control_Request_Headers = 11,
+    c_Access_Control_Request_Method = 12,
+    c_Age = 13,
+    c_Allow = 14,
+    c_Authorization = 15,
+    c_Cache_Control = 16,
+    c_Clear_Site_Data = 17,
+    c_Connection = 18,
+    c_Content_Disposition = 19,
+    c_Content_Encoding = 20,
+    c_Content_Language = 21,
+    c_Content_Length = 22,
+    c_Content_Location = 23,
+    c_Content_Range = 24,
+    c_Content_Security_Policy = 25,
+    c_Content_Security_Policy_Report_Only = 26,
+    c_Content_Type = 27,
+    c_Cookie = 28,
+    c_Cookie2 = 29,
+    c_DNT = 30,
+    c_Date = 31,
+    c_ETag = 32,
+    c_Expect = 33,
+    c_Expect_CT = 34,
+    c_Expires = 35,
+    c_Feature_Policy = 36,
+    c_Forwarded = 37,
+    c_From = 38,
+    c_Host = 39,
+    c_If_Match = 40,
+    c_If_Modified_Since = 41,
+    c_If_None_Match = 42,
+    c_If_Range = 43,
+    c_If_Unmodified_Since = 44,
+    c_Keep_Alive = 45,
+    c_Large_Allocation = 46,
+    c_Last_Modified = 47,
+    c_Location = 48,
+    c_Origin = 49,
+    c_Pragma = 50,
+    c_Proxy_Authenticate = 51,
+    c_Proxy_Authorization = 52,
+    c_Public_Key_Pins = 53,
+    c_Public_Key_Pins_Report_Only = 54,
+    c_Range = 55,
+    c_Referer = 56,
+    c_Referrer_Policy = 57,
+    c_Retry_After = 58,
+    c_Sec_WebSocket_Accept = 59,
+    c_Server = 60,
+    c_Server_Timing = 61,
+    c_Set_Cookie = 62,
+    c_Set_Cookie2 = 63,
+    c_SourceMap = 64,
+    c_Strict_Transport_Security = 65,
+    c_TE = 66,
+    c_Timing_Allow_Origin = 67,
+    c_Tk = 68,
+    c_Trailer = 69,
+    c_Transfer_Encoding = 70,
+    c_Upgrade_Insecure_Requests = 71,
+    c_User_Agent = 72,
+    c_Vary = 73,
+    c_Via = 74,
+    c_WWW_Authenticate = 75,
+    c_Warning = 76,
+    c_X_Content_Type_Options = 77,
+    c_X_DNS_Prefetch_Control = 78,
+    c_X_Forwarded_For = 79,
+    c_X_Forwarded_Host = 80,
+    c_X_Forwarded_Proto = 81,
+    c_X_Frame_Options = 82,
+    c_X_XSS_Protection = 83,
+};
+
+} // namespace internal_
+
+// Number of keywords, enum values other than the default are in [ 0, hash_count )
+constexpr size_t hash_count = 84;
+
+constexpr internal_::hash_enum hash( std::string_view s );
+
+namespace internal_ {
+
+constexpr uint64_t load_le8( const char *p )
+{
+    return uint64_t( static_cast< unsigned char >( p[ 0 ] ) )
+         | uint64_t( static_cast< unsigned char >( p[ 1 ] ) ) << 8
+         | uint64_t( static_cast< unsigned char >( p[ 2 ] ) ) << 16
+         | uint64_t( static_cast< unsigned char >( p[ 3 ] ) ) << 24
+         | uint64_t( static_cast< unsigned char >( p[ 4 ] ) ) << 32
+         | uint64_t( static_cast< unsigned char >( p[ 5 ] ) ) << 40
+         | uint64_t( static_cast< unsigned char >( p[ 6 ] ) ) << 48
+         | uint64_t( static_cast< unsigned char >( p[ 7 ] ) ) << 56;
+}
+
+constexpr uint64_t fold_case( uint64_t x )
+{
+    const uint64_t heptets = x & 0x7F7F7F7F7F7F7F7Full;
+    const uint64_t ge_A = heptets + 0x3F3F3F3F3F3F3F3Full; // High bit set if >= 'A'
+    const uint64_t gt_Z = heptets + 0x2525252525252525ull; // High bit set if > 'Z'
+    const uint64_t upper = ge_A & ~gt_Z & ~x & 0x8080808080808080ull;
+    return x | ( upper >> 2 );
+}
+
+constexpr bool equals_ignore_case( std::string_view s, std::string_view lower )
+{
+    if ( s.size() != lower.size() )
+    {
+        return false;
+    }
+
+    if ( s.size() < 8 )
+    {
+        uint64_t a = 0;
+        uint64_t b = 0;
+        for ( size_t i = 0; i < s.size(); ++i )
+        {
+            a |= uint64_t( static_cast< unsigned char >( s[ i ] ) ) << ( i * 8 );
+            b |= uint64_t( static_cast< unsigned char >( lower[ i ] ) ) << ( i * 8 );
+        }
+        return fold_case( a ) == b;
+    }
+
+    // Last 8 bytes overlap with the previous ones, instead of a loop for the tail
+    uint64_t diff = fold_case( load_le8( s.data() + s.size() - 8 ) ) ^ load_le8( lower.data() + s.size() - 8 );
+    for ( size_t i = 0; i + 8 < s.size(); i += 8 )
+    {
+        diff |= fold_case( load_le8( s.data() + i ) ) ^ load_le8( lower.data() + i );
+    }
+    return diff == 0;
+}
+
+} // namespace internal_
+
+constexpr internal_::hash_enum hash( std::string_view s )
+{
+    switch ( s.size() )
+    {
+    case 2:
+        switch ( s[ 1 ] )
+        {
+        case 'e':
+        case 'E':
+            if ( internal_::equals_ignore_case( s, "te" ) )
+            {
+                return internal_::hash_enum::c_TE;
+            }
+            break;
+        case 'k':
+        case 'K':
+            if ( internal_::equals_ignore_case( s, "tk" ) )
+            {
+                return internal_::hash_enum::c_Tk;
+            }
+            break;
+        }
+        break;
+    case 3:
+        switch ( s[ 0 ] )
+        {
+        case 'a':
+        case 'A':
+            if ( internal_::equals_ignore_case( s, "age" ) )
+            {
+                return internal_::hash_enum::c_Age;
+            }
+            break;
+        case 'd':
+        case 'D':
+            if ( internal_::equals_ignore_case( s, "dnt" ) )
+            {
+                return internal_::hash_enum::c_DNT;
+            }
+            break;
+        case 'v':
+        case 'V':
+            if ( internal_::equals_ignore_case( s, "via" ) )
+            {
+                return internal_::hash_enum::c_Via;
+            }
+            break;
+        }
+        break;
+    case 4:
+        switch ( s[ 0 ] )
+        {
+        case 'd':
+        case 'D':
+            if ( internal_::equals_ignore_case( s, "date" ) )
+            {
+                return internal_::hash_enum::c_Date;
+            }
+            break;
+        case 'e':
+        case 'E':
+            if ( internal_::equals_ignore_case( s, "etag" ) )
+            {
+                return internal_::hash_enum::c_ETag;
+            }
+            break;
+        case 'f':
+        case 'F':
+            if ( internal_::equals_ignore_case( s, "from" ) )
+            {
+                return internal_::hash_enum::c_From;
+            }
+            break;
+        case 'h':
+        case 'H':
+            if ( internal_::equals_ignore_case( s, "host" ) )
+            {
+                return internal_::hash_enum::c_Host;
+            }
+            break;
+        case 'v':
+        case 'V':
+            if ( internal_::equals_ignore_case( s, "vary" ) )
+            {
+                return internal_::hash_enum::c_Vary;
+            }
+            break;
+        }
+        break;
+    case 5:
+        switch ( s[ 0 ] )
+        {
+        case 'a':
+        case 'A':
+            if ( internal_::equals_ignore_case( s, "allow" ) )
+            {
+                return internal_::hash_enum::c_Allow;
+            }
+            break;
+        case 'r':
+        case 'R':
+            if ( internal_::equals_ignore_case( s, "range" ) )
+            {
+                return internal_::hash_enum::c_Range;
+            }
+            break;
+        }
+        break;
+    case 6:
+        switch ( s[ 0 ] )
+        {
+        case 'a':
+        case 'A':
+            if ( internal_::equals_ignore_case( s, "accept" ) )
+            {
+                return internal_::hash_enum::c_Accept;
+            }
+            break;
+        case 'c':
+        case 'C':
+            if ( internal_::equals_ignore_case( s, "cookie" ) )
+            {
+                return internal_::hash_enum::c_Cookie;
+            }
+            break;
+        case 'e':
+        case 'E':
+            if ( internal_::equals_ignore_case( s, "expect" ) )
+            {
+                return internal_::hash_enum::c_Expect;
+            }
+            break;
+        case 'o':
+        case 'O':
+            if ( internal_::equals_ignore_case( s, "origin" ) )
+            {
+                return internal_::hash_enum::c_Origin;
+            }
+            break;
+        case 'p':
+        case 'P':
+            if ( internal_::equals_ignore_case( s, "pragma" ) )
+            {
+                return internal_::hash_enum::c_Pragma;
+            }
+            break;
+        case 's':
+        case 'S':
+            if ( internal_::equals_ignore_case( s, "server" ) )
+            {
+                return internal_::hash_enum::c_Server;
+            }
+            break;
+        }
+        break;
+    case 7:
+        switch ( s[ 0 ] )
+        {
+        case 'c':
+        case 'C':
+            if ( internal_::equals_ignore_case( s, "cookie2" ) )
+            {
+                return internal_::hash_enum::c_Cookie2;
+            }
+            break;
+        case 'e':
+        case 'E':
+            if ( internal_::equals_ignore_case( s, "expires" ) )
+            {
+                return internal_::hash_enum::c_Expires;
+            }
+            break;
+        case 'r':
+        case 'R':
+            if ( internal_::equals_ignore_case( s, "referer" ) )
+            {
+                return internal_::hash_enum::c_Referer;
+            }
+            break;
+        case 't':
+        case 'T':
+            if ( internal_::equals_ignore_case( s, "trailer" ) )
+            {
+                return internal_::hash_enum::c_Trailer;
+            }
+            break;
+        case 'w':
+        case 'W':
+            if ( internal_::equals_ignore_case( s, "warning" ) )
+            {
+                return internal_::hash_enum::c_Warning;
+            }
+            break;
+        }
+        break;
+    case 8:
+        switch ( s[ 3 ] )
+        {
+        case 'a':
+        case 'A':
+            if ( internal_::equals_ignore_case( s, "location" ) )
+            {
+                return internal_::hash_enum::c_Location;
+            }
+            break;
+        case 'm':
+        case 'M':
+            if ( internal_::equals_ignore_case( s, "if-match" ) )
+            {
+                return internal_::hash_enum::c_If_Match;
+            }
+            break;
+        case 'r':
+        case 'R':
+            if ( internal_::equals_ignore_case( s, "if-range" ) )
+            {
+                return internal_::hash_enum::c_If_Range;
+            }
+            break;
+        }
+        break;
+    case 9:
+        switch ( s[ 0 ] )
+        {
+        case 'e':
+        case 'E':
+            if ( internal_::equals_ignore_case( s, "expect-ct" ) )
+            {
+                return internal_::hash_enum::c_Expect_CT;
+            }
+            break;
+        case 'f':
+        case 'F':
+            if ( internal_::equals_ignore_case( s, "forwarded" ) )
+            {
+                return internal_::hash_enum::c_Forwarded;
+            }
+            break;
+        case 's':
+        case 'S':
+            if ( internal_::equals_ignore_case( s, "sourcemap" ) )
+            {
+                return internal_::hash_enum::c_SourceMap;
+            }
+            break;
+        }
+        break;
+    case 10:
+        switch ( s[ 0 ] )
+        {
+        case 'c':
+        case 'C':
+            if ( internal_::equals_ignore_case( s, "connection" ) )
+            {
+                return internal_::hash_enum::c_Connection;
+            }
+            break;
+        case 'k':
+        case 'K':
+            if ( internal_::equals_ignore_case( s, "keep-alive" ) )
+            {
+                return internal_::hash_enum::c_Keep_Alive;
+            }
+            break;
+        case 's':
+        case 'S':
+            if ( internal_::equals_ignore_case( s, "set-cookie" ) )
+            {
+                return internal_::hash_enum::c_Set_Cookie;
+            }
+            break;
+        case 'u':
+        case 'U':
+            if ( internal_::equals_ignore_case( s, "user-agent" ) )
+            {
+                return internal_::hash_enum::c_User_Agent;
+            }
+            break;
+        }
+        break;
+    case 11:
+        switch ( s[ 0 ] )
+        {
+        case 'r':
+        case 'R':
+            if ( internal_::equals_ignore_case( s, "retry-after" ) )
+            {
+                return internal_::hash_enum::c_Retry_After;
+            }
+            break;
+        case 's':
+        case 'S':
+            if ( internal_::equals_ignore_case( s, "set-cookie2" ) )
+            {
+                return internal_::hash_enum::c_Set_Cookie2;
+            }
+            break;
+        }
+        break;
+    case 12:
+        if ( internal_::equals_ignore_case( s, "content-type" ) )
+        {
+            return internal_::hash_enum::c_Content_Type;
+        }
+        break;
+    case 13:
+        switch ( s[ 12 ] )
+        {
+        case 'd':
+        case 'D':
+            if ( internal_::equals_ignore_case( s, "last-modified" ) )
+            {
+                return internal_::hash_enum::c_Last_Modified;
+            }
+            break;
+        case 'e':
+        case 'E':
+            if ( internal_::equals_ignore_case( s, "content-range" ) )
+            {
+                return internal_::hash_enum::c_Content_Range;
+            }
+            break;
+        case 'g':
+        case 'G':
+            if ( internal_::equals_ignore_case( s, "server-timing" ) )
+            {
+                return internal_::hash_enum::c_Server_Timing;
+            }
+            break;
+        case 'h':
+        case 'H':
+            if ( internal_::equals_ignore_case( s, "if-none-match" ) )
+            {
+                return internal_::hash_enum::c_If_None_Match;
+            }
+            break;
+        case 'l':
+        case 'L':
+            if ( internal_::equals_ignore_case( s, "cache-control" ) )
+            {
+                return internal_::hash_enum::c_Cache_Control;
+            }
+            break;
+        case 'n':
+        case 'N':
+            if ( internal_::equals_ignore_case( s, "authorization" ) )
+            {
+                return internal_::hash_enum::c_Authorization;
+            }
+            break;
+        case 's':
+        case 'S':
+            if ( internal_::equals_ignore_case( s, "accept-ranges" ) )
+            {
+                return internal_::hash_enum::c_Accept_Ranges;
+            }
+            break;
+        }
+        break;
+    case 14:
+        switch ( s[ 0 ] )
+        {
+        case 'a':
+        case 'A':
+            if ( internal_::equals_ignore_case( s, "accept-charset" ) )
+            {
+                return internal_::hash_enum::c_Accept_Charset;
+            }
+            break;
+        case 'c':
+        case 'C':
+            if ( internal_::equals_ignore_case( s, "content-length" ) )
+            {
+                return internal_::hash_enum::c_Content_Length;
+            }
+            break;
+        case 'f':
+        case 'F':
+            if ( internal_::equals_ignore_case( s, "feature-policy" ) )
+            {
+                return internal_::hash_enum::c_Feature_Policy;
+            }
+            break;
+        }
+        break;
+    case 15:
+        switch ( s[ 8 ] )
+        {
+        case '-':
+            if ( internal_::equals_ignore_case( s, "referrer-policy" ) )
+            {
+                return internal_::hash_enum::c_Referrer_Policy;
+            }
+            break;
+        case 'a':
+        case 'A':
+            if ( internal_::equals_ignore_case( s, "accept-language" ) )
+            {
+                return internal_::hash_enum::c_Accept_Language;
+            }
+            break;
+        case 'd':
+        case 'D':
+            if ( internal_::equals_ignore_case( s, "x-forwarded-for" ) )
+            {
+                return internal_::hash_enum::c_X_Forwarded_For;
+            }
+            break;
+        case 'e':
+        case 'E':
+            if ( internal_::equals_ignore_case( s, "public-key-pins" ) )
+            {
+                return internal_::hash_enum::c_Public_Key_Pins;
+            }
+            break;
+        case 'n':
+        case 'N':
+            if ( internal_::equals_ignore_case( s, "accept-encoding" ) )
+            {
+                return internal_::hash_enum::c_Accept_Encoding;
+            }
+            break;
+        case 'o':
+        case 'O':
+            if ( internal_::equals_ignore_case( s, "x-frame-options" ) )
+            {
+                return internal_::hash_enum::c_X_Frame_Options;
+            }
+            break;
+        case 't':
+        case 'T':
+            if ( internal_::equals_ignore_case( s, "clear-site-data" ) )
+            {
+                return internal_::hash_enum::c_Clear_Site_Data;
+            }
+            break;
+        }
+        break;
+    case 16:
+        switch ( s[ 11 ] )
+        {
+        case '-':
+            if ( internal_::equals_ignore_case( s, "x-forwarded-host" ) )
+            {
+                return internal_::hash_enum::c_X_Forwarded_Host;
+            }
+            break;
+        case 'a':
+        case 'A':
+            switch ( s[ 0 ] )
+            {
+            case 'c':
+            case 'C':
+                if ( internal_::equals_ignore_case( s, "content-location" ) )
+                {
+                    return internal_::hash_enum::c_Content_Location;
+                }
+                break;
+            case 'l':
+            case 'L':
+                if ( internal_::equals_ignore_case( s, "large-allocation" ) )
+                {
+                    return internal_::hash_enum::c_Large_Allocation;
+                }
+                break;
+            }
+            break;
+        case 'c':
+        case 'C':
+            if ( internal_::equals_ignore_case( s, "x-xss-protection" ) )
+            {
+                return internal_::hash_enum::c_X_XSS_Protection;
+            }
+            break;
+        case 'g':
+        case 'G':
+            if ( internal_::equals_ignore_case( s, "content-language" ) )
+            {
+                return internal_::hash_enum::c_Content_Language;
+            }
+            break;
+        case 'i':
+        case 'I':
+            if ( internal_::equals_ignore_case( s, "www-authenticate" ) )
+            {
+                return internal_::hash_enum::c_WWW_Authenticate;
+            }
+            break;
+        case 'o':
+        case 'O':
+            if ( internal_::equals_ignore_case( s, "content-encoding" ) )
+            {
+                return internal_::hash_enum::c_Content_Encoding;
+            }
+            break;
+        }
+        break;
+    case 17:
+        switch ( s[ 0 ] )
+        {
+        case 'i':
+        case 'I':
+            if ( internal_::equals_ignore_case( s, "if-modified-since" ) )
+            {
+                return internal_::hash_enum::c_If_Modified_Since;
+            }
+            break;
+        case 't':
+        case 'T':
+            if ( internal_::equals_ignore_case( s, "transfer-encoding" ) )
+            {
+                return internal_::hash_enum::c_Transfer_Encoding;
+            }
+            break;
+        case 'x':
+        case 'X':
+            if ( internal_::equals_ignore_case( s, "x-forwarded-proto" ) )
+            {
+                return internal_::hash_enum::c_X_Forwarded_Proto;
+            }
+            break;
+        }
+        break;
+    case 18:
+        if ( internal_::equals_ignore_case( s, "proxy-authenticate" ) )
+        {
+            return internal_::hash_enum::c_Proxy_Authenticate;
+        }
+        break;
+    case 19:
+        switch ( s[ 0 ] )
+        {
+        case 'c':
+        case 'C':
+            if ( internal_::equals_ignore_case( s, "content-disposition" ) )
+            {
+                return internal_::hash_enum::c_Content_Disposition;
+            }
+            break;
+        case 'i':
+        case 'I':
+            if ( internal_::equals_ignore_case( s, "if-unmodified-since" ) )
+            {
+                return internal_::hash_enum::c_If_Unmodified_Since;
+            }
+            break;
+        case 'p':
+        case 'P':
+            if ( internal_::equals_ignore_case( s, "proxy-authorization" ) )
+            {
+                return internal_::hash_enum::c_Proxy_Authorization;
+            }
+            break;
+        case 't':
+        case 'T':
+            if ( internal_::equals_ignore_case( s, "timing-allow-origin" ) )
+            {
+                return internal_::hash_enum::c_Timing_Allow_Origin;
+            }
+            break;
+        }
+        break;
+    case 20:
+        if ( internal_::equals_ignore_case( s, "sec-websocket-accept" ) )
+        {
+            return internal_::hash_enum::c_Sec_WebSocket_Accept;
+        }
+        break;
+    case 22:
+        switch ( s[ 3 ] )
+        {
+        case 'e':
+        case 'E':
+            if ( internal_::equals_ignore_case( s, "access-control-max-age" ) )
+            {
+                return internal_::hash_enum::c_Access_Control_Max_Age;
+            }
+            break;
+        case 'n':
+        case 'N':
+            if ( internal_::equals_ignore_case( s, "x-dns-prefetch-control" ) )
+            {
+                return internal_::hash_enum::c_X_DNS_Prefetch_Control;
+            }
+            break;
+        case 'o':
+        case 'O':
+            if ( internal_::equals_ignore_case( s, "x-content-type-options" ) )
+            {
+                return internal_::hash_enum::c_X_Content_Type_Options;
+            }
+            break;
+        }
+        break;
+    case 23:
+        if ( internal_::equals_ignore_case( s, "content-security-policy" ) )
+        {
+            return internal_::hash_enum::c_Content_Security_Policy;
+        }
+        break;
+    case 25:
+        switch ( s[ 0 ] )
+        {
+        case 's':
+        case 'S':
+            if ( internal_::equals_ignore_case( s, "strict-transport-security" ) )
+            {
+                return internal_::hash_enum::c_Strict_Transport_Security;
+            }
+            break;
+        case 'u':
+        case 'U':
+            if ( internal_::equals_ignore_case( s, "upgrade-insecure-requests" ) )
+            {
+                return internal_::hash_enum::c_Upgrade_Insecure_Requests;
+            }
+            break;
+        }
+        break;
+    case 27:
+        switch ( s[ 0 ] )
+        {
+        case 'a':
+        case 'A':
+            if ( internal_::equals_ignore_case( s, "access-control-allow-origin" ) )
+            {
+                return internal_::hash_enum::c_Access_Control_Allow_Origin;
+            }
+            break;
+        case 'p':
+        case 'P':
+            if ( internal_::equals_ignore_case( s, "public-key-pins-report-only" ) )
+            {
+                return internal_::hash_enum::c_Public_Key_Pins_Report_Only;
+            }
+            break;
+        }
+        break;
+    case 28:
+        switch ( s[ 21 ] )
+        {
+        case 'h':
+        case 'H':
+            if ( internal_::equals_ignore_case( s, "access-control-allow-headers" ) )
+            {
+                return internal_::hash_enum::c_Access_Control_Allow_Headers;
+            }
+            break;
+        case 'm':
+        case 'M':
+            if ( internal_::equals_ignore_case( s, "access-control-allow-methods" ) )
+            {
+                return internal_::hash_enum::c_Access_Control_Allow_Methods;
+            }
+            break;
+        }
+        break;
+    case 29:
+        switch ( s[ 15 ] )
+        {
+        case 'e':
+        case 'E':
+            if ( internal_::equals_ignore_case( s, "access-control-expose-headers" ) )
+            {
+                return internal_::hash_enum::c_Access_Control_Expose_Headers;
+            }
+            break;
+        case 'r':
+        case 'R':
+            if ( internal_::equals_ignore_case( s, "access-control-request-method" ) )
+            {
+                return internal_::hash_enum::c_Access_Control_Request_Method;
+            }
+            break;
+        }
+        break;
+    case 30:
+        if ( internal_::equals_ignore_case( s, "access-control-request-headers" ) )
+        {
+            return internal_::hash_enum::c_Access_Control_Request_Headers;
+        }
+        break;
+    case 32:
+        if ( internal_::equals_ignore_case( s, "access-control-allow-credentials" ) )
+        {
+            return internal_::hash_enum::c_Access_Control_Allow_Credentials;
+        }
+        break;
+    case 35:
+        if ( internal_::equals_ignore_case( s, "content-security-policy-report-only" ) )
+        {
+            return internal_::hash_enum::c_Content_Security_Policy_Report_Only;
+        }
+        break;
+    }
+
+    return internal_::hash_enum::default_;
+}
+
+} // namespace ignore_case {
+
+// Extra check for safety
+static_assert( ignore_case::hash( "Accept" ) == ignore_case::internal_::hash_enum::c_Accept );
+static_assert( ignore_case::hash( "Accept-Charset" ) == ignore_case::internal_::hash_enum::c_Accept_Charset );
+static_assert( ignore_case::hash( "Accept-Encoding" ) == ignore_case::internal_::hash_enum::c_Accept_Encoding );
+static_assert( ignore_case::hash( "Accept-Language" ) == ignore_case::internal_::hash_enum::c_Accept_Language );
+static_assert( ignore_case::hash( "Accept-Ranges" ) == ignore_case::internal_::hash_enum::c_Accept_Ranges );
+static_assert( ignore_case::hash( "Access-Control-Allow-Credentials" ) == ignore_case::internal_::hash_enum::c_Access_Control_Allow_Credentials );
+static_assert( ignore_case::hash( "Access-Control-Allow-Headers" ) == ignore_case::internal_::hash_enum::c_Access_Control_Allow_Headers );
+static_assert( ignore_case::hash( "Access-Control-Allow-Methods" ) == ignore_case::internal_::hash_enum::c_Access_Control_Allow_Methods );
+static_assert( ignore_case::hash( "Access-Control-Allow-Origin" ) == ignore_case::internal_::hash_enum::c_Access_Control_Allow_Origin );
+static_assert( ignore_case::hash( "Access-Control-Expose-Headers" ) == ignore_case::internal_::hash_enum::c_Access_Control_Expose_Headers );
+static_assert( ignore_case::hash( "Access-Control-Max-Age" ) == ignore_case::internal_::hash_enum::c_Access_Control_Max_Age );
+static_assert( ignore_case::hash( "Access-Control-Request-Headers" ) == ignore_case::internal_::hash_enum::c_Access_Control_Request_Headers );
+static_assert( ignore_case::hash( "Access-Control-Request-Method" ) == ignore_case::internal_::hash_enum::c_Access_Control_Request_Method );
+static_assert( ignore_case::hash( "Age" ) == ignore_case::internal_::hash_enum::c_Age );
+static_assert( ignore_case::hash( "Allow" ) == ignore_case::internal_::hash_enum::c_Allow );
+static_assert( ignore_case::hash( "Authorization" ) == ignore_case::internal_::hash_enum::c_Authorization );
+static_assert( ignore_case::hash( "Cache-Control" ) == ignore_case::internal_::hash_enum::c_Cache_Control );
+static_assert( ignore_case::hash( "Clear-Site-Data" ) == ignore_case::internal_::hash_enum::c_Clear_Site_Data );
+static_assert( ignore_case::hash( "Connection" ) == ignore_case::internal_::hash_enum::c_Connection );
+static_assert( ignore_case::hash( "Content-Disposition" ) == ignore_case::internal_::hash_enum::c_Content_Disposition );
+static_assert( ignore_case::hash( "Content-Encoding" ) == ignore_case::internal_::hash_enum::c_Content_Encoding );
+static_assert( ignore_case::hash( "Content-Language" ) == ignore_case::internal_::hash_enum::c_Content_Language );
+static_assert( ignore_case::hash( "Content-Length" ) == ignore_case::internal_::hash_enum::c_Content_Length );
+static_assert( ignore_case::hash( "Content-Location" ) == ignore_case::internal_::hash_enum::c_Content_Location );
+static_assert( ignore_case::hash( "Content-Range" ) == ignore_case::internal_::hash_enum::c_Content_Range );
+static_assert( ignore_case::hash( "Content-Security-Policy" ) == ignore_case::internal_::hash_enum::c_Content_Security_Policy );
+static_assert( ignore_case::hash( "Content-Security-Policy-Report-Only" ) == ignore_case::internal_::hash_enum::c_Content_Security_Policy_Report_Only );
+static_assert( ignore_case::hash( "Content-Type" ) == ignore_case::internal_::hash_enum::c_Content_Type );
+static_assert( ignore_case::hash( "Cookie" ) == ignore_case::internal_::hash_enum::c_Cookie );
+static_assert( ignore_case::hash( "Cookie2" ) == ignore_case::internal_::hash_enum::c_Cookie2 );
+static_assert( ignore_case::hash( "DNT" ) == ignore_case::internal_::hash_enum::c_DNT );
+static_assert( ignore_case::hash( "Date" ) == ignore_case::internal_::hash_enum::c_Date );
+static_assert( ignore_case::hash( "ETag" ) == ignore_case::internal_::hash_enum::c_ETag );
+static_assert( ignore_case::hash( "Expect" ) == ignore_case::internal_::hash_enum::c_Expect );
+static_assert( ignore_case::hash( "Expect-CT" ) == ignore_case::internal_::hash_enum::c_Expect_CT );
+static_assert( ignore_case::hash( "Expires" ) == ignore_case::internal_::hash_enum::c_Expires );
+static_assert( ignore_case::hash( "Feature-Policy" ) == ignore_case::internal_::hash_enum::c_Feature_Policy );
+static_assert( ignore_case::hash( "Forwarded" ) == ignore_case::internal_::hash_enum::c_Forwarded );
+static_assert( ignore_case::hash( "From" ) == ignore_case::internal_::hash_enum::c_From );
+static_assert( ignore_case::hash( "Host" ) == ignore_case::internal_::hash_enum::c_Host );
+static_assert( ignore_case::hash( "If-Match" ) == ignore_case::internal_::hash_enum::c_If_Match );
+static_assert( ignore_case::hash( "If-Modified-Since" ) == ignore_case::internal_::hash_enum::c_If_Modified_Since );
+static_assert( ignore_case::hash( "If-None-Match" ) == ignore_case::internal_::hash_enum::c_If_None_Match );
+static_assert( ignore_case::hash( "If-Range" ) == ignore_case::internal_::hash_enum::c_If_Range );
+static_assert( ignore_case::hash( "If-Unmodified-Since" ) == ignore_case::internal_::hash_enum::c_If_Unmodified_Since );
+static_assert( ignore_case::hash( "Keep-Alive" ) == ignore_case::internal_::hash_enum::c_Keep_Alive );
+static_assert( ignore_case::hash( "Large-Allocation" ) == ignore_case::internal_::hash_enum::c_Large_Allocation );
+static_assert( ignore_case::hash( "Last-Modified" ) == ignore_case::internal_::hash_enum::c_Last_Modified );
+static_assert( ignore_case::hash( "Location" ) == ignore_case::internal_::hash_enum::c_Location );
+static_assert( ignore_case::hash( "Origin" ) == ignore_case::internal_::hash_enum::c_Origin );
+static_assert( ignore_case::hash( "Pragma" ) == ignore_case::internal_::hash_enum::c_Pragma );
+static_assert( ignore_case::hash( "Proxy-Authenticate" ) == ignore_case::internal_::hash_enum::c_Proxy_Authenticate );
+static_assert( ignore_case::hash( "Proxy-Authorization" ) == ignore_case::internal_::hash_enum::c_Proxy_Authorization );
+static_assert( ignore_case::hash( "Public-Key-Pins" ) == ignore_case::internal_::hash_enum::c_Public_Key_Pins );
+static_assert( ignore_case::hash( "Public-Key-Pins-Report-Only" ) == ignore_case::internal_::hash_enum::c_Public_Key_Pins_Report_Only );
+static_assert( ignore_case::hash( "Range" ) == ignore_case::internal_::hash_enum::c_Range );
+static_assert( ignore_case::hash( "Referer" ) == ignore_case::internal_::hash_enum::c_Referer );
+static_assert( ignore_case::hash( "Referrer-Policy" ) == ignore_case::internal_::hash_enum::c_Referrer_Policy );
+static_assert( ignore_case::hash( "Retry-After" ) == ignore_case::internal_::hash_enum::c_Retry_After );
+static_assert( ignore_case::hash( "Sec-WebSocket-Accept" ) == ignore_case::internal_::hash_enum::c_Sec_WebSocket_Accept );
+static_assert( ignore_case::hash( "Server" ) == ignore_case::internal_::hash_enum::c_Server );
+static_assert( ignore_case::hash( "Server-Timing" ) == ignore_case::internal_::hash_enum::c_Server_Timing );
+static_assert( ignore_case::hash( "Set-Cookie" ) == ignore_case::internal_::hash_enum::c_Set_Cookie );
+static_assert( ignore_case::hash( "Set-Cookie2" ) == ignore_case::internal_::hash_enum::c_Set_Cookie2 );
+static_assert( ignore_case::hash( "SourceMap" ) == ignore_case::internal_::hash_enum::c_SourceMap );
+static_assert( ignore_case::hash( "Strict-Transport-Security" ) == ignore_case::internal_::hash_enum::c_Strict_Transport_Security );
+static_assert( ignore_case::hash( "TE" ) == ignore_case::internal_::hash_enum::c_TE );
+static_assert( ignore_case::hash( "Timing-Allow-Origin" ) == ignore_case::internal_::hash_enum::c_Timing_Allow_Origin );
+static_assert( ignore_case::hash( "Tk" ) == ignore_case::internal_::hash_enum::c_Tk );
+static_assert( ignore_case::hash( "Trailer" ) == ignore_case::internal_::hash_enum::c_Trailer );
+static_assert( ignore_case::hash( "Transfer-Encoding" ) == ignore_case::internal_::hash_enum::c_Transfer_Encoding );
+static_assert( ignore_case::hash( "Upgrade-Insecure-Requests" ) == ignore_case::internal_::hash_enum::c_Upgrade_Insecure_Requests );
+static_assert( ignore_case::hash( "User-Agent" ) == ignore_case::internal_::hash_enum::c_User_Agent );
+static_assert( ignore_case::hash( "Vary" ) == ignore_case::internal_::hash_enum::c_Vary );
+static_assert( ignore_case::hash( "Via" ) == ignore_case::internal_::hash_enum::c_Via );
+static_assert( ignore_case::hash( "WWW-Authenticate" ) == ignore_case::internal_::hash_enum::c_WWW_Authenticate );
+static_assert( ignore_case::hash( "Warning" ) == ignore_case::internal_::hash_enum::c_Warning );
+static_assert( ignore_case::hash( "X-Content-Type-Options" ) == ignore_case::internal_::hash_enum::c_X_Content_Type_Options );
+static_assert( ignore_case::hash( "X-DNS-Prefetch-Control" ) == ignore_case::internal_::hash_enum::c_X_DNS_Prefetch_Control );
+static_assert( ignore_case::hash( "X-Forwarded-For" ) == ignore_case::internal_::hash_enum::c_X_Forwarded_For );
+static_assert( ignore_case::hash( "X-Forwarded-Host" ) == ignore_case::internal_::hash_enum::c_X_Forwarded_Host );
+static_assert( ignore_case::hash( "X-Forwarded-Proto" ) == ignore_case::internal_::hash_enum::c_X_Forwarded_Proto );
+static_assert( ignore_case::hash( "X-Frame-Options" ) == ignore_case::internal_::hash_enum::c_X_Frame_Options );
+static_assert( ignore_case::hash( "X-XSS-Protection" ) == ignore_case::internal_::hash_enum::c_X_XSS_Protection );
+static_assert( ignore_case::hash( "ACCEPT" ) == ignore_case::internal_::hash_enum::c_Accept );
+static_assert( ignore_case::hash( "ACCEPT-CHARSET" ) == ignore_case::internal_::hash_enum::c_Accept_Charset );
+static_assert( ignore_case::hash( "ACCEPT-ENCODING" ) == ignore_case::internal_::hash_enum::c_Accept_Encoding );
+static_assert( ignore_case::hash( "ACCEPT-LANGUAGE" ) == ignore_case::internal_::hash_enum::c_Accept_Language );
+static_assert( ignore_case::hash( "ACCEPT-RANGES" ) == ignore_case::internal_::hash_enum::c_Accept_Ranges );
+static_assert( ignore_case::hash( "ACCESS-CONTROL-ALLOW-CREDENTIALS" ) == ignore_case::internal_::hash_enum::c_Access_Control_Allow_Credentials );
+static_assert( ignore_case::hash( "ACCESS-CONTROL-ALLOW-HEADERS" ) == ignore_case::internal_::hash_enum::c_Access_Control_Allow_Headers );
+static_assert( ignore_case::hash( "ACCESS-CONTROL-ALLOW-METHODS" ) == ignore_case::internal_::hash_enum::c_Access_Control_Allow_Methods );
+static_assert( ignore_case::hash( "ACCESS-CONTROL-ALLOW-ORIGIN" ) == ignore_case::internal_::hash_enum::c_Access_Control_Allow_Origin );
+static_assert( ignore_case::hash( "ACCESS-CONTROL-EXPOSE-HEADERS" ) == ignore_case::internal_::hash_enum::c_Access_Control_Expose_Headers );
+static_assert( ignore_case::hash( "ACCESS-CONTROL-MAX-AGE" ) == ignore_case::internal_::hash_enum::c_Access_Control_Max_Age );
+static_assert( ignore_case::hash( "ACCESS-CONTROL-REQUEST-HEADERS" ) == ignore_case::internal_::hash_enum::c_Access_Control_Request_Headers );
+static_assert( ignore_case::hash( "ACCESS-CONTROL-REQUEST-METHOD" ) == ignore_case::internal_::hash_enum::c_Access_Control_Request_Method );
+static_assert( ignore_case::hash( "AGE" ) == ignore_case::internal_::hash_enum::c_Age );
+static_assert( ignore_case::hash( "ALLOW" ) == ignore_case::internal_::hash_enum::c_Allow );
+static_assert( ignore_case::hash( "AUTHORIZATION" ) == ignore_case::internal_::hash_enum::c_Authorization );
+static_assert( ignore_case::hash( "CACHE-CONTROL" ) == ignore_case::internal_::hash_enum::c_Cache_Control );
+static_assert( ignore_case::hash( "CLEAR-SITE-DATA" ) == ignore_case::internal_::hash_enum::c_Clear_Site_Data );
+static_assert( ignore_case::hash( "CONNECTION" ) == ignore_case::internal_::hash_enum::c_Connection );
+static_assert( ignore_case::hash( "CONTENT-DISPOSITION" ) == ignore_case::internal_::hash_enum::c_Content_Disposition );
+static_assert( ignore_case::hash( "CONTENT-ENCODING" ) == ignore_case::internal_::hash_enum::c_Content_Encoding );
+static_assert( ignore_case::hash( "CONTENT-LANGUAGE" ) == ignore_case::internal_::hash_enum::c_Content_Language );
+static_assert( ignore_case::hash( "CONTENT-LENGTH" ) == ignore_case::internal_::hash_enum::c_Content_Length );
+static_assert( ignore_case::hash( "CONTENT-LOCATION" ) == ignore_case::internal_::hash_enum::c_Content_Location );
+static_assert( ignore_case::hash( "CONTENT-RANGE" ) == ignore_case::internal_::hash_enum::c_Content_Range );
+static_assert( ignore_case::hash( "CONTENT-SECURITY-POLICY" ) == ignore_case::internal_::hash_enum::c_Content_Security_Policy );
+static_assert( ignore_case::hash( "CONTENT-SECURITY-POLICY-REPORT-ONLY" ) == ignore_case::internal_::hash_enum::c_Content_Security_Policy_Report_Only );
+static_assert( ignore_case::hash( "CONTENT-TYPE" ) == ignore_case::internal_::hash_enum::c_Content_Type );
+static_assert( ignore_case::hash( "COOKIE" ) == ignore_case::internal_::hash_enum::c_Cookie );
+static_assert( ignore_case::hash( "COOKIE2" ) == ignore_case::internal_::hash_enum::c_Cookie2 );
+static_assert( ignore_case::hash( "DNT" ) == ignore_case::internal_::hash_enum::c_DNT );
+static_assert( ignore_case::hash( "DATE" ) == ignore_case::internal_::hash_enum::c_Date );
+static_assert( ignore_case::hash( "ETAG" ) == ignore_case::internal_::hash_enum::c_ETag );
+static_assert( ignore_case::hash( "EXPECT" ) == ignore_case::internal_::hash_enum::c_Expect );
+static_assert( ignore_case::hash( "EXPECT-CT" ) == ignore_case::internal_::hash_enum::c_Expect_CT );
+static_assert( ignore_case::hash( "EXPIRES" ) == ignore_case::internal_::hash_enum::c_Expires );
+static_assert( ignore_case::hash( "FEATURE-POLICY" ) == ignore_case::internal_::hash_enum::c_Feature_Policy );
+static_assert( ignore_case::hash( "FORWARDED" ) == ignore_case::internal_::hash_enum::c_Forwarded );
+static_assert( ignore_case::hash( "FROM" ) == ignore_case::internal_::hash_enum::c_From );
+static_assert( ignore_case::hash( "HOST" ) == ignore_case::internal_::hash_enum::c_Host );
+static_assert( ignore_case::hash( "IF-MATCH" ) == ignore_case::internal_::hash_enum::c_If_Match );
+static_assert( ignore_case::hash( "IF-MODIFIED-SINCE" ) == ignore_case::internal_::hash_enum::c_If_Modified_Since );
+static_assert( ignore_case::hash( "IF-NONE-MATCH" ) == ignore_case::internal_::hash_enum::c_If_None_Match );
+static_assert( ignore_case::hash( "IF-RANGE" ) == ignore_case::internal_::hash_enum::c_If_Range );
+static_assert( ignore_case::hash( "IF-UNMODIFIED-SINCE" ) == ignore_case::internal_::hash_enum::c_If_Unmodified_Since );
+static_assert( ignore_case::hash( "KEEP-ALIVE" ) == ignore_case::internal_::hash_enum::c_Keep_Alive );
+static_assert( ignore_case::hash( "LARGE-ALLOCATION" ) == ignore_case::internal_::hash_enum::c_Large_Allocation );
+static_assert( ignore_case::hash( "LAST-MODIFIED" ) == ignore_case::internal_::hash_enum::c_Last_Modified );
+static_assert( ignore_case::hash( "LOCATION" ) == ignore_case::internal_::hash_enum::c_Location );
+static_assert( ignore_case::hash( "ORIGIN" ) == ignore_case::internal_::hash_enum::c_Origin );
+static_assert( ignore_case::hash( "PRAGMA" ) == ignore_case::internal_::hash_enum::c_Pragma );
+static_assert( ignore_case::hash( "PROXY-AUTHENTICATE" ) == ignore_case::internal_::hash_enum::c_Proxy_Authenticate );
+static_assert( ignore_case::hash( "PROXY-AUTHORIZATION" ) == ignore_case::internal_::hash_enum::c_Proxy_Authorization );
+static_assert( ignore_case::hash( "PUBLIC-KEY-PINS" ) == ignore_case::internal_::hash_enum::c_Public_Key_Pins );
+static_assert( ignore_case::hash( "PUBLIC-KEY-PINS-REPORT-ONLY" ) == ignore_case::internal_::hash_enum::c_Public_Key_Pins_Report_Only );
+static_assert( ignore_case::hash( "RANGE" ) == ignore_case::internal_::hash_enum::c_Range );
+static_assert( ignore_case::hash( "REFERER" ) == ignore_case::internal_::hash_enum::c_Referer );
+static_assert( ignore_case::hash( "REFERRER-POLICY" ) == ignore_case::internal_::hash_enum::c_Referrer_Policy );
+static_assert( ignore_case::hash( "RETRY-AFTER" ) == ignore_case::internal_::hash_enum::c_Retry_After );
+static_assert( ignore_case::hash( "SEC-WEBSOCKET-ACCEPT" ) == ignore_case::internal_::hash_enum::c_Sec_WebSocket_Accept );
+static_assert( ignore_case::hash( "SERVER" ) == ignore_case::internal_::hash_enum::c_Server );
+static_assert( ignore_case::hash( "SERVER-TIMING" ) == ignore_case::internal_::hash_enum::c_Server_Timing );
+static_assert( ignore_case::hash( "SET-COOKIE" ) == ignore_case::internal_::hash_enum::c_Set_Cookie );
+static_assert( ignore_case::hash( "SET-COOKIE2" ) == ignore_case::internal_::hash_enum::c_Set_Cookie2 );
+static_assert( ignore_case::hash( "SOURCEMAP" ) == ignore_case::internal_::hash_enum::c_SourceMap );
+static_assert( ignore_case::hash( "STRICT-TRANSPORT-SECURITY" ) == ignore_case::internal_::hash_enum::c_Strict_Transport_Security );
+static_assert( ignore_case::hash( "TE" ) == ignore_case::internal_::hash_enum::c_TE );
+static_assert( ignore_case::hash( "TIMING-ALLOW-ORIGIN" ) == ignore_case::internal_::hash_enum::c_Timing_Allow_Origin );
+static_assert( ignore_case::hash( "TK" ) == ignore_case::internal_::hash_enum::c_Tk );
+static_assert( ignore_case::hash( "TRAILER" ) == ignore_case::internal_::hash_enum::c_Trailer );
+static_assert( ignore_case::hash( "TRANSFER-ENCODING" ) == ignore_case::internal_::hash_enum::c_Transfer_Encoding );
+static_assert( ignore_case::hash( "UPGRADE-INSECURE-REQUESTS" ) == ignore_case::internal_::hash_enum::c_Upgrade_Insecure_Requests );
+static_assert( ignore_case::hash( "USER-AGENT" ) == ignore_case::internal_::hash_enum::c_User_Agent );
+static_assert( ignore_case::hash( "VARY" ) == ignore_case::internal_::hash_enum::c_Vary );
+static_assert( ignore_case::hash( "VIA" ) == ignore_case::internal_::hash_enum::c_Via );
+static_assert( ignore_case::hash( "WWW-AUTHENTICATE" ) == ignore_case::internal_::hash_enum::c_WWW_Authenticate );
+static_assert( ignore_case::hash( "WARNING" ) == ignore_case::internal_::hash_enum::c_Warning );
+static_assert( ignore_case::hash( "X-CONTENT-TYPE-OPTIONS" ) == ignore_case::internal_::hash_enum::c_X_Content_Type_Options );
+static_assert( ignore_case::hash( "X-DNS-PREFETCH-CONTROL" ) == ignore_case::internal_::hash_enum::c_X_DNS_Prefetch_Control );
+static_assert( ignore_case::hash( "X-FORWARDED-FOR" ) == ignore_case::internal_::hash_enum::c_X_Forwarded_For );
+static_assert( ignore_case::hash( "X-FORWARDED-HOST" ) == ignore_case::internal_::hash_enum::c_X_Forwarded_Host );
+static_assert( ignore_case::hash( "X-FORWARDED-PROTO" ) == ignore_case::internal_::hash_enum::c_X_Forwarded_Proto );
+static_assert( ignore_case::hash( "X-FRAME-OPTIONS" ) == ignore_case::internal_::hash_enum::c_X_Frame_Options );
+static_assert( ignore_case::hash( "X-XSS-PROTECTION" ) == ignore_case::internal_::hash_enum::c_X_XSS_Protection );
+
+#endif // IGNORE_CASE__HASH_HPP_
@@ -0,0 +1,665 @@
+#ifndef STATUS__REASON_HPP_
+#define STATUS__REASON_HPP_
+
+#include <array>
+#include <string_view>
+
+namespace status {
+
+namespace internal_ {
+
+enum class reason_enum
+{
+    default_ = -1,
+    c_Continue = 0,
+    c_Switching_Protocols = 1,
+    c_OK = 2,
+    c_Created = 3,
+    c_Accepted = 4,
+    c_No_Content = 5,
+    c_Partial_Content = 6,
+    c_Multiple_Choices = 7,
+    c_Moved_Permanently = 8,
+    c_Found = 9,
+    c_See_Other = 10,
+    c_Not_Modified = 11,
+    c_Temporary_Redirect = 12,
+    c_Permanent_Redirect = 13,
+    c_Bad_Request = 14,
+    c_Unauthorized = 15,
+    c_Forbidden = 16,
+    c_Not_Found = 17,
+    c_Method_Not_Allowed = 18,
+    c_Not_Acceptable = 19,
+    c_Request_Timeout = 20,
+    c_Conflict = 21,
+    c_Gone = 22,
+    c_Length_Required = 23,
+    c_Payload_Too_Large = 24,
+    c_URI_Too_Long = 25,
+    c_Unsupported_Media_Type = 26,
+    c_Too_Many_Requests = 27,
+    c_Internal_Server_Error = 28,
+    c_Not_Implemented = 29,
+    c_Bad_Gateway = 30,
+    c_Service_Unavailable = 31,
+    c_Gateway_Timeout = 32,
+};
+
+} // namespace internal_
+
+// Number of keywords, enum values other than the default are in [ 0, reason_count )
+constexpr size_t reason_count = 33;
+
+constexpr internal_::reason_enum reason( std::string_view s );
+
+using reason_value_type = int;
+
+// Returns the value given to keyword s, nullptr if s is not a keyword
+constexpr const reason_value_type* reason_value( std::string_view s );
+
+namespace internal_ {
+
+constexpr std::array< reason_value_type, 33 > values = {{
+    100, // Continue
+    101, // Switching Protocols
+    200, // OK
+    201, // Created
+    202, // Accepted
+    204, // No Content
+    206, // Partial Content
+    300, // Multiple Choices
+    301, // Moved Permanently
+    302, // Found
+    303, // See Other
+    304, // Not Modified
+    307, // Temporary Redirect
+    308, // Permanent Redirect
+    400, // Bad Request
+    401, // Unauthorized
+    403, // Forbidden
+    404, // Not Found
+    405, // Method Not Allowed
+    406, // Not Acceptable
+    408, // Request Timeout
+    409, // Conflict
+    410, // Gone
+    411, // Length Required
+    413, // Payload Too Large
+    414, // URI Too Long
+    415, // Unsupported Media Type
+    429, // Too Many Requests
+    500, // Internal Server Error
+    501, // Not Implemented
+    502, // Bad Gateway
+    503, // Service Unavailable
+    504, // Gateway Timeout
+}};
+
+} // namespace internal_
+
+constexpr internal_::reason_enum reason( std::string_view s )
+{
+    switch ( s.size() )
+    {
+    case 2:
+        if ( s == "OK" )
+        {
+            return internal_::reason_enum::c_OK;
+        }
+        break;
+    case 4:
+        if ( s == "Gone" )
+        {
+            return internal_::reason_enum::c_Gone;
+        }
+        break;
+    case 5:
+        if ( s == "Found" )
+        {
+            return internal_::reason_enum::c_Found;
+        }
+        break;
+    case 7:
+        if ( s == "Created" )
+        {
+            return internal_::reason_enum::c_Created;
+        }
+        break;
+    case 8:
+        switch ( s[ 3 ] )
+        {
+        case 'e':
+            if ( s == "Accepted" )
+            {
+                return internal_::reason_enum::c_Accepted;
+            }
+            break;
+        case 'f':
+            if ( s == "Conflict" )
+            {
+                return internal_::reason_enum::c_Conflict;
+            }
+            break;
+        case 't':
+            if ( s == "Continue" )
+            {
+                return internal_::reason_enum::c_Continue;
+            }
+            break;
+        }
+        break;
+    case 9:
+        switch ( s[ 0 ] )
+        {
+        case 'F':
+            if ( s == "Forbidden" )
+            {
+                return internal_::reason_enum::c_Forbidden;
+            }
+            break;
+        case 'N':
+            if ( s == "Not Found" )
+            {
+                return internal_::reason_enum::c_Not_Found;
+            }
+            break;
+        case 'S':
+            if ( s == "See Other" )
+            {
+                return internal_::reason_enum::c_See_Other;
+            }
+            break;
+        }
+        break;
+    case 10:
+        if ( s == "No Content" )
+        {
+            return internal_::reason_enum::c_No_Content;
+        }
+        break;
+    case 11:
+        switch ( s[ 4 ] )
+        {
+        case 'G':
+            if ( s == "Bad Gateway" )
+            {
+                return internal_::reason_enum::c_Bad_Gateway;
+            }
+            break;
+        case 'R':
+            if ( s == "Bad Request" )
+            {
+                return internal_::reason_enum::c_Bad_Request;
+            }
+            break;
+        }
+        break;
+    case 12:
+        switch ( s[ 1 ] )
+        {
+        case 'R':
+            if ( s == "URI Too Long" )
+            {
+                return internal_::reason_enum::c_URI_Too_Long;
+            }
+            break;
+        case 'n':
+            if ( s == "Unauthorized" )
+            {
+                return internal_::reason_enum::c_Unauthorized;
+            }
+            break;
+        case 'o':
+            if ( s == "Not Modified" )
+            {
+                return internal_::reason_enum::c_Not_Modified;
+            }
+            break;
+        }
+        break;
+    case 14:
+        if ( s == "Not Acceptable" )
+        {
+            return internal_::reason_enum::c_Not_Acceptable;
+        }
+        break;
+    case 15:
+        switch ( s[ 0 ] )
+        {
+        case 'G':
+            if ( s == "Gateway Timeout" )
+            {
+                return internal_::reason_enum::c_Gateway_Timeout;
+            }
+            break;
+        case 'L':
+            if ( s == "Length Required" )
+            {
+                return internal_::reason_enum::c_Length_Required;
+            }
+            break;
+        case 'N':
+            if ( s == "Not Implemented" )
+            {
+                return internal_::reason_enum::c_Not_Implemented;
+            }
+            break;
+        case 'P':
+            if ( s == "Partial Content" )
+            {
+                return internal_::reason_enum::c_Partial_Content;
+            }
+            break;
+        case 'R':
+            if ( s == "Request Timeout" )
+            {
+                return internal_::reason_enum::c_Request_Timeout;
+            }
+            break;
+        }
+        break;
+    case 16:
+        if ( s == "Multiple Choices" )
+        {
+            return internal_::reason_enum::c_Multiple_Choices;
+        }
+        break;
+    case 17:
+        switch ( s[ 0 ] )
+        {
+        case 'M':
+            if ( s == "Moved Permanently" )
+            {
+                return internal_::reason_enum::c_Moved_Permanently;
+            }
+            break;
+        case 'P':
+            if ( s == "Payload Too Large" )
+            {
+                return internal_::reason_enum::c_Payload_Too_Large;
+            }
+            break;
+        case 'T':
+            if ( s == "Too Many Requests" )
+            {
+                return internal_::reason_enum::c_Too_Many_Requests;
+            }
+            break;
+        }
+        break;
+    case 18:
+        switch ( s[ 0 ] )
+        {
+        case 'M':
+            if ( s == "Method Not Allowed" )
+            {
+                return internal_::reason_enum::c_Method_Not_Allowed;
+            }
+            break;
+        case 'P':
+            if ( s == "Permanent Redirect" )
+            {
+                return internal_::reason_enum::c_Permanent_Redirect;
+            }
+            break;
+        case 'T':
+            if ( s == "Temporary Redirect" )
+            {
+                return internal_::reason_enum::c_Temporary_Redirect;
+            }
+            break;
+        }
+        break;
+    case 19:
+        switch ( s[ 1 ] )
+        {
+        case 'e':
+            if ( s == "Service Unavailable" )
+            {
+                return internal_::reason_enum::c_Service_Unavailable;
+            }
+            break;
+        case 'w':
+            if ( s == "Switching Protocols" )
+            {
+                return internal_::reason_enum::c_Switching_Protocols;
+            }
+            break;
+        }
+        break;
+    case 21:
+        if ( s == "Internal Server Error" )
+        {
+            return internal_::reason_enum::c_Internal_Server_Error;
+        }
+        break;
+    case 22:
+        if ( s == "Unsupported Media Type" )
+        {
+            return internal_::reason_enum::c_Unsupported_Media_Type;
+        }
+        break;
+    }
+
+    return internal_::reason_enum::default_;
+}
+
+constexpr const reason_value_type* reason_value( std::string_view s )
+{
+    switch ( s.size() )
+    {
+    case 2:
+        if ( s == "OK" )
+        {
+            return &internal_::values[ 2 ];
+        }
+        break;
+    case 4:
+        if ( s == "Gone" )
+        {
+            return &internal_::values[ 22 ];
+        }
+        break;
+    case 5:
+        if ( s == "Found" )
+        {
+            return &internal_::values[ 9 ];
+        }
+        break;
+    case 7:
+        if ( s == "Created" )
+        {
+            return &internal_::values[ 3 ];
+        }
+        break;
+    case 8:
+        switch ( s[ 3 ] )
+        {
+        case 'e':
+            if ( s == "Accepted" )
+            {
+                return &internal_::values[ 4 ];
+            }
+            break;
+        case 'f':
+            if ( s == "Conflict" )
+            {
+                return &internal_::values[ 21 ];
+            }
+            break;
+        case 't':
+            if ( s == "Continue" )
+            {
+                return &internal_::values[ 0 ];
+            }
+            break;
+        }
+        break;
+    case 9:
+        switch ( s[ 0 ] )
+        {
+        case 'F':
+            if ( s == "Forbidden" )
+            {
+                return &internal_::values[ 16 ];
+            }
+            break;
+        case 'N':
+            if ( s == "Not Found" )
+            {
+                return &internal_::values[ 17 ];
+            }
+            break;
+        case 'S':
+            if ( s == "See Other" )
+            {
+                return &internal_::values[ 10 ];
+            }
+            break;
+        }
+        break;
+    case 10:
+        if ( s == "No Content" )
+        {
+            return &internal_::values[ 5 ];
+        }
+        break;
+    case 11:
+        switch ( s[ 4 ] )
+        {
+        case 'G':
+            if ( s == "Bad Gateway" )
+            {
+                return &internal_::values[ 30 ];
+            }
+            break;
+        case 'R':
+            if ( s == "Bad Request" )
+            {
+                return &internal_::values[ 14 ];
+            }
+            break;
+        }
+        break;
+    case 12:
+        switch ( s[ 1 ] )
+        {
+        case 'R':
+            if ( s == "URI Too Long" )
+            {
+                return &internal_::values[ 25 ];
+            }
+            break;
+        case 'n':
+            if ( s == "Unauthorized" )
+            {
+                return &internal_::values[ 15 ];
+            }
+            break;
+        case 'o':
+            if ( s == "Not Modified" )
+            {
+                return &internal_::values[ 11 ];
+            }
+            break;
+        }
+        break;
+    case 14:
+        if ( s == "Not Acceptable" )
+        {
+            return &internal_::values[ 19 ];
+        }
+        break;
+    case 15:
+        switch ( s[ 0 ] )
+        {
+        case 'G':
+            if ( s == "Gateway Timeout" )
+            {
+                return &internal_::values[ 32 ];
+            }
+            break;
+        case 'L':
+            if ( s == "Length Required" )
+            {
+                return &internal_::values[ 23 ];
+            }
+            break;
+        case 'N':
+            if ( s == "Not Implemented" )
+            {
+                return &internal_::values[ 29 ];
+            }
+            break;
+        case 'P':
+            if ( s == "Partial Content" )
+            {
+                return &internal_::values[ 6 ];
+            }
+            break;
+        case 'R':
+            if ( s == "Request Timeout" )
+            {
+                return &internal_::values[ 20 ];
+            }
+            break;
+        }
+        break;
+    case 16:
+        if ( s == "Multiple Choices" )
+        {
+            return &internal_::values[ 7 ];
+        }
+        break;
+    case 17:
+        switch ( s[ 0 ] )
+        {
+        case 'M':
+            if ( s == "Moved Permanently" )
+            {
+                return &internal_::values[ 8 ];
+            }
+            break;
+        case 'P':
+            if ( s == "Payload Too Large" )
+            {
+                return &internal_::values[ 24 ];
+            }
+            break;
+        case 'T':
+            if ( s == "Too Many Requests" )
+            {
+                return &internal_::values[ 27 ];
+            }
+            break;
+        }
+        break;
+    case 18:
+        switch ( s[ 0 ] )
+        {
+        case 'M':
+            if ( s == "Method Not Allowed" )
+            {
+                return &internal_::values[ 18 ];
+            }
+            break;
+        case 'P':
+            if ( s == "Permanent Redirect" )
+            {
+                return &internal_::values[ 13 ];
+            }
+            break;
+        case 'T':
+            if ( s == "Temporary Redirect" )
+            {
+                return &internal_::values[ 12 ];
+            }
+            break;
+        }
+        break;
+    case 19:
+        switch ( s[ 1 ] )
+        {
+        case 'e':
+            if ( s == "Service Unavailable" )
+            {
+                return &internal_::values[ 31 ];
+            }
+            break;
+        case 'w':
+            if ( s == "Switching Protocols" )
+            {
+                return &internal_::values[ 1 ];
+            }
+            break;
+        }
+        break;
+    case 21:
+        if ( s == "Internal Server Error" )
+        {
+            return &internal_::values[ 28 ];
+        }
+        break;
+    case 22:
+        if ( s == "Unsupported Media Type" )
+        {
+            return &internal_::values[ 26 ];
+        }
+        break;
+    }
+
+    return nullptr;
+}
+
+} // namespace status {
+
+// Extra check for safety
+static_assert( status::reason( "Continue" ) == status::internal_::reason_enum::c_Continue );
+static_assert( status::reason( "Switching Protocols" ) == status::internal_::reason_enum::c_Switching_Protocols );
+static_assert( status::reason( "OK" ) == status::internal_::reason_enum::c_OK );
+static_assert( status::reason( "Created" ) == status::internal_::reason_enum::c_Created );
+static_assert( status::reason( "Accepted" ) == status::internal_::reason_enum::c_Accepted );
+static_assert( status::reason( "No Content" ) == status::internal_::reason_enum::c_No_Content );
+static_assert( status::reason( "Partial Content" ) == status::internal_::reason_enum::c_Partial_Content );
+static_assert( status::reason( "Multiple Choices" ) == status::internal_::reason_enum::c_Multiple_Choices );
+static_assert( status::reason( "Moved Permanently" ) == status::internal_::reason_enum::c_Moved_Permanently );
+static_assert( status::reason( "Found" ) == status::internal_::reason_enum::c_Found );
+static_assert( status::reason( "See Other" ) == status::internal_::reason_enum::c_See_Other );
+static_assert( status::reason( "Not Modified" ) == status::internal_::reason_enum::c_Not_Modified );
+static_assert( status::reason( "Temporary Redirect" ) == status::internal_::reason_enum::c_Temporary_Redirect );
+static_assert( status::reason( "Permanent Redirect" ) == status::internal_::reason_enum::c_Permanent_Redirect );
+static_assert( status::reason( "Bad Request" ) == status::internal_::reason_enum::c_Bad_Request );
+static_assert( status::reason( "Unauthorized" ) == status::internal_::reason_enum::c_Unauthorized );
+static_assert( status::reason( "Forbidden" ) == status::internal_::reason_enum::c_Forbidden );
+static_assert( status::reason( "Not Found" ) == status::internal_::reason_enum::c_Not_Found );
+static_assert( status::reason( "Method Not Allowed" ) == status::internal_::reason_enum::c_Method_Not_Allowed );
+static_assert( status::reason( "Not Acceptable" ) == status::internal_::reason_enum::c_Not_Acceptable );
+static_assert( status::reason( "Request Timeout" ) == status::internal_::reason_enum::c_Request_Timeout );
+static_assert( status::reason( "Conflict" ) == status::internal_::reason_enum::c_Conflict );
+static_assert( status::reason( "Gone" ) == status::internal_::reason_enum::c_Gone );
+static_assert( status::reason( "Length Required" ) == status::internal_::reason_enum::c_Length_Required );
+static_assert( status::reason( "Payload Too Large" ) == status::internal_::reason_enum::c_Payload_Too_Large );
+static_assert( status::reason( "URI Too Long" ) == status::internal_::reason_enum::c_URI_Too_Long );
+static_assert( status::reason( "Unsupported Media Type" ) == status::internal_::reason_enum::c_Unsupported_Media_Type );
+static_assert( status::reason( "Too Many Requests" ) == status::internal_::reason_enum::c_Too_Many_Requests );
+static_assert( status::reason( "Internal Server Error" ) == status::internal_::reason_enum::c_Internal_Server_Error );
+static_assert( status::reason( "Not Implemented" ) == status::internal_::reason_enum::c_Not_Implemented );
+static_assert( status::reason( "Bad Gateway" ) == status::internal_::reason_enum::c_Bad_Gateway );
+static_assert( status::reason( "Service Unavailable" ) == status::internal_::reason_enum::c_Service_Unavailable );
+static_assert( status::reason( "Gateway Timeout" ) == status::internal_::reason_enum::c_Gateway_Timeout );
+static_assert( status::reason_value( "Continue" ) != nullptr );
+static_assert( status::reason_value( "Switching Protocols" ) != nullptr );
+static_assert( status::reason_value( "OK" ) != nullptr );
+static_assert( status::reason_value( "Created" ) != nullptr );
+static_assert( status::reason_value( "Accepted" ) != nullptr );
+static_assert( status::reason_value( "No Content" ) != nullptr );
+static_assert( status::reason_value( "Partial Content" ) != nullptr );
+static_assert( status::reason_value( "Multiple Choices" ) != nullptr );
+static_assert( status::reason_value( "Moved Permanently" ) != nullptr );
+static_assert( status::reason_value( "Found" ) != nullptr );
+static_assert( status::reason_value( "See Other" ) != nullptr );
+static_assert( status::reason_value( "Not Modified" ) != nullptr );
+static_assert( status::reason_value( "Temporary Redirect" ) != nullptr );
+static_assert( status::reason_value( "Permanent Redirect" ) != nullptr );
+static_assert( status::reason_value( "Bad Request" ) != nullptr );
+static_assert( status::reason_value( "Unauthorized" ) != nullptr );
+static_assert( status::reason_value( "Forbidden" ) != nullptr );
+static_assert( status::reason_value( "Not Found" ) != nullptr );
+static_assert( status::reason_value( "Method Not Allowed" ) != nullptr );
+static_assert( status::reason_value( "Not Acceptable" ) != nullptr );
+static_assert( status::reason_value( "Request Timeout" ) != nullptr );
+static_assert( status::reason_value( "Conflict" ) != nullptr );
+static_assert( status::reason_value( "Gone" ) != nullptr );
+static_assert( status::reason_value( "Length Required" ) != nullptr );
+static_assert( status::reason_value( "Payload Too Large" ) != nullptr );
+static_assert( status::reason_value( "URI Too Long" ) != nullptr );
+static_assert( status::reason_value( "Unsupported Media Type" ) != nullptr );
+static_assert( status::reason_value( "Too Many Requests" ) != nullptr );
+static_assert( status::reason_value( "Internal Server Error" ) != nullptr );
+static_assert( status::reason_value( "Not Implemented" ) != nullptr );
+static_assert( status::reason_value( "Bad Gateway" ) != nullptr );
+static_assert( status::reason_value( "Service Unavailable" ) != nullptr );
+static_assert( status::reason_value( "Gateway Timeout" ) != nullptr );
+
+#endif // STATUS__REASON_HPP_
@@ -0,0 +1,243 @@
+// Lookup structures shared between threads
+// (C) Copyright 2018 Mustafa Serdar Sanli <mserdarsanli@gmail.com>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "concurrent.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+/* ================================ Reloading =============================== */
+
+ReloadablePerfectHash::ReloadablePerfectHash( const std::vector< std::string > &words, SearchOptions options )
+    : m_options( options )
+    , m_current( new PerfectHashTable( words, options ) )
+    , m_thread( &ReloadablePerfectHash::run, this )
+{
+}
+
+ReloadablePerfectHash::~ReloadablePerfectHash()
+{
+    {
+        std::lock_guard< std::mutex > lock( m_mutex );
+        m_stopping = true;
+    }
+    m_requested.notify_one();
+    m_thread.join();
+
+    delete m_current.load();
+}
+
+std::future< void > ReloadablePerfectHash::reload( std::vector< std::string > words )
+{
+    std::promise< void > published;
+    std::future< void > res = published.get_future();
+    {
+        std::lock_guard< std::mutex > lock( m_mutex );
+        m_requests.emplace_back( std::move( words ), std::move( published ) );
+    }
+    m_requested.notify_one();
+    return res;
+}
+
+void ReloadablePerfectHash::synchronize()
+{
+    /* A reader may have read the parity just before a flip and announce
+       itself under it after the wait below, hence the second flip.  Such a
+       reader reads the table after the one it announced, so it already sees
+       the replacement.  */
+    for ( int phase = 0; phase < 2; ++phase )
+    {
+        unsigned int previous = m_parity.load();
+        m_parity.store( previous ^ 1 );
+
+        for ( const Shard &shard : m_shards )
+            while ( shard.readers[ previous ].load() != 0 )
+                std::this_thread::yield();
+    }
+}
+
+void ReloadablePerfectHash::run()
+{
+    for (;;)
+    {
+        std::pair< std::vector< std::string >, std::promise< void > > request;
+        {
+            std::unique_lock< std::mutex > lock( m_mutex );
+            m_requested.wait( lock, [ this ]() { return m_stopping || !m_requests.empty(); } );
+            if ( m_requests.empty() )
+                return;
+            request = std::move( m_requests.front() );
+            m_requests.pop_front();
+        }
+
+        const PerfectHashTable *table;
+        try
+        {
+            table = new PerfectHashTable( request.first, m_options );
+        }
+        catch ( ... )
+        {
+            request.second.set_exception( std::current_exception() );
+            continue;
+        }
+
+        const PerfectHashTable *replaced = m_current.exchange( table );
+        request.second.set_value();
+
+        synchronize();
+        delete replaced;
+    }
+}
+
+/* ================================ Interning =============================== */
+
+static
+uint64_t hash_bytes( std::string_view s )
+{
+    uint64_t h = 0x9E3779B97F4A7C15ull ^ s.size();
+    for ( size_t i = 0; i < s.size(); i += 8 )
+    {
+        uint64_t word = 0;
+        std::memcpy( &word, s.data() + i, std::min< size_t >( 8, s.size() - i ) );
+        h = ( h ^ word ) * 0xBF58476D1CE4E5B9ull;
+        h ^= h >> 31;
+    }
+    h *= 0x94D049BB133111EBull;
+    return h ^ ( h >> 29 );
+}
+
+/* Mask of a power of 2 number of slots, more than twice the capacity.  */
+static
+size_t slot_mask( size_t capacity )
+{
+    size_t slots = 2;
+    while ( slots <= 2 * capacity )
+        slots *= 2;
+    return slots - 1;
+}
+
+OverflowTable::OverflowTable( size_t capacity, size_t max_bytes )
+    : m_capacity( std::min< size_t >( capacity, UINT32_MAX - 1 ) )
+    , m_mask( slot_mask( m_capacity ) )
+    , m_slots( new std::atomic< uint64_t >[ m_mask + 1 ]() )
+    , m_names( new Name[ m_capacity ] )
+    , m_max_bytes( max_bytes )
+{
+}
+
+const char* OverflowTable::store( std::string_view s )
+{
+    constexpr size_t BlockSize = 64 * 1024;
+
+    for (;;)
+    {
+        Block *block = m_block.load( std::memory_order_acquire );
+        if ( block )
+        {
+            size_t offset = block->used.fetch_add( s.size() );
+            if ( offset + s.size() <= block->size )
+            {
+                std::memcpy( block->data.get() + offset, s.data(), s.size() );
+                return block->data.get() + offset;
+            }
+        }
+
+        /* The block is full, the first thread to get here appends a new one
+           and others retry on it.  */
+        std::lock_guard< std::mutex > lock( m_blocks_mutex );
+        if ( m_block.load() == block )
+        {
+            m_blocks.push_back( std::make_unique< Block >( std::max( BlockSize, s.size() ) ) );
+            m_block.store( m_blocks.back().get(), std::memory_order_release );
+        }
+    }
+}
+
+uint32_t OverflowTable::published_id( const std::atomic< uint64_t > &slot )
+{
+    uint64_t value;
+    while ( uint32_t( value = slot.load( std::memory_order_acquire ) ) == Pending )
+        std::this_thread::yield();
+    return uint32_t( value ) - 1;
+}
+
+int OverflowTable::intern( std::string_view s )
+{
+    uint64_t hash = hash_bytes( s );
+    uint64_t tag = hash & 0xFFFFFFFF00000000ull;
+
+    for ( size_t i = hash & m_mask; ; i = ( i + 1 ) & m_mask )
+    {
+        std::atomic< uint64_t > &slot = m_slots[ i ];
+        uint64_t value = slot.load( std::memory_order_acquire );
+
+        if ( value == 0 )
+        {
+            if ( m_reserved.fetch_add( 1 ) >= m_capacity )
+            {
+                m_reserved.fetch_sub( 1 );
+                return find( s );
+            }
+            if ( m_reserved_bytes.fetch_add( s.size() ) + s.size() > m_max_bytes )
+            {
+                m_reserved_bytes.fetch_sub( s.size() );
+                m_reserved.fetch_sub( 1 );
+                return find( s );
+            }
+
+            if ( slot.compare_exchange_strong( value, tag | Pending, std::memory_order_acq_rel ) )
+            {
+                uint32_t id = m_next_id.fetch_add( 1 );
+                m_names[ id ] = { store( s ), s.size() };
+                slot.store( tag | ( id + 1 ), std::memory_order_release );
+                return id;
+            }
+
+            /* Another string took the slot, it may be the same one.  */
+            m_reserved_bytes.fetch_sub( s.size() );
+            m_reserved.fetch_sub( 1 );
+        }
+
+        if ( ( value & 0xFFFFFFFF00000000ull ) == tag )
+        {
+            uint32_t id = published_id( slot );
+            if ( name( id ) == s )
+                return id;
+        }
+    }
+}
+
+int OverflowTable::find( std::string_view s ) const
+{
+    uint64_t hash = hash_bytes( s );
+    uint64_t tag = hash & 0xFFFFFFFF00000000ull;
+
+    for ( size_t i = hash & m_mask; ; i = ( i + 1 ) & m_mask )
+    {
+        const std::atomic< uint64_t > &slot = m_slots[ i ];
+        uint64_t value = slot.load( std::memory_order_acquire );
+
+        if ( value == 0 )
+            return -1;
+
+        if ( ( value & 0xFFFFFFFF00000000ull ) == tag )
+        {
+            uint32_t id = published_id( slot );
+            if ( name( id ) == s )
+                return id;
+        }
+    }
+}
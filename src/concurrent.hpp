@@ -0,0 +1,247 @@
+// Lookup structures shared between threads
+// (C) Copyright 2018 Mustafa Serdar Sanli <mserdarsanli@gmail.com>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// Kept apart from search.hpp, so that code only evaluating tables does not
+// need threads. Link with -pthread.
+
+#ifndef CONCURRENT_H_
+#define CONCURRENT_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "search.hpp"
+
+// Holds a PerfectHashTable which is replaced while other threads look up
+// keys, for keyword sets changing at run time. Replacement tables are built
+// on a background thread and published with an atomic pointer swap.
+//
+// Lookups never block: a reader announces itself with one atomic increment
+// on a counter shard, picked per thread, and reads the current table. A
+// replaced table is freed once no reader may still use it, userspace RCU
+// style: readers count under the parity of a grace period, and the
+// background thread flips the parity twice, waiting each time for readers
+// of the previous parity to leave.
+class ReloadablePerfectHash
+{
+public:
+    static constexpr size_t ShardCount = 16;
+
+    explicit ReloadablePerfectHash( const std::vector< std::string > &words = {}, SearchOptions options = {} );
+    ReloadablePerfectHash( const ReloadablePerfectHash & ) = delete;
+    ReloadablePerfectHash& operator=( const ReloadablePerfectHash & ) = delete;
+    ~ReloadablePerfectHash();
+
+    // Keeps the table current at its creation alive, so that several lookups
+    // can share the cost of announcing the reader. Guards should be short
+    // lived, a replaced table is not freed while a guard of it exists.
+    class ReadGuard
+    {
+    public:
+        ReadGuard( const ReadGuard & ) = delete;
+        ReadGuard& operator=( const ReadGuard & ) = delete;
+        ~ReadGuard() { m_readers->fetch_sub( 1, std::memory_order_release ); }
+
+        const PerfectHashTable& operator*() const { return *m_table; }
+        const PerfectHashTable* operator->() const { return m_table; }
+
+    private:
+        friend class ReloadablePerfectHash;
+        ReadGuard( std::atomic< uint64_t > *readers, const PerfectHashTable *table )
+            : m_readers( readers )
+            , m_table( table )
+        {
+        }
+
+        std::atomic< uint64_t > *m_readers;
+        const PerfectHashTable *m_table;
+    };
+
+    ReadGuard read() const
+    {
+        std::atomic< uint64_t > *readers = &m_shards[ shard_of_thread() ].readers[ m_parity.load() ];
+        readers->fetch_add( 1 );
+        return ReadGuard( readers, m_current.load() );
+    }
+
+    // Returns index of word in the words of the current table, or -1.
+    int find( std::string_view word ) const { return read()->find( word ); }
+
+    // Builds a table for words on the background thread and publishes it.
+    // Reloads are applied in order; the future is ready once this one is
+    // published, or holds the exception if words are not valid keywords.
+    std::future< void > reload( std::vector< std::string > words );
+
+private:
+    static size_t shard_of_thread()
+    {
+        static std::atomic< size_t > next_shard{ 0 };
+        thread_local size_t shard = next_shard++ % ShardCount;
+        return shard;
+    }
+
+    // Waits until no reader may use a table replaced before the call.
+    void synchronize();
+
+    void run();
+
+    struct alignas( 64 ) Shard
+    {
+        std::atomic< uint64_t > readers[ 2 ] = {}; // Readers which entered under each parity.
+    };
+
+    SearchOptions m_options;
+    std::atomic< const PerfectHashTable* > m_current;
+    mutable Shard m_shards[ ShardCount ];
+    std::atomic< unsigned int > m_parity{ 0 };
+
+    // Requests for the background thread, guarded by m_mutex.
+    std::mutex m_mutex;
+    std::condition_variable m_requested;
+    std::deque< std::pair< std::vector< std::string >, std::promise< void > > > m_requests;
+    bool m_stopping = false;
+    std::thread m_thread;
+};
+
+// Concurrent set of strings with dense ids, in order of insertion. Slots are
+// kept in a fixed open addressing table with linear probing, and strings in
+// an arena of blocks which are never moved, so ids and names stay valid for
+// the lifetime of the table. Inserting threads claim a slot with a single
+// compare-and-swap, lookups take no lock.
+class OverflowTable
+{
+public:
+    // Up to capacity strings of max_bytes in total can be inserted, which
+    // bounds memory used for strings from untrusted sources: slots grow with
+    // capacity, and the arena with max_bytes. The end of a block is left unused
+    // when the next string does not fit, so the arena may take up to twice
+    // max_bytes, and a block of 64 KiB.
+    explicit OverflowTable( size_t capacity = 1 << 16, size_t max_bytes = 1 << 22 );
+    OverflowTable( const OverflowTable & ) = delete;
+    OverflowTable& operator=( const OverflowTable & ) = delete;
+
+    // Returns id of s, inserting it if needed, or -1 if the table is full or
+    // s does not fit in the bytes left.
+    int intern( std::string_view s );
+
+    // Returns id of s, or -1 if it was not inserted.
+    int find( std::string_view s ) const;
+
+    // Returns the string of an id returned by intern().
+    std::string_view name( int id ) const { return { m_names[ id ].data, m_names[ id ].size }; }
+
+    size_t size() const { return m_next_id.load(); }
+
+private:
+    // Slot value of a string being inserted, its name is not published yet.
+    static constexpr uint32_t Pending = UINT32_MAX;
+
+    const char* store( std::string_view s );
+
+    // Returns id in the slot, waiting for a pending insert to finish.
+    static uint32_t published_id( const std::atomic< uint64_t > &slot );
+
+    struct Name
+    {
+        const char *data;
+        size_t size;
+    };
+
+    size_t m_capacity;
+    size_t m_mask;
+    std::unique_ptr< std::atomic< uint64_t >[] > m_slots; // Upper half of the hash, and id + 1, 0 if unused.
+    std::unique_ptr< Name[] > m_names;
+    std::atomic< size_t > m_reserved{ 0 }; // Slots claimed or being claimed, bounded by capacity.
+    size_t m_max_bytes;
+    std::atomic< size_t > m_reserved_bytes{ 0 }; // Size of strings claimed or being claimed, bounded by max_bytes.
+    std::atomic< uint32_t > m_next_id{ 0 };
+
+    // Arena, strings are appended to the last block with an atomic bump.
+    struct Block
+    {
+        explicit Block( size_t size ) : data( new char[ size ] ), size( size ) {}
+        std::unique_ptr< char[] > data;
+        size_t size;
+        std::atomic< size_t > used{ 0 };
+    };
+    std::mutex m_blocks_mutex;
+    std::vector< std::unique_ptr< Block > > m_blocks;
+    std::atomic< Block* > m_block{ nullptr };
+};
+
+// Interns strings to stable ids in two tiers. Keywords of a static set are
+// resolved by its lookup alone, a generated function or a PerfectHashTable,
+// to ids in [ 0, static_count ). Other strings go to an OverflowTable, and get
+// ids from static_count on, so the static tier never needs to be rebuilt.
+//
+//     Interner headers( header_count, []( std::string_view s ) { return (int)header( s ); } );
+template< typename Lookup >
+class Interner
+{
+public:
+    // lookup( s ) returns the id of a static keyword, or a negative value.
+    Interner( size_t static_count, Lookup lookup, size_t overflow_capacity = 1 << 16, size_t overflow_bytes = 1 << 22 )
+        : m_static_count( static_count )
+        , m_lookup( std::move( lookup ) )
+        , m_overflow( overflow_capacity, overflow_bytes )
+    {
+    }
+
+    // Returns id of s, adding it to the overflow tier if needed, or -1 if
+    // the overflow tier is full or s does not fit in the bytes left.
+    int intern( std::string_view s )
+    {
+        int id = m_lookup( s );
+        if ( id >= 0 )
+            return id;
+        id = m_overflow.intern( s );
+        return id < 0 ? id : m_static_count + id;
+    }
+
+    // Returns id of s, or -1 if it was never interned and is not static.
+    int find( std::string_view s ) const
+    {
+        int id = m_lookup( s );
+        if ( id >= 0 )
+            return id;
+        id = m_overflow.find( s );
+        return id < 0 ? id : m_static_count + id;
+    }
+
+    bool is_static( int id ) const { return id >= 0 && (size_t)id < m_static_count; }
+
+    // Returns the string of an id of the overflow tier.
+    std::string_view overflow_name( int id ) const { return m_overflow.name( id - m_static_count ); }
+
+    const OverflowTable& overflow() const { return m_overflow; }
+
+private:
+    size_t m_static_count;
+    Lookup m_lookup;
+    OverflowTable m_overflow;
+};
+
+#endif
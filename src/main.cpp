@@ -14,18 +14,53 @@
 // You should have received a copy of the GNU General Public License
 // along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
+#include <algorithm>
+#include <bitset>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <random>
+#include <sstream>
 #include <unordered_map>
 #include <unordered_set>
 
+#include <stdlib.h>
+
 #include "search.hpp"
 
 // Arguments passed in command line
 std::string arg_namespace;
 std::string arg_func_name;
 bool arg_new_format;
+bool arg_minimal;
+bool arg_emit_padded;
+bool arg_emit_unchecked;
+SearchOptions arg_search_options;
+std::string arg_backend = "auto";
+std::string arg_value_type;
+bool arg_dispatch;
+bool arg_emit_batch;
+bool arg_emit_pipelined;
+bool arg_emit_scan;
+bool arg_emit_matcher;
+bool arg_emit_find_all;
+bool arg_emit_classify_all;
+bool arg_emit_binary;
+bool arg_autotune;
+std::string arg_autotune_compiler = "c++ -std=c++17 -O2";
+std::string arg_autotune_sample;
+size_t arg_partition_by_length;
+std::string arg_dispatch_params;
+std::string arg_dispatch_return_type = "void";
+std::string arg_dispatch_default;
+
+// Values of keywords, given as `keyword<TAB>value` lines with --value-type,
+// handler statements with --dispatch, or payloads with --emit-binary
+std::unordered_map< std::string, std::string > keyword_values;
 
 struct EnumNameGen
 {
@@ -87,166 +122,297 @@ char ToHex( int a )
 static std::string StringEscape( const std::string &unescaped )
 {
     std::string res;
+    bool after_hex = false;
 
     for ( char c : unescaped )
     {
         if ( isprint( c ) )
         {
+            // Hex escapes take as many digits as follow, end the literal there
+            if ( after_hex && isxdigit( c ) )
+            {
+                res += "\" \"";
+            }
             if ( c == '\'' || c == '"' || c == '\\' )
             {
                 res.push_back( '\\' );
             }
             res.push_back( c );
+            after_hex = false;
         }
         else
         {
             res += "\\x";
             res.push_back( ToHex( static_cast< unsigned char >( c ) / 16 ) );
             res.push_back( ToHex( static_cast< unsigned char >( c ) % 16 ) );
+            after_hex = true;
         }
     }
 
     return res;
 }
 
-static void OutputCpp17Code( const PerfectHash &soln )
+// Returns value as a hexadecimal literal
+static std::string HexLiteral( uint64_t value )
 {
-    EnumNameGen enum_names;
+    std::ostringstream out;
+    out << "0x" << std::hex << std::uppercase << value << "ull";
+    return out.str();
+}
 
+// Emits a bitmap of used hash values and the number of used hash values
+// preceding each 64 bit word of it, so that rank of a hash value can be
+// computed with a single popcount. Rank of the hash value is used as the
+// index into a dense wordlist.
+static void OutputRankBitmap( const PerfectHash &soln )
+{
     int max_hash_value = soln.word_map.rbegin()->first;
+    size_t word_count = max_hash_value / 64 + 1;
 
-    size_t max_word_len = soln.word_map.begin()->second.size();
-    size_t min_word_len = soln.word_map.begin()->second.size();
+    std::vector< uint64_t > bitmap( word_count, 0 );
     for ( const auto &it : soln.word_map )
     {
-        max_word_len = std::max( max_word_len, it.second.size() );
-        min_word_len = std::min( min_word_len, it.second.size() );
+        bitmap[ it.first / 64 ] |= uint64_t( 1 ) << ( it.first % 64 );
     }
 
-    std::string guard_macro;
-    for ( char c : arg_namespace )
+    const char *rank_type = soln.word_map.size() < 65536 ? "uint16_t" : "uint32_t";
+
+    std::cout
+        << "constexpr int popcount( uint64_t x )\n"
+        << "{\n"
+        << "    x = x - ( ( x >> 1 ) & 0x5555555555555555ull );\n"
+        << "    x = ( x & 0x3333333333333333ull ) + ( ( x >> 2 ) & 0x3333333333333333ull );\n"
+        << "    x = ( x + ( x >> 4 ) ) & 0x0F0F0F0F0F0F0F0Full;\n"
+        << "    return ( x * 0x0101010101010101ull ) >> 56;\n"
+        << "}\n"
+        << "\n";
+
+    std::cout << "constexpr std::array< uint64_t, " << word_count << " > slot_bitmap = {\n";
+    for ( size_t i = 0; i < word_count; ++i )
     {
-        guard_macro.push_back( c == ':' ? '_' : c );
+        std::cout << "    0x" << std::hex << std::setw( 16 ) << std::setfill( '0' ) << std::uppercase << bitmap[ i ]
+                  << std::dec << std::setfill( ' ' ) << std::nouppercase << "ull,\n";
+    }
+    std::cout << "};\n\n";
 
+    std::cout << "constexpr std::array< " << rank_type << ", " << word_count << " > slot_rank = {\n";
+    {
+        size_t rank = 0;
+        for ( size_t i = 0; i < word_count; ++i )
+        {
+            std::cout << "    " << rank << ",\n";
+            rank += std::bitset< 64 >( bitmap[ i ] ).count();
+        }
     }
-    guard_macro += "__" + arg_func_name + "_HPP_";
-    for ( char &c : guard_macro )
+    std::cout << "};\n\n";
+}
+
+static std::pair< size_t, size_t > WordLengthRange( const PerfectHash &soln )
+{
+    size_t max_word_len = soln.word_map.begin()->second.size();
+    size_t min_word_len = soln.word_map.begin()->second.size();
+    for ( const auto &it : soln.word_map )
     {
-        c = toupper( c );
+        max_word_len = std::max( max_word_len, it.second.size() );
+        min_word_len = std::min( min_word_len, it.second.size() );
     }
+    return { min_word_len, max_word_len };
+}
 
+// Emits load_leN(), reading N bytes as a little endian integer. Compilers
+// turn the expanded form into a single unaligned load, while it is still
+// usable in constant expressions.
+static void OutputLoadLittleEndian( int width )
+{
     std::cout
-        << "#ifndef " << guard_macro << "\n"
-        << "#define " << guard_macro << "\n"
-        << "\n"
-        << "#include <array>\n"
-        << "#include <string_view>\n"
-        << "\n";
+        << "constexpr uint64_t load_le" << width << "( const char *p )\n"
+        << "{\n"
+        << "    return uint64_t( static_cast< unsigned char >( p[ 0 ] ) )";
 
-    if ( arg_namespace.size() )
+    for ( int i = 1; i < width; ++i )
     {
-        std::cout << "namespace " << arg_namespace << " {\n";
+        std::cout << "\n         | uint64_t( static_cast< unsigned char >( p[ " << i << " ] ) ) << " << i * 8;
     }
 
     std::cout
-        << "\n"
-        << "namespace internal_ {\n"
-        << "\n"
-        << "enum class " << arg_func_name << "_enum\n"
+        << ";\n"
+        << "}\n"
+        << "\n";
+}
+
+// Emits fold_case(), converting ASCII upper case letters in 8 bytes to lower
+// case, and optionally equals_ignore_case() comparing s against a lower case
+// keyword with it, 8 bytes at a time.
+static void OutputCaseFolding( bool with_equals )
+{
+    std::cout
+        << "constexpr uint64_t fold_case( uint64_t x )\n"
         << "{\n"
-        << "    " << enum_names.get_default_case_label() << " = -1,\n";
+        << "    const uint64_t heptets = x & 0x7F7F7F7F7F7F7F7Full;\n"
+        << "    const uint64_t ge_A = heptets + 0x3F3F3F3F3F3F3F3Full; // High bit set if >= 'A'\n"
+        << "    const uint64_t gt_Z = heptets + 0x2525252525252525ull; // High bit set if > 'Z'\n"
+        << "    const uint64_t upper = ge_A & ~gt_Z & ~x & 0x8080808080808080ull;\n"
+        << "    return x | ( upper >> 2 );\n"
+        << "}\n"
+        << "\n";
 
-    int idx = -1;
-    for ( const auto &it : soln.word_map )
+    if ( !with_equals )
     {
-        ++idx;
-        std::cout
-            << "    " << enum_names.get_case_label( it.second ) << " = " << idx << ",\n";
+        return;
     }
 
     std::cout
-        << "};\n"
-        << "\n"
-        << "} // namespace internal_\n"
+        << "constexpr bool equals_ignore_case( std::string_view s, std::string_view lower )\n"
+        << "{\n"
+        << "    if ( s.size() != lower.size() )\n"
+        << "    {\n"
+        << "        return false;\n"
+        << "    }\n"
         << "\n"
-        << "constexpr internal_::" << arg_func_name << "_enum " << arg_func_name << "( std::string_view s );\n"
+        << "    if ( s.size() < 8 )\n"
+        << "    {\n"
+        << "        uint64_t a = 0;\n"
+        << "        uint64_t b = 0;\n"
+        << "        for ( size_t i = 0; i < s.size(); ++i )\n"
+        << "        {\n"
+        << "            a |= uint64_t( static_cast< unsigned char >( s[ i ] ) ) << ( i * 8 );\n"
+        << "            b |= uint64_t( static_cast< unsigned char >( lower[ i ] ) ) << ( i * 8 );\n"
+        << "        }\n"
+        << "        return fold_case( a ) == b;\n"
+        << "    }\n"
         << "\n"
-        << "namespace internal_ {\n"
+        << "    // Last 8 bytes overlap with the previous ones, instead of a loop for the tail\n"
+        << "    uint64_t diff = fold_case( load_le8( s.data() + s.size() - 8 ) ) ^ load_le8( lower.data() + s.size() - 8 );\n"
+        << "    for ( size_t i = 0; i + 8 < s.size(); i += 8 )\n"
+        << "    {\n"
+        << "        diff |= fold_case( load_le8( s.data() + i ) ) ^ load_le8( lower.data() + i );\n"
+        << "    }\n"
+        << "    return diff == 0;\n"
+        << "}\n"
         << "\n";
+}
 
-    // TODO check on a flag to enable definitions for use from multiple translation units?
-
-    std::cout << "constexpr std::array< int, " << soln.asso_values.size() << " > asso_values = {\n";
+static std::string WindowLookup( const KeyWindow &window, size_t index, const std::string &asso_values )
+{
+    std::ostringstream res;
+    res << asso_values << "[ " << 256 * index << " + ";
 
-    for ( size_t i = 0; i < soln.asso_values.size(); ++i )
+    if ( window.width == 1 )
     {
-        if ( i % 10 == 0 )
+        res << "static_cast< unsigned char >( s[ ";
+        if ( window.offset < 0 )
         {
-            std::cout << "    ";
+            res << "s.size() - " << -window.offset;
         }
-
-        std::cout << std::setw( 6 ) << std::right << soln.asso_values[ i ] << ",";
-
-        if ( i % 10 == 9 || i == soln.asso_values.size() - 1 )
+        else
         {
-            std::cout << "\n";
+            res << window.offset;
         }
+        res << " ] )";
+    }
+    else
+    {
+        res << "( ( internal_::load_le" << window.width << "( s.data() + ";
+        if ( window.offset < 0 )
+        {
+            res << "s.size() - " << -window.offset;
+        }
+        else
+        {
+            res << window.offset;
+        }
+        res << " ) * 0x" << std::hex << std::uppercase << window.multiplier << "ull ) >> 56 )";
     }
 
-    std::cout << "};\n\n";
+    res << " ]";
+    return res.str();
+}
+
+// Emits statements computing hash_val of s for the wide window hash family.
+// Windows relative to the start are added in a fallthrough ladder like key
+// positions, windows relative to the end need only s to be long enough.
+static void OutputWindowHashComputation( const PerfectHash &soln, const std::string &asso_values )
+{
+    auto [ min_word_len, max_word_len ] = WordLengthRange( soln );
+
+    std::cout << "    size_t hash_val = s.size();\n";
+
+    for ( size_t j = 0; j < soln.key_windows.size(); ++j )
+    {
+        const KeyWindow &window = soln.key_windows[ j ];
+        if ( window.offset >= 0 )
+        {
+            continue;
+        }
 
+        if ( min_word_len < (size_t)-window.offset )
+        {
+            std::cout
+                << "    if ( s.size() >= " << -window.offset << " )\n"
+                << "    {\n"
+                << "        hash_val += " << WindowLookup( window, j, asso_values ) << ";\n"
+                << "    }\n";
+        }
+        else
+        {
+            std::cout << "    hash_val += " << WindowLookup( window, j, asso_values ) << ";\n";
+        }
+    }
 
     std::cout
-        << "struct word_entry\n"
-        << "{\n"
-        << "    std::string_view word;\n"
-        << "    " << arg_func_name << "_enum enum_val;\n"
-        << "};\n"
-        << "\n";
+        << "    switch( s.size() )\n"
+        << "    {\n";
 
-    std::cout << "constexpr std::array< word_entry, " << max_hash_value + 1 << " > wordlist = {{\n";
+    for ( int len = max_word_len; len > 0; --len )
     {
-        int index = 0;
-        for ( const auto &it : soln.word_map )
+        if ( len == (int)max_word_len )
         {
-            int hash = it.first;
-            const std::string &keyword = it.second;
-            std::string case_label = enum_names.get_case_label( keyword );
+            std::cout << "                       case " << len << ":\n";
+        }
+        else
+        {
+            std::cout << "    [[ fallthrough ]]; case " << len << ":\n";
+        }
 
-            while (index < hash )
+        bool empty = true;
+        for ( size_t j = 0; j < soln.key_windows.size(); ++j )
+        {
+            const KeyWindow &window = soln.key_windows[ j ];
+            if ( window.offset >= 0 && window.offset + window.width == len )
             {
-                std::cout << "    { \"\", " << arg_func_name << "_enum::" << enum_names.get_default_case_label() << " },\n";
-                ++index;
+                std::cout << "        hash_val += " << WindowLookup( window, j, asso_values ) << ";\n";
+                empty = false;
             }
+        }
 
-            std::cout << "    { \"" << StringEscape( keyword ) << "\", " << arg_func_name << "_enum::" << case_label << " },\n";
-            ++index;
+        if ( empty && len == 1 )
+        {
+            std::cout << "        ; // Prevent compiler error\n";
         }
     }
-    std::cout
-        << "}};\n"
-        << "\n"
-        << "} // namespace internal_\n"
-        << "\n";
 
     std::cout
-        << "constexpr internal_::" << arg_func_name << "_enum " << arg_func_name << "( std::string_view s )\n"
-        << "{\n"
-        << "    constexpr size_t MinWordLength = " << min_word_len << ";\n"
-        << "    constexpr size_t MaxWordLength = " << max_word_len << ";\n"
-        << "    constexpr size_t MaxHashValue = " << max_hash_value << ";\n"
-        << "\n"
-        // TODO is this check really useful, considering the switch below?
-        << "    if ( s.size() < MinWordLength || s.size() > MaxWordLength )\n"
-        << "    {\n"
-        << "        return internal_::" << arg_func_name << "_enum::" << enum_names.get_default_case_label() << ";\n"
         << "    }\n"
-        << "\n"
-        << "    size_t hash_val = s.size();\n";
+        << "\n";
+}
+
+// Emits statements computing hash_val of s, s.size() is expected to be
+// within the range of keyword lengths. asso_values names the table of soln.
+static void OutputHashComputation( const PerfectHash &soln, const std::string &asso_values = "internal_::asso_values" )
+{
+    if ( soln.key_windows.size() )
+    {
+        OutputWindowHashComputation( soln, asso_values );
+        return;
+    }
+
+    size_t max_word_len = WordLengthRange( soln ).second;
+
+    std::cout << "    size_t hash_val = s.size();\n";
 
     if ( soln.key_positions.count( -1 ) )
     {
-        std::cout << "    hash_val += internal_::asso_values[ static_cast< unsigned char >( s[ s.size() - 1 ] ) ];\n";
+        std::cout << "    hash_val += " << asso_values << "[ static_cast< unsigned char >( s[ s.size() - 1 ] ) ];\n";
     }
 
     std::cout
@@ -268,14 +434,14 @@ static void OutputCpp17Code( const PerfectHash &soln )
 
         if ( soln.key_positions.count( pos ) )
         {
-            std::cout << "        hash_val += internal_::asso_values[ static_cast< unsigned char >( s[ " << pos << "]";
+            std::cout << "        hash_val += " << asso_values << "[ static_cast< unsigned char >( s[ " << pos << "] )";
 
             if ( soln.alpha_inc[ pos ] )
             {
                 std::cout << " + " << soln.alpha_inc[ pos ];
             }
 
-            std::cout << " ) ];\n";
+            std::cout << " ];\n";
         }
         else if ( len == 1 )
         {
@@ -285,83 +451,3373 @@ static void OutputCpp17Code( const PerfectHash &soln )
 
     std::cout
         << "    }\n"
-        << "\n"
-        << "    if ( hash_val <= MaxHashValue && internal_::wordlist[ hash_val ].word == s )\n"
-        << "    {\n"
-        << "        return internal_::wordlist[ hash_val ].enum_val;\n"
-        << "    }\n"
-        << "    return internal_::" << arg_func_name << "_enum::" << enum_names.get_default_case_label() << ";\n"
-        << "}\n"
         << "\n";
-    if ( arg_namespace.size() )
-    {
-        std::cout << "} // namespace " << arg_namespace << " {\n";
-    }
+}
 
+// Emits statements finding the slot of hash_val and returning `result` if
+// `verify` holds for it, `miss` otherwise. MaxHashValue must be defined.
+// With an empty `verify`, `result` is returned for any used slot.
+static void OutputSlotLookup( const std::string &verify,
+                              const std::string &result,
+                              const std::string &miss )
+{
     std::cout
-        << "\n"
-        << "// Extra check for safety\n";
+        << "    if ( hash_val <= MaxHashValue )\n"
+        << "    {\n";
 
-    idx = -1;
-    for ( const auto &it : soln.word_map )
+    if ( arg_minimal )
     {
-        ++idx;
-        std::cout << "static_assert( " << arg_namespace << "::" << arg_func_name << "( \"" << StringEscape( it.second ) << "\" ) == " << arg_namespace << "::internal_::" << arg_func_name << "_enum::" << enum_names.get_case_label( it.second ) << " );\n";
+        std::cout
+            << "        const uint64_t bits = internal_::slot_bitmap[ hash_val / 64 ];\n"
+            << "        const uint64_t bit = uint64_t( 1 ) << ( hash_val % 64 );\n"
+            << "        const size_t slot = internal_::slot_rank[ hash_val / 64 ] + internal_::popcount( bits & ( bit - 1 ) );\n"
+            << "        if ( ( bits & bit )" << ( verify.size() ? " && " + verify : "" ) << " )\n";
+    }
+    else if ( verify.size() )
+    {
+        std::cout
+            << "        const size_t slot = hash_val;\n"
+            << "        if ( " << verify << " )\n";
+    }
+    else
+    {
+        std::cout
+            << "        const size_t slot = hash_val;\n"
+            << "        return " << result << ";\n"
+            << "    }\n"
+            << "    return " << miss << ";\n";
+        return;
     }
 
+    std::cout
+        << "        {\n"
+        << "            return " << result << ";\n"
+        << "        }\n"
+        << "    }\n"
+        << "    return " << miss << ";\n";
+}
+
+// Emits body of a lookup function for s. `verify` is an expression checking
+// whether s matches the keyword at `slot`, `result` is the value returned
+// when it does and `miss` the value returned otherwise.
+static void OutputLookupBody( const PerfectHash &soln,
+                              const std::string &verify,
+                              const std::string &result,
+                              const std::string &miss,
+                              const std::string &asso_values = "internal_::asso_values" )
+{
+    auto [ min_word_len, max_word_len ] = WordLengthRange( soln );
+    int max_hash_value = soln.word_map.rbegin()->first;
 
     std::cout
+        << "    constexpr size_t MinWordLength = " << min_word_len << ";\n"
+        << "    constexpr size_t MaxWordLength = " << max_word_len << ";\n"
+        << "    constexpr size_t MaxHashValue = " << max_hash_value << ";\n"
         << "\n"
-        << "#endif // " << guard_macro << "\n";
+        // TODO is this check really useful, considering the switch below?
+        << "    if ( s.size() < MinWordLength || s.size() > MaxWordLength )\n"
+        << "    {\n"
+        << "        return " << miss << ";\n"
+        << "    }\n"
+        << "\n";
+
+    OutputHashComputation( soln, asso_values );
+    OutputSlotLookup( verify, result, miss );
 }
 
-int main( int argc, char* argv[] )
+// Emits keywords zero padded to a multiple of 8 bytes along with masks
+// selecting their bytes, to be compared against unaligned loads from the
+// input.
+static void OutputPaddedKeys( const PerfectHash &soln, EnumNameGen &enum_names )
 {
-    using namespace std::literals;
+    size_t max_word_len = WordLengthRange( soln ).second;
+    size_t word_count = ( max_word_len + 7 ) / 8;
+    int max_hash_value = soln.word_map.rbegin()->first;
 
-    for ( int i = 1; i < argc; )
+    auto output_words = [ word_count ]( const std::string &keyword, bool mask )
     {
-        if ( argv[ i ] == "--help"sv )
+        std::cout << "{ ";
+        for ( size_t i = 0; i < word_count; ++i )
         {
-            std::cout << "Read the doc at http://example.com\n";
-            return 0;
+            uint64_t word = 0;
+            for ( size_t j = 0; j < 8 && i * 8 + j < keyword.size(); ++j )
+            {
+                uint64_t byte = mask ? 0xFF : static_cast< unsigned char >( keyword[ i * 8 + j ] );
+                word |= byte << ( j * 8 );
+            }
+            std::cout << "0x" << std::hex << std::setw( 16 ) << std::setfill( '0' ) << std::uppercase << word
+                      << std::dec << std::setfill( ' ' ) << std::nouppercase << "ull, ";
         }
+        std::cout << "}";
+    };
 
-        if ( argv[ i ] == "--namespace"sv )
-        {
-            // TODO check if namespace is valid
-            arg_namespace = argv[ i + 1 ];
-            i += 2;
-            continue;
-        }
+    std::cout
+        << "struct padded_entry\n"
+        << "{\n"
+        << "    std::array< uint64_t, " << word_count << " > key;\n"
+        << "    std::array< uint64_t, " << word_count << " > mask;\n"
+        << "    uint64_t size;\n"
+        << "    " << arg_func_name << "_enum enum_val;\n"
+        << "};\n"
+        << "\n";
 
-        if ( argv[ i ] == "--func-name"sv )
+    size_t table_size = arg_minimal ? soln.word_map.size() : max_hash_value + 1;
+    std::cout << "constexpr std::array< padded_entry, " << table_size << " > padded_keys = {{\n";
+    {
+        int index = 0;
+        for ( const auto &it : soln.word_map )
         {
-            arg_func_name = argv[ i + 1 ];
-            i += 2;
-            continue;
-        }
+            while ( !arg_minimal && index < it.first )
+            {
+                std::cout << "    { {}, {}, 0, " << arg_func_name << "_enum::default_ },\n";
+                ++index;
+            }
 
-        std::cerr << "Unknown argument: " << argv[ i ] << "\n";
-        return 1;
+            std::cout << "    { ";
+            output_words( arg_search_options.ignore_case ? ToLowerAscii( it.second ) : it.second, false );
+            std::cout << ", ";
+            output_words( it.second, true );
+            std::cout << ", " << it.second.size() << ", " << arg_func_name << "_enum::" << enum_names.get_case_label( it.second ) << " },\n";
+            ++index;
+        }
     }
+    std::cout << "}};\n\n";
 
-    if ( arg_func_name.size() == 0 )
-    {
-        std::cerr << "Need to specify --func-name\n";
-        return 1;
-    }
+    // Words past the end of s are loaded from s.data() instead, their mask
+    // is zero anyway. So no byte past the 8 byte boundary following the end
+    // of s is read.
+    std::cout
+        << "inline bool padded_equals( const padded_entry &entry, std::string_view s )\n"
+        << "{\n"
+        << "    uint64_t diff = s.size() ^ entry.size;\n";
 
-    std::vector< std::string > input_keywords;
+    for ( size_t i = 0; i < word_count; ++i )
     {
-        std::string line;
-        while ( std::getline( std::cin, line ) )
+        std::cout
+            << "    {\n"
+            << "        uint64_t word;\n";
+        if ( i == 0 )
         {
-            input_keywords.emplace_back( std::move( line ) );
+            std::cout << "        std::memcpy( &word, s.data(), 8 );\n";
+        }
+        else
+        {
+            std::cout << "        std::memcpy( &word, s.data() + ( s.size() > " << i * 8 << " ? " << i * 8 << " : 0 ), 8 );\n";
         }
+        std::cout
+            << "        diff |= ( " << ( arg_search_options.ignore_case ? "fold_case( word )" : "word" ) << " & entry.mask[ " << i << " ] ) ^ entry.key[ " << i << " ];\n"
+            << "    }\n";
     }
 
-    OutputCpp17Code( GeneratePerfectHash( input_keywords ) );
+    std::cout
+        << "    return diff == 0;\n"
+        << "}\n"
+        << "\n";
+}
+
+static std::string GuardMacro()
+{
+    std::string guard_macro;
+    for ( char c : arg_namespace )
+    {
+        guard_macro.push_back( c == ':' ? '_' : c );
+
+    }
+    guard_macro += "__" + arg_func_name + "_HPP_";
+    for ( char &c : guard_macro )
+    {
+        c = toupper( c );
+    }
+    return guard_macro;
+}
+
+// Emits everything up to the tables of the generated code: includes, the
+// enum with a case label per keyword (in word_map order) and declaration
+// of the lookup function.
+static void OutputPrologue( const std::map< int, std::string > &word_map,
+                            EnumNameGen &enum_names,
+                            std::set< std::string > includes )
+{
+    std::string guard_macro = GuardMacro();
+
+    includes.insert( "array" );
+    includes.insert( "string_view" );
+
+    std::cout
+        << "#ifndef " << guard_macro << "\n"
+        << "#define " << guard_macro << "\n"
+        << "\n";
+
+    for ( const std::string &include : includes )
+    {
+        std::cout << "#include <" << include << ">\n";
+    }
+
+    std::cout << "\n";
+
+    if ( arg_emit_batch || arg_emit_find_all || arg_backend == "simd" )
+    {
+        std::cout
+            << "#if defined( __GNUC__ ) && ( defined( __x86_64__ ) || defined( __i386__ ) )\n"
+            << "#include <immintrin.h>\n"
+            << "#endif\n"
+            << "\n";
+    }
+
+    if ( arg_emit_scan || arg_emit_classify_all || arg_backend == "simd" )
+    {
+        std::cout
+            << "#if defined( __SSE2__ )\n"
+            << "#include <emmintrin.h>\n"
+            << "#endif\n"
+            << "\n";
+    }
+
+    if ( arg_emit_padded )
+    {
+        std::cout
+            << "#if defined( __BYTE_ORDER__ ) && __BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__\n"
+            << "#error \"" << arg_func_name << "_padded() requires a little endian target\"\n"
+            << "#endif\n"
+            << "\n";
+    }
+
+    if ( arg_namespace.size() )
+    {
+        std::cout << "namespace " << arg_namespace << " {\n";
+    }
+
+    std::cout
+        << "\n"
+        << "namespace internal_ {\n"
+        << "\n"
+        << "enum class " << arg_func_name << "_enum\n"
+        << "{\n"
+        << "    " << enum_names.get_default_case_label() << " = -1,\n";
+
+    int idx = -1;
+    for ( const auto &it : word_map )
+    {
+        ++idx;
+        std::cout
+            << "    " << enum_names.get_case_label( it.second ) << " = " << idx << ",\n";
+    }
+
+    std::cout
+        << "};\n"
+        << "\n"
+        << "} // namespace internal_\n"
+        << "\n"
+        << "// Number of keywords, enum values other than the default are in [ 0, " << arg_func_name << "_count )\n"
+        << "constexpr size_t " << arg_func_name << "_count = " << word_map.size() << ";\n"
+        << "\n"
+        << "constexpr internal_::" << arg_func_name << "_enum " << arg_func_name << "( std::string_view s );\n"
+        << "\n";
+
+    if ( arg_value_type.size() )
+    {
+        std::cout
+            << "using " << arg_func_name << "_value_type = " << arg_value_type << ";\n"
+            << "\n"
+            << "// Returns the value given to keyword s, nullptr if s is not a keyword\n"
+            << "constexpr const " << arg_func_name << "_value_type* " << arg_func_name << "_value( std::string_view s );\n"
+            << "\n";
+    }
+
+    if ( arg_emit_padded )
+    {
+        std::cout
+            << "// Number of bytes " << arg_func_name << "_padded() may read past the end of its input\n"
+            << "constexpr size_t " << arg_func_name << "_padding = 7;\n"
+            << "\n";
+    }
+}
+
+// Emits the end of the generated code, following definition of the lookup
+// function.
+static void OutputEpilogue( const std::map< int, std::string > &word_map,
+                            EnumNameGen &enum_names )
+{
+    if ( arg_namespace.size() )
+    {
+        std::cout << "} // namespace " << arg_namespace << " {\n";
+    }
+
+    std::cout
+        << "\n"
+        << "// Extra check for safety\n";
+
+    for ( const auto &it : word_map )
+    {
+        std::cout << "static_assert( " << arg_namespace << "::" << arg_func_name << "( \"" << StringEscape( it.second ) << "\" ) == " << arg_namespace << "::internal_::" << arg_func_name << "_enum::" << enum_names.get_case_label( it.second ) << " );\n";
+    }
+
+    if ( arg_value_type.size() )
+    {
+        for ( const auto &it : word_map )
+        {
+            std::cout << "static_assert( " << arg_namespace << "::" << arg_func_name << "_value( \"" << StringEscape( it.second ) << "\" ) != nullptr );\n";
+        }
+    }
+
+    if ( arg_search_options.ignore_case )
+    {
+        for ( const auto &it : word_map )
+        {
+            std::string upper = it.second;
+            for ( char &c : upper )
+            {
+                c = ( c >= 'a' && c <= 'z' ) ? c - 'a' + 'A' : c;
+            }
+            std::cout << "static_assert( " << arg_namespace << "::" << arg_func_name << "( \"" << StringEscape( upper ) << "\" ) == " << arg_namespace << "::internal_::" << arg_func_name << "_enum::" << enum_names.get_case_label( it.second ) << " );\n";
+        }
+    }
+
+    if ( arg_emit_unchecked )
+    {
+        for ( const auto &it : word_map )
+        {
+            std::cout << "static_assert( " << arg_namespace << "::" << arg_func_name << "_unchecked( \"" << StringEscape( it.second ) << "\" ) == " << arg_namespace << "::internal_::" << arg_func_name << "_enum::" << enum_names.get_case_label( it.second ) << " );\n";
+        }
+    }
+
+
+    std::cout
+        << "\n"
+        << "#endif // " << GuardMacro() << "\n";
+}
+
+// Returns the initializer of value member in table entry of keyword, prefixed
+// with a comma, or an empty string if keywords have no values.
+static std::string ValueInitializer( const std::string &keyword )
+{
+    if ( arg_value_type.empty() )
+    {
+        return "";
+    }
+
+    return ", " + keyword_values.at( keyword );
+}
+
+// Same as ValueInitializer(), for empty table entries.
+static std::string EmptyValueInitializer()
+{
+    return arg_value_type.empty() ? "" : ", {}";
+}
+
+// Emits the value member of table entries, if keywords have values.
+static void OutputValueMember()
+{
+    if ( arg_value_type.size() )
+    {
+        std::cout << "    " << arg_func_name << "_value_type value;\n";
+    }
+}
+
+// Emits name_scan(), looking up the key before a delimiter, found 16 bytes at
+// a time with SSE2. Key is hashed right after the scan, while it is in L1.
+static void OutputScan()
+{
+    std::cout
+        << "struct " << arg_func_name << "_scan_result\n"
+        << "{\n"
+        << "    internal_::" << arg_func_name << "_enum value;\n"
+        << "    const char *stop; // First delimiter, end if there is none\n"
+        << "};\n"
+        << "\n"
+        << "// Looks up [ p, stop ), stop being the first delim in [ p, end ). Saves a\n"
+        << "// separate search for the delimiter when parsing `key<delim>value` input.\n"
+        << "inline " << arg_func_name << "_scan_result " << arg_func_name << "_scan( const char *p, const char *end, char delim )\n"
+        << "{\n"
+        << "    const char *stop = p;\n"
+        << "\n"
+        << "#if defined( __SSE2__ )\n"
+        << "    const __m128i pattern = _mm_set1_epi8( delim );\n"
+        << "    for ( ; end - stop >= 16; stop += 16 )\n"
+        << "    {\n"
+        << "        const __m128i chunk = _mm_loadu_si128( reinterpret_cast< const __m128i* >( stop ) );\n"
+        << "        const int mask = _mm_movemask_epi8( _mm_cmpeq_epi8( chunk, pattern ) );\n"
+        << "        if ( mask )\n"
+        << "        {\n"
+        << "            stop += __builtin_ctz( mask );\n"
+        << "            return { " << arg_func_name << "( std::string_view( p, stop - p ) ), stop };\n"
+        << "        }\n"
+        << "    }\n"
+        << "#endif\n"
+        << "\n"
+        << "    while ( stop != end && *stop != delim )\n"
+        << "    {\n"
+        << "        ++stop;\n"
+        << "    }\n"
+        << "    return { " << arg_func_name << "( std::string_view( p, stop - p ) ), stop };\n"
+        << "}\n"
+        << "\n";
+}
+
+// Emits name_matcher, matching a key given in chunks. It keeps the range of
+// keywords, in sorted order, starting with the bytes fed so far, narrowed
+// with a binary search on each byte. Once a single keyword is left the rest
+// of each chunk is compared against it at once.
+static void OutputMatcher( const std::map< int, std::string > &word_map, EnumNameGen &enum_names )
+{
+    bool ignore_case = arg_search_options.ignore_case;
+
+    std::map< std::string, std::string > sorted_words;
+    for ( const auto &it : word_map )
+    {
+        sorted_words[ ignore_case ? ToLowerAscii( it.second ) : it.second ] = it.second;
+    }
+
+    std::cout
+        << "namespace internal_ {\n"
+        << "\n";
+
+    if ( ignore_case )
+    {
+        std::cout
+            << "constexpr unsigned char to_lower_ascii( char c )\n"
+            << "{\n"
+            << "    return c >= 'A' && c <= 'Z' ? c - 'A' + 'a' : c;\n"
+            << "}\n"
+            << "\n";
+    }
+
+    std::cout
+        << "struct sorted_entry\n"
+        << "{\n"
+        << "    std::string_view word;\n"
+        << "    " << arg_func_name << "_enum enum_val;\n"
+        << "};\n"
+        << "\n"
+        << "// Keywords" << ( ignore_case ? " in lower case," : "" ) << " in lexicographic order of unsigned bytes\n"
+        << "constexpr std::array< sorted_entry, " << sorted_words.size() << " > sorted_words = {{\n";
+
+    for ( const auto &it : sorted_words )
+    {
+        std::cout << "    { \"" << StringEscape( it.first ) << "\", " << arg_func_name << "_enum::" << enum_names.get_case_label( it.second ) << " },\n";
+    }
+
+    std::string byte = ignore_case ? "internal_::to_lower_ascii( chunk[ i ] )" : "static_cast< unsigned char >( chunk[ i ] )";
+
+    std::cout
+        << "}};\n"
+        << "\n"
+        << "} // namespace internal_\n"
+        << "\n"
+        << "// Same as " << arg_func_name << "(), for keys split into consecutive chunks: feed() the\n"
+        << "// chunks in order, then finish(). Chunks need not outlive the call.\n"
+        << "class " << arg_func_name << "_matcher\n"
+        << "{\n"
+        << "public:\n"
+        << "    constexpr void feed( std::string_view chunk )\n"
+        << "    {\n"
+        << "        size_t i = 0;\n"
+        << "        while ( i < chunk.size() && m_first + 1 < m_last )\n"
+        << "        {\n"
+        << "            const unsigned char c = " << byte << ";\n"
+        << "\n"
+        << "            // Keywords ending at m_size come first in the range, then by their byte at m_size.\n"
+        << "            // Bytes are widened, so that the bound c + 1 does not wrap for 0xFF.\n"
+        << "            auto before = [ this ]( std::string_view word, unsigned c ) {\n"
+        << "                return word.size() <= m_size || static_cast< unsigned char >( word[ m_size ] ) < c;\n"
+        << "            };\n"
+        << "\n"
+        << "            size_t first = m_first;\n"
+        << "            size_t last = m_last;\n"
+        << "            while ( first < last )\n"
+        << "            {\n"
+        << "                const size_t mid = first + ( last - first ) / 2;\n"
+        << "                if ( before( internal_::sorted_words[ mid ].word, c ) )\n"
+        << "                    first = mid + 1;\n"
+        << "                else\n"
+        << "                    last = mid;\n"
+        << "            }\n"
+        << "            m_first = first;\n"
+        << "\n"
+        << "            last = m_last;\n"
+        << "            while ( first < last )\n"
+        << "            {\n"
+        << "                const size_t mid = first + ( last - first ) / 2;\n"
+        << "                if ( before( internal_::sorted_words[ mid ].word, c + 1 ) )\n"
+        << "                    first = mid + 1;\n"
+        << "                else\n"
+        << "                    last = mid;\n"
+        << "            }\n"
+        << "            m_last = first;\n"
+        << "\n"
+        << "            ++i;\n"
+        << "            ++m_size;\n"
+        << "        }\n"
+        << "\n"
+        << "        if ( i == chunk.size() || m_first == m_last )\n"
+        << "        {\n"
+        << "            m_size += chunk.size() - i;\n"
+        << "            return;\n"
+        << "        }\n"
+        << "\n"
+        << "        // Single candidate left, compare rest of the chunk against it\n"
+        << "        const std::string_view word = internal_::sorted_words[ m_first ].word;\n"
+        << "        const std::string_view rest = chunk.substr( i );\n";
+
+    if ( ignore_case )
+    {
+        std::cout
+            << "        bool equal = m_size + rest.size() <= word.size();\n"
+            << "        for ( size_t j = 0; equal && j < rest.size(); ++j )\n"
+            << "        {\n"
+            << "            equal = internal_::to_lower_ascii( rest[ j ] ) == static_cast< unsigned char >( word[ m_size + j ] );\n"
+            << "        }\n";
+    }
+    else
+    {
+        std::cout
+            << "        const bool equal = m_size + rest.size() <= word.size() && word.substr( m_size, rest.size() ) == rest;\n";
+    }
+
+    std::cout
+        << "        if ( !equal )\n"
+        << "        {\n"
+        << "            m_last = m_first;\n"
+        << "        }\n"
+        << "        m_size += rest.size();\n"
+        << "    }\n"
+        << "\n"
+        << "    constexpr internal_::" << arg_func_name << "_enum finish() const\n"
+        << "    {\n"
+        << "        if ( m_first != m_last && internal_::sorted_words[ m_first ].word.size() == m_size )\n"
+        << "        {\n"
+        << "            return internal_::sorted_words[ m_first ].enum_val;\n"
+        << "        }\n"
+        << "        return internal_::" << arg_func_name << "_enum::" << enum_names.get_default_case_label() << ";\n"
+        << "    }\n"
+        << "\n"
+        << "private:\n"
+        << "    // Keywords in [ m_first, m_last ) of sorted_words start with the m_size bytes fed\n"
+        << "    size_t m_first = 0;\n"
+        << "    size_t m_last = internal_::sorted_words.size();\n"
+        << "    size_t m_size = 0;\n"
+        << "};\n"
+        << "\n";
+}
+
+// Emits name_classify_all(), splitting a buffer on a set of delimiters and
+// looking up each token. Delimiters are found 16 bytes at a time with SSE2,
+// comparing against each delimiter and walking the bits of the combined mask.
+static void OutputClassifyAll()
+{
+    std::cout
+        << "struct " << arg_func_name << "_token\n"
+        << "{\n"
+        << "    internal_::" << arg_func_name << "_enum value;\n"
+        << "    size_t offset; // Position of the token in buffer, after trimming\n"
+        << "    size_t size;\n"
+        << "};\n"
+        << "\n"
+        << "// Splits buf on any of delims, trims spaces and tabs around tokens and writes\n"
+        << "// a " << arg_func_name << "_token for each non-empty one to out. Returns out past the last\n"
+        << "// token. SSE2 is used for up to 4 delimiters.\n"
+        << "template < typename OutputIt >\n"
+        << "inline OutputIt " << arg_func_name << "_classify_all( std::string_view buf, std::string_view delims, OutputIt out )\n"
+        << "{\n"
+        << "    size_t start = 0;\n"
+        << "    auto token_end = [ & ]( size_t end ) {\n"
+        << "        while ( start < end && ( buf[ start ] == ' ' || buf[ start ] == '\\t' ) )\n"
+        << "        {\n"
+        << "            ++start;\n"
+        << "        }\n"
+        << "        while ( start < end && ( buf[ end - 1 ] == ' ' || buf[ end - 1 ] == '\\t' ) )\n"
+        << "        {\n"
+        << "            --end;\n"
+        << "        }\n"
+        << "        if ( start < end )\n"
+        << "        {\n"
+        << "            *out++ = " << arg_func_name << "_token{ " << arg_func_name << "( buf.substr( start, end - start ) ), start, end - start };\n"
+        << "        }\n"
+        << "    };\n"
+        << "\n"
+        << "    size_t i = 0;\n"
+        << "\n"
+        << "#if defined( __SSE2__ )\n"
+        << "    if ( delims.size() && delims.size() <= 4 )\n"
+        << "    {\n"
+        << "        // Unused patterns repeat the first delimiter\n"
+        << "        __m128i patterns[ 4 ];\n"
+        << "        for ( size_t j = 0; j < 4; ++j )\n"
+        << "        {\n"
+        << "            patterns[ j ] = _mm_set1_epi8( delims[ j < delims.size() ? j : 0 ] );\n"
+        << "        }\n"
+        << "\n"
+        << "        for ( ; i + 16 <= buf.size(); i += 16 )\n"
+        << "        {\n"
+        << "            const __m128i chunk = _mm_loadu_si128( reinterpret_cast< const __m128i* >( buf.data() + i ) );\n"
+        << "            const __m128i hits = _mm_or_si128( _mm_or_si128( _mm_cmpeq_epi8( chunk, patterns[ 0 ] ), _mm_cmpeq_epi8( chunk, patterns[ 1 ] ) ),\n"
+        << "                                               _mm_or_si128( _mm_cmpeq_epi8( chunk, patterns[ 2 ] ), _mm_cmpeq_epi8( chunk, patterns[ 3 ] ) ) );\n"
+        << "            for ( unsigned mask = _mm_movemask_epi8( hits ); mask; mask &= mask - 1 )\n"
+        << "            {\n"
+        << "                const size_t end = i + __builtin_ctz( mask );\n"
+        << "                token_end( end );\n"
+        << "                start = end + 1;\n"
+        << "            }\n"
+        << "        }\n"
+        << "    }\n"
+        << "#endif\n"
+        << "\n"
+        << "    for ( ; i < buf.size(); ++i )\n"
+        << "    {\n"
+        << "        if ( delims.find( buf[ i ] ) != std::string_view::npos )\n"
+        << "        {\n"
+        << "            token_end( i );\n"
+        << "            start = i + 1;\n"
+        << "        }\n"
+        << "    }\n"
+        << "    token_end( buf.size() );\n"
+        << "\n"
+        << "    return out;\n"
+        << "}\n"
+        << "\n";
+}
+
+// Emits a std::array of bytes named `name`, in hex.
+static void OutputByteTable( const std::string &name, const std::vector< uint8_t > &bytes )
+{
+    std::cout << "constexpr std::array< uint8_t, " << bytes.size() << " > " << name << " = {\n";
+    for ( size_t i = 0; i < bytes.size(); ++i )
+    {
+        if ( i % 16 == 0 )
+        {
+            std::cout << "    ";
+        }
+
+        std::cout << "0x" << std::hex << std::setw( 2 ) << std::setfill( '0' ) << (int)bytes[ i ] << std::dec << std::setfill( ' ' ) << ",";
+        std::cout << ( i % 16 == 15 || i == bytes.size() - 1 ? "\n" : " " );
+    }
+    std::cout << "};\n\n";
+}
+
+// Emits name_find_all(), reporting occurrences of keywords in a text. Pairs
+// of the first two bytes of keywords are spread into 8 buckets, a position
+// is a candidate if both of its bytes are in a common bucket. With SSSE3,
+// 16 positions are filtered at once by looking up bucket masks of each
+// nibble with pshufb (as in the Teddy algorithm); otherwise with exact
+// tables of bytes. Candidates are confirmed with name() for lengths of
+// keywords in their buckets.
+static void OutputFindAll( const std::map< int, std::string > &word_map )
+{
+    bool ignore_case = arg_search_options.ignore_case;
+
+    // Second byte is -1 for single byte keywords, which match any. Lengths
+    // are kept as bits, lengths from LongLength on share the last bit.
+    constexpr size_t LongLength = 63;
+    std::map< std::pair< int, int >, uint64_t > prefixes;
+    std::set< size_t > long_lengths;
+    for ( const auto &it : word_map )
+    {
+        const std::string &word = it.second;
+        if ( word.size() >= LongLength )
+        {
+            long_lengths.insert( word.size() );
+        }
+
+        std::vector< int > firsts = { (unsigned char)word[ 0 ] };
+        std::vector< int > seconds = { word.size() > 1 ? (unsigned char)word[ 1 ] : -1 };
+        if ( ignore_case )
+        {
+            for ( std::vector< int > *bytes : { &firsts, &seconds } )
+            {
+                int c = ( *bytes )[ 0 ];
+                if ( isalpha( c ) )
+                {
+                    bytes->push_back( c ^ 0x20 );
+                }
+            }
+        }
+
+        for ( int first : firsts )
+        {
+            for ( int second : seconds )
+            {
+                prefixes[ { first, second } ] |= uint64_t( 1 ) << std::min( word.size(), LongLength );
+            }
+        }
+    }
+
+    std::vector< uint8_t > first_masks( 256 ), second_masks( 256 );
+    std::vector< uint8_t > first_lo( 16 ), first_hi( 16 ), second_lo( 16 ), second_hi( 16 );
+    std::vector< uint64_t > bucket_lengths( 8 );
+    {
+        int index = 0;
+        for ( const auto &it : prefixes )
+        {
+            auto [ first, second ] = it.first;
+            bucket_lengths[ index % 8 ] |= it.second;
+            const uint8_t bucket = 1 << ( index++ % 8 );
+
+            first_masks[ first ] |= bucket;
+            first_lo[ first & 15 ] |= bucket;
+            first_hi[ first >> 4 ] |= bucket;
+
+            for ( int c = 0; c < 256; ++c )
+            {
+                if ( second == -1 || c == second )
+                {
+                    second_masks[ c ] |= bucket;
+                    second_lo[ c & 15 ] |= bucket;
+                    second_hi[ c >> 4 ] |= bucket;
+                }
+            }
+        }
+    }
+
+    std::cout
+        << "namespace internal_ {\n"
+        << "\n"
+        << "// Masks of buckets having a keyword starting with a byte, by the byte\n";
+
+    OutputByteTable( "first_masks", first_masks );
+
+    std::cout << "// Masks of buckets having a keyword with a second byte, by the byte\n";
+    OutputByteTable( "second_masks", second_masks );
+
+    std::cout << "// Masks of buckets by low and high nibbles of first and second bytes\n";
+    OutputByteTable( "first_lo_masks", first_lo );
+    OutputByteTable( "first_hi_masks", first_hi );
+    OutputByteTable( "second_lo_masks", second_lo );
+    OutputByteTable( "second_hi_masks", second_hi );
+
+    std::cout << "// Bit n is set for keyword lengths n in buckets, last bit for lengths from " << LongLength << " on\n";
+    std::cout << "constexpr std::array< uint64_t, 8 > bucket_lengths = {\n";
+    for ( uint64_t lengths : bucket_lengths )
+    {
+        std::cout << "    0x" << std::hex << std::uppercase << lengths << std::dec << std::nouppercase << "ull,\n";
+    }
+    std::cout << "};\n\n";
+
+    std::cout << "constexpr std::array< size_t, " << long_lengths.size() << " > long_lengths = {";
+    for ( size_t length : long_lengths )
+    {
+        std::cout << " " << length << ",";
+    }
+
+    std::cout
+        << " };\n"
+        << "\n"
+        << "template < typename Callback >\n"
+        << "inline void " << arg_func_name << "_confirm_length( std::string_view text, size_t i, size_t length, Callback &callback )\n"
+        << "{\n"
+        << "    if ( length <= text.size() - i )\n"
+        << "    {\n"
+        << "        const auto res = " << arg_func_name << "( text.substr( i, length ) );\n"
+        << "        if ( res != " << arg_func_name << "_enum::default_ )\n"
+        << "        {\n"
+        << "            callback( i, res );\n"
+        << "        }\n"
+        << "    }\n"
+        << "}\n"
+        << "\n"
+        << "// Reports keywords starting at text[ i ], of lengths in the buckets of mask\n"
+        << "template < typename Callback >\n"
+        << "inline void " << arg_func_name << "_confirm( std::string_view text, size_t i, unsigned mask, Callback &callback )\n"
+        << "{\n"
+        << "    uint64_t lengths = 0;\n"
+        << "    for ( ; mask; mask &= mask - 1 )\n"
+        << "    {\n"
+        << "        lengths |= bucket_lengths[ __builtin_ctz( mask ) ];\n"
+        << "    }\n"
+        << "\n"
+        << "    for ( ; lengths; lengths &= lengths - 1 )\n"
+        << "    {\n"
+        << "        const size_t length = __builtin_ctzll( lengths );\n"
+        << "        if ( length < " << LongLength << " )\n"
+        << "        {\n"
+        << "            " << arg_func_name << "_confirm_length( text, i, length, callback );\n"
+        << "            continue;\n"
+        << "        }\n"
+        << "\n"
+        << "        for ( size_t long_length : long_lengths )\n"
+        << "        {\n"
+        << "            " << arg_func_name << "_confirm_length( text, i, long_length, callback );\n"
+        << "        }\n"
+        << "    }\n"
+        << "}\n"
+        << "\n"
+        << "// Checks candidates in text[ i, end ) one by one\n"
+        << "template < typename Callback >\n"
+        << "inline void " << arg_func_name << "_find_all_scalar( std::string_view text, size_t i, size_t end, Callback &callback )\n"
+        << "{\n"
+        << "    for ( ; i < end; ++i )\n"
+        << "    {\n"
+        << "        unsigned mask = first_masks[ static_cast< unsigned char >( text[ i ] ) ];\n"
+        << "        if ( i + 1 < text.size() )\n"
+        << "        {\n"
+        << "            mask &= second_masks[ static_cast< unsigned char >( text[ i + 1 ] ) ];\n"
+        << "        }\n"
+        << "\n"
+        << "        if ( mask )\n"
+        << "        {\n"
+        << "            " << arg_func_name << "_confirm( text, i, mask, callback );\n"
+        << "        }\n"
+        << "    }\n"
+        << "}\n"
+        << "\n"
+        << "#if defined( __GNUC__ ) && ( defined( __x86_64__ ) || defined( __i386__ ) )\n"
+        << "__attribute__(( target( \"ssse3\" ) ))\n"
+        << "inline __m128i bucket_masks( __m128i bytes, const std::array< uint8_t, 16 > &lo, const std::array< uint8_t, 16 > &hi )\n"
+        << "{\n"
+        << "    const __m128i nibble = _mm_set1_epi8( 0x0F );\n"
+        << "    const __m128i lo_masks = _mm_shuffle_epi8( _mm_loadu_si128( reinterpret_cast< const __m128i* >( lo.data() ) ), _mm_and_si128( bytes, nibble ) );\n"
+        << "    const __m128i hi_masks = _mm_shuffle_epi8( _mm_loadu_si128( reinterpret_cast< const __m128i* >( hi.data() ) ), _mm_and_si128( _mm_srli_epi16( bytes, 4 ), nibble ) );\n"
+        << "    return _mm_and_si128( lo_masks, hi_masks );\n"
+        << "}\n"
+        << "\n"
+        << "// Filters 16 positions at a time, returns the first position left\n"
+        << "template < typename Callback >\n"
+        << "__attribute__(( target( \"ssse3\" ) ))\n"
+        << "inline size_t " << arg_func_name << "_find_all_ssse3( std::string_view text, Callback &callback )\n"
+        << "{\n"
+        << "    size_t i = 0;\n"
+        << "    for ( ; i + 17 <= text.size(); i += 16 )\n"
+        << "    {\n"
+        << "        const __m128i first = _mm_loadu_si128( reinterpret_cast< const __m128i* >( text.data() + i ) );\n"
+        << "        const __m128i second = _mm_loadu_si128( reinterpret_cast< const __m128i* >( text.data() + i + 1 ) );\n"
+        << "        const __m128i masks = _mm_and_si128( bucket_masks( first, first_lo_masks, first_hi_masks ),\n"
+        << "                                             bucket_masks( second, second_lo_masks, second_hi_masks ) );\n"
+        << "\n"
+        << "        unsigned candidates = ~_mm_movemask_epi8( _mm_cmpeq_epi8( masks, _mm_setzero_si128() ) ) & 0xFFFF;\n"
+        << "        if ( candidates )\n"
+        << "        {\n"
+        << "            alignas( 16 ) uint8_t bucket_masks[ 16 ];\n"
+        << "            _mm_store_si128( reinterpret_cast< __m128i* >( bucket_masks ), masks );\n"
+        << "            for ( ; candidates; candidates &= candidates - 1 )\n"
+        << "            {\n"
+        << "                const int k = __builtin_ctz( candidates );\n"
+        << "                " << arg_func_name << "_confirm( text, i + k, bucket_masks[ k ], callback );\n"
+        << "            }\n"
+        << "        }\n"
+        << "    }\n"
+        << "    return i;\n"
+        << "}\n"
+        << "#endif\n"
+        << "\n"
+        << "} // namespace internal_\n"
+        << "\n"
+        << "// Calls callback( offset, value ) for each occurrence of a keyword in text,\n"
+        << "// by increasing offset, then increasing length\n"
+        << "template < typename Callback >\n"
+        << "inline void " << arg_func_name << "_find_all( std::string_view text, Callback &&callback )\n"
+        << "{\n"
+        << "    size_t i = 0;\n"
+        << "\n"
+        << "#if defined( __GNUC__ ) && ( defined( __x86_64__ ) || defined( __i386__ ) )\n"
+        << "    if ( __builtin_cpu_supports( \"ssse3\" ) )\n"
+        << "    {\n"
+        << "        i = internal_::" << arg_func_name << "_find_all_ssse3( text, callback );\n"
+        << "    }\n"
+        << "#endif\n"
+        << "\n"
+        << "    internal_::" << arg_func_name << "_find_all_scalar( text, i, text.size(), callback );\n"
+        << "}\n"
+        << "\n";
+}
+
+// Returns the smallest integer type holding enum values of count keywords
+static const char* CompactEnumType( size_t count )
+{
+    if ( count <= 127 )
+        return "int8_t";
+    if ( count <= 32767 )
+        return "int16_t";
+    return "int32_t";
+}
+
+// Emits enum values by hash value, for lookups which skip verification.
+static void OutputEnumTable( const PerfectHash &soln, EnumNameGen &enum_names )
+{
+    int max_hash_value = soln.word_map.rbegin()->first;
+
+    std::cout << "constexpr std::array< " << CompactEnumType( soln.word_map.size() ) << ", " << max_hash_value + 1 << " > enum_table = {\n";
+    {
+        int index = 0;
+        for ( const auto &it : soln.word_map )
+        {
+            while ( index < it.first )
+            {
+                std::cout << "    static_cast< int >( " << arg_func_name << "_enum::" << enum_names.get_default_case_label() << " ),\n";
+                ++index;
+            }
+
+            std::cout << "    static_cast< int >( " << arg_func_name << "_enum::" << enum_names.get_case_label( it.second ) << " ),\n";
+            ++index;
+        }
+    }
+    std::cout << "};\n\n";
+}
+
+static void OutputUncheckedPrologue()
+{
+    std::cout
+        << "// Same as " << arg_func_name << "(), but s must be one of the keywords. Only the hash\n"
+        << "// is computed, s is not verified (except by an assertion in debug builds).\n"
+        << "constexpr internal_::" << arg_func_name << "_enum " << arg_func_name << "_unchecked( std::string_view s )\n"
+        << "{\n";
+}
+
+static void OutputUncheckedEpilogue()
+{
+    std::cout
+        << "    assert( " << arg_func_name << "( s ) == res );\n"
+        << "    return res;\n"
+        << "}\n"
+        << "\n";
+}
+
+// Emits name_batch(), looking up keys with name() in turn, and
+// name_batch_avx2(), looking up 8 keys at a time where AVX2 is available
+// (checked at runtime), which measured slower so it is not the default. Hash
+// values are computed by lane without branches, then keys are verified in
+// batch by their size and tag (first and last 4 bytes, or all of them if
+// shorter) gathered from a table indexed by hash value. Only keys longer than
+// 8 bytes are compared further, between their first and last 4 bytes.
+static void OutputBatch( const PerfectHash &soln, EnumNameGen &enum_names )
+{
+    auto [ min_word_len, max_word_len ] = WordLengthRange( soln );
+    int max_hash_value = soln.word_map.rbegin()->first;
+    bool ignore_case = arg_search_options.ignore_case;
+
+    auto tag_of = [ & ]( const std::string &keyword ) {
+        std::string word = ignore_case ? ToLowerAscii( keyword ) : keyword;
+        size_t n = word.size();
+        if ( n >= 4 )
+        {
+            return IntegerKey( word.substr( 0, 4 ) ) | IntegerKey( word.substr( n - 4 ) ) << 32;
+        }
+        return IntegerKey( std::string{ word[ 0 ], word[ n / 2 ], word[ n - 1 ] } );
+    };
+
+    std::cout
+        << "namespace internal_ {\n"
+        << "\n"
+        << "// First and last 4 bytes of s, which are all of them for up to 8 bytes. Keys\n"
+        << "// are mostly longer than 3 bytes, so the branch is predictable.\n"
+        << "constexpr uint64_t " << arg_func_name << "_tag( std::string_view s )\n"
+        << "{\n"
+        << "    const char *p = s.data();\n"
+        << "    const size_t n = s.size();\n"
+        << "    uint64_t tag = 0;\n"
+        << "    if ( n >= 4 )\n"
+        << "    {\n"
+        << "        tag = load_le4( p ) | load_le4( p + n - 4 ) << 32;\n"
+        << "    }\n"
+        << "    else if ( n > 0 )\n"
+        << "    {\n"
+        << "        tag = uint64_t( static_cast< unsigned char >( p[ 0 ] ) )\n"
+        << "            | uint64_t( static_cast< unsigned char >( p[ n / 2 ] ) ) << 8\n"
+        << "            | uint64_t( static_cast< unsigned char >( p[ n - 1 ] ) ) << 16;\n"
+        << "    }\n"
+        << "    return " << ( ignore_case ? "fold_case( tag )" : "tag" ) << ";\n"
+        << "}\n"
+        << "\n"
+        << "struct alignas( 32 ) batch_entry\n"
+        << "{\n"
+        << "    uint64_t tag;\n"
+        << "    uint32_t size;\n"
+        << "    " << arg_func_name << "_enum enum_val;\n"
+        << "    const char *word;\n"
+        << "};\n"
+        << "\n"
+        << "static_assert( sizeof( batch_entry ) == 32 && sizeof( " << arg_func_name << "_enum ) == 4 );\n"
+        << "\n"
+        << "// Indexed by hash value, unused ones and the last one (for keys of other\n"
+        << "// lengths) have a size no key has\n"
+        << "constexpr std::array< batch_entry, " << max_hash_value + 2 << " > batch_entries = {{\n";
+
+    for ( int h = 0; h <= max_hash_value + 1; ++h )
+    {
+        auto it = soln.word_map.find( h );
+        if ( it == soln.word_map.end() )
+        {
+            std::cout << "    { 0, UINT32_MAX, " << arg_func_name << "_enum::" << enum_names.get_default_case_label() << ", nullptr },\n";
+            continue;
+        }
+
+        std::string word = ignore_case ? ToLowerAscii( it->second ) : it->second;
+        std::cout
+            << "    { " << HexLiteral( tag_of( it->second ) ) << ", " << word.size() << ", "
+            << arg_func_name << "_enum::" << enum_names.get_case_label( it->second ) << ", \"" << StringEscape( word ) << "\" },\n";
+    }
+
+    std::cout
+        << "}};\n"
+        << "\n"
+        << "#if defined( __GNUC__ ) && ( defined( __x86_64__ ) || defined( __i386__ ) )\n"
+        << "// Looks up in[ 0, 8 ) into out[ 0, 8 )\n"
+        << "__attribute__(( target( \"avx2\" ) ))\n"
+        << "inline void " << arg_func_name << "_batch8_avx2( const std::string_view *in, " << arg_func_name << "_enum *out )\n"
+        << "{\n"
+        << "    constexpr size_t MinWordLength = " << min_word_len << ";\n"
+        << "    constexpr size_t MaxWordLength = " << max_word_len << ";\n"
+        << "    constexpr int MaxHashValue = " << max_hash_value << ";\n"
+        << "\n"
+        << "    // Sizes past MaxWordLength are clamped, to fit in 32 bit lanes\n"
+        << "    auto size_of = [ in ]( int k ) {\n"
+        << "        return int( in[ k ].size() > MaxWordLength ? MaxWordLength + 1 : in[ k ].size() );\n"
+        << "    };\n"
+        << "    const __m256i size = _mm256_setr_epi32( size_of( 0 ), size_of( 1 ), size_of( 2 ), size_of( 3 ),\n"
+        << "                                            size_of( 4 ), size_of( 5 ), size_of( 6 ), size_of( 7 ) );\n"
+        << "\n"
+        << "    // Hash values are computed by lane and put together in a register, gathers\n"
+        << "    // from asso_values being slower than scalar loads. Bytes past the end of a\n"
+        << "    // key are read at offset 0 and masked off, so lengths do not branch.\n"
+        << "    auto hash_of = [ in ]( int k ) {\n"
+        << "        const size_t n = in[ k ].size();\n"
+        << "        const unsigned char *p = reinterpret_cast< const unsigned char* >( n ? in[ k ].data() : \"\" );\n"
+        << "        auto asso_at = [ p, n ]( size_t pos, int inc ) {\n"
+        << "            return asso_values[ p[ pos < n ? pos : 0 ] + inc ] & -int( pos < n );\n"
+        << "        };\n"
+        << "        return int( n )";
+
+    for ( int pos : soln.key_positions )
+    {
+        std::string at = pos == -1 ? "n - 1" : std::to_string( pos );
+        int inc = pos == -1 ? 0 : soln.alpha_inc[ pos ];
+        std::cout << " + asso_at( " << at << ", " << inc << " )";
+    }
+
+    std::cout
+        << ";\n"
+        << "    };\n"
+        << "    __m256i hash = _mm256_setr_epi32( hash_of( 0 ), hash_of( 1 ), hash_of( 2 ), hash_of( 3 ),\n"
+        << "                                      hash_of( 4 ), hash_of( 5 ), hash_of( 6 ), hash_of( 7 ) );\n"
+        << "\n"
+        << "    const __m256i valid = _mm256_andnot_si256(\n"
+        << "        _mm256_cmpgt_epi32( _mm256_set1_epi32( MinWordLength ), size ),\n"
+        << "        _mm256_cmpgt_epi32( _mm256_set1_epi32( MaxWordLength + 1 ), size ) );\n"
+        << "    hash = _mm256_blendv_epi8( _mm256_set1_epi32( MaxHashValue + 1 ), hash, valid );\n"
+        << "    // Other strings of a valid size may hash past the table, they go to the\n"
+        << "    // entry past the last hash value as well\n"
+        << "    hash = _mm256_min_epu32( hash, _mm256_set1_epi32( MaxHashValue + 1 ) );\n"
+        << "\n"
+        << "    // Entries are 32 bytes: tags at 8 byte index 4 * hash, sizes at 4 byte index 8 * hash + 2\n"
+        << "    const int *entries = reinterpret_cast< const int* >( batch_entries.data() );\n"
+        << "    const __m256i sizes = _mm256_i32gather_epi32( entries + 2, _mm256_slli_epi32( hash, 3 ), 4 );\n"
+        << "    const __m256i tag_index = _mm256_slli_epi32( hash, 2 );\n"
+        << "    const __m256i tags_lo = _mm256_i32gather_epi64( reinterpret_cast< const long long* >( entries ), _mm256_castsi256_si128( tag_index ), 8 );\n"
+        << "    const __m256i tags_hi = _mm256_i32gather_epi64( reinterpret_cast< const long long* >( entries ), _mm256_extracti128_si256( tag_index, 1 ), 8 );\n"
+        << "\n"
+        << "    const __m256i in_tags_lo = _mm256_setr_epi64x( " << arg_func_name << "_tag( in[ 0 ] ), " << arg_func_name << "_tag( in[ 1 ] ), " << arg_func_name << "_tag( in[ 2 ] ), " << arg_func_name << "_tag( in[ 3 ] ) );\n"
+        << "    const __m256i in_tags_hi = _mm256_setr_epi64x( " << arg_func_name << "_tag( in[ 4 ] ), " << arg_func_name << "_tag( in[ 5 ] ), " << arg_func_name << "_tag( in[ 6 ] ), " << arg_func_name << "_tag( in[ 7 ] ) );\n"
+        << "\n"
+        << "    const int size_match = _mm256_movemask_ps( _mm256_castsi256_ps( _mm256_cmpeq_epi32( sizes, size ) ) );\n"
+        << "    const int tag_match = _mm256_movemask_pd( _mm256_castsi256_pd( _mm256_cmpeq_epi64( tags_lo, in_tags_lo ) ) )\n"
+        << "                        | _mm256_movemask_pd( _mm256_castsi256_pd( _mm256_cmpeq_epi64( tags_hi, in_tags_hi ) ) ) << 4;\n"
+        << "\n"
+        << "    alignas( 32 ) int hashes[ 8 ];\n"
+        << "    _mm256_store_si256( reinterpret_cast< __m256i* >( hashes ), hash );\n"
+        << "    const int match = size_match & tag_match;\n"
+        << "    for ( int k = 0; k < 8; ++k )\n"
+        << "    {\n"
+        << "        const batch_entry &entry = batch_entries[ hashes[ k ] ];\n"
+        << "        bool found = match >> k & 1;\n"
+        << "        if ( found && in[ k ].size() > 8 )\n"
+        << "        {\n"
+        << "            // Bytes between the first and last 4\n";
+
+    if ( ignore_case )
+    {
+        std::cout << "            found = equals_ignore_case( in[ k ], std::string_view( entry.word, entry.size ) );\n";
+    }
+    else
+    {
+        std::cout << "            found = std::string_view( entry.word + 4, entry.size - 8 ) == in[ k ].substr( 4, entry.size - 8 );\n";
+    }
+
+    std::cout
+        << "        }\n"
+        << "        out[ k ] = found ? entry.enum_val : " << arg_func_name << "_enum::" << enum_names.get_default_case_label() << ";\n"
+        << "    }\n"
+        << "}\n"
+        << "#endif\n"
+        << "\n"
+        << "} // namespace internal_\n"
+        << "\n"
+        << "// Looks up in[ 0, n ) into out[ 0, n ), same as " << arg_func_name << "() on each\n"
+        << "inline void " << arg_func_name << "_batch( const std::string_view *in, size_t n, internal_::" << arg_func_name << "_enum *out )\n"
+        << "{\n"
+        << "    for ( size_t i = 0; i < n; ++i )\n"
+        << "    {\n"
+        << "        out[ i ] = " << arg_func_name << "( in[ i ] );\n"
+        << "    }\n"
+        << "}\n"
+        << "\n"
+        << "// Same as " << arg_func_name << "_batch(), 8 keys at a time where AVX2 is available\n"
+        << "// (checked at run time). Measured about 2x slower than " << arg_func_name << "_batch() on\n"
+        << "// tables fitting in L1, gathers being slow; benchmark before using it.\n"
+        << "inline void " << arg_func_name << "_batch_avx2( const std::string_view *in, size_t n, internal_::" << arg_func_name << "_enum *out )\n"
+        << "{\n"
+        << "    size_t i = 0;\n"
+        << "\n"
+        << "#if defined( __GNUC__ ) && ( defined( __x86_64__ ) || defined( __i386__ ) )\n"
+        << "    if ( __builtin_cpu_supports( \"avx2\" ) )\n"
+        << "    {\n"
+        << "        for ( ; i + 8 <= n; i += 8 )\n"
+        << "        {\n"
+        << "            internal_::" << arg_func_name << "_batch8_avx2( in + i, out + i );\n"
+        << "        }\n"
+        << "    }\n"
+        << "#endif\n"
+        << "\n"
+        << "    for ( ; i < n; ++i )\n"
+        << "    {\n"
+        << "        out[ i ] = " << arg_func_name << "( in[ i ] );\n"
+        << "    }\n"
+        << "}\n"
+        << "\n";
+}
+
+// Emits name_pipelined(), looking up n keys in groups going through three
+// stages, each group one stage behind the previous one: slots are computed
+// and prefetched, then keywords in the slots are prefetched, and finally
+// keys are verified. Cache misses of a group overlap with work on the two
+// groups around it, instead of two dependent misses for each key.
+static void OutputPipelined( const PerfectHash &soln, const std::string &verify, const std::string &result, const std::string &miss )
+{
+    std::cout
+        << "namespace internal_ {\n"
+        << "\n"
+        << "inline void prefetch( const void *p )\n"
+        << "{\n"
+        << "#if defined( __GNUC__ )\n"
+        << "    __builtin_prefetch( p );\n"
+        << "#else\n"
+        << "    ( void )p;\n"
+        << "#endif\n"
+        << "}\n"
+        << "\n"
+        << "// Returns slot of s in wordlist, wordlist.size() if s is not a keyword for sure\n"
+        << "constexpr size_t " << arg_func_name << "_slot( std::string_view s )\n"
+        << "{\n";
+
+    OutputLookupBody( soln, "", "slot", "wordlist.size()" );
+
+    std::cout
+        << "}\n"
+        << "\n"
+        << "} // namespace internal_\n"
+        << "\n"
+        << "// Looks up in[ 0, n ) into out[ 0, n ), same as " << arg_func_name << "() on each, with\n"
+        << "// memory accesses of different keys overlapped. Meant for tables exceeding caches.\n"
+        << "inline void " << arg_func_name << "_pipelined( const std::string_view *in, size_t n, internal_::" << arg_func_name << "_enum *out )\n"
+        << "{\n"
+        << "    constexpr size_t GroupSize = 16;\n"
+        << "    constexpr size_t NoSlot = internal_::wordlist.size();\n"
+        << "\n"
+        << "    const size_t groups = ( n + GroupSize - 1 ) / GroupSize;\n"
+        << "    size_t slots[ 3 ][ GroupSize ];\n"
+        << "\n"
+        << "    // Group g goes through stage j at iteration g + j\n"
+        << "    for ( size_t g = 0; g < groups + 2; ++g )\n"
+        << "    {\n"
+        << "        if ( g < groups )\n"
+        << "        {\n"
+        << "            size_t *group_slots = slots[ g % 3 ];\n"
+        << "            for ( size_t k = 0, i = g * GroupSize; k < GroupSize && i < n; ++k, ++i )\n"
+        << "            {\n"
+        << "                group_slots[ k ] = internal_::" << arg_func_name << "_slot( in[ i ] );\n"
+        << "                if ( group_slots[ k ] != NoSlot )\n"
+        << "                {\n"
+        << "                    internal_::prefetch( &internal_::wordlist[ group_slots[ k ] ] );\n"
+        << "                }\n"
+        << "            }\n"
+        << "        }\n"
+        << "\n"
+        << "        if ( g >= 1 && g <= groups )\n"
+        << "        {\n"
+        << "            const size_t *group_slots = slots[ ( g - 1 ) % 3 ];\n"
+        << "            for ( size_t k = 0, i = ( g - 1 ) * GroupSize; k < GroupSize && i < n; ++k, ++i )\n"
+        << "            {\n"
+        << "                if ( group_slots[ k ] != NoSlot )\n"
+        << "                {\n"
+        << "                    internal_::prefetch( internal_::wordlist[ group_slots[ k ] ].word.data() );\n"
+        << "                }\n"
+        << "            }\n"
+        << "        }\n"
+        << "\n"
+        << "        if ( g >= 2 )\n"
+        << "        {\n"
+        << "            const size_t *group_slots = slots[ ( g - 2 ) % 3 ];\n"
+        << "            for ( size_t k = 0, i = ( g - 2 ) * GroupSize; k < GroupSize && i < n; ++k, ++i )\n"
+        << "            {\n"
+        << "                const std::string_view s = in[ i ];\n"
+        << "                const size_t slot = group_slots[ k ];\n"
+        << "                out[ i ] = slot != NoSlot && " << verify << " ? " << result << " : " << miss << ";\n"
+        << "            }\n"
+        << "        }\n"
+        << "    }\n"
+        << "}\n"
+        << "\n";
+}
+
+// Emits name_dispatch(), switching on the hash value of s and running the
+// handler statement of the keyword in its case, after comparing s with that
+// single keyword.
+static void OutputDispatch( const PerfectHash &soln )
+{
+    auto [ min_word_len, max_word_len ] = WordLengthRange( soln );
+
+    bool returns_void = arg_dispatch_return_type == "void";
+
+    // Handlers of non-void functions are expected to return, the ones which
+    // do not continue with the default statement.
+    std::string default_statement = arg_dispatch_default;
+    if ( default_statement.empty() )
+    {
+        default_statement = returns_void ? "return;" : "return {};";
+    }
+
+    std::cout
+        << "// Runs the handler of keyword s, the default statement if s is not a keyword\n"
+        << "inline " << arg_dispatch_return_type << " " << arg_func_name << "_dispatch( std::string_view s" << ( arg_dispatch_params.size() ? ", " + arg_dispatch_params : "" ) << " )\n"
+        << "{\n"
+        << "    constexpr size_t MinWordLength = " << min_word_len << ";\n"
+        << "    constexpr size_t MaxWordLength = " << max_word_len << ";\n"
+        << "\n"
+        << "    if ( s.size() >= MinWordLength && s.size() <= MaxWordLength )\n"
+        << "    {\n";
+
+    // Hash computation is indented one more level, inside the size check
+    {
+        std::streambuf *out = std::cout.rdbuf();
+        std::ostringstream hash_computation;
+        std::cout.rdbuf( hash_computation.rdbuf() );
+        OutputHashComputation( soln );
+        std::cout.rdbuf( out );
+
+        std::istringstream lines( hash_computation.str() );
+        std::string line;
+        while ( std::getline( lines, line ) )
+        {
+            std::cout << ( line.size() ? "    " : "" ) << line << "\n";
+        }
+    }
+
+    std::cout
+        << "        switch ( hash_val )\n"
+        << "        {\n";
+
+    for ( const auto &it : soln.word_map )
+    {
+        const std::string &keyword = it.second;
+        std::string compare;
+        if ( arg_search_options.ignore_case )
+        {
+            compare = "internal_::equals_ignore_case( s, \"" + StringEscape( ToLowerAscii( keyword ) ) + "\" )";
+        }
+        else
+        {
+            // Constant size lets the compiler inline memcmp as a few loads
+            compare = "s.size() == " + std::to_string( keyword.size() ) + " && std::memcmp( s.data(), \"" + StringEscape( keyword ) + "\", " + std::to_string( keyword.size() ) + " ) == 0";
+        }
+
+        std::cout
+            << "        case " << it.first << ":\n"
+            << "            if ( " << compare << " )\n"
+            << "            {\n"
+            << "                " << keyword_values.at( keyword ) << "\n";
+
+        if ( returns_void )
+        {
+            std::cout << "                return;\n";
+        }
+
+        std::cout
+            << "            }\n"
+            << "            break;\n";
+    }
+
+    std::cout
+        << "        }\n"
+        << "    }\n"
+        << "\n"
+        << "    " << default_statement << "\n"
+        << "}\n"
+        << "\n";
+}
+
+// Emits asso_values of a hash, as table name
+static void OutputAssoValues( const std::string &name, const std::vector< int > &asso_values )
+{
+    std::cout << "constexpr std::array< int, " << asso_values.size() << " > " << name << " = {\n";
+
+    for ( size_t i = 0; i < asso_values.size(); ++i )
+    {
+        if ( i % 10 == 0 )
+        {
+            std::cout << "    ";
+        }
+
+        std::cout << std::setw( 6 ) << std::right << asso_values[ i ] << ",";
+
+        if ( i % 10 == 9 || i == asso_values.size() - 1 )
+        {
+            std::cout << "\n";
+        }
+    }
+
+    std::cout << "};\n\n";
+}
+
+static void OutputCpp17Code( const PerfectHash &soln )
+{
+    EnumNameGen enum_names;
+
+    int max_hash_value = soln.word_map.rbegin()->first;
+
+    std::set< std::string > includes;
+    if ( arg_minimal || arg_emit_padded || arg_emit_unchecked || arg_emit_find_all || arg_search_options.ignore_case || arg_value_type.size() || soln.key_windows.size() )
+    {
+        includes.insert( "cstdint" );
+    }
+    if ( arg_emit_padded || arg_dispatch )
+    {
+        includes.insert( "cstring" );
+    }
+    if ( arg_emit_unchecked )
+    {
+        includes.insert( "cassert" );
+    }
+
+    OutputPrologue( soln.word_map, enum_names, includes );
+
+    std::cout
+        << "namespace internal_ {\n"
+        << "\n";
+
+    // TODO check on a flag to enable definitions for use from multiple translation units?
+
+    {
+        std::set< int > widths;
+        for ( const KeyWindow &window : soln.key_windows )
+        {
+            widths.insert( window.width );
+        }
+        widths.erase( 1 );
+
+        if ( arg_search_options.ignore_case )
+        {
+            widths.insert( 8 );
+        }
+
+        // Tags of keys in batch lookups
+        if ( arg_emit_batch )
+        {
+            widths.insert( 4 );
+            widths.insert( 8 );
+        }
+
+        for ( int width : widths )
+        {
+            OutputLoadLittleEndian( width );
+        }
+    }
+
+    if ( arg_search_options.ignore_case )
+    {
+        OutputCaseFolding( true );
+    }
+
+    OutputAssoValues( "asso_values", soln.asso_values );
+
+    if ( arg_minimal )
+    {
+        OutputRankBitmap( soln );
+    }
+
+    std::cout
+        << "struct word_entry\n"
+        << "{\n"
+        << "    std::string_view word;\n"
+        << "    " << arg_func_name << "_enum enum_val;\n";
+
+    // Value is next to the keyword, a hit reads a single entry
+    OutputValueMember();
+
+    std::cout
+        << "};\n"
+        << "\n";
+
+    // In minimal mode slots are indexed by rank of the hash value, so there
+    // are no empty entries in the table.
+    size_t wordlist_size = arg_minimal ? soln.word_map.size() : max_hash_value + 1;
+
+    std::cout << "constexpr std::array< word_entry, " << wordlist_size << " > wordlist = {{\n";
+    {
+        int index = 0;
+        for ( const auto &it : soln.word_map )
+        {
+            int hash = it.first;
+            const std::string &keyword = it.second;
+            std::string case_label = enum_names.get_case_label( keyword );
+
+            while ( !arg_minimal && index < hash )
+            {
+                std::cout << "    { \"\", " << arg_func_name << "_enum::" << enum_names.get_default_case_label() << EmptyValueInitializer() << " },\n";
+                ++index;
+            }
+
+            // Keywords are compared in lower case when case-insensitive
+            std::string word = arg_search_options.ignore_case ? ToLowerAscii( keyword ) : keyword;
+            std::cout << "    { \"" << StringEscape( word ) << "\", " << arg_func_name << "_enum::" << case_label << ValueInitializer( keyword ) << " },\n";
+            ++index;
+        }
+    }
+    std::cout
+        << "}};\n"
+        << "\n";
+
+    if ( arg_emit_padded )
+    {
+        OutputPaddedKeys( soln, enum_names );
+    }
+
+    // In minimal mode the slot is the enum value already
+    if ( arg_emit_unchecked && !arg_minimal )
+    {
+        OutputEnumTable( soln, enum_names );
+    }
+
+    std::cout
+        << "} // namespace internal_\n"
+        << "\n";
+
+    std::cout
+        << "constexpr internal_::" << arg_func_name << "_enum " << arg_func_name << "( std::string_view s )\n"
+        << "{\n";
+
+    const std::string default_enum = "internal_::" + arg_func_name + "_enum::" + enum_names.get_default_case_label();
+    const std::string verify = arg_search_options.ignore_case ? "internal_::equals_ignore_case( s, internal_::wordlist[ slot ].word )" : "internal_::wordlist[ slot ].word == s";
+
+    OutputLookupBody( soln, verify, "internal_::wordlist[ slot ].enum_val", default_enum );
+
+    std::cout
+        << "}\n"
+        << "\n";
+
+    if ( arg_value_type.size() )
+    {
+        std::cout
+            << "constexpr const " << arg_func_name << "_value_type* " << arg_func_name << "_value( std::string_view s )\n"
+            << "{\n";
+
+        OutputLookupBody( soln, verify, "&internal_::wordlist[ slot ].value", "nullptr" );
+
+        std::cout
+            << "}\n"
+            << "\n";
+    }
+
+    if ( arg_emit_padded )
+    {
+        std::cout
+            << "// Same as " << arg_func_name << "(), but at least " << arg_func_name << "_padding bytes past the end of s\n"
+            << "// must be readable. Keys are compared 8 bytes at a time.\n"
+            << "inline internal_::" << arg_func_name << "_enum " << arg_func_name << "_padded( std::string_view s )\n"
+            << "{\n";
+
+        OutputLookupBody( soln, "internal_::padded_equals( internal_::padded_keys[ slot ], s )", "internal_::padded_keys[ slot ].enum_val", default_enum );
+
+        std::cout
+            << "}\n"
+            << "\n";
+    }
+
+    if ( arg_emit_scan )
+    {
+        OutputScan();
+    }
+
+    if ( arg_emit_matcher )
+    {
+        OutputMatcher( soln.word_map, enum_names );
+    }
+
+    if ( arg_emit_find_all )
+    {
+        OutputFindAll( soln.word_map );
+    }
+
+    if ( arg_emit_classify_all )
+    {
+        OutputClassifyAll();
+    }
+
+    if ( arg_emit_batch )
+    {
+        OutputBatch( soln, enum_names );
+    }
+
+    if ( arg_emit_pipelined )
+    {
+        OutputPipelined( soln, verify, "internal_::wordlist[ slot ].enum_val", default_enum );
+    }
+
+    if ( arg_dispatch )
+    {
+        OutputDispatch( soln );
+    }
+
+    if ( arg_emit_unchecked )
+    {
+        OutputUncheckedPrologue();
+        OutputHashComputation( soln );
+
+        if ( arg_minimal )
+        {
+            std::cout
+                << "    const uint64_t bits = internal_::slot_bitmap[ hash_val / 64 ];\n"
+                << "    const uint64_t bit = uint64_t( 1 ) << ( hash_val % 64 );\n"
+                << "    const auto res = static_cast< internal_::" << arg_func_name << "_enum >( internal_::slot_rank[ hash_val / 64 ] + internal_::popcount( bits & ( bit - 1 ) ) );\n";
+        }
+        else
+        {
+            std::cout << "    const auto res = static_cast< internal_::" << arg_func_name << "_enum >( internal_::enum_table[ hash_val ] );\n";
+        }
+
+        OutputUncheckedEpilogue();
+    }
+
+    OutputEpilogue( soln.word_map, enum_names );
+}
+
+static std::string IntegerLoad( size_t word_len )
+{
+    std::string load = "internal_::load_le" + std::to_string( word_len ) + "( s.data() )";
+    if ( arg_search_options.ignore_case )
+    {
+        return "internal_::fold_case( " + load + " )";
+    }
+    return load;
+}
+
+// Emits code for keywords of the same length of at most 8 bytes, which are
+// compared as a single integer.
+static void OutputIntegerCpp17Code( const IntegerHash &soln )
+{
+    EnumNameGen enum_names;
+
+    size_t word_len = soln.word_map.begin()->second.size();
+    size_t table_size = size_t( 1 ) << ( 64 - soln.shift );
+
+    std::set< std::string > includes = { "cstdint" };
+    if ( arg_emit_unchecked )
+    {
+        includes.insert( "cassert" );
+    }
+
+    OutputPrologue( soln.word_map, enum_names, includes );
+
+    std::cout
+        << "namespace internal_ {\n"
+        << "\n";
+
+    OutputLoadLittleEndian( word_len );
+
+    if ( arg_search_options.ignore_case )
+    {
+        OutputCaseFolding( false );
+    }
+
+    std::cout
+        << "struct key_entry\n"
+        << "{\n"
+        << "    uint64_t key;\n"
+        << "    " << arg_func_name << "_enum enum_val;\n";
+
+    OutputValueMember();
+
+    std::cout
+        << "};\n"
+        << "\n";
+
+    // Empty slots hold the key of a keyword, which hashes to the slot of that
+    // keyword, so no input matches them. A zero key would match NUL bytes.
+    auto key_of = []( const std::string &keyword ) {
+        return IntegerKey( arg_search_options.ignore_case ? ToLowerAscii( keyword ) : keyword );
+    };
+    const std::string empty_key = HexLiteral( key_of( soln.word_map.begin()->second ) );
+
+    std::cout << "constexpr std::array< key_entry, " << table_size << " > keylist = {{\n";
+    {
+        size_t index = 0;
+        for ( const auto &it : soln.word_map )
+        {
+            while ( index < (size_t)it.first )
+            {
+                std::cout << "    { " << empty_key << ", " << arg_func_name << "_enum::" << enum_names.get_default_case_label() << EmptyValueInitializer() << " },\n";
+                ++index;
+            }
+
+            std::cout
+                << "    { 0x" << std::hex << std::uppercase << key_of( it.second ) << std::dec << std::nouppercase << "ull, "
+                << arg_func_name << "_enum::" << enum_names.get_case_label( it.second ) << ValueInitializer( it.second ) << " }, // " << StringEscape( it.second ) << "\n";
+            ++index;
+        }
+
+        while ( index < table_size )
+        {
+            std::cout << "    { " << empty_key << ", " << arg_func_name << "_enum::" << enum_names.get_default_case_label() << EmptyValueInitializer() << " },\n";
+            ++index;
+        }
+    }
+    std::cout
+        << "}};\n"
+        << "\n"
+        << "} // namespace internal_\n"
+        << "\n";
+
+    std::cout
+        << "constexpr internal_::" << arg_func_name << "_enum " << arg_func_name << "( std::string_view s )\n"
+        << "{\n"
+        << "    constexpr size_t WordLength = " << word_len << ";\n"
+        << "\n"
+        << "    if ( s.size() != WordLength )\n"
+        << "    {\n"
+        << "        return internal_::" << arg_func_name << "_enum::" << enum_names.get_default_case_label() << ";\n"
+        << "    }\n"
+        << "\n"
+        << "    const uint64_t key = " << IntegerLoad( word_len ) << ";\n"
+        << "    const internal_::key_entry &entry = internal_::keylist[ ( key * 0x" << std::hex << std::uppercase << soln.multiplier << std::dec << std::nouppercase << "ull ) >> " << soln.shift << " ];\n"
+        << "    return entry.key == key ? entry.enum_val : internal_::" << arg_func_name << "_enum::" << enum_names.get_default_case_label() << ";\n"
+        << "}\n"
+        << "\n";
+
+    if ( arg_value_type.size() )
+    {
+        std::cout
+            << "constexpr const " << arg_func_name << "_value_type* " << arg_func_name << "_value( std::string_view s )\n"
+            << "{\n"
+            << "    if ( s.size() != " << word_len << " )\n"
+            << "    {\n"
+            << "        return nullptr;\n"
+            << "    }\n"
+            << "\n"
+            << "    const uint64_t key = " << IntegerLoad( word_len ) << ";\n"
+            << "    const internal_::key_entry &entry = internal_::keylist[ ( key * 0x" << std::hex << std::uppercase << soln.multiplier << std::dec << std::nouppercase << "ull ) >> " << soln.shift << " ];\n"
+            << "    return entry.key == key ? &entry.value : nullptr;\n"
+            << "}\n"
+            << "\n";
+    }
+
+    if ( arg_emit_scan )
+    {
+        OutputScan();
+    }
+
+    if ( arg_emit_matcher )
+    {
+        OutputMatcher( soln.word_map, enum_names );
+    }
+
+    if ( arg_emit_find_all )
+    {
+        OutputFindAll( soln.word_map );
+    }
+
+    if ( arg_emit_classify_all )
+    {
+        OutputClassifyAll();
+    }
+
+    if ( arg_emit_unchecked )
+    {
+        OutputUncheckedPrologue();
+
+        std::cout
+            << "    const uint64_t key = " << IntegerLoad( word_len ) << ";\n"
+            << "    const auto res = internal_::keylist[ ( key * 0x" << std::hex << std::uppercase << soln.multiplier << std::dec << std::nouppercase << "ull ) >> " << soln.shift << " ].enum_val;\n";
+
+        OutputUncheckedEpilogue();
+    }
+
+    OutputEpilogue( soln.word_map, enum_names );
+}
+
+// Emits code for keywords hashed whole, 8 bytes at a time. Lookup cost grows
+// with the length of s rather than with the number of positions needed to
+// tell keywords apart, which suits long keywords sharing prefixes.
+static void OutputFullKeyCpp17Code( const FullKeyHash &soln )
+{
+    EnumNameGen enum_names;
+
+    size_t min_word_len = SIZE_MAX;
+    size_t max_word_len = 0;
+    for ( const auto &it : soln.word_map )
+    {
+        min_word_len = std::min( min_word_len, it.second.size() );
+        max_word_len = std::max( max_word_len, it.second.size() );
+    }
+
+    std::set< std::string > includes = { "cstdint" };
+    if ( arg_emit_unchecked )
+    {
+        includes.insert( "cassert" );
+    }
+
+    OutputPrologue( soln.word_map, enum_names, includes );
+
+    const std::string default_enum = "internal_::" + arg_func_name + "_enum::" + enum_names.get_default_case_label();
+    auto fold = []( const std::string &load ) {
+        return arg_search_options.ignore_case ? "fold_case( " + load + " )" : load;
+    };
+
+    std::cout
+        << "namespace internal_ {\n"
+        << "\n";
+
+    OutputLoadLittleEndian( 8 );
+
+    if ( arg_search_options.ignore_case )
+    {
+        OutputCaseFolding( true );
+    }
+
+    std::cout
+        << "constexpr uint64_t mix( uint64_t x )\n"
+        << "{\n"
+        << "    x *= " << HexLiteral( FullKeyMixMultiplier ) << ";\n"
+        << "    return x ^ ( x >> 31 );\n"
+        << "}\n"
+        << "\n"
+        << "// Last 8 bytes overlap with the previous ones, instead of a loop for the tail\n"
+        << "constexpr uint64_t full_key_hash( std::string_view s )\n"
+        << "{\n"
+        << "    uint64_t h = " << HexLiteral( soln.seed ) << " ^ ( s.size() * " << HexLiteral( FullKeySizeMultiplier ) << " );\n"
+        << "    if ( s.size() < 8 )\n"
+        << "    {\n"
+        << "        uint64_t tail = 0;\n"
+        << "        for ( size_t i = 0; i < s.size(); ++i )\n"
+        << "        {\n"
+        << "            tail |= uint64_t( static_cast< unsigned char >( s[ i ] ) ) << ( i * 8 );\n"
+        << "        }\n"
+        << "        return mix( h ^ " << fold( "tail" ) << " );\n"
+        << "    }\n"
+        << "\n"
+        << "    for ( size_t i = 0; i + 8 < s.size(); i += 8 )\n"
+        << "    {\n"
+        << "        h = mix( h ^ " << fold( "load_le8( s.data() + i )" ) << " );\n"
+        << "    }\n"
+        << "    return mix( h ^ " << fold( "load_le8( s.data() + s.size() - 8 )" ) << " );\n"
+        << "}\n"
+        << "\n"
+        << "constexpr std::array< uint8_t, " << soln.displacements.size() << " > displacements = {{";
+
+    for ( size_t b = 0; b < soln.displacements.size(); ++b )
+    {
+        std::cout << ( b % 16 ? " " : "\n    " ) << soln.displacements[ b ] << ",";
+    }
+
+    std::cout
+        << "\n"
+        << "}};\n"
+        << "\n"
+        << "// High bits of the hash pick a bucket, whose displacement is mixed into the\n"
+        << "// hash again for the slot\n"
+        << "constexpr size_t full_key_slot( std::string_view s )\n"
+        << "{\n"
+        << "    const uint64_t h = full_key_hash( s );\n"
+        << "    const uint64_t bucket = ( ( h >> 32 ) * " << soln.displacements.size() << " ) >> 32;\n"
+        << "    const uint64_t x = ( h ^ ( displacements[ bucket ] * " << HexLiteral( FullKeySizeMultiplier ) << " ) ) * " << HexLiteral( FullKeySlotMultiplier ) << ";\n"
+        << "    return ( ( x >> 32 ) * " << soln.table_size << " ) >> 32;\n"
+        << "}\n"
+        << "\n"
+        << "struct word_entry\n"
+        << "{\n"
+        << "    std::string_view word;\n"
+        << "    " << arg_func_name << "_enum enum_val;\n";
+
+    OutputValueMember();
+
+    std::cout
+        << "};\n"
+        << "\n"
+        << "constexpr std::array< word_entry, " << soln.table_size << " > wordlist = {{\n";
+    {
+        size_t index = 0;
+        for ( const auto &it : soln.word_map )
+        {
+            while ( index < (size_t)it.first )
+            {
+                std::cout << "    { \"\", " << arg_func_name << "_enum::" << enum_names.get_default_case_label() << EmptyValueInitializer() << " },\n";
+                ++index;
+            }
+
+            std::string word = arg_search_options.ignore_case ? ToLowerAscii( it.second ) : it.second;
+            std::cout << "    { \"" << StringEscape( word ) << "\", " << arg_func_name << "_enum::" << enum_names.get_case_label( it.second ) << ValueInitializer( it.second ) << " },\n";
+            ++index;
+        }
+
+        while ( index < soln.table_size )
+        {
+            std::cout << "    { \"\", " << arg_func_name << "_enum::" << enum_names.get_default_case_label() << EmptyValueInitializer() << " },\n";
+            ++index;
+        }
+    }
+    std::cout
+        << "}};\n"
+        << "\n"
+        << "} // namespace internal_\n"
+        << "\n";
+
+    const std::string verify = arg_search_options.ignore_case ? "internal_::equals_ignore_case( s, entry.word )" : "entry.word == s";
+
+    auto lookup_body = [ & ]( const std::string &result, const std::string &miss ) {
+        std::cout
+            << "    constexpr size_t MinWordLength = " << min_word_len << ";\n"
+            << "    constexpr size_t MaxWordLength = " << max_word_len << ";\n"
+            << "\n"
+            << "    if ( s.size() < MinWordLength || s.size() > MaxWordLength )\n"
+            << "    {\n"
+            << "        return " << miss << ";\n"
+            << "    }\n"
+            << "\n"
+            << "    const internal_::word_entry &entry = internal_::wordlist[ internal_::full_key_slot( s ) ];\n"
+            << "    return " << verify << " ? " << result << " : " << miss << ";\n";
+    };
+
+    std::cout
+        << "constexpr internal_::" << arg_func_name << "_enum " << arg_func_name << "( std::string_view s )\n"
+        << "{\n";
+
+    lookup_body( "entry.enum_val", default_enum );
+
+    std::cout
+        << "}\n"
+        << "\n";
+
+    if ( arg_value_type.size() )
+    {
+        std::cout
+            << "constexpr const " << arg_func_name << "_value_type* " << arg_func_name << "_value( std::string_view s )\n"
+            << "{\n";
+
+        lookup_body( "&entry.value", "nullptr" );
+
+        std::cout
+            << "}\n"
+            << "\n";
+    }
+
+    if ( arg_emit_scan )
+    {
+        OutputScan();
+    }
+
+    if ( arg_emit_matcher )
+    {
+        OutputMatcher( soln.word_map, enum_names );
+    }
+
+    if ( arg_emit_find_all )
+    {
+        OutputFindAll( soln.word_map );
+    }
+
+    if ( arg_emit_classify_all )
+    {
+        OutputClassifyAll();
+    }
+
+    if ( arg_emit_unchecked )
+    {
+        OutputUncheckedPrologue();
+        std::cout << "    const auto res = internal_::wordlist[ internal_::full_key_slot( s ) ].enum_val;\n";
+        OutputUncheckedEpilogue();
+    }
+
+    OutputEpilogue( soln.word_map, enum_names );
+}
+
+// Emits values of keywords, indexed by enum value
+static void OutputValueArray( const std::map< int, std::string > &word_map )
+{
+    std::cout << "constexpr std::array< " << arg_func_name << "_value_type, " << word_map.size() << " > values = {{\n";
+    for ( const auto &it : word_map )
+    {
+        std::cout << "    " << keyword_values.at( it.second ) << ", // " << StringEscape( it.second ) << "\n";
+    }
+    std::cout
+        << "}};\n"
+        << "\n";
+}
+
+// Emits code for keywords split into groups of consecutive sizes, each with
+// its own asso_values and wordlist. The lookup dispatches on the size of s to
+// the function of its group, whose hash only separates keywords of similar
+// sizes, so it takes fewer positions and a denser table than a single hash.
+static void OutputPartitionedCpp17Code( const std::vector< SizeGroup > &groups )
+{
+    EnumNameGen enum_names;
+
+    // Enum values follow groups, then hash values in each
+    std::map< int, std::string > word_map;
+    for ( const SizeGroup &group : groups )
+    {
+        for ( const auto &it : group.hash.word_map )
+        {
+            word_map[ word_map.size() ] = it.second;
+        }
+    }
+
+    OutputPrologue( word_map, enum_names, { "cstdint" } );
+
+    const std::string enum_type = "internal_::" + arg_func_name + "_enum";
+    const std::string default_enum = enum_type + "::" + enum_names.get_default_case_label();
+
+    std::cout
+        << "namespace internal_ {\n"
+        << "\n";
+
+    {
+        std::set< int > widths;
+        for ( const SizeGroup &group : groups )
+        {
+            for ( const KeyWindow &window : group.hash.key_windows )
+            {
+                widths.insert( window.width );
+            }
+        }
+        widths.erase( 1 );
+
+        if ( arg_search_options.ignore_case )
+        {
+            widths.insert( 8 );
+        }
+
+        for ( int width : widths )
+        {
+            OutputLoadLittleEndian( width );
+        }
+    }
+
+    if ( arg_search_options.ignore_case )
+    {
+        OutputCaseFolding( true );
+    }
+
+    std::cout
+        << "struct word_entry\n"
+        << "{\n"
+        << "    std::string_view word;\n"
+        << "    " << arg_func_name << "_enum enum_val;\n";
+    OutputValueMember();
+    std::cout
+        << "};\n"
+        << "\n";
+
+    for ( size_t g = 0; g < groups.size(); ++g )
+    {
+        const SizeGroup &group = groups[ g ];
+        const std::string suffix = "_" + std::to_string( g );
+        int max_hash_value = group.hash.word_map.rbegin()->first;
+
+        std::cout << "// Keywords of " << group.min_size << " to " << group.max_size << " bytes\n";
+        OutputAssoValues( "asso_values" + suffix, group.hash.asso_values );
+
+        std::cout << "constexpr std::array< word_entry, " << max_hash_value + 1 << " > wordlist" << suffix << " = {{\n";
+        {
+            int index = 0;
+            for ( const auto &it : group.hash.word_map )
+            {
+                while ( index < it.first )
+                {
+                    std::cout << "    { \"\", " << arg_func_name << "_enum::" << enum_names.get_default_case_label() << EmptyValueInitializer() << " },\n";
+                    ++index;
+                }
+
+                std::string word = arg_search_options.ignore_case ? ToLowerAscii( it.second ) : it.second;
+                std::cout << "    { \"" << StringEscape( word ) << "\", " << arg_func_name << "_enum::" << enum_names.get_case_label( it.second ) << ValueInitializer( it.second ) << " },\n";
+                ++index;
+            }
+        }
+        std::cout
+            << "}};\n"
+            << "\n"
+            << "constexpr " << arg_func_name << "_enum " << arg_func_name << suffix << "( std::string_view s )\n"
+            << "{\n";
+
+        const std::string entry = "internal_::wordlist" + suffix + "[ slot ]";
+        const std::string verify = arg_search_options.ignore_case ? "internal_::equals_ignore_case( s, " + entry + ".word )" : entry + ".word == s";
+        OutputLookupBody( group.hash, verify, entry + ".enum_val", default_enum, "internal_::asso_values" + suffix );
+
+        std::cout
+            << "}\n"
+            << "\n";
+
+        if ( arg_value_type.size() )
+        {
+            std::cout
+                << "constexpr const " << arg_func_name << "_value_type* " << arg_func_name << "_value" << suffix << "( std::string_view s )\n"
+                << "{\n";
+
+            OutputLookupBody( group.hash, verify, "&" + entry + ".value", "nullptr", "internal_::asso_values" + suffix );
+
+            std::cout
+                << "}\n"
+                << "\n";
+        }
+    }
+
+    std::cout
+        << "} // namespace internal_\n"
+        << "\n"
+        << "constexpr " << enum_type << " " << arg_func_name << "( std::string_view s )\n"
+        << "{\n"
+        << "    switch ( s.size() )\n"
+        << "    {\n";
+
+    for ( size_t g = 0; g < groups.size(); ++g )
+    {
+        for ( size_t size = groups[ g ].min_size; size <= groups[ g ].max_size; ++size )
+        {
+            std::cout << "    case " << size << ":\n";
+        }
+        std::cout << "        return internal_::" << arg_func_name << "_" << g << "( s );\n";
+    }
+
+    std::cout
+        << "    }\n"
+        << "\n"
+        << "    return " << default_enum << ";\n"
+        << "}\n"
+        << "\n";
+
+    if ( arg_value_type.size() )
+    {
+        // Values are in the entries of each group, so a hit reads one entry
+        std::cout
+            << "constexpr const " << arg_func_name << "_value_type* " << arg_func_name << "_value( std::string_view s )\n"
+            << "{\n"
+            << "    switch ( s.size() )\n"
+            << "    {\n";
+
+        for ( size_t g = 0; g < groups.size(); ++g )
+        {
+            for ( size_t size = groups[ g ].min_size; size <= groups[ g ].max_size; ++size )
+            {
+                std::cout << "    case " << size << ":\n";
+            }
+            std::cout << "        return internal_::" << arg_func_name << "_value_" << g << "( s );\n";
+        }
+
+        std::cout
+            << "    }\n"
+            << "\n"
+            << "    return nullptr;\n"
+            << "}\n"
+            << "\n";
+    }
+
+    if ( arg_emit_scan )
+    {
+        OutputScan();
+    }
+
+    if ( arg_emit_matcher )
+    {
+        OutputMatcher( word_map, enum_names );
+    }
+
+    if ( arg_emit_find_all )
+    {
+        OutputFindAll( word_map );
+    }
+
+    if ( arg_emit_classify_all )
+    {
+        OutputClassifyAll();
+    }
+
+    OutputEpilogue( word_map, enum_names );
+}
+
+// Returns a character literal of byte c, for case labels
+static std::string CharLiteral( unsigned char c )
+{
+    if ( c >= 0x20 && c < 0x7F && c != '\'' && c != '\\' )
+    {
+        return std::string( "'" ) + char( c ) + "'";
+    }
+
+    return std::string( "'\\x" ) + ToHex( c / 16 ) + ToHex( c % 16 ) + "'";
+}
+
+// Emits the switch statement of a node of the tree and its children, with
+// result( keyword ) returned for keywords. Keywords are compared unless verify
+// is false, a leaf with several keywords is still compared to tell them apart.
+template < typename Result >
+static void OutputSwitchNode( const SwitchTree &tree, size_t index, const std::string &indent, bool verify, const Result &result )
+{
+    const SwitchNode &node = tree.nodes[ index ];
+
+    if ( node.position == -1 )
+    {
+        for ( const std::string &word : node.words )
+        {
+            if ( node.checked || ( !verify && node.words.size() == 1 ) )
+            {
+                std::cout << indent << "return " << result( word ) << ";\n";
+                continue;
+            }
+
+            if ( arg_search_options.ignore_case )
+            {
+                std::cout << indent << "if ( internal_::equals_ignore_case( s, \"" << StringEscape( ToLowerAscii( word ) ) << "\" ) )\n";
+            }
+            else
+            {
+                std::cout << indent << "if ( s == \"" << StringEscape( word ) << "\" )\n";
+            }
+
+            std::cout
+                << indent << "{\n"
+                << indent << "    return " << result( word ) << ";\n"
+                << indent << "}\n";
+        }
+
+        std::cout << indent << "break;\n";
+        return;
+    }
+
+    std::cout
+        << indent << "switch ( s[ " << node.position << " ] )\n"
+        << indent << "{\n";
+
+    for ( const auto &[ byte, child ] : node.children )
+    {
+        std::cout << indent << "case " << CharLiteral( byte ) << ":\n";
+        if ( arg_search_options.ignore_case && byte >= 'a' && byte <= 'z' )
+        {
+            std::cout << indent << "case " << CharLiteral( byte - 'a' + 'A' ) << ":\n";
+        }
+
+        OutputSwitchNode( tree, child, indent + "    ", verify, result );
+    }
+
+    std::cout
+        << indent << "}\n"
+        << indent << "break;\n";
+}
+
+// Emits body of a lookup through the tree, a switch on the size of s first
+template < typename Result >
+static void OutputSwitchLookupBody( const SwitchTree &tree, bool verify, const Result &result, const std::string &miss )
+{
+    std::cout
+        << "    switch ( s.size() )\n"
+        << "    {\n";
+
+    for ( const auto &[ size, root ] : tree.roots )
+    {
+        std::cout << "    case " << size << ":\n";
+        OutputSwitchNode( tree, root, "        ", verify, result );
+    }
+
+    std::cout
+        << "    }\n"
+        << "\n"
+        << "    return " << miss << ";\n";
+}
+
+// Emits code for small sets, looked up with nested switch statements on the
+// size and bytes of s, then a compare of constant length. There are no table
+// loads, jump tables are left to the compiler.
+static void OutputSwitchCpp17Code( const SwitchTree &tree )
+{
+    EnumNameGen enum_names;
+
+    std::set< std::string > includes;
+    if ( arg_search_options.ignore_case )
+    {
+        includes.insert( "cstdint" );
+    }
+    if ( arg_emit_unchecked )
+    {
+        includes.insert( "cassert" );
+    }
+
+    OutputPrologue( tree.word_map, enum_names, includes );
+
+    std::unordered_map< std::string, int > indices;
+    for ( const auto &it : tree.word_map )
+    {
+        indices[ it.second ] = it.first;
+    }
+
+    if ( arg_search_options.ignore_case || arg_value_type.size() )
+    {
+        std::cout
+            << "namespace internal_ {\n"
+            << "\n";
+
+        if ( arg_search_options.ignore_case )
+        {
+            OutputLoadLittleEndian( 8 );
+            OutputCaseFolding( true );
+        }
+
+        if ( arg_value_type.size() )
+        {
+            OutputValueArray( tree.word_map );
+        }
+
+        std::cout
+            << "} // namespace internal_\n"
+            << "\n";
+    }
+
+    auto enum_result = [ & ]( const std::string &keyword ) {
+        return "internal_::" + arg_func_name + "_enum::" + enum_names.get_case_label( keyword );
+    };
+    const std::string default_enum = "internal_::" + arg_func_name + "_enum::" + enum_names.get_default_case_label();
+
+    std::cout
+        << "constexpr internal_::" << arg_func_name << "_enum " << arg_func_name << "( std::string_view s )\n"
+        << "{\n";
+
+    OutputSwitchLookupBody( tree, true, enum_result, default_enum );
+
+    std::cout
+        << "}\n"
+        << "\n";
+
+    if ( arg_value_type.size() )
+    {
+        auto value_result = [ & ]( const std::string &keyword ) {
+            return "&internal_::values[ " + std::to_string( indices.at( keyword ) ) + " ]";
+        };
+
+        std::cout
+            << "constexpr const " << arg_func_name << "_value_type* " << arg_func_name << "_value( std::string_view s )\n"
+            << "{\n";
+
+        OutputSwitchLookupBody( tree, true, value_result, "nullptr" );
+
+        std::cout
+            << "}\n"
+            << "\n";
+    }
+
+    if ( arg_emit_scan )
+    {
+        OutputScan();
+    }
+
+    if ( arg_emit_matcher )
+    {
+        OutputMatcher( tree.word_map, enum_names );
+    }
+
+    if ( arg_emit_find_all )
+    {
+        OutputFindAll( tree.word_map );
+    }
+
+    if ( arg_emit_classify_all )
+    {
+        OutputClassifyAll();
+    }
+
+    if ( arg_emit_unchecked )
+    {
+        std::cout
+            << "namespace internal_ {\n"
+            << "\n"
+            << "// Lookup through the tree only, keywords are not compared\n"
+            << "constexpr " << arg_func_name << "_enum " << arg_func_name << "_find_unchecked( std::string_view s )\n"
+            << "{\n";
+
+        OutputSwitchLookupBody( tree, false, enum_result, default_enum );
+
+        std::cout
+            << "}\n"
+            << "\n"
+            << "} // namespace internal_\n"
+            << "\n";
+
+        OutputUncheckedPrologue();
+        std::cout << "    const auto res = internal_::" << arg_func_name << "_find_unchecked( s );\n";
+        OutputUncheckedEpilogue();
+    }
+
+    OutputEpilogue( tree.word_map, enum_names );
+}
+
+// Emits code for at most 32 keywords of at most 16 bytes, compared against all
+// of them at once. Keys are stored by column: each byte of s is broadcast and
+// compared against a column of 16 (SSE2) or 32 (AVX2) keys, and the size of s
+// against their sizes. The first bit set in the match mask is the enum value,
+// so a lookup takes the same steps for any input. Constant evaluation and
+// other targets use a scalar loop over the same tables.
+static void OutputSimdCpp17Code( const std::map< int, std::string > &word_map )
+{
+    EnumNameGen enum_names;
+
+    size_t max_word_len = 0;
+    for ( const auto &it : word_map )
+    {
+        max_word_len = std::max( max_word_len, it.second.size() );
+    }
+    size_t lanes = word_map.size() <= 16 ? 16 : 32;
+
+    OutputPrologue( word_map, enum_names, { "cstdint" } );
+
+    const std::string enum_type = "internal_::" + arg_func_name + "_enum";
+    const std::string default_enum = enum_type + "::" + enum_names.get_default_case_label();
+
+    std::cout
+        << "namespace internal_ {\n"
+        << "\n"
+        << "// Byte j of key k is key_columns[ j ][ k ], zero past its end" << ( arg_search_options.ignore_case ? ", in lower case" : "" ) << ".\n"
+        << "// Unused lanes have a size no input matches.\n"
+        << "alignas( 32 ) constexpr std::array< std::array< uint8_t, " << lanes << " >, " << max_word_len << " > key_columns = {{\n";
+
+    for ( size_t j = 0; j < max_word_len; ++j )
+    {
+        std::cout << "    {{";
+        for ( size_t k = 0; k < lanes; ++k )
+        {
+            int byte = 0;
+            if ( k < word_map.size() && j < word_map.at( k ).size() )
+            {
+                std::string word = arg_search_options.ignore_case ? ToLowerAscii( word_map.at( k ) ) : word_map.at( k );
+                byte = static_cast< unsigned char >( word[ j ] );
+            }
+            std::cout << ( k ? ", " : " " ) << byte;
+        }
+        std::cout << " }},\n";
+    }
+
+    std::cout
+        << "}};\n"
+        << "\n"
+        << "alignas( 32 ) constexpr std::array< uint8_t, " << lanes << " > key_sizes = {{";
+
+    for ( size_t k = 0; k < lanes; ++k )
+    {
+        std::cout << ( k ? ", " : " " ) << ( k < word_map.size() ? word_map.at( k ).size() : 255 );
+    }
+
+    std::cout
+        << " }};\n"
+        << "\n";
+
+    if ( arg_value_type.size() )
+    {
+        OutputValueArray( word_map );
+    }
+
+    std::cout
+        << "constexpr " << arg_func_name << "_enum " << arg_func_name << "_scalar( std::string_view s )\n"
+        << "{\n"
+        << "    for ( size_t k = 0; k < " << word_map.size() << "; ++k )\n"
+        << "    {\n"
+        << "        bool match = key_sizes[ k ] == s.size();\n"
+        << "        for ( size_t j = 0; j < s.size() && match; ++j )\n"
+        << "        {\n"
+        << "            uint8_t c = static_cast< uint8_t >( s[ j ] );\n";
+
+    if ( arg_search_options.ignore_case )
+    {
+        std::cout << "            c |= uint8_t( c - 'A' ) < 26 ? 0x20 : 0;\n";
+    }
+
+    std::cout
+        << "            match = key_columns[ j ][ k ] == c;\n"
+        << "        }\n"
+        << "\n"
+        << "        if ( match )\n"
+        << "        {\n"
+        << "            return static_cast< " << arg_func_name << "_enum >( k );\n"
+        << "        }\n"
+        << "    }\n"
+        << "\n"
+        << "    return " << arg_func_name << "_enum::" << enum_names.get_default_case_label() << ";\n"
+        << "}\n"
+        << "\n"
+        << "#if defined( __SSE2__ )\n"
+        << "inline " << arg_func_name << "_enum " << arg_func_name << "_simd( std::string_view s )\n"
+        << "{\n"
+        << "    constexpr size_t MaxWordLength = " << max_word_len << ";\n"
+        << "\n"
+        << "    if ( s.size() > MaxWordLength )\n"
+        << "    {\n"
+        << "        return " << arg_func_name << "_enum::" << enum_names.get_default_case_label() << ";\n"
+        << "    }\n"
+        << "\n";
+
+    // Bytes past the end of s are zero, as for the keys. They are read from s
+    // directly: copying s to a padded buffer costs a memcpy call, more than the
+    // compares.
+    std::cout
+        << "    auto byte = [ s ]( size_t j ) -> char {\n"
+        << "        uint8_t c = j < s.size() ? static_cast< uint8_t >( s[ j ] ) : 0;\n";
+
+    if ( arg_search_options.ignore_case )
+    {
+        std::cout << "        c |= uint8_t( c - 'A' ) < 26 ? 0x20 : 0;\n";
+    }
+
+    std::cout
+        << "        return char( c );\n"
+        << "    };\n"
+        << "\n";
+
+    if ( lanes == 32 )
+    {
+        std::cout
+            << "#if defined( __AVX2__ )\n"
+            << "    __m256i match = _mm256_cmpeq_epi8( _mm256_load_si256( reinterpret_cast< const __m256i* >( key_sizes.data() ) ), _mm256_set1_epi8( char( s.size() ) ) );\n"
+            << "    for ( size_t j = 0; j < MaxWordLength; ++j )\n"
+            << "    {\n"
+            << "        const __m256i column = _mm256_load_si256( reinterpret_cast< const __m256i* >( key_columns[ j ].data() ) );\n"
+            << "        match = _mm256_and_si256( match, _mm256_cmpeq_epi8( column, _mm256_set1_epi8( byte( j ) ) ) );\n"
+            << "    }\n"
+            << "    const uint32_t bits = _mm256_movemask_epi8( match );\n"
+            << "#else\n";
+    }
+
+    std::cout
+        << "    constexpr size_t Registers = " << lanes / 16 << ";\n"
+        << "\n"
+        << "    __m128i match[ Registers ];\n"
+        << "    for ( size_t r = 0; r < Registers; ++r )\n"
+        << "    {\n"
+        << "        match[ r ] = _mm_cmpeq_epi8( _mm_load_si128( reinterpret_cast< const __m128i* >( key_sizes.data() + 16 * r ) ), _mm_set1_epi8( char( s.size() ) ) );\n"
+        << "    }\n"
+        << "    for ( size_t j = 0; j < MaxWordLength; ++j )\n"
+        << "    {\n"
+        << "        const __m128i broadcast = _mm_set1_epi8( byte( j ) );\n"
+        << "        for ( size_t r = 0; r < Registers; ++r )\n"
+        << "        {\n"
+        << "            const __m128i column = _mm_load_si128( reinterpret_cast< const __m128i* >( key_columns[ j ].data() + 16 * r ) );\n"
+        << "            match[ r ] = _mm_and_si128( match[ r ], _mm_cmpeq_epi8( column, broadcast ) );\n"
+        << "        }\n"
+        << "    }\n"
+        << "    uint32_t bits = 0;\n"
+        << "    for ( size_t r = 0; r < Registers; ++r )\n"
+        << "    {\n"
+        << "        bits |= uint32_t( _mm_movemask_epi8( match[ r ] ) ) << ( 16 * r );\n"
+        << "    }\n";
+
+    if ( lanes == 32 )
+    {
+        std::cout << "#endif\n";
+    }
+
+    std::cout
+        << "\n"
+        << "    return bits ? static_cast< " << arg_func_name << "_enum >( __builtin_ctz( bits ) ) : " << arg_func_name << "_enum::" << enum_names.get_default_case_label() << ";\n"
+        << "}\n"
+        << "#endif\n"
+        << "\n"
+        << "} // namespace internal_\n"
+        << "\n"
+        << "constexpr " << enum_type << " " << arg_func_name << "( std::string_view s )\n"
+        << "{\n"
+        << "#if defined( __SSE2__ ) && defined( __has_builtin )\n"
+        << "#if __has_builtin( __builtin_is_constant_evaluated )\n"
+        << "    if ( !__builtin_is_constant_evaluated() )\n"
+        << "    {\n"
+        << "        return internal_::" << arg_func_name << "_simd( s );\n"
+        << "    }\n"
+        << "#endif\n"
+        << "#endif\n"
+        << "\n"
+        << "    return internal_::" << arg_func_name << "_scalar( s );\n"
+        << "}\n"
+        << "\n";
+
+    if ( arg_value_type.size() )
+    {
+        std::cout
+            << "constexpr const " << arg_func_name << "_value_type* " << arg_func_name << "_value( std::string_view s )\n"
+            << "{\n"
+            << "    const auto res = " << arg_func_name << "( s );\n"
+            << "    return res == " << default_enum << " ? nullptr : &internal_::values[ static_cast< int >( res ) ];\n"
+            << "}\n"
+            << "\n";
+    }
+
+    if ( arg_emit_scan )
+    {
+        OutputScan();
+    }
+
+    if ( arg_emit_matcher )
+    {
+        OutputMatcher( word_map, enum_names );
+    }
+
+    if ( arg_emit_find_all )
+    {
+        OutputFindAll( word_map );
+    }
+
+    if ( arg_emit_classify_all )
+    {
+        OutputClassifyAll();
+    }
+
+    OutputEpilogue( word_map, enum_names );
+}
+
+// Emits a table of 256 enum values, 16 per line
+static void OutputEnumRow( const std::vector< int > &row, const std::string &indent )
+{
+    for ( size_t i = 0; i < row.size(); ++i )
+    {
+        std::cout << ( i % 16 == 0 ? indent : "" ) << std::setw( 4 ) << std::right << row[ i ] << "," << ( i % 16 == 15 ? "\n" : "" );
+    }
+}
+
+// Emits code for keywords of one or two bytes, which index tables of enum
+// values directly: one byte keywords a table of 256 entries, two byte ones a
+// row picked by their first byte, so that tables stay small enough for L1
+// rather than taking 65536 entries. Nothing is compared, case-insensitive
+// keywords have an entry for each case.
+static void OutputDirectCpp17Code( const std::map< int, std::string > &word_map )
+{
+    EnumNameGen enum_names;
+
+    // Spellings of a keyword matched, both cases of letters if case-insensitive
+    auto spellings = []( const std::string &keyword ) {
+        std::vector< std::string > res = { keyword };
+        for ( size_t i = 0; arg_search_options.ignore_case && i < keyword.size(); ++i )
+        {
+            char c = keyword[ i ];
+            if ( ( c >= 'a' && c <= 'z' ) || ( c >= 'A' && c <= 'Z' ) )
+            {
+                for ( size_t k = 0, n = res.size(); k < n; ++k )
+                {
+                    res.push_back( res[ k ] );
+                    res.back()[ i ] ^= 0x20;
+                }
+            }
+        }
+        return res;
+    };
+
+    std::vector< int > one_byte( 256, -1 );
+    std::vector< int > row_of( 256, 0 );
+    std::vector< std::vector< int > > rows = { std::vector< int >( 256, -1 ) };
+    bool has_one_byte = false;
+
+    for ( const auto &it : word_map )
+    {
+        for ( const std::string &word : spellings( it.second ) )
+        {
+            const unsigned char c0 = word[ 0 ];
+            if ( word.size() == 1 )
+            {
+                one_byte[ c0 ] = it.first;
+                has_one_byte = true;
+                continue;
+            }
+
+            if ( row_of[ c0 ] == 0 )
+            {
+                row_of[ c0 ] = rows.size();
+                rows.emplace_back( 256, -1 );
+            }
+            rows[ row_of[ c0 ] ][ static_cast< unsigned char >( word[ 1 ] ) ] = it.first;
+        }
+    }
+
+    std::set< std::string > includes = { "cstdint" };
+    if ( arg_emit_unchecked )
+    {
+        includes.insert( "cassert" );
+    }
+
+    OutputPrologue( word_map, enum_names, includes );
+
+    const std::string enum_type = "internal_::" + arg_func_name + "_enum";
+    const std::string default_enum = enum_type + "::" + enum_names.get_default_case_label();
+    const char *entry_type = CompactEnumType( word_map.size() );
+
+    std::cout
+        << "namespace internal_ {\n"
+        << "\n";
+
+    if ( has_one_byte )
+    {
+        std::cout << "// Enum values of one byte keywords, by byte\n"
+                  << "constexpr std::array< " << entry_type << ", 256 > one_byte = {{\n";
+        OutputEnumRow( one_byte, "    " );
+        std::cout << "}};\n"
+                  << "\n";
+    }
+
+    if ( rows.size() > 1 )
+    {
+        std::cout << "// Row of two byte keywords by their first byte, row 0 has none\n"
+                  << "constexpr std::array< " << ( rows.size() <= 256 ? "uint8_t" : "uint16_t" ) << ", 256 > first_byte_rows = {{\n";
+        OutputEnumRow( row_of, "    " );
+        std::cout << "}};\n"
+                  << "\n"
+                  << "// Enum values of two byte keywords, by row and second byte\n"
+                  << "constexpr std::array< std::array< " << entry_type << ", 256 >, " << rows.size() << " > two_bytes = {{\n";
+        for ( const std::vector< int > &row : rows )
+        {
+            std::cout << "    {{\n";
+            OutputEnumRow( row, "        " );
+            std::cout << "    }},\n";
+        }
+        std::cout << "}};\n"
+                  << "\n";
+    }
+
+    if ( arg_value_type.size() )
+    {
+        OutputValueArray( word_map );
+    }
+
+    std::cout
+        << "} // namespace internal_\n"
+        << "\n"
+        << "constexpr " << enum_type << " " << arg_func_name << "( std::string_view s )\n"
+        << "{\n";
+
+    if ( has_one_byte )
+    {
+        std::cout
+            << "    if ( s.size() == 1 )\n"
+            << "    {\n"
+            << "        return static_cast< " << enum_type << " >( internal_::one_byte[ static_cast< unsigned char >( s[ 0 ] ) ] );\n"
+            << "    }\n"
+            << "\n";
+    }
+
+    if ( rows.size() > 1 )
+    {
+        std::cout
+            << "    if ( s.size() == 2 )\n"
+            << "    {\n"
+            << "        const auto &row = internal_::two_bytes[ internal_::first_byte_rows[ static_cast< unsigned char >( s[ 0 ] ) ] ];\n"
+            << "        return static_cast< " << enum_type << " >( row[ static_cast< unsigned char >( s[ 1 ] ) ] );\n"
+            << "    }\n"
+            << "\n";
+    }
+
+    std::cout
+        << "    return " << default_enum << ";\n"
+        << "}\n"
+        << "\n";
+
+    if ( arg_value_type.size() )
+    {
+        std::cout
+            << "constexpr const " << arg_func_name << "_value_type* " << arg_func_name << "_value( std::string_view s )\n"
+            << "{\n"
+            << "    const auto res = " << arg_func_name << "( s );\n"
+            << "    return res == " << default_enum << " ? nullptr : &internal_::values[ static_cast< int >( res ) ];\n"
+            << "}\n"
+            << "\n";
+    }
+
+    if ( arg_emit_scan )
+    {
+        OutputScan();
+    }
+
+    if ( arg_emit_matcher )
+    {
+        OutputMatcher( word_map, enum_names );
+    }
+
+    if ( arg_emit_find_all )
+    {
+        OutputFindAll( word_map );
+    }
+
+    if ( arg_emit_classify_all )
+    {
+        OutputClassifyAll();
+    }
+
+    // Lookup verifies nothing already, so it is the unchecked one too
+    if ( arg_emit_unchecked )
+    {
+        OutputUncheckedPrologue();
+        std::cout << "    const auto res = " << arg_func_name << "( s );\n";
+        OutputUncheckedEpilogue();
+    }
+
+    OutputEpilogue( word_map, enum_names );
+}
+
+// Fills word_map with keywords in given order, returns false if one is given
+// twice (in any case, if case-insensitive).
+static bool GivenOrderWordMap( const std::vector< std::string > &words, std::map< int, std::string > &word_map )
+{
+    std::unordered_set< std::string > representatives;
+    for ( const std::string &word : words )
+    {
+        if ( !representatives.insert( arg_search_options.ignore_case ? ToLowerAscii( word ) : word ).second )
+        {
+            std::cerr << "Duplicate Keyword found: " << word << "\n";
+            return false;
+        }
+
+        word_map[ word_map.size() ] = word;
+    }
+
+    return true;
+}
+
+// Writes the hash in the binary format read by MappedPerfectHash, instead of
+// code, with values of keywords as payload if any was given.
+static void OutputBinary( const PerfectHash &soln )
+{
+    PerfectHashTable table( soln, arg_search_options.ignore_case );
+
+    std::vector< std::string > payloads;
+    if ( keyword_values.size() )
+    {
+        for ( size_t i = 0; i < table.size(); ++i )
+        {
+            payloads.push_back( keyword_values[ std::string( table.key( i ) ) ] );
+        }
+    }
+
+    WritePerfectHash( std::cout, table.view(), payloads );
+}
+
+// Returns whether keywords are all of one or two bytes, for the direct backend
+static bool DirectApplies( const std::vector< std::string > &keywords )
+{
+    return std::all_of( keywords.begin(), keywords.end(), []( const std::string &keyword ) {
+        return keyword.size() >= 1 && keyword.size() <= 2;
+    } );
+}
+
+// Returns whether there are at most 32 keywords of at most 16 bytes, for the
+// simd backend
+static bool SimdApplies( const std::vector< std::string > &keywords )
+{
+    return keywords.size() <= 32 && std::all_of( keywords.begin(), keywords.end(), []( const std::string &keyword ) {
+        return keyword.size() <= 16;
+    } );
+}
+
+// Emits code of keywords with arg_backend, returns false (after reporting why)
+// if the backend does not apply to them.
+static bool OutputCode( const std::vector< std::string > &input_keywords, bool gperf_options )
+{
+    if ( arg_backend == "full-key" )
+    {
+        OutputFullKeyCpp17Code( GenerateFullKeyHash( input_keywords, arg_search_options.ignore_case ) );
+    }
+    else if ( arg_backend == "switch" )
+    {
+        OutputSwitchCpp17Code( GenerateSwitchTree( input_keywords, arg_search_options.ignore_case ) );
+    }
+    else if ( arg_backend == "simd" )
+    {
+        if ( !SimdApplies( input_keywords ) )
+        {
+            std::cerr << "Simd backend needs at most 32 keywords, of at most 16 bytes\n";
+            return false;
+        }
+
+        std::map< int, std::string > word_map;
+        if ( !GivenOrderWordMap( input_keywords, word_map ) )
+        {
+            return false;
+        }
+
+        OutputSimdCpp17Code( word_map );
+    }
+    // Keywords of one or two bytes index tables directly, auto prefers it
+    else if ( arg_backend == "direct" || ( arg_backend == "auto" && !gperf_options && DirectApplies( input_keywords ) ) )
+    {
+        if ( !DirectApplies( input_keywords ) )
+        {
+            std::cerr << "Direct backend needs keywords of one or two bytes\n";
+            return false;
+        }
+
+        std::map< int, std::string > word_map;
+        if ( !GivenOrderWordMap( input_keywords, word_map ) )
+        {
+            return false;
+        }
+
+        OutputDirectCpp17Code( word_map );
+    }
+    else if ( arg_backend == "integer" || ( arg_backend == "auto" && !gperf_options ) )
+    {
+        std::optional< IntegerHash > integer_hash = GenerateIntegerHash( input_keywords, arg_search_options.ignore_case );
+        if ( integer_hash )
+        {
+            OutputIntegerCpp17Code( *integer_hash );
+        }
+        else if ( arg_backend == "integer" )
+        {
+            std::cerr << "Integer backend needs keywords of the same length, of at most 8 bytes\n";
+            return false;
+        }
+        else
+        {
+            OutputCpp17Code( GeneratePerfectHash( input_keywords, arg_search_options ) );
+        }
+    }
+    else if ( arg_partition_by_length )
+    {
+        OutputPartitionedCpp17Code( GeneratePartitionedHash( input_keywords, arg_search_options, arg_partition_by_length ) );
+    }
+    else
+    {
+        OutputCpp17Code( GeneratePerfectHash( input_keywords, arg_search_options ) );
+    }
+
+    return true;
+}
+
+// Sends std::cout to a string while alive, to generate code of a backend
+// without writing it out.
+struct CaptureOutput
+{
+    CaptureOutput()
+        : m_previous( std::cout.rdbuf( m_buffer.rdbuf() ) )
+    {
+    }
+
+    ~CaptureOutput()
+    {
+        std::cout.rdbuf( m_previous );
+    }
+
+    std::string str() const
+    {
+        return m_buffer.str();
+    }
+
+    std::ostringstream m_buffer;
+    std::streambuf *m_previous;
+};
+
+// Returns lines to look up when benchmarking backends: the sample file if one
+// was given, otherwise each keyword and a miss next to it (last byte changed,
+// or a byte appended), shuffled.
+static std::vector< std::string > AutotuneWorkload( const std::vector< std::string > &keywords )
+{
+    std::vector< std::string > res;
+    if ( arg_autotune_sample.size() )
+    {
+        std::ifstream in( arg_autotune_sample );
+        for ( std::string line; std::getline( in, line ); )
+        {
+            res.push_back( line );
+        }
+        return res;
+    }
+
+    for ( const std::string &keyword : keywords )
+    {
+        res.push_back( keyword );
+        std::string miss = keyword;
+        if ( miss.size() && miss.back() != '~' )
+        {
+            miss.back() = '~';
+        }
+        else
+        {
+            miss.push_back( '~' );
+        }
+        res.push_back( miss );
+    }
+
+    std::mt19937 rng( 0 );
+    std::shuffle( res.begin(), res.end(), rng );
+    return res;
+}
+
+// Emits the benchmark of generated code in candidate.hpp. It prints
+// nanoseconds per lookup (the best of 7 runs of about 4M lookups each) and the
+// number of hits, which must be the same for every backend.
+static std::string AutotuneBenchmark()
+{
+    const std::string ns = arg_namespace.size() ? arg_namespace + "::" : "::";
+
+    std::ostringstream out;
+    out
+        << "#include <algorithm>\n"
+        << "#include <chrono>\n"
+        << "#include <cstdio>\n"
+        << "#include <fstream>\n"
+        << "#include <string>\n"
+        << "#include <vector>\n"
+        << "\n"
+        << "#include \"candidate.hpp\"\n"
+        << "\n"
+        << "int main( int argc, char *argv[] )\n"
+        << "{\n"
+        << "    if ( argc != 2 )\n"
+        << "    {\n"
+        << "        return 1;\n"
+        << "    }\n"
+        << "\n"
+        << "    std::vector< std::string > lines;\n"
+        << "    std::ifstream in( argv[ 1 ] );\n"
+        << "    for ( std::string line; std::getline( in, line ); )\n"
+        << "    {\n"
+        << "        lines.push_back( line );\n"
+        << "    }\n"
+        << "    if ( lines.empty() )\n"
+        << "    {\n"
+        << "        return 1;\n"
+        << "    }\n"
+        << "    const std::vector< std::string_view > inputs( lines.begin(), lines.end() );\n"
+        << "\n"
+        << "    const size_t rounds = std::max< size_t >( 1, ( 1 << 22 ) / inputs.size() );\n"
+        << "    double best = 1e300;\n"
+        << "    size_t hits = 0;\n"
+        << "    for ( int run = 0; run < 7; ++run )\n"
+        << "    {\n"
+        << "        hits = 0;\n"
+        << "        const auto start = std::chrono::steady_clock::now();\n"
+        << "        for ( size_t round = 0; round < rounds; ++round )\n"
+        << "        {\n"
+        << "            for ( std::string_view input : inputs )\n"
+        << "            {\n"
+        << "                hits += " << ns << arg_func_name << "( input ) != " << ns << "internal_::" << arg_func_name << "_enum::default_;\n"
+        << "            }\n"
+        << "        }\n"
+        << "        const std::chrono::duration< double, std::nano > elapsed = std::chrono::steady_clock::now() - start;\n"
+        << "        best = std::min( best, elapsed.count() / ( rounds * inputs.size() ) );\n"
+        << "    }\n"
+        << "\n"
+        << "    std::printf( \"%.3f %zu\\n\", best, hits / rounds );\n"
+        << "    return 0;\n"
+        << "}\n";
+    return out.str();
+}
+
+// Generates code of keywords with each backend which applies, benchmarks them
+// in a temporary directory with arg_autotune_compiler and emits the fastest,
+// with measurements in a comment. Returns false if none could be measured.
+static bool Autotune( const std::vector< std::string > &input_keywords, bool gperf_options )
+{
+    namespace fs = std::filesystem;
+
+    std::vector< std::string > candidates = { "gperf" };
+    if ( !gperf_options )
+    {
+        candidates.push_back( "switch" );
+        candidates.push_back( "full-key" );
+        if ( DirectApplies( input_keywords ) )
+        {
+            candidates.push_back( "direct" );
+        }
+        if ( GenerateIntegerHash( input_keywords, arg_search_options.ignore_case ) )
+        {
+            candidates.push_back( "integer" );
+        }
+        if ( SimdApplies( input_keywords ) && !arg_emit_unchecked )
+        {
+            candidates.push_back( "simd" );
+        }
+    }
+
+    std::string dir_template = ( fs::temp_directory_path() / "switch_gen.XXXXXX" ).string();
+    if ( !mkdtemp( dir_template.data() ) )
+    {
+        std::cerr << "Can not create a temporary directory for --autotune\n";
+        return false;
+    }
+    const fs::path dir = dir_template;
+
+    std::string workload_name = arg_autotune_sample.size() ? arg_autotune_sample : "keywords and as many misses";
+    {
+        std::ofstream workload( dir / "workload.txt" );
+        for ( const std::string &line : AutotuneWorkload( input_keywords ) )
+        {
+            workload << line << "\n";
+        }
+
+        std::ofstream( dir / "benchmark.cpp" ) << AutotuneBenchmark();
+    }
+
+    struct Measurement
+    {
+        std::string backend;
+        std::string code;
+        double ns;
+        size_t hits;
+    };
+    std::vector< Measurement > measurements;
+
+    for ( const std::string &backend : candidates )
+    {
+        Measurement m = { backend, {}, 0, 0 };
+
+        arg_backend = backend;
+        {
+            CaptureOutput capture;
+            if ( !OutputCode( input_keywords, gperf_options ) )
+            {
+                continue;
+            }
+            m.code = capture.str();
+        }
+
+        std::ofstream( dir / "candidate.hpp" ) << m.code;
+
+        const std::string binary = ( dir / "benchmark" ).string();
+        const std::string compile = arg_autotune_compiler + " -o '" + binary + "' -I '" + dir.string() + "' '" + ( dir / "benchmark.cpp" ).string() + "'";
+        if ( std::system( compile.c_str() ) != 0 )
+        {
+            std::cerr << "Autotune: " << backend << " backend failed to compile with: " << compile << "\n";
+            continue;
+        }
+
+        const std::string run = "'" + binary + "' '" + ( dir / "workload.txt" ).string() + "'";
+        FILE *pipe = popen( run.c_str(), "r" );
+        if ( !pipe || fscanf( pipe, "%lf %zu", &m.ns, &m.hits ) != 2 || pclose( pipe ) != 0 )
+        {
+            std::cerr << "Autotune: " << backend << " backend failed to run\n";
+            continue;
+        }
+
+        std::cerr << "Autotune: " << backend << " backend takes " << m.ns << " ns per lookup\n";
+        measurements.push_back( std::move( m ) );
+    }
+
+    fs::remove_all( dir );
+    arg_backend = "auto";
+
+    if ( measurements.empty() )
+    {
+        std::cerr << "Autotune: no backend could be measured\n";
+        return false;
+    }
+
+    for ( const Measurement &m : measurements )
+    {
+        if ( m.hits != measurements[ 0 ].hits )
+        {
+            std::cerr << "Autotune: " << m.backend << " and " << measurements[ 0 ].backend << " backends disagree on hits of the workload\n";
+            return false;
+        }
+    }
+
+    const Measurement &best = *std::min_element( measurements.begin(), measurements.end(), []( const Measurement &a, const Measurement &b ) {
+        return a.ns < b.ns;
+    } );
+
+    std::cout
+        << "// Backend picked by --autotune, nanoseconds per lookup of " << workload_name << "\n"
+        << "// (" << measurements[ 0 ].hits << " hits), best of 7 runs, compiled with: " << arg_autotune_compiler << "\n";
+    for ( const Measurement &m : measurements )
+    {
+        std::cout << "//   " << std::setw( 8 ) << std::left << m.backend << std::setw( 8 ) << std::right << std::fixed << std::setprecision( 3 ) << m.ns << ( &m == &best ? " (picked)" : "" ) << "\n";
+    }
+    std::cout << std::defaultfloat << "\n" << best.code;
+
+    return true;
+}
+
+int main( int argc, char* argv[] )
+{
+    using namespace std::literals;
+
+    for ( int i = 1; i < argc; )
+    {
+        if ( argv[ i ] == "--help"sv )
+        {
+            std::cout << "Read the doc at http://example.com\n";
+            return 0;
+        }
+
+        if ( argv[ i ] == "--namespace"sv )
+        {
+            // TODO check if namespace is valid
+            arg_namespace = argv[ i + 1 ];
+            i += 2;
+            continue;
+        }
+
+        if ( argv[ i ] == "--minimal"sv )
+        {
+            arg_minimal = true;
+            i += 1;
+            continue;
+        }
+
+        if ( argv[ i ] == "--emit-padded"sv )
+        {
+            arg_emit_padded = true;
+            i += 1;
+            continue;
+        }
+
+        if ( argv[ i ] == "--emit-unchecked"sv )
+        {
+            arg_emit_unchecked = true;
+            i += 1;
+            continue;
+        }
+
+        if ( argv[ i ] == "--ignore-case"sv )
+        {
+            arg_search_options.ignore_case = true;
+            i += 1;
+            continue;
+        }
+
+        if ( argv[ i ] == "--wide-windows"sv )
+        {
+            arg_search_options.family = HashFamily::WideWindows;
+            i += 1;
+            continue;
+        }
+
+        if ( argv[ i ] == "--partition-by-length"sv )
+        {
+            arg_partition_by_length = std::stoul( argv[ i + 1 ] );
+            i += 2;
+            continue;
+        }
+
+        if ( argv[ i ] == "--backend"sv )
+        {
+            arg_backend = argv[ i + 1 ];
+            i += 2;
+            continue;
+        }
+
+        if ( argv[ i ] == "--autotune"sv )
+        {
+            arg_autotune = true;
+            i += 1;
+            continue;
+        }
+
+        if ( argv[ i ] == "--autotune-compiler"sv )
+        {
+            arg_autotune_compiler = argv[ i + 1 ];
+            i += 2;
+            continue;
+        }
+
+        if ( argv[ i ] == "--autotune-sample"sv )
+        {
+            arg_autotune_sample = argv[ i + 1 ];
+            i += 2;
+            continue;
+        }
+
+        if ( argv[ i ] == "--value-type"sv )
+        {
+            arg_value_type = argv[ i + 1 ];
+            i += 2;
+            continue;
+        }
+
+        if ( argv[ i ] == "--emit-batch"sv )
+        {
+            arg_emit_batch = true;
+            i += 1;
+            continue;
+        }
+
+        if ( argv[ i ] == "--emit-scan"sv )
+        {
+            arg_emit_scan = true;
+            i += 1;
+            continue;
+        }
+
+        if ( argv[ i ] == "--emit-matcher"sv )
+        {
+            arg_emit_matcher = true;
+            i += 1;
+            continue;
+        }
+
+        if ( argv[ i ] == "--emit-find-all"sv )
+        {
+            arg_emit_find_all = true;
+            i += 1;
+            continue;
+        }
+
+        if ( argv[ i ] == "--emit-classify-all"sv )
+        {
+            arg_emit_classify_all = true;
+            i += 1;
+            continue;
+        }
+
+        if ( argv[ i ] == "--emit-binary"sv )
+        {
+            arg_emit_binary = true;
+            i += 1;
+            continue;
+        }
+
+        if ( argv[ i ] == "--emit-pipelined"sv )
+        {
+            arg_emit_pipelined = true;
+            i += 1;
+            continue;
+        }
+
+        if ( argv[ i ] == "--dispatch"sv )
+        {
+            arg_dispatch = true;
+            i += 1;
+            continue;
+        }
+
+        if ( argv[ i ] == "--dispatch-params"sv )
+        {
+            arg_dispatch_params = argv[ i + 1 ];
+            i += 2;
+            continue;
+        }
+
+        if ( argv[ i ] == "--dispatch-return-type"sv )
+        {
+            arg_dispatch_return_type = argv[ i + 1 ];
+            i += 2;
+            continue;
+        }
+
+        if ( argv[ i ] == "--dispatch-default"sv )
+        {
+            arg_dispatch_default = argv[ i + 1 ];
+            i += 2;
+            continue;
+        }
+
+        if ( argv[ i ] == "--func-name"sv )
+        {
+            arg_func_name = argv[ i + 1 ];
+            i += 2;
+            continue;
+        }
+
+        std::cerr << "Unknown argument: " << argv[ i ] << "\n";
+        return 1;
+    }
+
+    if ( arg_func_name.size() == 0 && !arg_emit_binary )
+    {
+        std::cerr << "Need to specify --func-name\n";
+        return 1;
+    }
+
+    if ( arg_dispatch && arg_value_type.size() )
+    {
+        std::cerr << "--dispatch can not be combined with --value-type\n";
+        return 1;
+    }
+
+    if ( arg_emit_binary && ( arg_value_type.size() || arg_dispatch || ( arg_backend != "auto" && arg_backend != "gperf" ) ) )
+    {
+        std::cerr << "--emit-binary can not be combined with --value-type, --dispatch or a backend other than gperf\n";
+        return 1;
+    }
+
+    std::vector< std::string > input_keywords;
+    {
+        std::string line;
+        while ( std::getline( std::cin, line ) )
+        {
+            if ( arg_emit_binary && line.find( '\t' ) != std::string::npos )
+            {
+                size_t tab = line.find( '\t' );
+                keyword_values[ line.substr( 0, tab ) ] = line.substr( tab + 1 );
+                line.resize( tab );
+            }
+            else if ( arg_value_type.size() || arg_dispatch )
+            {
+                size_t tab = line.find( '\t' );
+                if ( tab == std::string::npos )
+                {
+                    std::cerr << "Missing value for keyword: " << line << "\n";
+                    return 1;
+                }
+
+                keyword_values[ line.substr( 0, tab ) ] = line.substr( tab + 1 );
+                line.resize( tab );
+            }
+
+            input_keywords.emplace_back( std::move( line ) );
+        }
+    }
+
+    const std::set< std::string > backends = { "auto", "gperf", "integer", "switch", "simd", "direct", "full-key" };
+    if ( backends.count( arg_backend ) == 0 )
+    {
+        std::cerr << "Unknown backend: " << arg_backend << "\n";
+        return 1;
+    }
+
+    if ( arg_search_options.ignore_case && arg_search_options.family != HashFamily::BytePositions )
+    {
+        std::cerr << "--ignore-case can not be combined with --wide-windows\n";
+        return 1;
+    }
+
+    if ( arg_emit_batch && arg_search_options.family != HashFamily::BytePositions )
+    {
+        std::cerr << "--emit-batch can not be combined with --wide-windows\n";
+        return 1;
+    }
+
+    // Options below only apply to the gperf backend
+    bool gperf_options = arg_minimal || arg_emit_padded || arg_emit_batch || arg_emit_pipelined || arg_dispatch || arg_partition_by_length || arg_search_options.family != HashFamily::BytePositions;
+
+    if ( arg_backend != "auto" && arg_backend != "gperf" && gperf_options )
+    {
+        std::cerr << "--minimal, --emit-padded, --emit-batch, --emit-pipelined, --dispatch, --partition-by-length and --wide-windows need the gperf backend\n";
+        return 1;
+    }
+
+    if ( arg_partition_by_length && ( arg_minimal || arg_emit_padded || arg_emit_batch || arg_emit_pipelined || arg_dispatch || arg_emit_unchecked || arg_emit_binary ) )
+    {
+        std::cerr << "--partition-by-length can not be combined with --minimal, --emit-padded, --emit-batch, --emit-pipelined, --dispatch, --emit-unchecked or --emit-binary\n";
+        return 1;
+    }
+
+    if ( arg_backend == "simd" && arg_emit_unchecked )
+    {
+        std::cerr << "--emit-unchecked can not be combined with the simd backend, its lookup has nothing to skip\n";
+        return 1;
+    }
+
+    if ( arg_autotune && ( arg_emit_binary || arg_backend != "auto" ) )
+    {
+        std::cerr << "--autotune picks the backend, it can not be combined with --backend or --emit-binary\n";
+        return 1;
+    }
+
+    if ( arg_emit_binary )
+    {
+        OutputBinary( GeneratePerfectHash( input_keywords, arg_search_options ) );
+    }
+    else if ( arg_autotune )
+    {
+        if ( !Autotune( input_keywords, gperf_options ) )
+        {
+            return 1;
+        }
+    }
+    else if ( !OutputCode( input_keywords, gperf_options ) )
+    {
+        return 1;
+    }
 
     std::cout.flush();
     if ( ! std::cout )
@@ -24,11 +24,15 @@
 
 #include <algorithm>
 #include <climits>
+#include <cstddef>
+#include <cstdint>
 #include <cmath>
 #include <cstdlib>
 #include <cstring>
+#include <future>
 #include <iostream>
 #include <list>
+#include <ostream>
 #include <set>
 #include <stdio.h>
 #include <string>
@@ -37,6 +41,12 @@
 #include <utility>
 #include <vector>
 
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 struct Keywords
 {
 public:
@@ -75,50 +85,6 @@ private:
     std::vector< std::string > m_keywords;
 };
 
-struct Search
-{
-    Search( Keywords &&keywords )
-        : m_keywords( std::move( keywords ) )
-    {
-    }
-
-    PerfectHash get_solution()
-    {
-        PerfectHash res;
-        res.word_map = word_map;
-        res.key_positions = _key_positions;
-        res.alpha_inc = _alpha_inc;
-        res.asso_values = _asso_values;
-        return res;
-    }
-
-  void                  optimize ();
-private:
-
-  /* Finds good _asso_values[].  */
-  void                  find_good_asso_values ();
-
-public:
-
-    Keywords m_keywords; // TODO??
-
-private:
-
-  std::map< int, std::string > word_map; // Output param
-
-
-  /* User-specified or computed key positions.  */
-  std::set< int >             _key_positions;
-
-  /* Adjustments to add to bytes add specific key positions.  */
-  std::vector< int >        _alpha_inc;
-
-  /* Value associated with each character. */
-  std::vector< int >    _asso_values;
-};
-
-
-
 struct Chars
 {
     Chars() = default;
@@ -128,7 +94,7 @@ struct Chars
     {
     }
 
-    size_t count( int ch )
+    size_t count( int ch ) const
     {
         return std::count( m_data.begin(), m_data.end(), ch );
     }
@@ -163,6 +129,63 @@ template<> struct hash< Chars >
 
 } // namespace std
 
+struct Search
+{
+    Search( Keywords &&keywords, const SearchOptions &options )
+        : m_keywords( std::move( keywords ) )
+        , m_options( options )
+    {
+    }
+
+    PerfectHash get_solution()
+    {
+        PerfectHash res;
+        res.word_map = word_map;
+        res.key_positions = _key_positions;
+        res.alpha_inc = _alpha_inc;
+        res.key_windows = _key_windows;
+        res.asso_values = _asso_values;
+        return res;
+    }
+
+  void                  optimize ();
+private:
+
+  /* Finds good _asso_values[].  */
+  void                  find_good_asso_values ();
+
+  /* Fills word_map from the found _asso_values[].  */
+  void                  install_word_map ( const std::vector< int > &occurrences );
+
+public:
+
+    Keywords m_keywords; // TODO??
+
+private:
+
+  SearchOptions m_options;
+
+  std::map< int, std::string > word_map; // Output param
+
+
+  /* User-specified or computed key positions.  */
+  std::set< int >             _key_positions;
+
+  /* Adjustments to add to bytes add specific key positions.  */
+  std::vector< int >        _alpha_inc;
+
+  /* Computed key windows, for HashFamily::WideWindows.  */
+  std::vector< KeyWindow >  _key_windows;
+
+  /* Value associated with each character. */
+  std::vector< int >    _asso_values;
+
+  /* Characters selected from each keyword, in the same order as m_keywords,
+     and the maximum number of characters selected from a keyword.  */
+  std::vector< Chars >  _selected;
+  unsigned int          _selected_count;
+};
+
 static inline
 size_t next_power_of_2( size_t a )
 {
@@ -172,6 +195,17 @@ size_t next_power_of_2( size_t a )
     return res;
 }
 
+/* splitmix64: advances state and returns its next value.  Searches draw
+   multipliers, values and seeds from it, starting from a state of zero, so
+   that they are reproducible between runs.  */
+static uint64_t splitmix64( uint64_t &state )
+{
+    uint64_t z = ( state += 0x9E3779B97F4A7C15ull );
+    z = ( z ^ ( z >> 30 ) ) * 0xBF58476D1CE4E5B9ull;
+    z = ( z ^ ( z >> 27 ) ) * 0x94D049BB133111EBull;
+    return z ^ ( z >> 31 );
+}
+
 /* Initializes selchars and selchars_length.
 
    General idea:
@@ -200,7 +234,8 @@ size_t next_power_of_2( size_t a )
 static
 Chars selchars( const std::string &allchars,
                 const std::set< int >& positions,
-                const std::vector< int > &alpha_inc )
+                const std::vector< int > &alpha_inc,
+                const std::vector< int > &unified = {} )
 {
   std::vector< int > key_set;
 
@@ -223,6 +258,9 @@ Chars selchars( const std::string &allchars,
             c += alpha_inc[i];
         }
 
+      if ( unified.size() )
+        c = unified[ c ];
+
       key_set.push_back( c );
     }
 
@@ -477,8 +515,302 @@ std::set< int > find_positions ( const Keywords &keywords )
   return current;
 }
 
+/* Find key positions without minimizing them, for the quick search.  Each
+   position is picked greedily as the one which distinguishes the most
+   keywords, until all tuples (keyword[i] : i in Pos) are different.  Tuples
+   are compared by their 64 bit fingerprints, extended one position at a
+   time, which keeps each round linear in the number of keywords.  Positions
+   are returned in the order they are picked.  */
+static
+std::vector< int > find_positions_quick ( const Keywords &keywords )
+{
+  auto extend = []( uint64_t fingerprint, const std::string &kw, int i ) -> uint64_t
+  {
+    uint64_t c;
+    if ( i == -1 )
+      c = static_cast<unsigned char>( kw.back() );
+    else if ( i < (int)kw.size() )
+      c = static_cast<unsigned char>( kw[ i ] );
+    else
+      c = 256;
+
+    uint64_t z = ( fingerprint ^ ( c + 1 ) ) * 0x9E3779B97F4A7C15ull;
+    return z ^ ( z >> 29 );
+  };
+
+  /* Open addressing set of fingerprints, slots of previous counts are told
+     apart by their stamps, so that it needs no clearing.  */
+  size_t mask = next_power_of_2( 2 * keywords.size() ) - 1;
+  std::vector< uint64_t > slots( mask + 1 );
+  std::vector< unsigned int > stamps( mask + 1, 0 );
+  unsigned int stamp = 0;
+  auto count_distinct = [ & ]( const std::vector< uint64_t > &fingerprints ) -> size_t
+  {
+    stamp++;
+    size_t distinct = 0;
+    for ( uint64_t fingerprint : fingerprints )
+      for ( size_t slot = fingerprint >> 32; ; slot++ )
+        {
+          slot &= mask;
+          if ( stamps[ slot ] != stamp )
+            {
+              stamps[ slot ] = stamp;
+              slots[ slot ] = fingerprint;
+              distinct++;
+              break;
+            }
+          if ( slots[ slot ] == fingerprint )
+            break;
+        }
+    return distinct;
+  };
+
+  std::vector< uint64_t > current;
+  for ( const std::string &kw : keywords )
+    current.push_back( kw.size() * 0x9E3779B97F4A7C15ull );
+
+  std::vector< uint64_t > tryal( current.size() );
+
+  int imax = std::min( keywords.max_size() - 1, size_t( 254 ) );
+  std::vector< int > positions;
+  size_t current_distinct = count_distinct( current );
+  while ( current_distinct < keywords.size() )
+    {
+      int best = -2;
+      size_t best_distinct = 0;
+
+      for ( int i = 0; i <= imax + 1; i++ )
+        {
+          /* Try the last byte after all others, as it is the more
+             expensive one to load.  */
+          int pos = ( i <= imax ? i : -1 );
+          if ( std::count( positions.begin(), positions.end(), pos ) )
+            continue;
+
+          for ( size_t k = 0; k < keywords.size(); ++k )
+            tryal[ k ] = extend( current[ k ], keywords[ k ], pos );
+
+          size_t try_distinct = count_distinct( tryal );
+          if ( try_distinct > best_distinct )
+            {
+              best = pos;
+              best_distinct = try_distinct;
+            }
+        }
+
+      if ( best == -2 )
+        break;
+
+      positions.push_back( best );
+      for ( size_t k = 0; k < keywords.size(); ++k )
+        current[ k ] = extend( current[ k ], keywords[ k ], best );
+      current_distinct = best_distinct;
+    }
+
+  return positions;
+}
+
+/* Alpha increments for the quick search: each position gets its own range
+   of 256 asso_values, so that multisets are as distinct as the tuples and no
+   search for increments is needed.  */
+static
+std::vector< int > separate_positions( const Keywords &keywords,
+                                       const std::set< int > &key_positions )
+{
+  std::vector< int > alpha_inc( keywords.max_size(), 0 );
+
+  /* The last byte is never incremented, it keeps the first range.  */
+  int range = key_positions.count( -1 ) ? 1 : 0;
+  for ( int i : key_positions )
+    if ( i >= 0 )
+      alpha_inc[ i ] = 256 * range++;
+
+  return alpha_inc;
+}
+
+/* ======================= Finding good key windows ======================= */
+
+/* For HashFamily::WideWindows the general form of the hash function is
+
+      hash (keyword) = sum (asso_values[256 * j + fold_j (keyword)] : j in Win)
+                       + len (keyword)
+
+   where Win is a list of windows, each being 1, 2, 4 or 8 consecutive bytes
+   at a fixed offset from the start or the end of keyword, and fold_j maps
+   bytes of window j into [0, 256) with a multiply-shift.
+
+   Each window gets its own 256 entries of asso_values, so the multisets
+   {256 * j + fold_j (keyword) : j in Win} are different as soon as the
+   tuples (fold_j (keyword) : j in Win) are, there is no need for an
+   equivalent of alpha_inc.  Finding asso_values is then exactly Step 3
+   of the byte position search.  */
+
+bool WindowApplies( const KeyWindow &window, size_t size )
+{
+    if ( window.offset < 0 )
+        return (size_t)-window.offset <= size;
+    return (size_t)( window.offset + window.width ) <= size;
+}
+
+static
+uint64_t load_le( std::string_view bytes )
+{
+    uint64_t res = 0;
+    for ( size_t i = 0; i < bytes.size(); ++i )
+        res |= uint64_t( static_cast< unsigned char >( bytes[ i ] ) ) << ( i * 8 );
+    return res;
+}
+
+int FoldWindow( const KeyWindow &window, std::string_view word )
+{
+    size_t start = window.offset < 0 ? word.size() + window.offset : window.offset;
+
+    uint64_t bytes = load_le( word.substr( start, window.width ) );
+
+    if ( window.width == 1 )
+        return bytes;
+    return ( bytes * window.multiplier ) >> 56;
+}
+
+static
+Chars selwindows( const std::string &allchars,
+                  const std::vector< KeyWindow > &windows )
+{
+  std::vector< int > key_set;
+
+  for ( size_t j = 0; j < windows.size(); ++j )
+    if ( WindowApplies( windows[ j ], allchars.size() ) )
+      key_set.push_back( 256 * j + FoldWindow( windows[ j ], allchars ) );
+
+  return Chars( allchars.size(), std::move( key_set ) );
+}
+
+static
+size_t count_duplicates_windows( const Keywords &keywords,
+                                 const std::vector< KeyWindow > &windows )
+{
+  std::unordered_set< Chars > representatives;
+
+  for ( const std::string &kw : keywords )
+  {
+     representatives.emplace( selwindows( kw, windows ) );
+  }
+
+  return keywords.size() - representatives.size();
+}
+
+/* Find good key windows.  Wider windows are preferred as they distinguish
+   more keywords with a single lookup.  Single byte windows are always
+   candidates, so that any two keywords can be told apart.  */
+static
+std::vector< KeyWindow > find_windows( const Keywords &keywords )
+{
+  uint64_t state = 0;
+
+  int max_size = keywords.max_size();
+
+  std::vector< KeyWindow > candidates;
+  for ( int width : { 8, 4, 2, 1 } )
+    {
+      if ( width > max_size )
+        continue;
+      candidates.push_back( KeyWindow{ -width, width, width == 1 ? 0 : splitmix64( state ) | 1 } );
+      for ( int offset = 0; offset + width <= max_size; ++offset )
+        candidates.push_back( KeyWindow{ offset, width, width == 1 ? 0 : splitmix64( state ) | 1 } );
+    }
+
+  /* 1. Add windows, as long as this decreases the duplicates count.  This
+     always ends with no duplicates, as single byte windows lose nothing by
+     folding.  */
+  std::vector< KeyWindow > current;
+  std::vector< bool > used( candidates.size(), false );
+  size_t current_duplicates_count = count_duplicates_windows( keywords, current );
+  while ( current_duplicates_count > 0 )
+    {
+      size_t best = 0;
+      size_t best_duplicates_count = SIZE_MAX;
+
+      for ( size_t i = 0; i < candidates.size(); ++i )
+        if ( !used[ i ] )
+          {
+            std::vector< KeyWindow > tryal = current;
+            tryal.push_back( candidates[ i ] );
+            size_t try_duplicates_count = count_duplicates_windows( keywords, tryal );
+
+            if ( try_duplicates_count < best_duplicates_count )
+              {
+                best = i;
+                best_duplicates_count = try_duplicates_count;
+              }
+          }
+
+      /* Stop adding windows when it gives no improvement.  */
+      if ( best_duplicates_count >= current_duplicates_count )
+        break;
+
+      used[ best ] = true;
+      current.push_back( candidates[ best ] );
+      current_duplicates_count = best_duplicates_count;
+    }
+
+  /* 2. Remove windows, as long as this doesn't increase the duplicates
+     count.  Earlier windows are kept in favor of later ones.  */
+  for ( size_t i = current.size(); i-- > 0; )
+    {
+      std::vector< KeyWindow > tryal = current;
+      tryal.erase( tryal.begin() + i );
+      if ( count_duplicates_windows( keywords, tryal ) <= current_duplicates_count )
+        current = tryal;
+    }
+
+  return current;
+}
+
 /* ===================== Finding good alpha increments ===================== */
 
+/* For a case-insensitive hash function, the lower and upper case variants of
+   a letter at a key position must share their asso_values[].  As positions
+   have different alpha_inc[], a character can be the variant of different
+   letters at different positions, so these form equivalence classes.
+   Returns the representative of each character's class, the search then
+   works on representatives only.  Keywords are expected in lower case.  */
+static
+std::vector< int > unify_case( const std::set< int > &key_positions,
+                               const std::vector< int > &alpha_inc )
+{
+  int max_inc = alpha_inc.size() ? *std::max_element( alpha_inc.begin(), alpha_inc.end() ) : 0;
+  std::vector< int > unified( 256 + max_inc );
+  for ( size_t c = 0; c < unified.size(); ++c )
+    unified[ c ] = c;
+
+  auto find = [ &unified ]( int c ) -> int
+  {
+    while ( unified[ c ] != c )
+      c = unified[ c ] = unified[ unified[ c ] ];
+    return c;
+  };
+
+  for ( int i : key_positions )
+    {
+      int inc = ( i == -1 || alpha_inc.empty() ) ? 0 : alpha_inc[ i ];
+      for ( int c = 'a'; c <= 'z'; ++c )
+        {
+          int c1 = find( c + inc );
+          int c2 = find( c - 'a' + 'A' + inc );
+          /* Keep the smaller one as representative.  */
+          if ( c1 < c2 )
+            unified[ c2 ] = c1;
+          else
+            unified[ c1 ] = c2;
+        }
+    }
+
+  for ( size_t c = 0; c < unified.size(); ++c )
+    unified[ c ] = find( c );
+
+  return unified;
+}
+
 /* Count the duplicate keywords that occur with the given set of positions
    and a given alpha_inc[] array.
    In other words, it returns the difference
@@ -487,8 +819,13 @@ std::set< int > find_positions ( const Keywords &keywords )
 static
 size_t count_duplicates_multiset( const Keywords &keywords,
                                   const std::set< int > &key_positions,
-                                  const std::vector< int > &alpha_inc )
+                                  const std::vector< int > &alpha_inc,
+                                  bool ignore_case )
 {
+  std::vector< int > unified;
+  if ( ignore_case )
+    unified = unify_case( key_positions, alpha_inc );
+
   /* Run through the keyword list and count the duplicates incrementally.
      The result does not depend on the order of the keyword list, thanks to
      the formula above.  */
@@ -497,7 +834,7 @@ size_t count_duplicates_multiset( const Keywords &keywords,
 
   for ( const std::string &kw : keywords )
   {
-     representatives.emplace( selchars( kw, key_positions, alpha_inc ) );
+     representatives.emplace( selchars( kw, key_positions, alpha_inc, unified ) );
   }
 
   return keywords.size() - representatives.size();
@@ -505,7 +842,8 @@ size_t count_duplicates_multiset( const Keywords &keywords,
 
 static
 std::vector< int > find_alpha_inc( const Keywords &keywords,
-                                   const std::set< int > &key_positions )
+                                   const std::set< int > &key_positions,
+                                   bool ignore_case )
 {
   /* The goal is to choose _alpha_inc[] such that it doesn't introduce
      artificial duplicates.
@@ -515,7 +853,7 @@ std::vector< int > find_alpha_inc( const Keywords &keywords,
   /* Start with zero increments.  This is sufficient in most cases.  */
   std::vector< int > current( keywords.max_size(), 0 );
 
-  size_t current_duplicates_count = count_duplicates_multiset ( keywords, key_positions, current);
+  size_t current_duplicates_count = count_duplicates_multiset ( keywords, key_positions, current, ignore_case);
 
   if (current_duplicates_count > duplicates_goal)
     {
@@ -543,7 +881,7 @@ std::vector< int > find_alpha_inc( const Keywords &keywords,
                   std::vector< int > tryal( current );
                   tryal[ idx ] += inc;
 
-                  size_t try_duplicates_count = count_duplicates_multiset( keywords, key_positions, tryal );
+                  size_t try_duplicates_count = count_duplicates_multiset( keywords, key_positions, tryal, ignore_case );
 
                   /* We prefer 'try' to 'best' if it produces less
                      duplicates.  */
@@ -601,8 +939,8 @@ struct EquivalenceClass
   EquivalenceClass( EquivalenceClass&& ) = default;
   EquivalenceClass& operator=( EquivalenceClass&& ) = default;
 
-  // Map from undetermined chars to keyword set
-  std::unordered_map< Chars, std::vector< std::string > > m_map;
+  // Map from undetermined chars to selected chars of keywords
+  std::unordered_map< Chars, std::vector< const Chars* > > m_map;
 };
 
 struct Step
@@ -622,21 +960,20 @@ struct Step
 };
 
 static
-EquivalenceClass compute_partition ( const Keywords &keywords, std::vector< bool > &undetermined,
-                                     const std::set< int > &positions, const std::vector< int > &alpha_inc )
+EquivalenceClass compute_partition ( const std::vector< Chars > &selected, std::vector< bool > &undetermined )
 {
   EquivalenceClass partition;
 
-  for ( const std::string &keyword : keywords )
+  for ( const Chars &keyword : selected )
     {
       /* Compute the undetermined characters for this keyword.  */
       std::vector< int > undetermined_chars;
 
-      for ( int ch : selchars( keyword, positions, alpha_inc ) )
+      for ( int ch : keyword )
         if ( undetermined[ ch ] )
           undetermined_chars.push_back( ch );
 
-      partition.m_map[ Chars( 0, std::move( undetermined_chars ) ) ].push_back( keyword );
+      partition.m_map[ Chars( 0, std::move( undetermined_chars ) ) ].push_back( &keyword );
     }
 
   return partition;
@@ -645,8 +982,7 @@ EquivalenceClass compute_partition ( const Keywords &keywords, std::vector< bool
 /* Compute the possible number of collisions when _asso_values[c] is
    chosen, leading to the given partition.  */
 static
-size_t count_possible_collisions( const std::set< int > &key_positions,
-                                  const std::vector< int > &alpha_inc,
+size_t count_possible_collisions( unsigned int m,
                                   const EquivalenceClass &partition,
                                   unsigned int c )
 {
@@ -655,14 +991,13 @@ size_t count_possible_collisions( const std::set< int > &key_positions,
      This leads to   (|p|^2 - |p1|^2 - |p2|^2 - ...)/2  possible collisions.
      Return the sum of this expression over all equivalence classes.  */
   unsigned int sum = 0;
-  unsigned int m = key_positions.size();
 
   for ( const auto &it : partition.m_map )
     {
       std::vector< unsigned int > split_cardinalities( m + 1, 0 );
 
-      for ( const std::string &keyword : it.second )
-        split_cardinalities[ selchars( keyword, key_positions, alpha_inc ).count( c ) ]++;
+      for ( const Chars *keyword : it.second )
+        split_cardinalities[ keyword->count( c ) ]++;
 
       sum += it.second.size() * it.second.size();
       for (unsigned int i = 0; i <= m; i++)
@@ -675,18 +1010,16 @@ size_t count_possible_collisions( const std::set< int > &key_positions,
 /* Test whether adding c to the undetermined characters changes the given
    partition.  */
 static
-bool unchanged_partition( const std::set< int > &key_positions,
-                          const std::vector< int > &alpha_inc,
-                          const EquivalenceClass &partition,
+bool unchanged_partition( const EquivalenceClass &partition,
                           unsigned int c )
 {
   for ( const auto &it : partition.m_map )
     {
       unsigned int first_count = UINT_MAX;
 
-      for ( const std::string &keyword : it.second )
+      for ( const Chars *keyword : it.second )
         {
-          unsigned int count = selchars( keyword, key_positions, alpha_inc ).count( c );
+          unsigned int count = keyword->count( c );
 
           if (first_count == UINT_MAX )
             first_count = count;
@@ -700,10 +1033,10 @@ bool unchanged_partition( const std::set< int > &key_positions,
 
 static
 std::tuple< std::vector< int >, unsigned int, int >
-find_asso_values( const Keywords &keywords,
+find_asso_values( const std::vector< Chars > &selected,
                   size_t alpha_size,
-                  const std::set< int > &key_positions,
-                  const std::vector< int > &alpha_inc,
+                  unsigned int key_position_count,
+                  size_t max_keyword_size,
                   int jump,
                   const std::vector< int > &occurrences,
                   unsigned int asso_value_max,
@@ -723,7 +1056,7 @@ find_asso_values( const Keywords &keywords,
     for (;;)
       {
         /* Compute the partition that needs to be refined.  */
-        EquivalenceClass partition = compute_partition ( keywords, undetermined, key_positions, alpha_inc );
+        EquivalenceClass partition = compute_partition ( selected, undetermined );
 
         /* Determine the main character to be chosen in this step.
            Choosing such a character c has the effect of splitting every
@@ -739,7 +1072,7 @@ find_asso_values( const Keywords &keywords,
           for (unsigned int c = 0; c < alpha_size; c++)
             if (occurrences[c] > 0 && determined[c])
               {
-                unsigned int possible_collisions = count_possible_collisions ( key_positions, alpha_inc, partition, c );
+                unsigned int possible_collisions = count_possible_collisions ( key_position_count, partition, c );
                 if (possible_collisions < best_possible_collisions)
                   {
                     best_c = c;
@@ -764,7 +1097,7 @@ find_asso_values( const Keywords &keywords,
         /* Now determine how the equivalence classes will be before this
            step.  */
         undetermined[chosen_c] = true;
-        partition = compute_partition ( keywords, undetermined, key_positions, alpha_inc );
+        partition = compute_partition ( selected, undetermined );
 
         /* Now determine which other characters should be determined in this
            step, because they will not change the equivalence classes at
@@ -773,7 +1106,7 @@ find_asso_values( const Keywords &keywords,
            of the equivalence class.  */
         for (unsigned int c = 0; c < alpha_size; c++)
           if (occurrences[c] > 0 && determined[c]
-              && unchanged_partition ( key_positions, alpha_inc, partition, c))
+              && unchanged_partition ( partition, c))
             {
               undetermined[c] = true;
               determined[c] = false;
@@ -804,6 +1137,11 @@ find_asso_values( const Keywords &keywords,
       }
   }
 
+  /* Hash codes seen in the current equivalence class are marked with its
+     stamp, so that the detector needs no clearing between classes.  */
+  std::vector< unsigned int > collision_detector( max_hash_value + 1, 0 );
+  unsigned int collision_stamp = 0;
+
   unsigned int stepno = 0;
   for ( Step &step : steps )
     {
@@ -832,30 +1170,30 @@ find_asso_values( const Keywords &keywords,
           bool has_collision = false;
           for ( const auto &it : step._partition.m_map )
             {
-              std::vector< bool > collision_detector( max_hash_value + 1, false );
+              collision_stamp++;
 
-              for ( const std::string &keyword : it.second )
+              for ( const Chars *keyword : it.second )
                 {
                   /* Compute the new hash code for the keyword, leaving apart
                      the yet undetermined asso_values[].  */
                   int hashcode;
                   {
-                    hashcode = keyword.size();
+                    hashcode = keyword->m_keyword_size;
 
-                    for ( int ch : selchars( keyword, key_positions, alpha_inc ) )
+                    for ( int ch : *keyword )
                       if (!step._undetermined[ch])
                         hashcode += asso_values[ch];
                   }
 
                   /* See whether it collides with another keyword's hash code,
                      from the same equivalence class.  */
-                  if ( collision_detector[ hashcode ] )
+                  if ( collision_detector[ hashcode ] == collision_stamp )
                     {
                       has_collision = true;
                       break;
                     }
                   else
-                    collision_detector[ hashcode ] = true;
+                    collision_detector[ hashcode ] = collision_stamp;
                 }
 
               /* Don't need to continue looking at the other equivalence
@@ -940,8 +1278,9 @@ find_asso_values( const Keywords &keywords,
                           asso_value_max = step._asso_value_max;
                           /* Reinitialize max_hash_value.  */
                           max_hash_value =
-                            keywords.max_size()
-                            + (asso_value_max - 1) * key_positions.size();
+                            max_keyword_size
+                            + (asso_value_max - 1) * key_position_count;
+                          collision_detector.resize( max_hash_value + 1, 0 );
                         }
                     }
                 }
@@ -971,15 +1310,127 @@ find_asso_values( const Keywords &keywords,
   return std::make_tuple( std::move( asso_values ), asso_value_max, max_hash_value );
 }
 
+/* Finds some _asso_values[] for the quick search, where every position has
+   its own range of asso_values[] (see separate_positions()).
+
+   The characters are chosen one by one, from the most frequent one to the
+   least frequent one.  Once the last character of a keyword is chosen, its
+   hash value is final, so a random value is tried for the character until
+   the keywords it completes all get unused hash values.  Values are drawn
+   from a range much larger than the keyword count to keep the table sparse,
+   which makes a few tries per character enough.  */
+static
+std::vector< int > find_asso_values_quick( const std::vector< Chars > &selected,
+                                           size_t alpha_size,
+                                           unsigned int key_position_count,
+                                           size_t max_keyword_size,
+                                           const std::vector< int > &occurrences )
+{
+  std::vector< int > asso_values( alpha_size, 0 );
+
+  std::vector< unsigned int > order;
+  for ( unsigned int c = 0; c < alpha_size; c++ )
+    if ( occurrences[c] > 0 )
+      order.push_back( c );
+  std::stable_sort( order.begin(), order.end(), [ & ]( unsigned int c1, unsigned int c2 )
+  {
+    return occurrences[c1] > occurrences[c2];
+  });
+
+  std::vector< size_t > rank( alpha_size, 0 );
+  for ( size_t i = 0; i < order.size(); ++i )
+    rank[ order[ i ] ] = i + 1;
+
+  /* Keywords completed by each character, keywords without any selected
+     character are completed before the first one.  */
+  std::vector< std::vector< const Chars * > > completed( order.size() + 1 );
+  for ( const Chars &keyword : selected )
+    {
+      size_t last = 0;
+      for ( int ch : keyword )
+        last = std::max( last, rank[ ch ] );
+      completed[ last ].push_back( &keyword );
+    }
+
+  auto compute_hash = [ &asso_values ]( const Chars &keyword ) -> unsigned int
+  {
+    unsigned int sum = keyword.m_keyword_size;
+    for ( int ch : keyword )
+      sum += asso_values[ch];
+    return sum;
+  };
+
+  uint64_t state = 0;
+
+  unsigned int asso_value_max = 8 * next_power_of_2( selected.size() );
+  std::vector< bool > used;
+  std::vector< unsigned int > hashes;
+
+  /* Every character occurs at most once in a keyword, so the keywords
+     completed by a character keep their distances for any value of it.  If
+     two of them collide, the earlier choices were wrong, and the search
+     starts over with other values.  */
+  auto try_asso_values = [ & ]() -> bool
+  {
+    used.assign( max_keyword_size + ( asso_value_max - 1 ) * key_position_count + 1, false );
+
+    for ( size_t i = 0; i <= order.size(); ++i )
+      for ( unsigned int tries = 0; ; tries++ )
+        {
+          if ( tries == 64 )
+            return false;
+
+          if ( i > 0 )
+            asso_values[ order[ i - 1 ] ] = splitmix64( state ) & ( asso_value_max - 1 );
+
+          hashes.clear();
+          for ( const Chars *keyword : completed[ i ] )
+            {
+              unsigned int hashcode = compute_hash( *keyword );
+              if ( used[ hashcode ] )
+                break;
+              used[ hashcode ] = true;
+              hashes.push_back( hashcode );
+            }
+
+          for ( unsigned int hashcode : hashes )
+            used[ hashcode ] = false;
+
+          if ( hashes.size() < completed[ i ].size() )
+            {
+              unsigned int hashcode = compute_hash( *completed[ i ][ hashes.size() ] );
+              if ( std::find( hashes.begin(), hashes.end(), hashcode ) != hashes.end() )
+                return false;
+              continue;
+            }
+
+          for ( unsigned int hashcode : hashes )
+            used[ hashcode ] = true;
+          break;
+        }
+
+    return true;
+  };
+
+  for ( unsigned int restarts = 1; !try_asso_values(); restarts++ )
+    {
+      /* Widen the range, if the table seems too crowded.  */
+      if ( restarts % 4 == 0 )
+        asso_value_max *= 2;
+    }
+
+  return asso_values;
+}
+
 void
 Search::find_good_asso_values ()
 {
     // Computes a keyword's hash value, relative to the current _asso_values[],
-    auto compute_hash = [ this ]( const std::string &keyword ) -> int
+    auto compute_hash = [ this ]( const Chars &keyword ) -> int
     {
-        int sum = keyword.size();
+        int sum = keyword.m_keyword_size;
 
-        for ( int ch : selchars( keyword, _key_positions, _alpha_inc ) )
+        for ( int ch : keyword )
             sum += _asso_values[ch];
 
         return sum;
@@ -990,14 +1441,14 @@ Search::find_good_asso_values ()
   {
     std::unordered_set< Chars > representatives;
 
-    for ( const std::string &keyword : m_keywords )
+    for ( size_t i = 0; i < m_keywords.size(); ++i )
       {
-        auto [ it, inserted ] = representatives.emplace ( selchars( keyword, _key_positions, _alpha_inc ) );
+        auto [ it, inserted ] = representatives.emplace ( _selected[ i ] );
         (void)it;
 
         if ( !inserted )
         {
-          std::cerr << "Duplicate Keyword found: " << keyword << "\n";
+          std::cerr << "Duplicate Keyword found: " << m_keywords[ i ] << "\n";
           std::exit( 1 ) ;
         }
       }
@@ -1005,12 +1456,20 @@ Search::find_good_asso_values ()
 
   /* Compute the occurrences of each character in the alphabet.  */
   std::vector< int > occurrences( _asso_values.size(), 0 );
-  for ( const std::string &keyword : m_keywords )
+  for ( const Chars &keyword : _selected )
     {
-      for ( int ch : selchars( keyword, _key_positions, _alpha_inc ) )
+      for ( int ch : keyword )
         occurrences[ch]++;
     }
 
+  if ( m_options.quick )
+    {
+      _asso_values = find_asso_values_quick(
+          _selected, _asso_values.size(), _selected_count, m_keywords.max_size(), occurrences );
+      install_word_map( occurrences );
+      return;
+    }
+
   /* Round up to the next power of two.  This makes it easy to ensure
      an _asso_value[c] is >= 0 and < asso_value_max.  Also, the jump value
      being odd, it guarantees that Search::try_asso_value() will iterate
@@ -1020,7 +1479,7 @@ Search::find_good_asso_values ()
   /* Given the bound for _asso_values[c], we have a bound for the possible
      hash values, as computed in compute_hash().  */
   int _max_hash_value = m_keywords.max_size()
-                    + (asso_value_max - 1) * _key_positions.size();
+                    + (asso_value_max - 1) * _selected_count;
 
 
 
@@ -1052,14 +1511,14 @@ Search::find_good_asso_values ()
       m_keywords = saved_keywords;
 
       std::tie( _asso_values, asso_value_max, _max_hash_value ) = find_asso_values(
-          m_keywords, _asso_values.size(), _key_positions, _alpha_inc, jump, occurrences, asso_value_max, initial_asso_value, _max_hash_value );
+          _selected, _asso_values.size(), _selected_count, m_keywords.max_size(), jump, occurrences, asso_value_max, initial_asso_value, _max_hash_value );
 
       /* Test whether it is the best solution so far.  */
       int collisions = 0;
       int max_hash_value = INT_MIN;
       std::vector< bool > collision_detector( _max_hash_value + 1, false );
 
-      for ( const std::string &keyword : m_keywords )
+      for ( const Chars &keyword : _selected )
         {
           int hashcode = compute_hash (keyword);
           if (max_hash_value < hashcode)
@@ -1097,12 +1556,27 @@ Search::find_good_asso_values ()
   jump = best_jump;
   _asso_values = best_asso_values;
 
-  // finalize
-  {
-  for ( const std::string &word : m_keywords )
-    word_map[ compute_hash( word ) ] = word;
+  install_word_map( occurrences );
+}
 
-  /* Set unused asso_values[c] to max_hash_value + 1.  This is not absolutely
+void
+Search::install_word_map ( const std::vector< int > &occurrences )
+{
+    // Computes a keyword's hash value, relative to the current _asso_values[],
+    auto compute_hash = [ this ]( const Chars &keyword ) -> int
+    {
+        int sum = keyword.m_keyword_size;
+
+        for ( int ch : keyword )
+            sum += _asso_values[ch];
+
+        return sum;
+    };
+
+  for ( size_t i = 0; i < m_keywords.size(); ++i )
+    word_map[ compute_hash( _selected[ i ] ) ] = m_keywords[ i ];
+
+  /* Set unused asso_values[c] to max_hash_value + 1.  This is not absolutely
      necessary, but speeds up the lookup function in many cases of lookup
      failure: no string comparison is needed once the hash value of a string
      is larger than the hash value of any keyword.  */
@@ -1111,7 +1585,6 @@ Search::find_good_asso_values ()
   for (unsigned int c = 0; c < _asso_values.size(); c++)
     if (occurrences[c] == 0)
       _asso_values[c] = max_hash_value + 1;
-  }
 }
 
 /* ========================================================================= */
@@ -1119,20 +1592,836 @@ Search::find_good_asso_values ()
 void
 Search::optimize ()
 {
-  /* Step 1: Finding good byte positions.  */
-  _key_positions = find_positions ( m_keywords );
+  if ( m_options.family == HashFamily::WideWindows )
+    {
+      /* Step 1 and 2: Finding good key windows.  */
+      _key_windows = find_windows ( m_keywords );
+      _asso_values.resize( 256 * _key_windows.size() );
 
-  /* Step 2: Finding good alpha increments.  */
-  _alpha_inc = find_alpha_inc( m_keywords, _key_positions );
+      _selected.clear();
+      for ( const std::string &keyword : m_keywords )
+        _selected.push_back( selwindows( keyword, _key_windows ) );
+      _selected_count = _key_windows.size();
+
+      /* Step 3: Finding good asso_values.  */
+      find_good_asso_values ();
+      return;
+    }
+
+  if ( m_options.quick )
+    {
+      std::vector< int > positions = find_positions_quick ( m_keywords );
+      _key_positions.insert( positions.begin(), positions.end() );
+      _alpha_inc = separate_positions( m_keywords, _key_positions );
+    }
+  else
+    {
+      /* Step 1: Finding good byte positions.  */
+      _key_positions = find_positions ( m_keywords );
+
+      /* Step 2: Finding good alpha increments.  */
+      _alpha_inc = find_alpha_inc( m_keywords, _key_positions, m_options.ignore_case );
+    }
   _asso_values.resize( 256 + *std::max_element( _alpha_inc.begin(), _alpha_inc.end() ) );
 
+  std::vector< int > unified;
+  if ( m_options.ignore_case )
+    unified = unify_case( _key_positions, _alpha_inc );
+
+  _selected.clear();
+  for ( const std::string &keyword : m_keywords )
+    _selected.push_back( selchars( keyword, _key_positions, _alpha_inc, unified ) );
+  _selected_count = _key_positions.size();
+
   /* Step 3: Finding good asso_values.  */
   find_good_asso_values ();
+
+  /* Characters which are not representatives take the value of theirs.  */
+  for ( size_t c = 0; c < unified.size(); ++c )
+    _asso_values[ c ] = _asso_values[ unified[ c ] ];
+}
+
+std::string ToLowerAscii( std::string_view word )
+{
+    std::string res( word );
+    for ( char &c : res )
+        if ( c >= 'A' && c <= 'Z' )
+            c += 'a' - 'A';
+    return res;
 }
 
-PerfectHash GeneratePerfectHash( std::vector< std::string > words )
+PerfectHash GeneratePerfectHash( std::vector< std::string > words, const SearchOptions &options )
 {
-    Search searcher ( Keywords( std::move( words ) ) );
+    if ( options.ignore_case && options.family != HashFamily::BytePositions )
+        throw std::runtime_error( "Case-insensitive hash is only supported for byte positions." );
+
+    /* Search on lower case keywords, word_map keeps the given spelling.  */
+    std::unordered_map< std::string, std::string > spelling;
+    if ( options.ignore_case )
+        for ( std::string &word : words )
+          {
+            std::string lower = ToLowerAscii( word );
+            spelling[ lower ] = word;
+            word = lower;
+          }
+
+    Search searcher ( Keywords( std::move( words ) ), options );
     searcher.optimize ();
-    return searcher.get_solution();
+    PerfectHash res = searcher.get_solution();
+
+    if ( options.ignore_case )
+        for ( auto &it : res.word_map )
+            it.second = spelling[ it.second ];
+
+    return res;
+}
+
+/* ========================= Partitioned by size =========================== */
+
+std::vector< SizeGroup > GeneratePartitionedHash( const std::vector< std::string > &words, const SearchOptions &options, size_t min_group_size )
+{
+    std::map< size_t, std::vector< std::string > > by_size;
+    {
+        std::unordered_set< std::string > representatives;
+        for ( const std::string &word : words )
+        {
+            if ( !representatives.insert( options.ignore_case ? ToLowerAscii( word ) : word ).second )
+            {
+                std::cerr << "Duplicate Keyword found: " << word << "\n";
+                std::exit( 1 ) ;
+            }
+            by_size[ word.size() ].push_back( word );
+        }
+    }
+
+    /* Sizes are added to a group until it is large enough, a last group
+       which is not joins the previous one.  */
+    std::vector< SizeGroup > groups;
+    std::vector< std::vector< std::string > > group_words;
+    for ( auto &it : by_size )
+    {
+        if ( groups.empty() || group_words.back().size() >= min_group_size )
+        {
+            groups.push_back( { it.first, it.first, {} } );
+            group_words.emplace_back();
+        }
+
+        groups.back().max_size = it.first;
+        group_words.back().insert( group_words.back().end(), it.second.begin(), it.second.end() );
+    }
+
+    if ( groups.size() > 1 && group_words.back().size() < min_group_size )
+    {
+        groups[ groups.size() - 2 ].max_size = groups.back().max_size;
+        group_words[ groups.size() - 2 ].insert( group_words[ groups.size() - 2 ].end(), group_words.back().begin(), group_words.back().end() );
+        groups.pop_back();
+        group_words.pop_back();
+    }
+
+    std::vector< std::future< PerfectHash > > searches;
+    for ( std::vector< std::string > &group : group_words )
+        searches.push_back( std::async( std::launch::async, GeneratePerfectHash, std::move( group ), options ) );
+
+    for ( size_t i = 0; i < groups.size(); ++i )
+        groups[ i ].hash = searches[ i ].get();
+
+    return groups;
+}
+
+/* ============================= Integer hash ============================== */
+
+uint64_t IntegerKey( std::string_view word )
+{
+    return load_le( word );
+}
+
+std::optional< IntegerHash > GenerateIntegerHash( const std::vector< std::string > &words, bool ignore_case )
+{
+    std::vector< std::string > copy = words;
+    Keywords keywords( std::move( copy ) );
+    if ( keywords.min_size() != keywords.max_size() || keywords.max_size() > 8 )
+        return std::nullopt;
+
+    std::vector< uint64_t > keys;
+    for ( const std::string &keyword : keywords )
+        keys.push_back( IntegerKey( ignore_case ? ToLowerAscii( keyword ) : keyword ) );
+
+    {
+        std::unordered_set< uint64_t > representatives;
+        for ( size_t i = 0; i < keys.size(); ++i )
+            if ( !representatives.insert( keys[ i ] ).second )
+            {
+                std::cerr << "Duplicate Keyword found: " << keywords[ i ] << "\n";
+                std::exit( 1 ) ;
+            }
+    }
+
+    uint64_t state = 0;
+
+    /* Start with the smallest table which fits all keywords, random
+       multipliers are injective on it with probability of roughly
+       exp( -n^2 / 2m ), so a few doublings of the table are expected.  */
+    int bits = 1;
+    while ( ( size_t( 1 ) << bits ) < keys.size() )
+        ++bits;
+
+    constexpr int attempts = 1 << 16;
+    std::vector< bool > used;
+    for ( ; ( size_t( 1 ) << bits ) <= std::max< size_t >( 16, 16 * keys.size() ); ++bits )
+    {
+        for ( int attempt = 0; attempt < attempts; ++attempt )
+        {
+            uint64_t multiplier = splitmix64( state ) | 1;
+            int shift = 64 - bits;
+
+            used.assign( size_t( 1 ) << bits, false );
+            bool collision = false;
+            for ( uint64_t key : keys )
+            {
+                size_t slot = ( key * multiplier ) >> shift;
+                if ( used[ slot ] )
+                {
+                    collision = true;
+                    break;
+                }
+                used[ slot ] = true;
+            }
+
+            if ( !collision )
+            {
+                IntegerHash res;
+                res.multiplier = multiplier;
+                res.shift = shift;
+                for ( size_t i = 0; i < keys.size(); ++i )
+                    res.word_map[ ( keys[ i ] * multiplier ) >> shift ] = keywords[ i ];
+                return res;
+            }
+        }
+    }
+
+    return std::nullopt;
+}
+
+/* ============================ Full key hash ============================== */
+
+static uint64_t FullKeyMix( uint64_t x )
+{
+  x *= FullKeyMixMultiplier;
+  return x ^ ( x >> 31 );
+}
+
+uint64_t FullKeyHashValue( std::string_view word, uint64_t seed )
+{
+  uint64_t h = seed ^ ( word.size() * FullKeySizeMultiplier );
+  if ( word.size() < 8 )
+    return FullKeyMix( h ^ load_le( word ) );
+
+  /* Last 8 bytes overlap with the previous ones, instead of a shorter
+     tail.  */
+  for ( size_t i = 0; i + 8 < word.size(); i += 8 )
+    h = FullKeyMix( h ^ load_le( word.substr( i, 8 ) ) );
+  return FullKeyMix( h ^ load_le( word.substr( word.size() - 8 ) ) );
+}
+
+static size_t FullKeyBucket( uint64_t hash, size_t buckets )
+{
+  return ( ( hash >> 32 ) * buckets ) >> 32;
+}
+
+static size_t FullKeyDisplace( uint64_t hash, int displacement, size_t table_size )
+{
+  uint64_t x = ( hash ^ ( displacement * FullKeySizeMultiplier ) ) * FullKeySlotMultiplier;
+  return ( ( x >> 32 ) * table_size ) >> 32;
+}
+
+size_t FullKeySlot( const FullKeyHash &soln, std::string_view word )
+{
+  uint64_t hash = FullKeyHashValue( word, soln.seed );
+  int displacement = soln.displacements[ FullKeyBucket( hash, soln.displacements.size() ) ];
+  return FullKeyDisplace( hash, displacement, soln.table_size );
+}
+
+FullKeyHash GenerateFullKeyHash( const std::vector< std::string > &words, bool ignore_case )
+{
+  /* Throws on empty keywords, as for the other generators.  */
+  std::vector< std::string > copy = words;
+  Keywords keywords( std::move( copy ) );
+
+  std::vector< std::string > keys;
+  {
+    std::unordered_set< std::string > representatives;
+    for ( const std::string &word : words )
+      {
+        keys.push_back( ignore_case ? ToLowerAscii( word ) : word );
+        if ( !representatives.insert( keys.back() ).second )
+          {
+            std::cerr << "Duplicate Keyword found: " << word << "\n";
+            std::exit( 1 ) ;
+          }
+      }
+  }
+
+  uint64_t state = 0;
+
+  /* Two keywords per bucket on average.  Buckets are placed largest first,
+     trying displacements until all of their keywords land in free slots.
+     Starting from a table of one slot per keyword, seeds are retried before
+     the table grows.  */
+  size_t n = keys.size();
+  size_t buckets = std::max< size_t >( 1, ( n + 1 ) / 2 );
+  size_t step = std::max< size_t >( 1, n / 32 );
+  constexpr int attempts = 64;
+
+  std::vector< uint64_t > hashes( n );
+  std::vector< bool > used;
+  std::vector< size_t > slots;
+  for ( size_t table_size = std::max< size_t >( 1, n ); ; table_size += step )
+    {
+      for ( int attempt = 0; attempt < attempts; ++attempt )
+        {
+          uint64_t seed = splitmix64( state );
+
+          std::vector< std::vector< size_t > > bucket_keys( buckets );
+          for ( size_t i = 0; i < n; ++i )
+            {
+              hashes[ i ] = FullKeyHashValue( keys[ i ], seed );
+              bucket_keys[ FullKeyBucket( hashes[ i ], buckets ) ].push_back( i );
+            }
+
+          std::vector< size_t > order( buckets );
+          for ( size_t b = 0; b < buckets; ++b )
+            order[ b ] = b;
+          std::stable_sort( order.begin(), order.end(), [ & ]( size_t a, size_t b )
+            {
+              return bucket_keys[ a ].size() > bucket_keys[ b ].size();
+            } );
+
+          std::vector< int > displacements( buckets, 0 );
+          used.assign( table_size, false );
+          bool placed = true;
+          for ( size_t b : order )
+            {
+              if ( bucket_keys[ b ].empty() )
+                break;
+
+              placed = false;
+              for ( int d = 0; d < FullKeyMaxDisplacement && !placed; ++d )
+                {
+                  slots.clear();
+                  placed = true;
+                  for ( size_t i : bucket_keys[ b ] )
+                    {
+                      size_t slot = FullKeyDisplace( hashes[ i ], d, table_size );
+                      if ( used[ slot ] || std::find( slots.begin(), slots.end(), slot ) != slots.end() )
+                        {
+                          placed = false;
+                          break;
+                        }
+                      slots.push_back( slot );
+                    }
+
+                  if ( placed )
+                    {
+                      displacements[ b ] = d;
+                      for ( size_t slot : slots )
+                        used[ slot ] = true;
+                    }
+                }
+
+              if ( !placed )
+                break;
+            }
+
+          if ( placed )
+            {
+              FullKeyHash res;
+              res.seed = seed;
+              res.displacements = std::move( displacements );
+              res.table_size = table_size;
+              for ( size_t i = 0; i < n; ++i )
+                res.word_map[ FullKeySlot( res, keys[ i ] ) ] = words[ i ];
+              return res;
+            }
+        }
+    }
+}
+
+/* ============================== Switch tree ============================== */
+
+/* Adds the node telling apart keywords of group, which are of the same size,
+   and returns its index.  It switches on the first position the quick search
+   picks for them, the one which distinguishes the most keywords, and
+   children do the same for keywords sharing a byte there.  */
+static
+size_t add_switch_node( SwitchTree &tree,
+                        const std::vector< std::string > &words,
+                        const std::vector< std::string > &folded,
+                        const std::vector< size_t > &group,
+                        size_t depth )
+{
+    size_t index = tree.nodes.size();
+    tree.nodes.emplace_back();
+
+    std::vector< int > positions;
+    if ( group.size() > 1 )
+    {
+        std::vector< std::string > subset;
+        for ( size_t k : group )
+            subset.push_back( folded[ k ] );
+        positions = find_positions_quick( Keywords( std::move( subset ) ) );
+    }
+
+    /* Switch on the first position which splits the group, the quick
+       search may return positions which tell nothing apart.  */
+    size_t size = words[ group[ 0 ] ].size();
+    int position = -1;
+    std::map< unsigned char, std::vector< size_t > > by_byte;
+    for ( int pos : positions )
+    {
+        position = pos == -1 ? size - 1 : pos;
+        by_byte.clear();
+        for ( size_t k : group )
+            by_byte[ folded[ k ][ position ] ].push_back( k );
+        if ( by_byte.size() > 1 )
+            break;
+    }
+
+    /* Keywords differing only past the positions searched stay together,
+       they are compared in turn.  */
+    if ( by_byte.size() < 2 )
+    {
+        for ( size_t k : group )
+            tree.nodes[ index ].words.push_back( words[ k ] );
+        tree.nodes[ index ].checked = group.size() == 1 && depth == words[ group[ 0 ] ].size();
+        return index;
+    }
+
+    tree.nodes[ index ].position = position;
+    for ( const auto &it : by_byte )
+    {
+        size_t child = add_switch_node( tree, words, folded, it.second, depth + 1 );
+        tree.nodes[ index ].children.emplace_back( it.first, child );
+    }
+
+    return index;
+}
+
+SwitchTree GenerateSwitchTree( const std::vector< std::string > &words, bool ignore_case )
+{
+    std::vector< std::string > folded = words;
+    if ( ignore_case )
+        for ( std::string &word : folded )
+            word = ToLowerAscii( word );
+
+    /* Throws on empty keywords, as for the other generators.  */
+    std::vector< std::string > copy = folded;
+    Keywords keywords( std::move( copy ) );
+
+    std::map< size_t, std::vector< size_t > > by_size;
+    {
+        std::unordered_set< std::string > representatives;
+        for ( size_t i = 0; i < folded.size(); ++i )
+        {
+            if ( !representatives.insert( folded[ i ] ).second )
+            {
+                std::cerr << "Duplicate Keyword found: " << words[ i ] << "\n";
+                std::exit( 1 ) ;
+            }
+            by_size[ folded[ i ].size() ].push_back( i );
+        }
+    }
+
+    SwitchTree res;
+    for ( size_t i = 0; i < words.size(); ++i )
+        res.word_map[ i ] = words[ i ];
+
+    for ( const auto &it : by_size )
+        res.roots[ it.first ] = add_switch_node( res, words, folded, it.second, 0 );
+
+    return res;
+}
+
+/* ============================= Runtime table ============================= */
+
+PerfectHashTable::PerfectHashTable( const std::vector< std::string > &words, SearchOptions options )
+{
+    /* The search reports duplicates by exiting, which is fine for the
+       generator but not at run time.  */
+    std::unordered_set< std::string > seen;
+    for ( const std::string &word : words )
+        if ( !seen.insert( options.ignore_case ? ToLowerAscii( word ) : word ).second )
+            throw std::runtime_error( "Duplicate keyword: " + word );
+
+    if ( words.empty() )
+    {
+        update_view();
+        return;
+    }
+
+    options.quick = true;
+    build( GeneratePerfectHash( words, options ), words, options.ignore_case );
+}
+
+PerfectHashTable::PerfectHashTable( const PerfectHash &soln, bool ignore_case )
+{
+    std::vector< std::string > words;
+    for ( const auto &it : soln.word_map )
+        words.push_back( it.second );
+
+    build( soln, words, ignore_case );
+}
+
+void PerfectHashTable::build( const PerfectHash &soln, const std::vector< std::string > &words, bool ignore_case )
+{
+    m_ignore_case = ignore_case;
+    m_key_positions.assign( soln.key_positions.begin(), soln.key_positions.end() );
+    m_alpha_inc.assign( soln.alpha_inc.begin(), soln.alpha_inc.end() );
+    m_key_windows = soln.key_windows;
+    m_asso_values.assign( soln.asso_values.begin(), soln.asso_values.end() );
+
+    std::unordered_map< std::string_view, int > index;
+    for ( const std::string &word : words )
+    {
+        index.emplace( word, m_key_offsets.size() - 1 );
+        m_keys += word;
+        m_key_offsets.push_back( m_keys.size() );
+    }
+
+    m_min_size = SIZE_MAX;
+    m_max_size = 0;
+    m_slots.assign( soln.word_map.rbegin()->first + 1, -1 );
+    for ( const auto &[ hash, word ] : soln.word_map )
+    {
+        m_slots[ hash ] = index.at( word );
+        m_min_size = std::min( m_min_size, word.size() );
+        m_max_size = std::max( m_max_size, word.size() );
+    }
+
+    update_view();
+}
+
+void PerfectHashTable::update_view()
+{
+    m_view.ignore_case = m_ignore_case;
+    m_view.min_size = m_min_size;
+    m_view.max_size = m_max_size;
+    m_view.key_positions = m_key_positions.data();
+    m_view.key_position_count = m_key_positions.size();
+    m_view.alpha_inc = m_alpha_inc.data();
+    m_view.alpha_inc_count = m_alpha_inc.size();
+    m_view.key_windows = m_key_windows.data();
+    m_view.key_window_count = m_key_windows.size();
+    m_view.asso_values = m_asso_values.data();
+    m_view.asso_value_count = m_asso_values.size();
+    m_view.slots = m_slots.data();
+    m_view.slot_count = m_slots.size();
+    m_view.key_offsets = m_key_offsets.data();
+    m_view.keys = m_keys.data();
+    m_view.key_count = m_key_offsets.size() - 1;
+}
+
+int PerfectHashView::find( std::string_view word ) const
+{
+    if ( word.size() < min_size || word.size() > max_size )
+        return -1;
+
+    size_t hash = word.size();
+    if ( key_window_count == 0 )
+    {
+        for ( size_t j = 0; j < key_position_count; ++j )
+        {
+            int i = key_positions[ j ];
+            if ( i == -1 )
+                hash += asso_values[ static_cast< unsigned char >( word.back() ) ];
+            else if ( (size_t)i < word.size() )
+                hash += asso_values[ static_cast< unsigned char >( word[ i ] ) + alpha_inc[ i ] ];
+        }
+    }
+    else
+    {
+        for ( size_t j = 0; j < key_window_count; ++j )
+            if ( WindowApplies( key_windows[ j ], word.size() ) )
+                hash += asso_values[ 256 * j + FoldWindow( key_windows[ j ], word ) ];
+    }
+
+    if ( hash >= slot_count || slots[ hash ] == -1 )
+        return -1;
+
+    int idx = slots[ hash ];
+    if ( (size_t)idx >= key_count )
+        return -1;
+    std::string_view candidate = key( idx );
+    if ( candidate.size() != word.size() )
+        return -1;
+
+    if ( ignore_case )
+    {
+        auto lower = []( char c ) { return c >= 'A' && c <= 'Z' ? c + ( 'a' - 'A' ) : c; };
+        for ( size_t i = 0; i < word.size(); ++i )
+            if ( lower( candidate[ i ] ) != lower( word[ i ] ) )
+                return -1;
+        return idx;
+    }
+
+    return candidate == word ? idx : -1;
+}
+
+/* ============================== Binary format ============================= */
+
+namespace {
+
+constexpr char BinaryMagic[ 8 ] = { 'S', 'W', 'I', 'T', 'C', 'H', 'P', 'H' };
+constexpr uint32_t BinaryVersion = 1;
+constexpr uint32_t BinaryIgnoreCase = 1;
+constexpr uint32_t BinaryHasPayload = 2;
+
+struct BinaryHeader
+{
+    char magic[ 8 ];
+    uint32_t version;
+    uint32_t flags;
+    uint32_t min_size;
+    uint32_t max_size;
+    uint32_t key_position_count;
+    uint32_t alpha_inc_count;
+    uint32_t key_window_count;
+    uint32_t asso_value_count;
+    uint32_t slot_count;
+    uint32_t key_count;
+    uint32_t keys_size;
+    uint32_t payload_size;
+    uint64_t file_size;
+    uint64_t checksum;
+};
+
+static_assert( sizeof( BinaryHeader ) == 72 );
+static_assert( sizeof( KeyWindow ) == 16 && offsetof( KeyWindow, multiplier ) == 8,
+               "Key windows are mapped as they are stored" );
+
+size_t align8( size_t size )
+{
+    return ( size + 7 ) & ~size_t( 7 );
+}
+
+// Section sizes in the order they are stored, the header is not included.
+std::vector< size_t > section_sizes( const BinaryHeader &header )
+{
+    bool has_payload = header.flags & BinaryHasPayload;
+    return {
+        4 * size_t( header.key_position_count ),
+        4 * size_t( header.alpha_inc_count ),
+        16 * size_t( header.key_window_count ),
+        4 * size_t( header.asso_value_count ),
+        4 * size_t( header.slot_count ),
+        4 * ( size_t( header.key_count ) + 1 ),
+        header.keys_size,
+        has_payload ? 4 * ( size_t( header.key_count ) + 1 ) : 0,
+        header.payload_size,
+    };
+}
+
+// FNV-1a of the stored header, with the checksum taken as zero.
+uint64_t header_checksum( const char *header )
+{
+    uint64_t res = 0xCBF29CE484222325ull;
+    for ( size_t i = 0; i < sizeof( BinaryHeader ); ++i )
+    {
+        unsigned char byte = i < offsetof( BinaryHeader, checksum ) ? header[ i ] : 0;
+        res = ( res ^ byte ) * 0x100000001B3ull;
+    }
+    return res;
+}
+
+void append_le( std::string &out, uint64_t value, int width )
+{
+    for ( int i = 0; i < width; ++i )
+        out.push_back( static_cast< char >( value >> ( 8 * i ) ) );
+}
+
+} // namespace
+
+void WritePerfectHash( std::ostream &out, const PerfectHashView &view, const std::vector< std::string > &payloads )
+{
+    if ( !payloads.empty() && payloads.size() != view.key_count )
+        throw std::runtime_error( "Payload count does not match key count" );
+
+    std::vector< uint32_t > payload_offsets = { 0 };
+    std::string payload;
+    for ( const std::string &p : payloads )
+    {
+        payload += p;
+        payload_offsets.push_back( payload.size() );
+    }
+
+    BinaryHeader header = {};
+    std::memcpy( header.magic, BinaryMagic, sizeof( BinaryMagic ) );
+    header.version = BinaryVersion;
+    header.flags = ( view.ignore_case ? BinaryIgnoreCase : 0 ) | ( payloads.empty() ? 0 : BinaryHasPayload );
+    header.min_size = view.min_size;
+    header.max_size = view.max_size;
+    header.key_position_count = view.key_position_count;
+    header.alpha_inc_count = view.alpha_inc_count;
+    header.key_window_count = view.key_window_count;
+    header.asso_value_count = view.asso_value_count;
+    header.slot_count = view.slot_count;
+    header.key_count = view.key_count;
+    header.keys_size = view.key_offsets[ view.key_count ];
+    header.payload_size = payload.size();
+
+    std::string body;
+    auto end_section = [ &body ]()
+    {
+        body.resize( align8( body.size() ), '\0' );
+    };
+
+    for ( size_t j = 0; j < view.key_position_count; ++j )
+        append_le( body, view.key_positions[ j ], 4 );
+    end_section();
+    for ( size_t i = 0; i < view.alpha_inc_count; ++i )
+        append_le( body, view.alpha_inc[ i ], 4 );
+    end_section();
+    for ( size_t j = 0; j < view.key_window_count; ++j )
+    {
+        append_le( body, view.key_windows[ j ].offset, 4 );
+        append_le( body, view.key_windows[ j ].width, 4 );
+        append_le( body, view.key_windows[ j ].multiplier, 8 );
+    }
+    end_section();
+    for ( size_t c = 0; c < header.asso_value_count; ++c )
+        append_le( body, view.asso_values[ c ], 4 );
+    end_section();
+    for ( size_t h = 0; h < view.slot_count; ++h )
+        append_le( body, view.slots[ h ], 4 );
+    end_section();
+    for ( size_t i = 0; i <= view.key_count; ++i )
+        append_le( body, view.key_offsets[ i ], 4 );
+    end_section();
+    body.append( view.keys, header.keys_size );
+    end_section();
+    if ( !payloads.empty() )
+    {
+        for ( uint32_t offset : payload_offsets )
+            append_le( body, offset, 4 );
+        end_section();
+        body += payload;
+        end_section();
+    }
+
+    header.file_size = sizeof( header ) + body.size();
+
+    std::string head;
+    head.append( header.magic, sizeof( header.magic ) );
+    for ( uint32_t field : { header.version, header.flags, header.min_size, header.max_size,
+                             header.key_position_count, header.alpha_inc_count, header.key_window_count,
+                             header.asso_value_count, header.slot_count, header.key_count,
+                             header.keys_size, header.payload_size } )
+        append_le( head, field, 4 );
+    append_le( head, header.file_size, 8 );
+    append_le( head, header_checksum( head.data() ), 8 );
+
+    out.write( head.data(), head.size() );
+    out.write( body.data(), body.size() );
+}
+
+MappedPerfectHash::MappedPerfectHash( const std::string &path )
+{
+#if __BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__
+    throw std::runtime_error( "Mapped tables need a little endian host" );
+#endif
+
+    int fd = open( path.c_str(), O_RDONLY );
+    if ( fd == -1 )
+        throw std::runtime_error( "Can not open " + path + ": " + std::strerror( errno ) );
+
+    struct stat st;
+    if ( fstat( fd, &st ) == -1 || st.st_size < (off_t)sizeof( BinaryHeader ) )
+    {
+        close( fd );
+        throw std::runtime_error( "Not a perfect hash table: " + path );
+    }
+
+    m_size = st.st_size;
+    m_data = mmap( nullptr, m_size, PROT_READ, MAP_SHARED, fd, 0 );
+    close( fd );
+    if ( m_data == MAP_FAILED )
+    {
+        m_data = nullptr;
+        throw std::runtime_error( "Can not map " + path + ": " + std::strerror( errno ) );
+    }
+
+    const char *data = static_cast< const char* >( m_data );
+    BinaryHeader header;
+    std::memcpy( &header, data, sizeof( header ) );
+
+    bool valid = std::memcmp( header.magic, BinaryMagic, sizeof( BinaryMagic ) ) == 0
+        && header.version == BinaryVersion
+        && header.checksum == header_checksum( data )
+        && header.file_size == m_size;
+
+    /* Sections must fit in the file, and their lengths must match.  */
+    std::vector< const char* > sections;
+    if ( valid )
+    {
+        size_t offset = sizeof( header );
+        for ( size_t size : section_sizes( header ) )
+        {
+            sections.push_back( data + offset );
+            offset += align8( size );
+        }
+        valid = offset == m_size;
+    }
+
+    if ( valid )
+    {
+        m_view.ignore_case = header.flags & BinaryIgnoreCase;
+        m_view.min_size = header.min_size;
+        m_view.max_size = header.max_size;
+        m_view.key_positions = reinterpret_cast< const int32_t* >( sections[ 0 ] );
+        m_view.key_position_count = header.key_position_count;
+        m_view.alpha_inc = reinterpret_cast< const int32_t* >( sections[ 1 ] );
+        m_view.alpha_inc_count = header.alpha_inc_count;
+        m_view.key_windows = reinterpret_cast< const KeyWindow* >( sections[ 2 ] );
+        m_view.key_window_count = header.key_window_count;
+        m_view.asso_values = reinterpret_cast< const int32_t* >( sections[ 3 ] );
+        m_view.asso_value_count = header.asso_value_count;
+        m_view.slots = reinterpret_cast< const int32_t* >( sections[ 4 ] );
+        m_view.slot_count = header.slot_count;
+        m_view.key_offsets = reinterpret_cast< const uint32_t* >( sections[ 5 ] );
+        m_view.keys = sections[ 6 ];
+        m_view.key_count = header.key_count;
+        if ( header.flags & BinaryHasPayload )
+        {
+            m_view.payload_offsets = reinterpret_cast< const uint32_t* >( sections[ 7 ] );
+            m_view.payload = sections[ 8 ];
+        }
+
+        valid = m_view.key_offsets[ m_view.key_count ] == header.keys_size
+            && ( !m_view.payload_offsets || m_view.payload_offsets[ m_view.key_count ] == header.payload_size );
+
+        /* Hashing must stay in asso_values[], for any word.  */
+        for ( size_t j = 0; valid && j < m_view.key_position_count; ++j )
+        {
+            int32_t i = m_view.key_positions[ j ];
+            valid = i >= -1 && i < (int32_t)m_view.alpha_inc_count
+                && ( i == -1 ? 256 : 256 + (size_t)m_view.alpha_inc[ i ] ) <= m_view.asso_value_count
+                && ( i == -1 || m_view.alpha_inc[ i ] >= 0 );
+        }
+        for ( size_t j = 0; valid && j < m_view.key_window_count; ++j )
+        {
+            const KeyWindow &window = m_view.key_windows[ j ];
+            valid = window.width >= 1 && window.width <= 8
+                && 256 * ( j + 1 ) <= m_view.asso_value_count;
+        }
+    }
+
+    if ( !valid )
+    {
+        munmap( m_data, m_size );
+        throw std::runtime_error( "Not a valid perfect hash table: " + path );
+    }
+}
+
+MappedPerfectHash::~MappedPerfectHash()
+{
+    munmap( m_data, m_size );
 }
@@ -23,19 +23,263 @@
 #ifndef SEARCH_H_
 #define SEARCH_H_
 
+#include <algorithm>
+#include <cstdint>
+#include <iosfwd>
+#include <optional>
 #include <set>
 #include <map>
 #include <string>
+#include <string_view>
+#include <utility>
 #include <vector>
 
+enum class HashFamily
+{
+    BytePositions, // One asso_values lookup per selected byte.
+    WideWindows, // One asso_values lookup per selected window of 1, 2, 4 or 8 bytes.
+};
+
+struct SearchOptions
+{
+    HashFamily family = HashFamily::BytePositions;
+    bool ignore_case = false; // Upper and lower case ASCII letters share asso_values.
+    bool quick = false; // Trades a larger table for a much faster search, for tables built at run time.
+};
+
+struct KeyWindow
+{
+    int offset; // Offset of the first byte, negative offsets are relative to the end of keyword.
+    int width; // Number of bytes loaded.
+    uint64_t multiplier; // Folds loaded bytes into 8 bits, unused for single byte windows.
+};
+
 struct PerfectHash
 {
     std::map< int, std::string > word_map;
     std::set< int > key_positions; // Computed key positions.
     std::vector< int > alpha_inc; // Adjustments to add to bytes add specific key positions.
+    std::vector< KeyWindow > key_windows; // Computed key windows, used instead of key positions if not empty.
     std::vector< int > asso_values; // Value associated with each character.
 };
 
-PerfectHash GeneratePerfectHash( std::vector< std::string > words );
+// Returns whether window fits in a keyword of given size.
+bool WindowApplies( const KeyWindow &window, size_t size );
+
+// Returns bytes of the window in word (little endian) folded into [0, 256).
+int FoldWindow( const KeyWindow &window, std::string_view word );
+
+// Returns word with ASCII upper case letters converted to lower case.
+std::string ToLowerAscii( std::string_view word );
+
+PerfectHash GeneratePerfectHash( std::vector< std::string > words, const SearchOptions &options = {} );
+
+// Keywords of consecutive sizes, with a perfect hash of their own.
+struct SizeGroup
+{
+    size_t min_size;
+    size_t max_size;
+    PerfectHash hash;
+};
+
+// Splits keywords into groups of consecutive sizes, each of at least
+// min_group_size keywords unless there are fewer in all, so that a hash only
+// separates keywords of similar sizes. Hashes of groups are searched in
+// parallel. Exits if a keyword is given twice, as GeneratePerfectHash does.
+std::vector< SizeGroup > GeneratePartitionedHash( const std::vector< std::string > &words, const SearchOptions &options = {}, size_t min_group_size = 8 );
+
+// Perfect hash for keywords of the same length, of at most 8 bytes. Keywords
+// are loaded as little endian integers (in lower case, if case-insensitive)
+// and hashed as ( key * multiplier ) >> shift.
+struct IntegerHash
+{
+    std::map< int, std::string > word_map;
+    uint64_t multiplier;
+    int shift;
+};
+
+// Returns keyword loaded as a little endian integer, it must not be longer than 8 bytes.
+uint64_t IntegerKey( std::string_view word );
+
+// Returns nullopt if words are not of the same length or longer than 8 bytes,
+// or if no multiplier is found for a table of at most 16 slots per keyword.
+std::optional< IntegerHash > GenerateIntegerHash( const std::vector< std::string > &words, bool ignore_case = false );
+
+// Perfect hash reading the whole keyword, for long keywords sharing prefixes.
+// Keywords are mixed 8 bytes at a time from a seed into a 64 bit hash, whose
+// high bits pick a bucket. Keywords of a bucket are placed in the table by
+// mixing the hash with the displacement of the bucket.
+struct FullKeyHash
+{
+    std::map< int, std::string > word_map;
+    uint64_t seed;
+    std::vector< int > displacements; // Per bucket, less than FullKeyMaxDisplacement.
+    size_t table_size;
+};
+
+constexpr int FullKeyMaxDisplacement = 256;
+
+// Constants of the mixer, generated code uses the same ones
+constexpr uint64_t FullKeySizeMultiplier = 0x9E3779B97F4A7C15ull;
+constexpr uint64_t FullKeyMixMultiplier = 0xBF58476D1CE4E5B9ull;
+constexpr uint64_t FullKeySlotMultiplier = 0xD6E8FEB86659FD93ull;
+
+// Returns 64 bit hash of keyword (in lower case, if case-insensitive) with seed.
+uint64_t FullKeyHashValue( std::string_view word, uint64_t seed );
+
+// Returns slot of keyword (in lower case, if case-insensitive) in the table.
+size_t FullKeySlot( const FullKeyHash &soln, std::string_view word );
+
+FullKeyHash GenerateFullKeyHash( const std::vector< std::string > &words, bool ignore_case = false );
+
+// Decision tree for small sets, lowered to nested switch statements instead of
+// a hash: keywords are told apart by their size, then by one byte at a time.
+struct SwitchNode
+{
+    int position = -1; // Byte switched on, -1 at a leaf.
+    std::vector< std::pair< unsigned char, size_t > > children; // Byte value (lower case, if case-insensitive) and child node.
+    std::vector< std::string > words; // Keywords left at a leaf, compared in turn.
+    bool checked = false; // Every byte of the leaf keyword was switched on, no compare is needed.
+};
+
+struct SwitchTree
+{
+    std::map< int, std::string > word_map; // Keywords in given order.
+    std::vector< SwitchNode > nodes;
+    std::map< size_t, size_t > roots; // Root node by keyword size.
+};
+
+// Builds the tree, switching at each node on the byte position which
+// distinguishes the most of its keywords.
+SwitchTree GenerateSwitchTree( const std::vector< std::string > &words, bool ignore_case = false );
+
+// Tables of a perfect hash evaluated at run time, without owning them. The
+// hash function is the one of the generated code.
+struct PerfectHashView
+{
+    bool ignore_case = false;
+    size_t min_size = 1;
+    size_t max_size = 0;
+    const int32_t *key_positions = nullptr; // In increasing order, -1 is the last byte.
+    size_t key_position_count = 0;
+    const int32_t *alpha_inc = nullptr; // Indexed by key position.
+    size_t alpha_inc_count = 0;
+    const KeyWindow *key_windows = nullptr; // Used instead of key positions if not empty.
+    size_t key_window_count = 0;
+    const int32_t *asso_values = nullptr;
+    size_t asso_value_count = 0;
+    const int32_t *slots = nullptr; // Index of the key with each hash value, -1 if unused.
+    size_t slot_count = 0;
+    const uint32_t *key_offsets = nullptr; // Offset of each key in keys, and the end of last one.
+    const char *keys = nullptr;
+    size_t key_count = 0;
+    const uint32_t *payload_offsets = nullptr; // Same as key_offsets, null if there is no payload.
+    const char *payload = nullptr;
+
+    // Returns index of word, or -1 if it is not a keyword.
+    int find( std::string_view word ) const;
+
+    std::string_view key( size_t idx ) const
+    {
+        return std::string_view( keys + key_offsets[ idx ], key_offsets[ idx + 1 ] - key_offsets[ idx ] );
+    }
+
+    // Returns the payload of the key, empty if there is no payload.
+    std::string_view payload_of( size_t idx ) const
+    {
+        if ( !payload_offsets )
+            return {};
+        return std::string_view( payload + payload_offsets[ idx ], payload_offsets[ idx + 1 ] - payload_offsets[ idx ] );
+    }
+};
+
+// Perfect hash table built and evaluated at run time, for keywords which are
+// only known at startup. Keys are kept in flat arrays.
+class PerfectHashTable
+{
+public:
+    // Builds the table with a quick search (see SearchOptions::quick), indices
+    // are positions in words. Throws if a word is empty or given twice.
+    explicit PerfectHashTable( const std::vector< std::string > &words, SearchOptions options = {} );
+
+    // Evaluates a hash from GeneratePerfectHash, indices follow its word_map.
+    explicit PerfectHashTable( const PerfectHash &soln, bool ignore_case = false );
+
+    // Not copyable or movable, the view points into the arrays of the table.
+    PerfectHashTable( const PerfectHashTable & ) = delete;
+    PerfectHashTable& operator=( const PerfectHashTable & ) = delete;
+
+    // Returns index of word, or -1 if it is not a keyword.
+    int find( std::string_view word ) const { return m_view.find( word ); }
+
+    size_t size() const { return m_key_offsets.size() - 1; }
+
+    std::string_view key( size_t idx ) const { return m_view.key( idx ); }
+
+    const PerfectHashView& view() const { return m_view; }
+
+private:
+    void build( const PerfectHash &soln, const std::vector< std::string > &words, bool ignore_case );
+    void update_view();
+
+    bool m_ignore_case = false;
+    size_t m_min_size = 1;
+    size_t m_max_size = 0;
+    std::vector< int32_t > m_key_positions;
+    std::vector< int32_t > m_alpha_inc;
+    std::vector< KeyWindow > m_key_windows;
+    std::vector< int32_t > m_asso_values;
+    std::vector< int32_t > m_slots;
+    std::string m_keys;
+    std::vector< uint32_t > m_key_offsets = { 0 };
+    PerfectHashView m_view; // Built once the arrays are, so lookups do not build one
+};
+
+// Binary format of a perfect hash, to ship tables built offline as data. All
+// integers are little endian. A 72 byte header:
+//   char     magic[ 8 ]        "SWITCHPH"
+//   uint32   version           1
+//   uint32   flags             1: ignore case, 2: has payload
+//   uint32   min_size, max_size
+//   uint32   key_position_count, alpha_inc_count, key_window_count,
+//            asso_value_count, slot_count, key_count, keys_size, payload_size
+//   uint64   file_size
+//   uint64   checksum          FNV-1a of the header, with this field zero
+// is followed by these sections, each starting at a multiple of 8 bytes:
+//   int32    key_positions[ key_position_count ]
+//   int32    alpha_inc[ alpha_inc_count ]
+//   { int32 offset, int32 width, uint64 multiplier } key_windows[ key_window_count ]
+//   int32    asso_values[ asso_value_count ]
+//   int32    slots[ slot_count ]
+//   uint32   key_offsets[ key_count + 1 ]
+//   char     keys[ keys_size ]
+//   uint32   payload_offsets[ key_count + 1 ]    only with payload
+//   char     payload[ payload_size ]              only with payload
+
+// Writes view in the binary format, with payloads given in the order of
+// keys, or no payload if empty.
+void WritePerfectHash( std::ostream &out, const PerfectHashView &view, const std::vector< std::string > &payloads = {} );
+
+// Perfect hash mapped from a file in the binary format, lookups read the
+// mapping directly. Throws std::runtime_error if the file can not be mapped,
+// or if its header is not valid. Only the header and the section bounds are
+// validated, contents of the sections are trusted.
+class MappedPerfectHash
+{
+public:
+    explicit MappedPerfectHash( const std::string &path );
+    MappedPerfectHash( const MappedPerfectHash & ) = delete;
+    MappedPerfectHash& operator=( const MappedPerfectHash & ) = delete;
+    ~MappedPerfectHash();
+
+    int find( std::string_view word ) const { return m_view.find( word ); }
+
+    const PerfectHashView& view() const { return m_view; }
+
+private:
+    void *m_data = nullptr;
+    size_t m_size = 0;
+    PerfectHashView m_view;
+};
 
 #endif
@@ -0,0 +1,118 @@
+#include <algorithm>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "batch.switch.hpp"
+
+using batch::hash;
+using batch::hash_batch;
+using batch::hash_batch_avx2;
+using batch::hash_pipelined;
+using batch::internal_::hash_enum;
+
+int main( int argc, char *argv[] )
+{
+    if ( argc != 2 )
+    {
+        return 1;
+    }
+
+    // Keywords along with strings of the same length or around it which
+    // are not keywords
+    std::vector< std::string > keys;
+    {
+        std::ifstream in( argv[ 1 ] );
+        std::string line;
+        while ( std::getline( in, line ) )
+        {
+            keys.push_back( line );
+            keys.push_back( line.substr( 0, line.size() - 1 ) );
+            keys.push_back( line + line );
+            // Keys are verified by first and last bytes, then the ones between
+            std::string middle = line;
+            middle[ middle.size() / 2 ] ^= 1;
+            keys.push_back( middle );
+            line.back() ^= 1;
+            keys.push_back( line );
+        }
+        keys.push_back( "" );
+    }
+
+    // Strings of one repeated byte, of every length up to past the longest
+    // keyword. Bytes with large asso_values hash them past the table.
+    size_t max_size = 0;
+    for ( const std::string &key : keys )
+    {
+        max_size = std::max( max_size, key.size() );
+    }
+    for ( size_t size = 1; size <= max_size + 1; ++size )
+    {
+        for ( int c = 0; c < 256; ++c )
+        {
+            keys.push_back( std::string( size, char( c ) ) );
+        }
+    }
+
+    // Random bytes, of random lengths
+    std::mt19937 rng( 1 );
+    for ( int k = 0; k < 20000; ++k )
+    {
+        std::string key( rng() % ( max_size + 2 ), '\0' );
+        for ( char &c : key )
+        {
+            c = char( rng() );
+        }
+        keys.push_back( key );
+    }
+
+    std::vector< std::string_view > views( keys.begin(), keys.end() );
+
+    auto matches = [ & ]( size_t offset, size_t n ) {
+        std::vector< hash_enum > out( n );
+        hash_batch( views.data() + offset, n, out.data() );
+
+        std::vector< hash_enum > out_avx2( n );
+        hash_batch_avx2( views.data() + offset, n, out_avx2.data() );
+
+        std::vector< hash_enum > out_pipelined( n );
+        hash_pipelined( views.data() + offset, n, out_pipelined.data() );
+
+        for ( size_t i = 0; i < n; ++i )
+        {
+            hash_enum expected = hash( views[ offset + i ] );
+            if ( out[ i ] != expected || out_avx2[ i ] != expected || out_pipelined[ i ] != expected )
+            {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    // All keys, at every offset and with every tail length, so that each key
+    // goes through every lane and through the scalar tail
+    for ( size_t offset = 0; offset < 8; ++offset )
+    {
+        for ( size_t tail = 0; tail < 8; ++tail )
+        {
+            size_t n = ( views.size() - offset ) / 8 * 8 - 8 + tail;
+            if ( !matches( offset, n ) )
+            {
+                return 1;
+            }
+        }
+    }
+
+    // Different counts, so that partial groups of the pipeline are tested
+    // along with the full ones
+    for ( size_t n = 0; n <= 1000; n += 3 )
+    {
+        if ( !matches( 0, n ) )
+        {
+            return 1;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,41 @@
+#include <fstream>
+#include <string>
+
+#include "search.hpp"
+
+int main( int argc, char *argv[] )
+{
+    if ( argc != 3 )
+    {
+        return 1;
+    }
+
+    MappedPerfectHash table( argv[ 2 ] );
+
+    std::ifstream in( argv[ 1 ] );
+    std::string line;
+    size_t count = 0;
+    while ( std::getline( in, line ) )
+    {
+        size_t tab = line.find( '\t' );
+        std::string keyword = line.substr( 0, tab );
+        std::string payload = line.substr( tab + 1 );
+
+        int idx = table.find( keyword );
+        if ( idx == -1 || table.view().key( idx ) != keyword || table.view().payload_of( idx ) != payload )
+        {
+            return 1;
+        }
+
+        std::string changed = keyword;
+        changed.back() ^= 1;
+        if ( table.find( changed ) != -1 )
+        {
+            return 1;
+        }
+
+        ++count;
+    }
+
+    return count == table.view().key_count ? 0 : 1;
+}
@@ -0,0 +1,111 @@
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "classify_all.switch.hpp"
+
+using classify_all::hash;
+using classify_all::hash_classify_all;
+using classify_all::hash_token;
+
+namespace classify_all {
+
+static bool operator==( const hash_token &a, const hash_token &b )
+{
+    return a.value == b.value && a.offset == b.offset && a.size == b.size;
+}
+
+} // namespace classify_all
+
+// Straightforward split with find, for reference
+static std::vector< hash_token > split( std::string_view buf, std::string_view delims )
+{
+    std::vector< hash_token > tokens;
+    size_t start = 0;
+    while ( start <= buf.size() )
+    {
+        size_t end = std::min( buf.find_first_of( delims, start ), buf.size() );
+        size_t first = start;
+        size_t last = end;
+        while ( first < last && ( buf[ first ] == ' ' || buf[ first ] == '\t' ) )
+            ++first;
+        while ( first < last && ( buf[ last - 1 ] == ' ' || buf[ last - 1 ] == '\t' ) )
+            --last;
+        if ( first < last )
+            tokens.push_back( { hash( buf.substr( first, last - first ) ), first, last - first } );
+        start = end + 1;
+    }
+    return tokens;
+}
+
+int main( int argc, char *argv[] )
+{
+    if ( argc != 2 )
+    {
+        return 1;
+    }
+
+    std::vector< std::string > keywords;
+    {
+        std::ifstream in( argv[ 1 ] );
+        std::string line;
+        while ( std::getline( in, line ) )
+        {
+            keywords.push_back( line );
+        }
+    }
+
+    // Lists of keywords and a few other tokens, with optional whitespace
+    std::mt19937 rng( 42 );
+    std::string buf;
+    const char *separators[] = { ",", ", ", " ,\t", ",,", ";", "  " };
+    while ( buf.size() < ( 1 << 20 ) )
+    {
+        buf += rng() % 8 ? keywords[ rng() % keywords.size() ] : "token";
+        buf += separators[ rng() % 6 ];
+    }
+
+    for ( std::string_view delims : { ",", ",;", ", ;\t", ",; \t-", "" } )
+    {
+        std::vector< hash_token > tokens;
+        hash_classify_all( buf, delims, std::back_inserter( tokens ) );
+        if ( tokens != split( buf, delims ) )
+        {
+            return 1;
+        }
+
+        // Short buffers, ending around the 16 byte chunks
+        for ( size_t len = 0; len < 48; ++len )
+        {
+            std::string_view part = std::string_view( buf ).substr( 0, len );
+            tokens.clear();
+            hash_classify_all( part, delims, std::back_inserter( tokens ) );
+            if ( tokens != split( part, delims ) )
+            {
+                return 1;
+            }
+        }
+    }
+
+    auto time = [ & ]( auto &&f ) {
+        auto start = std::chrono::steady_clock::now();
+        for ( int i = 0; i < 20; ++i )
+        {
+            f();
+        }
+        std::chrono::duration< double > elapsed = std::chrono::steady_clock::now() - start;
+        return 20.0 * buf.size() / elapsed.count() / 1e9;
+    };
+
+    std::vector< hash_token > tokens;
+    tokens.reserve( buf.size() / 4 );
+    double simd = time( [ & ] { tokens.clear(); hash_classify_all( buf, ",;", std::back_inserter( tokens ) ); } );
+    double reference = time( [ & ] { tokens = split( buf, ",;" ); } );
+    std::cout << "classify_all: " << simd << " GB/s, find loop: " << reference << " GB/s\n";
+
+    return 0;
+}
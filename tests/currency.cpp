@@ -0,0 +1,44 @@
+#include <fstream>
+#include <string>
+
+#include "currency.switch.hpp"
+
+using currency::code;
+using currency::internal_::code_enum;
+
+// Keywords are of the same length, so the integer backend is used
+static_assert( currency::internal_::keylist.size() == 64 );
+
+int main( int argc, char *argv[] )
+{
+    if ( argc != 2 )
+    {
+        return 1;
+    }
+
+    std::ifstream in( argv[ 1 ] );
+    std::string line;
+    while ( std::getline( in, line ) )
+    {
+        if ( code( line ) == code_enum::default_ || currency::code_unchecked( line ) != code( line ) )
+        {
+            return 1;
+        }
+
+        for ( std::string miss : { line + "X", line.substr( 1 ), std::string( 3, '\0' ) } )
+        {
+            if ( code( miss ) != code_enum::default_ )
+            {
+                return 1;
+            }
+        }
+
+        line[ 0 ] += 'a' - 'A';
+        if ( code( line ) != code_enum::default_ )
+        {
+            return 1;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,61 @@
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "direct.switch.hpp"
+
+using units::unit;
+using units::internal_::unit_enum;
+
+// Keywords are of one or two bytes, so the direct backend is used
+static_assert( units::internal_::one_byte.size() == 256 );
+
+int main( int argc, char *argv[] )
+{
+    if ( argc != 2 )
+    {
+        return 1;
+    }
+
+    std::vector< std::string > keywords;
+    std::ifstream in( argv[ 1 ] );
+    std::string line;
+    while ( std::getline( in, line ) )
+    {
+        keywords.push_back( line );
+    }
+
+    // Every input of one or two bytes, enum values follow order of keywords
+    for ( int size = 1; size <= 2; ++size )
+    {
+        for ( int bytes = 0; bytes < ( 1 << ( 8 * size ) ); ++bytes )
+        {
+            std::string s( size, '\0' );
+            for ( int i = 0; i < size; ++i )
+            {
+                s[ i ] = char( bytes >> ( 8 * i ) );
+            }
+
+            int expected = -1;
+            for ( size_t k = 0; k < keywords.size(); ++k )
+            {
+                if ( keywords[ k ] == s )
+                {
+                    expected = k;
+                }
+            }
+
+            if ( static_cast< int >( unit( s ) ) != expected || ( expected != -1 && units::unit_unchecked( s ) != unit( s ) ) )
+            {
+                return 1;
+            }
+        }
+    }
+
+    if ( unit( "" ) != unit_enum::default_ || unit( "kgs" ) != unit_enum::default_ )
+    {
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,56 @@
+#include <string>
+#include <string_view>
+
+// Handlers in dispatch.strings.txt call into this
+struct Session
+{
+    bool hello( std::string_view args ) { last = "hello " + std::string( args ); return true; }
+    bool mail( std::string_view args ) { last = "mail " + std::string( args ); return true; }
+    bool rcpt( std::string_view args ) { last = "rcpt " + std::string( args ); return true; }
+    bool data() { last = "data"; return true; }
+    void reset() { last = "reset"; }
+    bool start_tls() { last = "starttls"; return true; }
+    bool auth( std::string_view args ) { last = "auth " + std::string( args ); return true; }
+    bool unknown() { last = "unknown"; return false; }
+
+    std::string last;
+    bool open = true;
+};
+
+#include "dispatch.switch.hpp"
+
+using smtp::command_dispatch;
+
+static bool expect( std::string_view command, std::string_view args, bool result, std::string_view last )
+{
+    Session session;
+    return command_dispatch( command, session, args ) == result && session.last == last;
+}
+
+int main()
+{
+    Session session;
+    if ( !command_dispatch( "QUIT", session, "" ) || session.open )
+    {
+        return 1;
+    }
+
+    bool ok =
+        expect( "HELO", "example.com", true, "hello example.com" ) &&
+        expect( "EHLO", "example.com", true, "hello example.com" ) &&
+        expect( "MAIL", "FROM:<a@b>", true, "mail FROM:<a@b>" ) &&
+        expect( "RCPT", "TO:<c@d>", true, "rcpt TO:<c@d>" ) &&
+        expect( "DATA", "", true, "data" ) &&
+        expect( "RSET", "", true, "reset" ) &&
+        expect( "NOOP", "", true, "" ) &&
+        expect( "STARTTLS", "", true, "starttls" ) &&
+        expect( "AUTH", "PLAIN", true, "auth PLAIN" ) &&
+        expect( "VRFY", "", false, "" ) &&
+        expect( "helo", "", false, "unknown" ) &&
+        expect( "HEL", "", false, "unknown" ) &&
+        expect( "STARTTLX", "", false, "unknown" ) &&
+        expect( "", "", false, "unknown" ) &&
+        expect( "STARTTLS ", "", false, "unknown" );
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,82 @@
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "find_all.switch.hpp"
+
+using find_all::hash;
+using find_all::hash_find_all;
+using find_all::internal_::hash_enum;
+
+int main( int argc, char *argv[] )
+{
+    if ( argc != 2 )
+    {
+        return 1;
+    }
+
+    std::vector< std::string > keywords;
+    size_t max_length = 0;
+    {
+        std::ifstream in( argv[ 1 ] );
+        std::string line;
+        while ( std::getline( in, line ) )
+        {
+            keywords.push_back( line );
+            max_length = std::max( max_length, line.size() );
+        }
+    }
+
+    // Random lower case text with keywords, and some of their prefixes, spliced in
+    std::mt19937 rng( 42 );
+    std::string text;
+    while ( text.size() < ( 1 << 20 ) )
+    {
+        for ( int i = rng() % 512; i > 0; --i )
+        {
+            text.push_back( 'a' + rng() % 26 );
+        }
+
+        const std::string &keyword = keywords[ rng() % keywords.size() ];
+        text += rng() % 2 ? keyword : keyword.substr( 0, keyword.size() - 1 );
+    }
+
+    std::vector< std::pair< size_t, hash_enum > > found;
+    hash_find_all( text, [ & ]( size_t offset, hash_enum value ) {
+        found.emplace_back( offset, value );
+    } );
+
+    // Same occurrences in the same order, by brute force
+    std::vector< std::pair< size_t, hash_enum > > expected;
+    for ( size_t i = 0; i < text.size(); ++i )
+    {
+        for ( size_t len = 1; len <= max_length && i + len <= text.size(); ++len )
+        {
+            hash_enum value = hash( std::string_view( text ).substr( i, len ) );
+            if ( value != hash_enum::default_ )
+            {
+                expected.emplace_back( i, value );
+            }
+        }
+    }
+
+    if ( found != expected || found.empty() )
+    {
+        return 1;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    size_t count = 0;
+    for ( int i = 0; i < 100; ++i )
+    {
+        hash_find_all( text, [ & ]( size_t, hash_enum ) { ++count; } );
+    }
+    std::chrono::duration< double > elapsed = std::chrono::steady_clock::now() - start;
+    std::cout << "find_all: " << 100.0 * text.size() / elapsed.count() / 1e9 << " GB/s, " << count / 100 << " matches\n";
+
+    return 0;
+}
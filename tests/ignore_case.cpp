@@ -0,0 +1,64 @@
+#include <cctype>
+#include <fstream>
+#include <string>
+
+#include "ignore_case.switch.hpp"
+
+using ignore_case::hash;
+using ignore_case::internal_::hash_enum;
+
+int main( int argc, char *argv[] )
+{
+    if ( argc != 2 )
+    {
+        return 1;
+    }
+
+    std::ifstream in( argv[ 1 ] );
+    std::string line;
+    while ( std::getline( in, line ) )
+    {
+        hash_enum expected = hash( line );
+        if ( expected == hash_enum::default_ )
+        {
+            return 1;
+        }
+
+        std::string upper = line;
+        std::string lower = line;
+        std::string mixed = line;
+        for ( size_t i = 0; i < line.size(); ++i )
+        {
+            upper[ i ] = std::toupper( line[ i ] );
+            lower[ i ] = std::tolower( line[ i ] );
+            mixed[ i ] = i % 2 ? upper[ i ] : lower[ i ];
+        }
+
+        if ( hash( upper ) != expected || hash( lower ) != expected || hash( mixed ) != expected )
+        {
+            return 1;
+        }
+
+        // Only letters are folded, '-' ^ 0x20 is '\r' and '@' is one below 'A'
+        for ( size_t i = 0; i < line.size(); ++i )
+        {
+            std::string changed = line;
+            changed[ i ] ^= 0x20;
+            if ( !std::isalpha( line[ i ] ) && hash( changed ) == expected )
+            {
+                return 1;
+            }
+
+            if ( std::isalpha( line[ i ] ) )
+            {
+                changed[ i ] = std::isupper( line[ i ] ) ? line[ i ] - 1 : line[ i ] + 1;
+                if ( hash( changed ) == expected )
+                {
+                    return 1;
+                }
+            }
+        }
+    }
+
+    return 0;
+}
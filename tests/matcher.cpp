@@ -0,0 +1,68 @@
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "matcher.switch.hpp"
+
+using matcher::hash;
+using matcher::hash_matcher;
+
+// Feeds text split at the given offsets
+static bool check( std::string_view text, std::vector< size_t > splits )
+{
+    hash_matcher m;
+    size_t start = 0;
+    for ( size_t split : splits )
+    {
+        m.feed( text.substr( start, split - start ) );
+        start = split;
+    }
+    m.feed( text.substr( start ) );
+
+    return m.finish() == hash( text );
+}
+
+constexpr auto match_constexpr( std::string_view a, std::string_view b )
+{
+    hash_matcher m;
+    m.feed( a );
+    m.feed( b );
+    return m.finish();
+}
+
+static_assert( match_constexpr( "Content-", "Length" ) == hash( "Content-Length" ) );
+static_assert( match_constexpr( "Content-", "Lengths" ) == matcher::internal_::hash_enum::default_ );
+
+int main( int argc, char *argv[] )
+{
+    if ( argc != 2 )
+    {
+        return 1;
+    }
+
+    std::ifstream in( argv[ 1 ] );
+    std::string line;
+    while ( std::getline( in, line ) )
+    {
+        std::string changed = line;
+        changed.back() ^= 1;
+
+        for ( const std::string &text : { line, line.substr( 0, line.size() - 1 ), line + "x", changed } )
+        {
+            if ( !check( text, {} ) )
+            {
+                return 1;
+            }
+
+            for ( size_t i = 0; i <= text.size(); ++i )
+            {
+                if ( !check( text, { i } ) || !check( text, { i, i } ) || !check( text, { i / 2, i } ) )
+                {
+                    return 1;
+                }
+            }
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,43 @@
+#include <fstream>
+#include <string>
+
+#include "minimal.switch.hpp"
+
+using namespace minimal::internal_;
+
+// Slot table is dense, one entry per keyword
+static_assert( wordlist.size() == 84 );
+
+int main( int argc, char *argv[] )
+{
+    if ( argc != 2 )
+    {
+        return 1;
+    }
+
+    std::ifstream in( argv[ 1 ] );
+    std::string line;
+    int expected = 0;
+    while ( std::getline( in, line ) )
+    {
+        hash_enum res = minimal::hash( line );
+        if ( res == hash_enum::default_ || wordlist[ static_cast< int >( res ) ].word != line )
+        {
+            return 1;
+        }
+
+        if ( minimal::hash_unchecked( line ) != res )
+        {
+            return 1;
+        }
+
+        line.push_back( '_' );
+        if ( minimal::hash( line ) != hash_enum::default_ )
+        {
+            return 1;
+        }
+        ++expected;
+    }
+
+    return expected == static_cast< int >( wordlist.size() ) ? 0 : 1;
+}
@@ -0,0 +1,49 @@
+#include <fstream>
+#include <string>
+
+#include "padded.switch.hpp"
+
+using padded::hash;
+using padded::hash_padded;
+using padded::hash_padding;
+using padded::internal_::hash_enum;
+
+// Looks up s with only the guaranteed padding readable past its end.
+static hash_enum lookup_padded( const std::string &s )
+{
+    std::string buf = s + std::string( hash_padding, '#' );
+    return hash_padded( std::string_view( buf.data(), s.size() ) );
+}
+
+int main( int argc, char *argv[] )
+{
+    if ( argc != 2 )
+    {
+        return 1;
+    }
+
+    std::ifstream in( argv[ 1 ] );
+    std::string line;
+    while ( std::getline( in, line ) )
+    {
+        if ( lookup_padded( line ) != hash( line ) || hash( line ) == hash_enum::default_ )
+        {
+            return 1;
+        }
+
+        std::string prefix = line.substr( 0, line.size() - 1 );
+        if ( prefix.size() && lookup_padded( prefix ) != hash( prefix ) )
+        {
+            return 1;
+        }
+
+        std::string changed = line;
+        changed.back() ^= 1;
+        if ( lookup_padded( changed ) != hash( changed ) )
+        {
+            return 1;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,53 @@
+#include <fstream>
+#include <set>
+#include <string>
+
+#include "routes.switch.hpp"
+
+using routes::route;
+using routes::route_unchecked;
+using routes::internal_::route_enum;
+
+static_assert( route( "/api/v1/users/{id}/posts/{post_id}/likes" ) != route_enum::default_ );
+static_assert( route( "/api/v1/users/{id}/posts/{post_id}/like" ) == route_enum::default_ );
+
+int main( int argc, char *argv[] )
+{
+    if ( argc != 2 )
+    {
+        return 1;
+    }
+
+    std::ifstream in( argv[ 1 ] );
+    std::string line;
+    std::set< route_enum > seen;
+    while ( std::getline( in, line ) )
+    {
+        route_enum expected = route( line );
+        if ( expected == route_enum::default_ || route_unchecked( line ) != expected || !seen.insert( expected ).second )
+        {
+            return 1;
+        }
+
+        // Keywords share prefixes, misses differ in the tail or in a single byte
+        for ( std::string miss : { line + "/", line + std::string( 1, '\0' ), line.substr( 0, line.size() - 1 ) } )
+        {
+            if ( route( miss ) == expected )
+            {
+                return 1;
+            }
+        }
+
+        for ( size_t i = 0; i < line.size(); ++i )
+        {
+            std::string changed = line;
+            changed[ i ] ^= 0x01;
+            if ( route( changed ) == expected )
+            {
+                return 1;
+            }
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,48 @@
+#include <fstream>
+#include <string>
+
+#include "scan.switch.hpp"
+
+using scan::hash;
+using scan::hash_scan;
+using scan::internal_::hash_enum;
+
+// Checks that scanning text stops at its first ':' and matches the part before it
+static bool check( const std::string &text )
+{
+    size_t colon = text.find( ':' );
+    size_t stop = colon == std::string::npos ? text.size() : colon;
+
+    auto res = hash_scan( text.data(), text.data() + text.size(), ':' );
+    return res.stop == text.data() + stop && res.value == hash( std::string_view( text ).substr( 0, stop ) );
+}
+
+int main( int argc, char *argv[] )
+{
+    if ( argc != 2 )
+    {
+        return 1;
+    }
+
+    std::ifstream in( argv[ 1 ] );
+    std::string line;
+    while ( std::getline( in, line ) )
+    {
+        if ( hash_scan( line.data(), line.data() + line.size(), ':' ).value == hash_enum::default_ )
+        {
+            return 1;
+        }
+
+        // Values of different lengths around the 16 byte chunks
+        for ( size_t len = 0; len < 40; ++len )
+        {
+            std::string value( len, 'x' );
+            if ( !check( line + ":" + value ) || !check( line + value ) || !check( value + ":" + line ) )
+            {
+                return 1;
+            }
+        }
+    }
+
+    return 0;
+}
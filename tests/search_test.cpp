@@ -13,12 +13,18 @@
 // You should have received a copy of the GNU General Public License
 // along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
+#include <cctype>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 
 #define CATCH_CONFIG_MAIN
 #include <catch2/catch.hpp>
 
+#include "concurrent.hpp"
 #include "search.hpp"
 
 TEST_CASE( "ada" )
@@ -664,3 +670,567 @@ TEST_CASE( "smtp" )
     CHECK( 8 == hash.word_map.begin()->first );
     CHECK( 161 == hash.word_map.rbegin()->first );
 }
+
+TEST_CASE( "wide-windows" )
+{
+    std::vector< std::string > words = {
+        "Accept", "Accept-Charset", "Accept-Encoding", "Accept-Language",
+        "Accept-Ranges", "Age", "Allow", "Authorization", "Cache-Control",
+        "Connection", "Content-Encoding", "Content-Language", "Content-Length",
+        "Content-Location", "Content-Range", "Content-Type", "Cookie", "Date",
+        "ETag", "Expect", "Expires", "From", "Host", "If-Match", "If-Modified-Since",
+        "If-None-Match", "If-Range", "If-Unmodified-Since", "Last-Modified",
+        "Location", "Range", "Referer", "Server", "Set-Cookie", "TE", "Tk",
+        "Trailer", "Transfer-Encoding", "Upgrade", "User-Agent", "Vary", "Via",
+    };
+
+    SearchOptions options;
+    options.family = HashFamily::WideWindows;
+    PerfectHash hash = GeneratePerfectHash( words, options );
+
+    REQUIRE( hash.key_windows.size() > 0 );
+    CHECK( hash.key_positions.empty() );
+    CHECK( hash.asso_values.size() == 256 * hash.key_windows.size() );
+    CHECK( hash.word_map.size() == words.size() );
+
+    for ( const auto &it : hash.word_map )
+    {
+        int hash_val = it.second.size();
+        for ( size_t j = 0; j < hash.key_windows.size(); ++j )
+        {
+            if ( WindowApplies( hash.key_windows[ j ], it.second.size() ) )
+            {
+                hash_val += hash.asso_values[ 256 * j + FoldWindow( hash.key_windows[ j ], it.second ) ];
+            }
+        }
+        CHECK( hash_val == it.first );
+    }
+}
+
+TEST_CASE( "integer" )
+{
+    std::vector< std::string > words = {
+        "ADD ", "SUB ", "MUL ", "DIV ", "LOAD", "STOR", "JMP ", "JZ  ",
+        "CALL", "RET ", "PUSH", "POP ", "NOP ", "HALT", "AND ", "OR  ",
+    };
+
+    std::optional< IntegerHash > hash = GenerateIntegerHash( words );
+    REQUIRE( hash );
+    CHECK( hash->word_map.size() == words.size() );
+
+    for ( const auto &it : hash->word_map )
+    {
+        CHECK( int( ( IntegerKey( it.second ) * hash->multiplier ) >> hash->shift ) == it.first );
+    }
+
+    CHECK( !GenerateIntegerHash( { "a", "bb" } ) );
+    CHECK( !GenerateIntegerHash( { "123456789" } ) );
+}
+
+TEST_CASE( "full-key" )
+{
+    // Long keywords which only differ past their first 16 bytes
+    std::vector< std::string > words;
+    for ( const char *resource : { "users", "groups", "projects", "issues", "releases" } )
+    {
+        for ( const char *suffix : { "", "/{id}", "/{id}/members", "/{id}/settings", "/{id}/settings/privacy" } )
+        {
+            words.push_back( std::string( "/api/v1/organizations/{id}/" ) + resource + suffix );
+        }
+    }
+
+    FullKeyHash hash = GenerateFullKeyHash( words );
+    REQUIRE( hash.word_map.size() == words.size() );
+    CHECK( hash.table_size < words.size() * 2 );
+
+    for ( int displacement : hash.displacements )
+    {
+        CHECK( displacement >= 0 );
+        CHECK( displacement < FullKeyMaxDisplacement );
+    }
+
+    for ( const auto &it : hash.word_map )
+    {
+        CHECK( (size_t)it.first < hash.table_size );
+        CHECK( FullKeySlot( hash, it.second ) == (size_t)it.first );
+    }
+
+    // Seeds are reproducible between runs
+    CHECK( GenerateFullKeyHash( words ).seed == hash.seed );
+
+    // Keywords are hashed in lower case
+    FullKeyHash folded = GenerateFullKeyHash( { "Content-Type", "content-length", "X-Forwarded-For" }, true );
+    CHECK( folded.word_map.at( FullKeySlot( folded, "content-type" ) ) == "Content-Type" );
+    CHECK( folded.word_map.at( FullKeySlot( folded, "x-forwarded-for" ) ) == "X-Forwarded-For" );
+
+    CHECK_THROWS( GenerateFullKeyHash( { "abc", "", "xyz" } ) );
+}
+
+TEST_CASE( "switch-tree" )
+{
+    std::vector< std::string > words = {
+        "Monday", "Tuesday", "Wednesday", "Thursday", "Friday", "Saturday", "Sunday",
+        "a", "b", "ab", "ba", "abc", "abd", "acd",
+    };
+
+    SwitchTree tree = GenerateSwitchTree( words );
+    CHECK( tree.word_map.size() == words.size() );
+
+    // Returns keywords left at the leaf s leads to
+    auto walk = [ & ]( std::string_view s ) -> std::vector< std::string >
+    {
+        auto root = tree.roots.find( s.size() );
+        if ( root == tree.roots.end() )
+            return {};
+
+        const SwitchNode *node = &tree.nodes[ root->second ];
+        while ( node->position != -1 )
+        {
+            auto child = std::find_if( node->children.begin(), node->children.end(), [ & ]( const auto &c ) {
+                return c.first == static_cast< unsigned char >( s[ node->position ] );
+            } );
+            if ( child == node->children.end() )
+                return {};
+            node = &tree.nodes[ child->second ];
+        }
+        return node->words;
+    };
+
+    for ( const std::string &word : words )
+    {
+        CHECK( walk( word ) == std::vector< std::string >{ word } );
+    }
+
+    // Single bytes are switched on, one byte keywords need no compare
+    CHECK( tree.nodes[ tree.roots[ 1 ] ].position == 0 );
+    CHECK( tree.nodes[ tree.nodes[ tree.roots[ 1 ] ].children[ 0 ].second ].checked );
+    CHECK( walk( "c" ).empty() );
+
+    // Only keyword of its size, s is left for the compare
+    CHECK( walk( "Mondays" ) == std::vector< std::string >{ "Tuesday" } );
+    CHECK( !tree.nodes[ tree.roots[ 7 ] ].checked );
+
+    SwitchTree folded = GenerateSwitchTree( { "GET", "Put", "post" }, true );
+    CHECK( folded.word_map.at( 1 ) == "Put" );
+    const SwitchNode &root = folded.nodes[ folded.roots[ 3 ] ];
+    REQUIRE( root.position != -1 );
+    for ( const auto &child : root.children )
+    {
+        CHECK( !( child.first >= 'A' && child.first <= 'Z' ) );
+    }
+}
+
+TEST_CASE( "partitioned" )
+{
+    // Four keywords of each size, sharing all but the last byte, and a lone
+    // long one which is too few for a group of its own
+    std::vector< std::string > words;
+    for ( size_t size = 1; size <= 12; ++size )
+    {
+        for ( char c : { 'a', 'b', 'c', 'd' } )
+        {
+            words.push_back( std::string( size - 1, 'x' ) + c );
+        }
+    }
+    words.push_back( std::string( 30, 'y' ) );
+
+    std::vector< SizeGroup > groups = GeneratePartitionedHash( words, {}, 8 );
+    REQUIRE( groups.size() == 6 );
+    CHECK( groups.front().min_size == 1 );
+    CHECK( groups.back().max_size == 30 );
+
+    size_t count = 0;
+    for ( size_t i = 0; i < groups.size(); ++i )
+    {
+        const SizeGroup &group = groups[ i ];
+        if ( i > 0 )
+        {
+            CHECK( group.min_size == groups[ i - 1 ].max_size + 1 );
+        }
+
+        const PerfectHash &hash = group.hash;
+        for ( const auto &it : hash.word_map )
+        {
+            const std::string &word = it.second;
+            CHECK( word.size() >= group.min_size );
+            CHECK( word.size() <= group.max_size );
+
+            int hash_val = word.size();
+            for ( int pos : hash.key_positions )
+            {
+                if ( pos == -1 )
+                {
+                    hash_val += hash.asso_values[ static_cast< unsigned char >( word.back() ) ];
+                }
+                else if ( pos < (int)word.size() )
+                {
+                    hash_val += hash.asso_values[ static_cast< unsigned char >( word[ pos ] ) + hash.alpha_inc[ pos ] ];
+                }
+            }
+            CHECK( hash_val == it.first );
+        }
+        count += hash.word_map.size();
+    }
+    CHECK( count == words.size() );
+}
+
+TEST_CASE( "switch-tree-long" )
+{
+    // Only byte 270 differs, past the positions the quick search looks at
+    std::vector< std::string > words = {
+        std::string( 270, 'a' ) + "x" + std::string( 29, 'z' ),
+        std::string( 270, 'a' ) + "y" + std::string( 29, 'z' ),
+        "short", "shore",
+    };
+
+    SwitchTree tree = GenerateSwitchTree( words );
+    CHECK( tree.word_map.size() == words.size() );
+
+    // Left for a compare in turn, instead of switching on a byte they share
+    const SwitchNode &root = tree.nodes[ tree.roots[ 300 ] ];
+    CHECK( root.position == -1 );
+    CHECK( root.words == std::vector< std::string >{ words[ 0 ], words[ 1 ] } );
+    CHECK( !root.checked );
+
+    CHECK( tree.nodes[ tree.roots[ 5 ] ].position == 4 );
+}
+
+TEST_CASE( "ignore-case" )
+{
+    std::vector< std::string > words = {
+        "Accept", "Accept-Charset", "Accept-Encoding", "Accept-Language",
+        "Accept-Ranges", "Age", "Allow", "Authorization", "Cache-Control",
+        "Connection", "Content-Encoding", "Content-Language", "Content-Length",
+        "Content-Location", "Content-Range", "Content-Type", "Cookie", "Date",
+        "ETag", "Expect", "Expires", "From", "Host", "If-Match", "If-Modified-Since",
+        "If-None-Match", "If-Range", "If-Unmodified-Since", "Last-Modified",
+        "Location", "Range", "Referer", "Server", "Set-Cookie", "TE", "Tk",
+        "Trailer", "Transfer-Encoding", "Upgrade", "User-Agent", "Vary", "Via",
+    };
+
+    SearchOptions options;
+    options.ignore_case = true;
+    PerfectHash hash = GeneratePerfectHash( words, options );
+
+    CHECK( hash.word_map.size() == words.size() );
+
+    auto hash_of = [ & ]( const std::string &word ) {
+        int hash_val = word.size();
+        for ( int pos : hash.key_positions )
+        {
+            if ( pos == -1 )
+            {
+                hash_val += hash.asso_values[ static_cast< unsigned char >( word.back() ) ];
+            }
+            else if ( pos < (int)word.size() )
+            {
+                hash_val += hash.asso_values[ static_cast< unsigned char >( word[ pos ] ) + hash.alpha_inc[ pos ] ];
+            }
+        }
+        return hash_val;
+    };
+
+    for ( const auto &it : hash.word_map )
+    {
+        std::string upper = it.second;
+        std::string lower = it.second;
+        for ( size_t i = 0; i < upper.size(); ++i )
+        {
+            upper[ i ] = std::toupper( upper[ i ] );
+            lower[ i ] = std::tolower( lower[ i ] );
+        }
+
+        CHECK( hash_of( it.second ) == it.first );
+        CHECK( hash_of( upper ) == it.first );
+        CHECK( hash_of( lower ) == it.first );
+    }
+}
+
+TEST_CASE( "runtime-table" )
+{
+    // Routes of a few thousand keys, sharing long prefixes.
+    std::vector< std::string > words;
+    for ( int i = 0; i < 3000; ++i )
+    {
+        words.push_back( "/api/v" + std::to_string( i % 3 ) + "/users/" + std::to_string( i * 7919 % 10007 ) );
+    }
+
+    PerfectHashTable table( words );
+
+    REQUIRE( table.size() == words.size() );
+    for ( size_t i = 0; i < words.size(); ++i )
+    {
+        CHECK( table.find( words[ i ] ) == (int)i );
+        CHECK( table.key( i ) == words[ i ] );
+    }
+    CHECK( table.find( "" ) == -1 );
+    CHECK( table.find( "/api/v3/users/0" ) == -1 );
+    CHECK( table.find( "/api/v0/users/" ) == -1 );
+    CHECK( table.find( std::string( 100, 'x' ) ) == -1 );
+
+    CHECK( PerfectHashTable( std::vector< std::string >() ).find( "a" ) == -1 );
+    CHECK_THROWS( PerfectHashTable( { "a", "b", "a" } ) );
+    CHECK_THROWS( PerfectHashTable( { "a", "" } ) );
+}
+
+TEST_CASE( "runtime-table-generated" )
+{
+    std::vector< std::string > words = {
+        "Accept", "Accept-Charset", "Accept-Encoding", "Accept-Language",
+        "Accept-Ranges", "Age", "Allow", "Authorization", "Cache-Control",
+        "Connection", "Content-Encoding", "Content-Language", "Content-Length",
+        "Content-Location", "Content-Range", "Content-Type", "Cookie", "Date",
+        "ETag", "Expect", "Expires", "From", "Host", "If-Match", "If-Modified-Since",
+        "If-None-Match", "If-Range", "If-Unmodified-Since", "Last-Modified",
+        "Location", "Range", "Referer", "Server", "Set-Cookie", "TE", "Tk",
+        "Trailer", "Transfer-Encoding", "Upgrade", "User-Agent", "Vary", "Via",
+    };
+
+    for ( HashFamily family : { HashFamily::BytePositions, HashFamily::WideWindows } )
+    {
+        SearchOptions options;
+        options.family = family;
+        PerfectHashTable table( GeneratePerfectHash( words, options ) );
+
+        REQUIRE( table.size() == words.size() );
+        for ( const std::string &word : words )
+        {
+            int idx = table.find( word );
+            REQUIRE( idx != -1 );
+            CHECK( table.key( idx ) == word );
+        }
+        CHECK( table.find( "Accept-Encodinh" ) == -1 );
+        CHECK( table.find( "accept" ) == -1 );
+    }
+
+    SearchOptions options;
+    options.ignore_case = true;
+    PerfectHashTable table( words, options );
+    for ( size_t i = 0; i < words.size(); ++i )
+    {
+        std::string upper = words[ i ];
+        for ( char &c : upper )
+        {
+            c = std::toupper( c );
+        }
+
+        CHECK( table.find( words[ i ] ) == (int)i );
+        CHECK( table.find( upper ) == (int)i );
+        CHECK( table.find( ToLowerAscii( words[ i ] ) ) == (int)i );
+    }
+    CHECK( table.find( "Accept-Encodinh" ) == -1 );
+}
+
+TEST_CASE( "binary-format" )
+{
+    std::vector< std::string > words = {
+        "Accept", "Accept-Charset", "Accept-Encoding", "Accept-Language",
+        "Accept-Ranges", "Age", "Allow", "Authorization", "Cache-Control",
+        "Connection", "Content-Encoding", "Content-Language", "Content-Length",
+        "Content-Location", "Content-Range", "Content-Type", "Cookie", "Date",
+    };
+    std::vector< std::string > payloads;
+    for ( const std::string &word : words )
+    {
+        payloads.push_back( std::to_string( word.size() ) );
+    }
+
+    std::string path = "out/test-binary-format-" + std::to_string( std::rand() ) + ".bin";
+    auto write = [ & ]( const std::string &bytes ) {
+        std::ofstream( path, std::ios::binary ) << bytes;
+    };
+
+    SearchOptions options;
+    options.ignore_case = true;
+    PerfectHashTable table( words, options );
+    std::ostringstream out;
+    WritePerfectHash( out, table.view(), payloads );
+    std::string bytes = out.str();
+    REQUIRE( bytes.size() % 8 == 0 );
+
+    write( bytes );
+    {
+        MappedPerfectHash mapped( path );
+        CHECK( mapped.view().key_count == words.size() );
+        for ( size_t i = 0; i < words.size(); ++i )
+        {
+            CHECK( mapped.find( words[ i ] ) == (int)i );
+            CHECK( mapped.find( ToLowerAscii( words[ i ] ) ) == (int)i );
+            CHECK( mapped.view().payload_of( i ) == payloads[ i ] );
+        }
+        CHECK( mapped.find( "Content-Lengtg" ) == -1 );
+    }
+
+    // Windows, and no payload
+    options = {};
+    options.family = HashFamily::WideWindows;
+    PerfectHashTable windows( GeneratePerfectHash( words, options ) );
+    out.str( "" );
+    WritePerfectHash( out, windows.view() );
+    write( out.str() );
+    {
+        MappedPerfectHash mapped( path );
+        for ( const std::string &word : words )
+        {
+            int idx = mapped.find( word );
+            REQUIRE( idx != -1 );
+            CHECK( mapped.view().key( idx ) == word );
+            CHECK( mapped.view().payload_of( idx ).empty() );
+        }
+        CHECK( mapped.find( "accept" ) == -1 );
+    }
+
+    // Any change to the header is caught by its checksum
+    for ( size_t i : { 0, 8, 20, 44, 56, 64 } )
+    {
+        std::string corrupt = bytes;
+        corrupt[ i ] ^= 1;
+        write( corrupt );
+        CHECK_THROWS( MappedPerfectHash( path ) );
+    }
+
+    write( bytes.substr( 0, bytes.size() - 8 ) );
+    CHECK_THROWS( MappedPerfectHash( path ) );
+
+    write( "" );
+    CHECK_THROWS( MappedPerfectHash( path ) );
+
+    std::remove( path.c_str() );
+    CHECK_THROWS( MappedPerfectHash( path ) );
+}
+
+TEST_CASE( "reload" )
+{
+    // Generations of keywords, "gen<g>-<i>" is the i-th keyword of generation g
+    auto generation = []( int g ) {
+        std::vector< std::string > words;
+        for ( int i = 0; i < 200 + g % 7; ++i )
+        {
+            words.push_back( "gen" + std::to_string( g ) + "-" + std::to_string( i ) );
+        }
+        return words;
+    };
+
+    ReloadablePerfectHash holder( generation( 0 ) );
+    CHECK( holder.find( "gen0-5" ) == 5 );
+    CHECK( holder.find( "gen1-5" ) == -1 );
+
+    // Readers only ever see a whole generation
+    std::atomic< bool > stop{ false };
+    std::atomic< int > errors{ 0 };
+    std::vector< std::thread > readers;
+    for ( int t = 0; t < 4; ++t )
+    {
+        readers.emplace_back( [ & ]() {
+            while ( !stop.load() )
+            {
+                auto table = holder.read();
+                std::string first( table->key( 0 ) );
+                std::string prefix = first.substr( 0, first.find( '-' ) + 1 );
+                for ( size_t i = 0; i < table->size(); i += 17 )
+                {
+                    if ( table->find( prefix + std::to_string( i ) ) != (int)i )
+                    {
+                        errors++;
+                    }
+                }
+            }
+        } );
+    }
+
+    for ( int g = 1; g <= 20; ++g )
+    {
+        holder.reload( generation( g ) ).get();
+        CHECK( holder.find( "gen" + std::to_string( g ) + "-3" ) == 3 );
+        CHECK( holder.find( "gen" + std::to_string( g - 1 ) + "-3" ) == -1 );
+    }
+
+    stop = true;
+    for ( std::thread &reader : readers )
+    {
+        reader.join();
+    }
+    CHECK( errors == 0 );
+
+    // A failed reload keeps the current table
+    std::future< void > failed = holder.reload( { "a", "a" } );
+    CHECK_THROWS( failed.get() );
+    CHECK( holder.find( "gen20-3" ) == 3 );
+}
+
+TEST_CASE( "interner" )
+{
+    std::vector< std::string > headers = {
+        "Accept", "Accept-Encoding", "Content-Length", "Content-Type", "Cookie", "Host",
+    };
+    PerfectHashTable table( headers );
+    Interner interner( table.size(), [ & ]( std::string_view s ) { return table.find( s ); }, 1000 );
+
+    for ( size_t i = 0; i < headers.size(); ++i )
+    {
+        CHECK( interner.intern( headers[ i ] ) == (int)i );
+        CHECK( interner.is_static( i ) );
+    }
+    CHECK( interner.overflow().size() == 0 );
+
+    CHECK( interner.find( "X-Request-Id" ) == -1 );
+    int custom = interner.intern( "X-Request-Id" );
+    CHECK( custom == (int)headers.size() );
+    CHECK( !interner.is_static( custom ) );
+    CHECK( interner.overflow_name( custom ) == "X-Request-Id" );
+    CHECK( interner.intern( "X-Request-Id" ) == custom );
+    CHECK( interner.find( "X-Request-Id" ) == custom );
+    CHECK( interner.intern( "" ) == custom + 1 );
+
+    // Threads interning the same names agree on their ids
+    constexpr int names = 900;
+    std::vector< std::vector< int > > ids( 4, std::vector< int >( names ) );
+    std::vector< std::thread > threads;
+    for ( int t = 0; t < 4; ++t )
+    {
+        threads.emplace_back( [ &, t ]() {
+            for ( int k = 0; k < names; ++k )
+            {
+                int n = ( k + t * names / 4 ) % names;
+                ids[ t ][ n ] = interner.intern( "X-Custom-" + std::to_string( n ) + std::string( n % 50, 'x' ) );
+            }
+        } );
+    }
+    for ( std::thread &thread : threads )
+    {
+        thread.join();
+    }
+
+    std::set< int > distinct;
+    for ( int n = 0; n < names; ++n )
+    {
+        CHECK( ids[ 0 ][ n ] >= (int)headers.size() );
+        CHECK( ids[ 1 ][ n ] == ids[ 0 ][ n ] );
+        CHECK( ids[ 2 ][ n ] == ids[ 0 ][ n ] );
+        CHECK( ids[ 3 ][ n ] == ids[ 0 ][ n ] );
+        CHECK( interner.overflow_name( ids[ 0 ][ n ] ) == "X-Custom-" + std::to_string( n ) + std::string( n % 50, 'x' ) );
+        distinct.insert( ids[ 0 ][ n ] );
+    }
+    CHECK( distinct.size() == names );
+    CHECK( interner.overflow().size() == names + 2 );
+
+    // Ids are dense, and the overflow tier stops at its capacity
+    for ( int n = 0; interner.overflow().size() < 1000; ++n )
+    {
+        int next = headers.size() + interner.overflow().size();
+        CHECK( interner.intern( "X-Fill-" + std::to_string( n ) ) == next );
+    }
+    CHECK( interner.intern( "X-One-Too-Many" ) == -1 );
+    CHECK( interner.intern( "X-Request-Id" ) == custom );
+    CHECK( interner.intern( "Host" ) == 5 );
+
+    // Strings stop fitting once their sizes reach the byte budget
+    OverflowTable budget( 100, 16 );
+    CHECK( budget.intern( "0123456789" ) == 0 );
+    CHECK( budget.intern( "abcdefg" ) == -1 );
+    CHECK( budget.intern( "abcdef" ) == 1 );
+    CHECK( budget.intern( "x" ) == -1 );
+    CHECK( budget.intern( "" ) == 2 );
+    CHECK( budget.intern( "0123456789" ) == 0 );
+    CHECK( budget.find( "abcdefg" ) == -1 );
+}
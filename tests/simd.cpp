@@ -0,0 +1,47 @@
+#include <fstream>
+#include <string>
+
+#include "simd.switch.hpp"
+
+using simd::lookup;
+using simd::internal_::lookup_enum;
+
+int main( int argc, char *argv[] )
+{
+    if ( argc != 2 )
+    {
+        return 1;
+    }
+
+    std::ifstream in( argv[ 1 ] );
+    std::string line;
+    while ( std::getline( in, line ) )
+    {
+        lookup_enum expected = lookup( line );
+        if ( expected == lookup_enum::default_ || simd::internal_::lookup_scalar( line ) != expected )
+        {
+            return 1;
+        }
+
+        // Keys are zero padded, sizes tell them apart from input with zero bytes
+        for ( std::string miss : { line + std::string( 1, '\0' ), line.substr( 0, line.size() - 1 ), line + "XXXXXXXXXXXXXXXX" } )
+        {
+            if ( lookup( miss ) != simd::internal_::lookup_scalar( miss ) || lookup( miss ) == expected )
+            {
+                return 1;
+            }
+        }
+
+        for ( size_t i = 0; i < line.size(); ++i )
+        {
+            std::string changed = line;
+            changed[ i ] ^= 0x40;
+            if ( lookup( changed ) != simd::internal_::lookup_scalar( changed ) || lookup( changed ) == expected )
+            {
+                return 1;
+            }
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,62 @@
+#include <fstream>
+#include <set>
+#include <string>
+#include <string_view>
+
+#include "status_codes.switch.hpp"
+
+using status_codes::code;
+using status_codes::code_value;
+using status_codes::internal_::code_enum;
+
+// Keywords are of the same length, so the integer backend is used
+static_assert( status_codes::internal_::keylist.size() == 64 );
+static_assert( std::string_view( *code_value( "404" ) ) == "Not Found" );
+
+// Input of zero bytes is loaded as zero, which hashes to the first slot. It
+// must be empty to test that the key of empty slots matches nothing.
+static_assert( status_codes::internal_::keylist[ 0 ].enum_val == code_enum::default_ );
+
+int main( int argc, char *argv[] )
+{
+    if ( argc != 2 )
+    {
+        return 1;
+    }
+
+    std::ifstream in( argv[ 1 ] );
+    std::string line;
+    std::set< std::string > keywords;
+    while ( std::getline( in, line ) )
+    {
+        std::string keyword = line.substr( 0, line.find( '\t' ) );
+        keywords.insert( keyword );
+
+        if ( code_value( keyword ) == nullptr )
+        {
+            return 1;
+        }
+    }
+
+    if ( code_value( std::string( 3, '\0' ) ) != nullptr || code( std::string( 3, '\0' ) ) != code_enum::default_ )
+    {
+        return 1;
+    }
+
+    // Every input of the keyword length reaches some slot, empty ones included
+    std::string s( 3, '\0' );
+    for ( int i = 0; i < ( 1 << 24 ); ++i )
+    {
+        s[ 0 ] = i & 0xFF;
+        s[ 1 ] = ( i >> 8 ) & 0xFF;
+        s[ 2 ] = i >> 16;
+
+        bool keyword = keywords.count( s ) != 0;
+        if ( ( code_value( s ) != nullptr ) != keyword || ( code( s ) != code_enum::default_ ) != keyword )
+        {
+            return 1;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,43 @@
+#include <fstream>
+#include <string>
+
+#include "values.switch.hpp"
+
+using status::reason;
+using status::reason_value;
+
+static_assert( *reason_value( "Not Found" ) == 404 );
+static_assert( reason_value( "Not found" ) == nullptr );
+
+int main( int argc, char *argv[] )
+{
+    if ( argc != 2 )
+    {
+        return 1;
+    }
+
+    std::ifstream in( argv[ 1 ] );
+    std::string line;
+    while ( std::getline( in, line ) )
+    {
+        size_t tab = line.find( '\t' );
+        std::string keyword = line.substr( 0, tab );
+        int value = std::stoi( line.substr( tab + 1 ) );
+
+        const int *found = reason_value( keyword );
+        if ( !found || *found != value )
+        {
+            return 1;
+        }
+
+        // Value lookup must agree with the enum lookup on misses
+        std::string changed = keyword;
+        changed.back() ^= 1;
+        if ( ( reason_value( changed ) == nullptr ) != ( reason( changed ) == status::internal_::reason_enum::default_ ) )
+        {
+            return 1;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,220 @@
+// Counts keywords in a newline delimited file, using a generated header
+// (C) Copyright 2018 Mustafa Serdar Sanli <mserdarsanli@gmail.com>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// Usage: classify <keywords file> <input file> [threads]
+//
+// Keywords file is the one the header was generated from, used to name the
+// enum values (keywords it leaves out are counted, with a placeholder name).
+// Input is mapped in memory and split into chunks of whole
+// lines, which threads take in turn from a shared counter. Each thread
+// counts into a table it allocates, tables are summed once all threads are
+// done.
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "classify.switch.hpp"
+
+using classify::keyword;
+using classify::internal_::keyword_enum;
+
+constexpr size_t ChunkSize = 1 << 20;
+
+// Counters of a thread. Each thread allocates the ones it counts into, rather
+// than the main thread allocating them next to each other, and hands them over
+// once done. glibc and most allocators serve threads from separate arenas, so
+// cache lines written while counting are not shared.
+struct Counters
+{
+    std::vector< uint64_t > counts; // Indexed by enum value + 1, unknown lines first
+    uint64_t lines = 0;
+};
+
+// Returns the offset of the first line starting at or after pos
+static size_t LineStart( std::string_view data, size_t pos )
+{
+    if ( pos == 0 || pos >= data.size() )
+    {
+        return std::min( pos, data.size() );
+    }
+
+    const void *newline = std::memchr( data.data() + pos - 1, '\n', data.size() - pos + 1 );
+    return newline ? static_cast< const char* >( newline ) - data.data() + 1 : data.size();
+}
+
+static void CountLines( std::string_view data, Counters &counters )
+{
+    while ( data.size() )
+    {
+        size_t end = data.find( '\n' );
+        std::string_view line = data.substr( 0, end );
+        if ( line.size() && line.back() == '\r' )
+        {
+            line.remove_suffix( 1 );
+        }
+
+        ++counters.counts[ static_cast< int >( keyword( line ) ) + 1 ];
+        ++counters.lines;
+
+        data.remove_prefix( end == std::string_view::npos ? data.size() : end + 1 );
+    }
+}
+
+int main( int argc, char *argv[] )
+{
+    if ( argc != 3 && argc != 4 )
+    {
+        std::cerr << "Usage: " << argv[ 0 ] << " <keywords file> <input file> [threads]\n";
+        return 1;
+    }
+
+    // Sized by the keywords of the header, which the keywords file may not
+    // all give names to
+    std::vector< std::string > names( classify::keyword_count + 1 );
+    names[ 0 ] = "(unknown)";
+    for ( size_t i = 1; i < names.size(); ++i )
+    {
+        names[ i ] = "(keyword " + std::to_string( i - 1 ) + ")";
+    }
+    {
+        std::ifstream in( argv[ 1 ] );
+        if ( !in )
+        {
+            std::cerr << "Can not open " << argv[ 1 ] << "\n";
+            return 1;
+        }
+
+        std::string line;
+        while ( std::getline( in, line ) )
+        {
+            keyword_enum value = keyword( line );
+            if ( value == keyword_enum::default_ )
+            {
+                std::cerr << "Not a keyword of the generated header: " << line << "\n";
+                return 1;
+            }
+
+            names[ static_cast< int >( value ) + 1 ] = line;
+        }
+    }
+
+    size_t thread_count = argc == 4 ? std::stoul( argv[ 3 ] ) : std::thread::hardware_concurrency();
+    thread_count = std::max< size_t >( thread_count, 1 );
+
+    int fd = open( argv[ 2 ], O_RDONLY );
+    struct stat st;
+    if ( fd < 0 || fstat( fd, &st ) != 0 )
+    {
+        std::cerr << "Can not open " << argv[ 2 ] << "\n";
+        return 1;
+    }
+
+    std::string_view data;
+    void *mapped = nullptr;
+    if ( st.st_size > 0 )
+    {
+        mapped = mmap( nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0 );
+        if ( mapped == MAP_FAILED )
+        {
+            std::cerr << "Can not map " << argv[ 2 ] << "\n";
+            return 1;
+        }
+        madvise( mapped, st.st_size, MADV_SEQUENTIAL );
+        data = std::string_view( static_cast< const char* >( mapped ), st.st_size );
+    }
+
+    auto start = std::chrono::steady_clock::now();
+
+    const size_t chunk_count = ( data.size() + ChunkSize - 1 ) / ChunkSize;
+    std::atomic< size_t > next_chunk{ 0 };
+    std::vector< Counters > counters( thread_count );
+    std::vector< std::thread > threads;
+    for ( Counters &thread_counters : counters )
+    {
+        threads.emplace_back( [ & ] {
+            Counters local;
+            local.counts.resize( names.size() );
+            for ( size_t chunk; ( chunk = next_chunk.fetch_add( 1, std::memory_order_relaxed ) ) < chunk_count; )
+            {
+                size_t begin = LineStart( data, chunk * ChunkSize );
+                size_t end = LineStart( data, ( chunk + 1 ) * ChunkSize );
+                CountLines( data.substr( begin, end - begin ), local );
+            }
+            thread_counters = std::move( local );
+        } );
+    }
+
+    for ( std::thread &thread : threads )
+    {
+        thread.join();
+    }
+
+    std::chrono::duration< double > elapsed = std::chrono::steady_clock::now() - start;
+
+    Counters total;
+    total.counts.resize( names.size() );
+    for ( const Counters &thread_counters : counters )
+    {
+        for ( size_t i = 0; i < names.size(); ++i )
+        {
+            total.counts[ i ] += thread_counters.counts[ i ];
+        }
+        total.lines += thread_counters.lines;
+    }
+
+    std::vector< size_t > order;
+    for ( size_t i = 0; i < names.size(); ++i )
+    {
+        if ( total.counts[ i ] )
+        {
+            order.push_back( i );
+        }
+    }
+    std::sort( order.begin(), order.end(), [ & ]( size_t a, size_t b ) {
+        return total.counts[ a ] != total.counts[ b ] ? total.counts[ a ] > total.counts[ b ] : a < b;
+    } );
+
+    for ( size_t i : order )
+    {
+        std::cout << total.counts[ i ] << "\t" << names[ i ] << "\n";
+    }
+
+    std::cerr
+        << total.lines << " lines, " << data.size() << " bytes in " << elapsed.count() << " s with "
+        << thread_count << " threads, " << data.size() / elapsed.count() / 1e9 << " GB/s\n";
+
+    if ( mapped )
+    {
+        munmap( mapped, st.st_size );
+    }
+    close( fd );
+
+    return 0;
+}